@@ -0,0 +1,168 @@
+// benchmarks/filter/bench_predicate.cpp
+//
+// Google Benchmark comparison of the predicate tree evaluator against
+// compiled predicates.
+//
+// Cases:
+//  - Conjunction: the typical store query, id-set membership AND state
+//  - Mixed:       OR / NOT forcing the flattened program
+//  - Opaque:      plain std::function leaves without typed leaves
+//
+// Run with: bench_filter --benchmark_counters_tabular=true
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "filter/compiled_predicate.hpp"
+#include "filter/leaves.hpp"
+#include "filter/predicate.hpp"
+
+namespace
+{
+    struct Item
+    {
+        std::int64_t id;
+        std::int64_t accountId;
+        std::string  ticker;
+        bool         open;
+    };
+
+    constexpr std::int64_t ITEM_COUNT    = 10'000;
+    constexpr std::int64_t ACCOUNT_COUNT = 200;
+
+    std::vector<Item> makeItems()
+    {
+        std::vector<Item> items;
+        items.reserve(ITEM_COUNT);
+
+        for (std::int64_t i = 0; i < ITEM_COUNT; ++i)
+        {
+            items.push_back(
+                Item{
+                    .id        = i,
+                    .accountId = i % ACCOUNT_COUNT,
+                    .ticker    = "T" + std::to_string(i % 50),
+                    .open      = i % 3 != 0
+                }
+            );
+        }
+        return items;
+    }
+
+    std::vector<std::int64_t> makeAccountIds()
+    {
+        std::vector<std::int64_t> ids;
+        for (std::int64_t i = 0; i < ACCOUNT_COUNT; i += 4)
+            ids.push_back(i);
+        return ids;
+    }
+
+    filter::Predicate<Item> typedConjunction()
+    {
+        return filter::makeIdSetPredicate<Item>(
+                   [](const Item& item, const filter::IdList& ids)
+                   { return ids.contains(item.accountId); },
+                   filter::IdList{makeAccountIds()}
+               ) &&
+               filter::makeFlagPredicate<Item>([](const Item& item)
+                                               { return item.open; });
+    }
+
+    filter::Predicate<Item> typedMixed()
+    {
+        return typedConjunction() ||
+               !filter::makeStringEqualPredicate<Item>(
+                   [](const Item& item) { return item.ticker; },
+                   "T7"
+               );
+    }
+
+    filter::Predicate<Item> opaqueConjunction()
+    {
+        const auto ids = makeAccountIds();
+
+        return filter::makePredicate<Item>(
+                   [ids](const Item& item)
+                   {
+                       for (const auto id : ids)
+                           if (id == item.accountId)
+                               return true;
+                       return false;
+                   }
+               ) &&
+               filter::makePredicate<Item>([](const Item& item)
+                                           { return item.open; });
+    }
+
+    void runTree(benchmark::State& state, const filter::Predicate<Item>& pred)
+    {
+        const auto items = makeItems();
+
+        for (auto _ : state)
+        {
+            std::int64_t matches = 0;
+            for (const auto& item : items)
+                matches += filter::evaluatePredicate(pred, item) ? 1 : 0;
+            benchmark::DoNotOptimize(matches);
+        }
+        state.SetItemsProcessed(state.iterations() * ITEM_COUNT);
+    }
+
+    void runCompiled(
+        benchmark::State&              state,
+        const filter::Predicate<Item>& pred
+    )
+    {
+        const auto items    = makeItems();
+        const auto compiled = filter::CompiledPredicate<Item>::compile(pred);
+
+        for (auto _ : state)
+        {
+            std::int64_t matches = 0;
+            for (const auto& item : items)
+                matches += compiled(item) ? 1 : 0;
+            benchmark::DoNotOptimize(matches);
+        }
+        state.SetItemsProcessed(state.iterations() * ITEM_COUNT);
+    }
+
+    void BM_TreeConjunction(benchmark::State& state)
+    {
+        runTree(state, typedConjunction());
+    }
+
+    void BM_CompiledConjunction(benchmark::State& state)
+    {
+        runCompiled(state, typedConjunction());
+    }
+
+    void BM_TreeMixed(benchmark::State& state)
+    {
+        runTree(state, typedMixed());
+    }
+
+    void BM_CompiledMixed(benchmark::State& state)
+    {
+        runCompiled(state, typedMixed());
+    }
+
+    void BM_TreeOpaque(benchmark::State& state)
+    {
+        runTree(state, opaqueConjunction());
+    }
+
+    void BM_CompiledOpaque(benchmark::State& state)
+    {
+        runCompiled(state, opaqueConjunction());
+    }
+}   // namespace
+
+BENCHMARK(BM_TreeConjunction);
+BENCHMARK(BM_CompiledConjunction);
+BENCHMARK(BM_TreeMixed);
+BENCHMARK(BM_CompiledMixed);
+BENCHMARK(BM_TreeOpaque);
+BENCHMARK(BM_CompiledOpaque);
@@ -0,0 +1,140 @@
+// benchmarks/finance/bench_pnl.cpp
+//
+// Google Benchmark measuring the throughput of the PnL fold and of the
+// Cash / Quantity arithmetic it is built from.
+//
+// Cases:
+//  - StockFold:  buy/sell stock trades, partial closes and flips
+//  - OptionFold: option legs opened and closed against each other
+//  - CashMulAdd: the bare `cash * quantity` accumulation of the fold
+//
+// Run with: bench_pnl --benchmark_counters_tabular=true
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <vector>
+
+#include "common/cash.hpp"
+#include "common/quantity.hpp"
+#include "finance/transaction/pnl.hpp"
+
+namespace
+{
+    constexpr std::int64_t EVENT_COUNT   = 10'000;
+    constexpr micro_units  PRICE_BASE    = 100'000'000;
+    constexpr micro_units  PRICE_STEP    = 250'000;
+    constexpr std::int64_t CONTRACT_SIZE = 100;
+
+    Cash usd(micro_units amount) { return Cash{Currency::USD, amount}; }
+
+    Quantity shares(std::int64_t count)
+    {
+        return Quantity{count * Quantity::factor};
+    }
+
+    std::vector<finance::PositionEvent> makeStockEvents()
+    {
+        std::vector<finance::PositionEvent> events;
+        events.reserve(EVENT_COUNT);
+
+        for (std::int64_t i = 0; i < EVENT_COUNT; ++i)
+        {
+            // three buys followed by a larger sell, flipping every few rounds
+            const auto count = i % 4 == 3 ? -(4 + (i % 3)) : 1 + (i % 3);
+            const auto price = PRICE_BASE + ((i % 40) * PRICE_STEP);
+
+            events.push_back(
+                finance::PositionEvent{
+                    .timestamp = Timestamp{},
+                    .data =
+                        finance::StockTrade{
+                            .quantity  = shares(count),
+                            .unitPrice = usd(price),
+                            .fees      = usd(1'000'000)
+                        }
+                }
+            );
+        }
+        return events;
+    }
+
+    std::vector<finance::PositionEvent> makeOptionEvents()
+    {
+        std::vector<finance::PositionEvent> events;
+        events.reserve(EVENT_COUNT);
+
+        for (std::int64_t i = 0; i < EVENT_COUNT; ++i)
+        {
+            const bool open   = i % 2 == 0;
+            const auto strike = PRICE_BASE + ((i / 2 % 10) * PRICE_STEP);
+
+            events.push_back(
+                finance::PositionEvent{
+                    .timestamp = Timestamp{},
+                    .data =
+                        finance::OptionTrade{
+                            .type    = OptionType::Call,
+                            .buySell = open ? OptionBuySell::Sell
+                                            : OptionBuySell::Buy,
+                            .action  = open ? TransactionOptionAction::Open
+                                            : TransactionOptionAction::Close,
+                            .strike  = usd(strike),
+                            .quantity     = shares(1),
+                            .contractSize = CONTRACT_SIZE,
+                            .premium      = usd(50'000'000),
+                            .fees         = usd(650'000)
+                        }
+                }
+            );
+        }
+        return events;
+    }
+
+    void runFold(
+        benchmark::State&                          state,
+        const std::vector<finance::PositionEvent>& events
+    )
+    {
+        for (auto _ : state)
+        {
+            auto result = finance::foldEvents({}, events);
+            benchmark::DoNotOptimize(result);
+        }
+        state.SetItemsProcessed(state.iterations() * EVENT_COUNT);
+    }
+
+    void BM_StockFold(benchmark::State& state)
+    {
+        runFold(state, makeStockEvents());
+    }
+
+    void BM_OptionFold(benchmark::State& state)
+    {
+        runFold(state, makeOptionEvents());
+    }
+
+    void BM_CashMulAdd(benchmark::State& state)
+    {
+        std::vector<Cash>     prices;
+        std::vector<Quantity> quantities;
+        for (std::int64_t i = 0; i < EVENT_COUNT; ++i)
+        {
+            prices.push_back(usd(PRICE_BASE + ((i % 40) * PRICE_STEP)));
+            quantities.push_back(shares(1 + (i % 5)));
+        }
+
+        for (auto _ : state)
+        {
+            Cash total{Currency::USD, 0};
+            for (std::size_t i = 0; i < prices.size(); ++i)
+                total += prices[i] * quantities[i];
+            benchmark::DoNotOptimize(total);
+        }
+        state.SetItemsProcessed(state.iterations() * EVENT_COUNT);
+    }
+}   // namespace
+
+BENCHMARK(BM_StockFold);
+BENCHMARK(BM_OptionFold);
+BENCHMARK(BM_CashMulAdd);
@@ -0,0 +1,16 @@
+#ifndef __COMMON__INCLUDE__COMMON__ATOMIC_FILE_HPP__
+#define __COMMON__INCLUDE__COMMON__ATOMIC_FILE_HPP__
+
+#include <filesystem>
+#include <string_view>
+
+namespace common
+{
+    bool writeFileAtomically(
+        const std::filesystem::path& path,
+        std::string_view             content
+    );
+
+}   // namespace common
+
+#endif   // __COMMON__INCLUDE__COMMON__ATOMIC_FILE_HPP__
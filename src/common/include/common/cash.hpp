@@ -2,6 +2,9 @@
 #define __COMMON__INCLUDE__COMMON__CASH_HPP__
 
 #include <compare>
+#include <cstdint>
+#include <optional>
+#include <string>
 
 #include "common/finance.hpp"
 #include "common/quantity.hpp"
@@ -13,6 +16,12 @@
  * amounts. It ensures that operations are only performed between amounts of
  * the same currency.
  *
+ * The arithmetic is defined inline and constexpr in cash.tpp. Operands of the
+ * same currency take a single compare fast path, only a mismatch leaves the
+ * inline code to throw a CurrencyMismatchException. Building with
+ * MOLARTRACKER_UNCHECKED_CASH skips the mismatch check altogether, an amount
+ * without currency still adopts the currency of the other operand.
+ *
  */
 class Cash
 {
@@ -23,35 +32,45 @@ class Cash
     micro_units _amount;
 
    public:
-    Cash(Currency currency, micro_units amount);
-    Cash();
+    constexpr Cash(Currency currency, micro_units amount);
+    constexpr Cash();
 
-    friend bool                           operator==(Cash lhs, const Cash& rhs);
+    friend constexpr bool operator==(Cash lhs, const Cash& rhs);
     friend constexpr std::strong_ordering operator<=>(
         const Cash& lhs,
         const Cash& rhs
     );
 
-    friend Cash   operator+(Cash lhs, const Cash& rhs);
-    friend Cash   operator-(Cash lhs, const Cash& rhs);
-    friend Cash   operator-(const Cash& cash);
-    friend Cash   operator*(const Cash& cash, const Quantity& multiplier);
-    friend Cash   operator*(const Quantity& multiplier, const Cash& cash);
-    friend Cash   operator/(const Cash& cash, const Quantity& divisor);
-    friend double operator/(const Cash& cash, const Cash& divisor);
+    friend constexpr Cash operator+(Cash lhs, const Cash& rhs);
+    friend constexpr Cash operator-(Cash lhs, const Cash& rhs);
+    friend constexpr Cash operator-(const Cash& cash);
+    friend constexpr Cash operator*(
+        const Cash&     cash,
+        const Quantity& multiplier
+    );
+    friend constexpr Cash operator*(
+        const Quantity& multiplier,
+        const Cash&     cash
+    );
+    friend constexpr Cash operator/(
+        const Cash&     cash,
+        const Quantity& divisor
+    );
+    friend constexpr double operator/(const Cash& cash, const Cash& divisor);
 
-    friend Cash& operator+=(Cash& lhs, const Cash& rhs);
-    friend Cash& operator-=(Cash& lhs, const Cash& rhs);
+    friend constexpr Cash& operator+=(Cash& lhs, const Cash& rhs);
+    friend constexpr Cash& operator-=(Cash& lhs, const Cash& rhs);
 
-    [[nodiscard]] bool isZero() const;
-    [[nodiscard]] bool isPositive() const;
-    [[nodiscard]] bool isNegative() const;
+    [[nodiscard]] constexpr bool isZero() const;
+    [[nodiscard]] constexpr bool isPositive() const;
+    [[nodiscard]] constexpr bool isNegative() const;
 
-    [[nodiscard]] static Cash max(const Cash& lhs, const Cash& rhs);
-    [[nodiscard]] static Cash min(const Cash& lhs, const Cash& rhs);
+    [[nodiscard]] static constexpr Cash max(const Cash& lhs, const Cash& rhs);
+    [[nodiscard]] static constexpr Cash min(const Cash& lhs, const Cash& rhs);
+
+    [[nodiscard]] constexpr micro_units getAmount() const;
+    [[nodiscard]] constexpr Currency    getCurrency() const;
 
-    [[nodiscard]] micro_units getAmount() const;
-    [[nodiscard]] Currency    getCurrency() const;
     [[nodiscard]] std::string toString(
         std::optional<std::uint8_t> nDecimalPlaces        = std::nullopt,
         bool                        includeCurrencySymbol = true,
@@ -60,7 +79,15 @@ class Cash
 
    private:
     // cppcheck-suppress unusedPrivateFunction -- used in friend operators
-    void _takeCurrency(const Cash& cash);
+    constexpr void _takeCurrency(const Cash& cash);
+    constexpr void _ensureComparable(const Cash& cash) const;
+
+    [[noreturn]] static void _throwCurrencyMismatch(Currency lhs, Currency rhs);
+    [[noreturn]] static void _throwComparisonMismatch();
 };
 
-#endif   // __COMMON__INCLUDE__COMMON__CASH_HPP__
\ No newline at end of file
+#ifndef __COMMON__INCLUDE__COMMON__CASH_TPP__
+#include "cash.tpp"
+#endif
+
+#endif   // __COMMON__INCLUDE__COMMON__CASH_HPP__
@@ -0,0 +1,275 @@
+#ifndef __COMMON__INCLUDE__COMMON__CASH_TPP__
+#define __COMMON__INCLUDE__COMMON__CASH_TPP__
+
+#include "cash.hpp"
+
+/**
+ * @brief Construct a new Cash:: Cash object with a specified amount
+ *
+ * @param currency
+ * @param amount
+ */
+constexpr Cash::Cash(Currency currency, micro_units amount)
+    : _currency(currency), _amount(amount)
+{
+}
+
+/**
+ * @brief Construct a new Cash:: Cash object
+ *
+ */
+constexpr Cash::Cash() : _currency(Currency::Unknown), _amount(0) {}
+
+/**
+ * @brief Equality operator for Cash
+ *
+ * @param lhs
+ * @param rhs
+ * @return true if both Cash objects have the same currency and amount
+ * @return false otherwise
+ */
+constexpr bool operator==(Cash lhs, const Cash& rhs)
+{
+    lhs._takeCurrency(rhs);
+    return lhs._amount == rhs._amount;
+}
+
+/**
+ * @brief Three-way comparison operator for Cash
+ *
+ * @param lhs
+ * @param rhs
+ * @return std::strong_ordering the result of the comparison
+ */
+constexpr std::strong_ordering operator<=>(const Cash& lhs, const Cash& rhs)
+{
+    lhs._ensureComparable(rhs);
+
+    return lhs._amount <=> rhs._amount;
+}
+
+/**
+ * @brief Addition operator for Cash
+ *
+ * @param lhs
+ * @param rhs
+ * @return Cash the result of adding two Cash objects
+ */
+constexpr Cash operator+(Cash lhs, const Cash& rhs)
+{
+    lhs._takeCurrency(rhs);
+
+    return Cash{lhs._currency, lhs._amount + rhs._amount};
+}
+
+/**
+ * @brief Subtraction operator for Cash
+ *
+ * @param lhs
+ * @param rhs
+ * @return Cash the result of subtracting two Cash objects
+ */
+constexpr Cash operator-(Cash lhs, const Cash& rhs) { return lhs + (-rhs); }
+
+/**
+ * @brief Unary negation operator for Cash
+ *
+ * @param cash
+ * @return Cash the result of negating a Cash object
+ */
+constexpr Cash operator-(const Cash& cash)
+{
+    return Cash{cash._currency, -cash._amount};
+}
+
+/**
+ * @brief Multiplication operator for Cash
+ *
+ * @param cash
+ * @param multiplier
+ * @return Cash the result of multiplying a Cash object by a Quantity
+ */
+constexpr Cash operator*(const Cash& cash, const Quantity& multiplier)
+{
+    return Cash{cash._currency, mulDiv(cash._amount, multiplier)};
+}
+
+/**
+ * @brief Multiplication operator for Cash
+ *
+ * @param multiplier
+ * @param cash
+ * @return Cash the result of multiplying a Quantity by a Cash object
+ */
+constexpr Cash operator*(const Quantity& multiplier, const Cash& cash)
+{
+    return cash * multiplier;
+}
+
+/**
+ * @brief Division operator for Cash
+ *
+ * @param cash
+ * @param divisor
+ * @return Cash
+ */
+constexpr Cash operator/(const Cash& cash, const Quantity& divisor)
+{
+    return Cash{cash._currency, divBy(cash._amount, divisor)};
+}
+
+/**
+ * @brief Division operator for Cash
+ *
+ * @param cash
+ * @param divisor
+ * @return double
+ */
+constexpr double operator/(const Cash& cash, const Cash& divisor)
+{
+    return static_cast<double>(cash._amount) /
+           static_cast<double>(divisor._amount);
+}
+
+/**
+ * @brief Compound addition assignment operator for Cash
+ *
+ * @param lhs
+ * @param rhs
+ * @return Cash& the result of adding two Cash objects and assigning the
+ * result to the left-hand side object
+ */
+constexpr Cash& operator+=(Cash& lhs, const Cash& rhs)
+{
+    lhs._takeCurrency(rhs);
+
+    lhs._amount += rhs._amount;
+    return lhs;
+}
+
+/**
+ * @brief Compound subtraction assignment operator for Cash
+ *
+ * @param lhs
+ * @param rhs
+ * @return Cash& the result of subtracting two Cash objects and assigning
+ * the result to the left-hand side object
+ */
+constexpr Cash& operator-=(Cash& lhs, const Cash& rhs)
+{
+    lhs._takeCurrency(rhs);
+
+    lhs._amount -= rhs._amount;
+    return lhs;
+}
+
+/**
+ * @brief Checks if the Cash amount is zero.
+ *
+ * @return true if the amount is zero, false otherwise.
+ */
+constexpr bool Cash::isZero() const { return _amount == 0; }
+
+/**
+ * @brief Checks if the Cash amount is positive.
+ *
+ * @return true if the amount is greater than zero, false otherwise.
+ */
+constexpr bool Cash::isPositive() const { return _amount > 0; }
+
+/**
+ * @brief Checks if the Cash amount is negative.
+ *
+ * @return true if the amount is less than zero, false otherwise.
+ */
+constexpr bool Cash::isNegative() const { return _amount < 0; }
+
+/**
+ * @brief Gets the amount of cash in micro_units.
+ *
+ * @return micro_units The amount of cash.
+ */
+constexpr micro_units Cash::getAmount() const { return _amount; }
+
+/**
+ * @brief Gets the currency of the cash.
+ *
+ * @return Currency The currency of the cash.
+ */
+constexpr Currency Cash::getCurrency() const { return _currency; }
+
+/**
+ * @brief Returns the maximum of two Cash objects, ensuring they have the same
+ * currency.
+ *
+ * @param lhs The first Cash object.
+ * @param rhs The second Cash object.
+ * @return Cash The Cash object with the greater amount.
+ */
+constexpr Cash Cash::max(const Cash& lhs, const Cash& rhs)
+{
+    lhs._ensureComparable(rhs);
+
+    return lhs._amount >= rhs._amount ? lhs : rhs;
+}
+
+/**
+ * @brief Returns the minimum of two Cash objects, ensuring they have the same
+ * currency.
+ *
+ * @param lhs The first Cash object.
+ * @param rhs The second Cash object.
+ * @return Cash The Cash object with the lesser amount.
+ */
+constexpr Cash Cash::min(const Cash& lhs, const Cash& rhs)
+{
+    lhs._ensureComparable(rhs);
+
+    return lhs._amount <= rhs._amount ? lhs : rhs;
+}
+
+/**
+ * @brief Reconcile the currency with the one of another operand
+ *
+ * Equal currencies are the fast path. An operand without currency adopts
+ * the currency of the other one, differing currencies throw unless
+ * MOLARTRACKER_UNCHECKED_CASH is defined.
+ *
+ * @param cash
+ */
+constexpr void Cash::_takeCurrency(const Cash& cash)
+{
+    if (_currency == cash._currency) [[likely]]
+        return;
+
+    if (cash._currency == Currency::Unknown)
+        return;   // rhs is currency-less, nothing to reconcile
+
+    if (_currency == Currency::Unknown)
+    {
+        _currency = cash._currency;
+        return;
+    }
+
+#ifndef MOLARTRACKER_UNCHECKED_CASH
+    _throwCurrencyMismatch(_currency, cash._currency);
+#endif
+}
+
+/**
+ * @brief Ensure that two Cash objects can be compared, i.e. share the same
+ * currency (not checked with MOLARTRACKER_UNCHECKED_CASH)
+ *
+ * @param cash
+ */
+constexpr void Cash::_ensureComparable(
+    [[maybe_unused]] const Cash& cash
+) const
+{
+#ifndef MOLARTRACKER_UNCHECKED_CASH
+    if (_currency != cash._currency) [[unlikely]]
+        _throwComparisonMismatch();
+#endif
+}
+
+#endif   // __COMMON__INCLUDE__COMMON__CASH_TPP__
@@ -0,0 +1,74 @@
+#ifndef __COMMON__INCLUDE__COMMON__CONTAINER__INDEX_VIEW_HPP__
+#define __COMMON__INCLUDE__COMMON__CONTAINER__INDEX_VIEW_HPP__
+
+#include <cstddef>
+#include <iterator>
+#include <span>
+
+/**
+ * @brief A non-owning view selecting items of a contiguous storage by index.
+ *
+ * The view neither copies the items nor the index list, both have to outlive
+ * it. Items are iterated in the order of the index list.
+ *
+ * @tparam T The type of the viewed items.
+ */
+template <typename T>
+class IndexView
+{
+   private:
+    /// The viewed storage
+    std::span<const T> _items;
+    /// The indices of the selected items in the storage
+    std::span<const std::size_t> _indices;
+
+   public:
+    /**
+     * @brief Forward iterator over the selected items
+     *
+     */
+    class ConstIterator
+    {
+       private:
+        /// The viewed storage
+        const T* _items = nullptr;
+        /// The current position in the index list
+        const std::size_t* _index = nullptr;
+
+       public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type        = T;
+        using difference_type   = std::ptrdiff_t;
+        using pointer           = const T*;
+        using reference         = const T&;
+
+        ConstIterator() = default;
+        ConstIterator(const T* items, const std::size_t* index);
+
+        reference operator*() const;
+        pointer   operator->() const;
+
+        ConstIterator& operator++();
+        ConstIterator  operator++(int);
+
+        bool operator==(const ConstIterator& other) const;
+    };
+
+    IndexView() = default;
+    IndexView(std::span<const T> items, std::span<const std::size_t> indices);
+
+    [[nodiscard]] std::size_t size() const;
+    [[nodiscard]] bool        empty() const;
+
+    [[nodiscard]] const T& operator[](std::size_t index) const;
+    [[nodiscard]] const T& front() const;
+
+    [[nodiscard]] ConstIterator begin() const;
+    [[nodiscard]] ConstIterator end() const;
+};
+
+#ifndef __COMMON__INCLUDE__COMMON__CONTAINER__INDEX_VIEW_TPP__
+#include "index_view.tpp"
+#endif
+
+#endif   // __COMMON__INCLUDE__COMMON__CONTAINER__INDEX_VIEW_HPP__
@@ -0,0 +1,176 @@
+#ifndef __COMMON__INCLUDE__COMMON__CONTAINER__INDEX_VIEW_TPP__
+#define __COMMON__INCLUDE__COMMON__CONTAINER__INDEX_VIEW_TPP__
+
+#include "index_view.hpp"
+
+/**
+ * @brief Construct a new IndexView
+ *
+ * @tparam T
+ * @param items The viewed storage
+ * @param indices The indices of the selected items, all smaller than
+ * items.size()
+ */
+template <typename T>
+IndexView<T>::IndexView(
+    std::span<const T>           items,
+    std::span<const std::size_t> indices
+)
+    : _items(items), _indices(indices)
+{
+}
+
+/**
+ * @brief Get the number of selected items
+ *
+ * @tparam T
+ * @return std::size_t
+ */
+template <typename T>
+std::size_t IndexView<T>::size() const
+{
+    return _indices.size();
+}
+
+/**
+ * @brief Check whether no item is selected
+ *
+ * @tparam T
+ * @return true if the view is empty, false otherwise
+ */
+template <typename T>
+bool IndexView<T>::empty() const
+{
+    return _indices.empty();
+}
+
+/**
+ * @brief Get the selected item at the given position of the index list
+ *
+ * @tparam T
+ * @param index
+ * @return const T&
+ */
+template <typename T>
+const T& IndexView<T>::operator[](std::size_t index) const
+{
+    return _items[_indices[index]];
+}
+
+/**
+ * @brief Get the first selected item
+ *
+ * @tparam T
+ * @return const T&
+ */
+template <typename T>
+const T& IndexView<T>::front() const
+{
+    return _items[_indices.front()];
+}
+
+/**
+ * @brief Get an iterator to the first selected item
+ *
+ * @tparam T
+ * @return ConstIterator
+ */
+template <typename T>
+auto IndexView<T>::begin() const -> ConstIterator
+{
+    return ConstIterator{_items.data(), _indices.data()};
+}
+
+/**
+ * @brief Get an iterator past the last selected item
+ *
+ * @tparam T
+ * @return ConstIterator
+ */
+template <typename T>
+auto IndexView<T>::end() const -> ConstIterator
+{
+    return ConstIterator{_items.data(), _indices.data() + _indices.size()};
+}
+
+/**
+ * @brief Construct a new ConstIterator
+ *
+ * @tparam T
+ * @param items The viewed storage
+ * @param index The current position in the index list
+ */
+template <typename T>
+IndexView<T>::ConstIterator::ConstIterator(
+    const T*           items,
+    const std::size_t* index
+)
+    : _items(items), _index(index)
+{
+}
+
+/**
+ * @brief Dereference the iterator
+ *
+ * @tparam T
+ * @return const T&
+ */
+template <typename T>
+auto IndexView<T>::ConstIterator::operator*() const -> reference
+{
+    return _items[*_index];
+}
+
+/**
+ * @brief Access the current item
+ *
+ * @tparam T
+ * @return const T*
+ */
+template <typename T>
+auto IndexView<T>::ConstIterator::operator->() const -> pointer
+{
+    return &_items[*_index];
+}
+
+/**
+ * @brief Advance to the next selected item
+ *
+ * @tparam T
+ * @return ConstIterator&
+ */
+template <typename T>
+auto IndexView<T>::ConstIterator::operator++() -> ConstIterator&
+{
+    ++_index;
+    return *this;
+}
+
+/**
+ * @brief Advance to the next selected item, returning the previous state
+ *
+ * @tparam T
+ * @return ConstIterator
+ */
+template <typename T>
+auto IndexView<T>::ConstIterator::operator++(int) -> ConstIterator
+{
+    auto copy = *this;
+    ++_index;
+    return copy;
+}
+
+/**
+ * @brief Compare two iterators
+ *
+ * @tparam T
+ * @param other
+ * @return true if both point to the same position, false otherwise
+ */
+template <typename T>
+bool IndexView<T>::ConstIterator::operator==(const ConstIterator& other) const
+{
+    return _index == other._index;
+}
+
+#endif   // __COMMON__INCLUDE__COMMON__CONTAINER__INDEX_VIEW_TPP__
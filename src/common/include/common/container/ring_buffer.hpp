@@ -0,0 +1,102 @@
+#ifndef __COMMON__INCLUDE__COMMON__CONTAINER__RING_BUFFER_HPP__
+#define __COMMON__INCLUDE__COMMON__CONTAINER__RING_BUFFER_HPP__
+
+#include <cstddef>
+#include <iterator>
+#include <vector>
+
+/**
+ * @brief A fixed capacity container overwriting its oldest item once full.
+ *
+ * Items are iterated from the oldest to the newest one. Adding an item is
+ * O(1), the storage is allocated once up front.
+ *
+ * @tparam T The type of elements stored in the ring buffer.
+ */
+template <typename T>
+class RingBuffer
+{
+   private:
+    /// The storage, always of size capacity
+    std::vector<T> _items;
+    /// Index of the oldest item
+    std::size_t _head = 0;
+    /// Number of stored items
+    std::size_t _size = 0;
+
+   public:
+    /**
+     * @brief Random access iterator from the oldest to the newest item
+     *
+     */
+    class ConstIterator
+    {
+       private:
+        /// The iterated ring buffer
+        const RingBuffer* _buffer = nullptr;
+        /// The logical index, 0 is the oldest item
+        std::size_t _index = 0;
+
+       public:
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type        = T;
+        using difference_type   = std::ptrdiff_t;
+        using pointer           = const T*;
+        using reference         = const T&;
+
+        ConstIterator() = default;
+        ConstIterator(const RingBuffer* buffer, std::size_t index);
+
+        reference operator*() const;
+        pointer   operator->() const;
+        reference operator[](difference_type offset) const;
+
+        ConstIterator& operator++();
+        ConstIterator  operator++(int);
+        ConstIterator& operator--();
+        ConstIterator  operator--(int);
+        ConstIterator& operator+=(difference_type offset);
+        ConstIterator& operator-=(difference_type offset);
+
+        ConstIterator operator+(difference_type offset) const;
+        ConstIterator operator-(difference_type offset) const;
+
+        friend ConstIterator operator+(
+            difference_type      offset,
+            const ConstIterator& iterator
+        )
+        {
+            return iterator + offset;
+        }
+
+        difference_type operator-(const ConstIterator& other) const;
+
+        bool operator==(const ConstIterator& other) const;
+        auto operator<=>(const ConstIterator& other) const;
+    };
+
+    explicit RingBuffer(std::size_t capacity);
+
+    void push(T item);
+    void clear();
+
+    [[nodiscard]] std::size_t size() const;
+    [[nodiscard]] std::size_t capacity() const;
+    [[nodiscard]] bool        empty() const;
+    [[nodiscard]] bool        full() const;
+
+    [[nodiscard]] const T& operator[](std::size_t index) const;
+    [[nodiscard]] const T& front() const;
+    [[nodiscard]] const T& back() const;
+
+    [[nodiscard]] ConstIterator begin() const;
+    [[nodiscard]] ConstIterator end() const;
+
+    [[nodiscard]] std::vector<T> toVector() const;
+};
+
+#ifndef __COMMON__INCLUDE__COMMON__CONTAINER__RING_BUFFER_TPP__
+#include "ring_buffer.tpp"
+#endif
+
+#endif   // __COMMON__INCLUDE__COMMON__CONTAINER__RING_BUFFER_HPP__
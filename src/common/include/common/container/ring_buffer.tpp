@@ -0,0 +1,397 @@
+#ifndef __COMMON__INCLUDE__COMMON__CONTAINER__RING_BUFFER_TPP__
+#define __COMMON__INCLUDE__COMMON__CONTAINER__RING_BUFFER_TPP__
+
+#include <algorithm>
+#include <stdexcept>
+#include <utility>
+
+#include "ring_buffer.hpp"
+
+/**
+ * @brief Construct a new RingBuffer with a fixed capacity
+ *
+ * @tparam T
+ * @param capacity The maximum number of items, must be greater than zero
+ */
+template <typename T>
+RingBuffer<T>::RingBuffer(std::size_t capacity) : _items(capacity)
+{
+    if (capacity == 0)
+        throw std::invalid_argument("RingBuffer capacity must be positive");
+}
+
+/**
+ * @brief Add an item, overwriting the oldest item if the buffer is full
+ *
+ * @tparam T
+ * @param item
+ */
+template <typename T>
+void RingBuffer<T>::push(T item)
+{
+    const auto capacity = _items.size();
+
+    if (_size < capacity)
+    {
+        _items[(_head + _size) % capacity] = std::move(item);
+        ++_size;
+        return;
+    }
+
+    _items[_head] = std::move(item);
+    _head         = (_head + 1) % capacity;
+}
+
+/**
+ * @brief Remove all items, the capacity is kept
+ *
+ * @tparam T
+ */
+template <typename T>
+void RingBuffer<T>::clear()
+{
+    std::ranges::fill(_items, T{});
+    _head = 0;
+    _size = 0;
+}
+
+/**
+ * @brief Get the number of stored items
+ *
+ * @tparam T
+ * @return std::size_t
+ */
+template <typename T>
+std::size_t RingBuffer<T>::size() const
+{
+    return _size;
+}
+
+/**
+ * @brief Get the maximum number of items
+ *
+ * @tparam T
+ * @return std::size_t
+ */
+template <typename T>
+std::size_t RingBuffer<T>::capacity() const
+{
+    return _items.size();
+}
+
+/**
+ * @brief Check whether the buffer is empty
+ *
+ * @tparam T
+ * @return true if no item is stored, false otherwise
+ */
+template <typename T>
+bool RingBuffer<T>::empty() const
+{
+    return _size == 0;
+}
+
+/**
+ * @brief Check whether the buffer is full, the next push overwrites the
+ * oldest item
+ *
+ * @tparam T
+ * @return true if the buffer is full, false otherwise
+ */
+template <typename T>
+bool RingBuffer<T>::full() const
+{
+    return _size == _items.size();
+}
+
+/**
+ * @brief Get an item by its logical index, 0 is the oldest item
+ *
+ * @tparam T
+ * @param index
+ * @return const T&
+ */
+template <typename T>
+const T& RingBuffer<T>::operator[](std::size_t index) const
+{
+    return _items[(_head + index) % _items.size()];
+}
+
+/**
+ * @brief Get the oldest item
+ *
+ * @tparam T
+ * @return const T&
+ */
+template <typename T>
+const T& RingBuffer<T>::front() const
+{
+    return (*this)[0];
+}
+
+/**
+ * @brief Get the newest item
+ *
+ * @tparam T
+ * @return const T&
+ */
+template <typename T>
+const T& RingBuffer<T>::back() const
+{
+    return (*this)[_size - 1];
+}
+
+/**
+ * @brief Get an iterator to the oldest item
+ *
+ * @tparam T
+ * @return ConstIterator
+ */
+template <typename T>
+typename RingBuffer<T>::ConstIterator RingBuffer<T>::begin() const
+{
+    return ConstIterator{this, 0};
+}
+
+/**
+ * @brief Get an iterator past the newest item
+ *
+ * @tparam T
+ * @return ConstIterator
+ */
+template <typename T>
+typename RingBuffer<T>::ConstIterator RingBuffer<T>::end() const
+{
+    return ConstIterator{this, _size};
+}
+
+/**
+ * @brief Copy the items into a vector, ordered from the oldest to the newest
+ *
+ * @tparam T
+ * @return std::vector<T>
+ */
+template <typename T>
+std::vector<T> RingBuffer<T>::toVector() const
+{
+    return std::vector<T>(begin(), end());
+}
+
+/**************************
+ * ConstIterator methods *
+ **************************/
+
+/**
+ * @brief Construct a new iterator
+ *
+ * @tparam T
+ * @param buffer The iterated ring buffer
+ * @param index The logical index
+ */
+template <typename T>
+RingBuffer<T>::ConstIterator::ConstIterator(
+    const RingBuffer* buffer,
+    std::size_t       index
+)
+    : _buffer(buffer), _index(index)
+{
+}
+
+/**
+ * @brief Dereference the iterator
+ *
+ * @tparam T
+ * @return const T&
+ */
+template <typename T>
+auto RingBuffer<T>::ConstIterator::operator*() const -> reference
+{
+    return (*_buffer)[_index];
+}
+
+/**
+ * @brief Access a member of the item
+ *
+ * @tparam T
+ * @return const T*
+ */
+template <typename T>
+auto RingBuffer<T>::ConstIterator::operator->() const -> pointer
+{
+    return &(*_buffer)[_index];
+}
+
+/**
+ * @brief Access the item at an offset to the iterator
+ *
+ * @tparam T
+ * @param offset
+ * @return const T&
+ */
+template <typename T>
+auto RingBuffer<T>::ConstIterator::operator[](difference_type offset) const
+    -> reference
+{
+    return *(*this + offset);
+}
+
+/**
+ * @brief Pre-increment
+ *
+ * @tparam T
+ * @return ConstIterator&
+ */
+template <typename T>
+auto RingBuffer<T>::ConstIterator::operator++() -> ConstIterator&
+{
+    ++_index;
+    return *this;
+}
+
+/**
+ * @brief Post-increment
+ *
+ * @tparam T
+ * @return ConstIterator
+ */
+template <typename T>
+auto RingBuffer<T>::ConstIterator::operator++(int) -> ConstIterator
+{
+    auto copy = *this;
+    ++_index;
+    return copy;
+}
+
+/**
+ * @brief Pre-decrement
+ *
+ * @tparam T
+ * @return ConstIterator&
+ */
+template <typename T>
+auto RingBuffer<T>::ConstIterator::operator--() -> ConstIterator&
+{
+    --_index;
+    return *this;
+}
+
+/**
+ * @brief Post-decrement
+ *
+ * @tparam T
+ * @return ConstIterator
+ */
+template <typename T>
+auto RingBuffer<T>::ConstIterator::operator--(int) -> ConstIterator
+{
+    auto copy = *this;
+    --_index;
+    return copy;
+}
+
+/**
+ * @brief Advance the iterator
+ *
+ * @tparam T
+ * @param offset
+ * @return ConstIterator&
+ */
+template <typename T>
+auto RingBuffer<T>::ConstIterator::operator+=(difference_type offset)
+    -> ConstIterator&
+{
+    _index = static_cast<std::size_t>(
+        static_cast<difference_type>(_index) + offset
+    );
+    return *this;
+}
+
+/**
+ * @brief Move the iterator back
+ *
+ * @tparam T
+ * @param offset
+ * @return ConstIterator&
+ */
+template <typename T>
+auto RingBuffer<T>::ConstIterator::operator-=(difference_type offset)
+    -> ConstIterator&
+{
+    return *this += -offset;
+}
+
+/**
+ * @brief Get an advanced copy of the iterator
+ *
+ * @tparam T
+ * @param offset
+ * @return ConstIterator
+ */
+template <typename T>
+auto RingBuffer<T>::ConstIterator::operator+(difference_type offset) const
+    -> ConstIterator
+{
+    auto copy  = *this;
+    copy      += offset;
+    return copy;
+}
+
+/**
+ * @brief Get a copy of the iterator moved back
+ *
+ * @tparam T
+ * @param offset
+ * @return ConstIterator
+ */
+template <typename T>
+auto RingBuffer<T>::ConstIterator::operator-(difference_type offset) const
+    -> ConstIterator
+{
+    auto copy  = *this;
+    copy      -= offset;
+    return copy;
+}
+
+/**
+ * @brief Get the distance between two iterators
+ *
+ * @tparam T
+ * @param other
+ * @return difference_type
+ */
+template <typename T>
+auto RingBuffer<T>::ConstIterator::operator-(const ConstIterator& other) const
+    -> difference_type
+{
+    return static_cast<difference_type>(_index) -
+           static_cast<difference_type>(other._index);
+}
+
+/**
+ * @brief Compare two iterators for equality
+ *
+ * @tparam T
+ * @param other
+ * @return true if both point to the same item
+ */
+template <typename T>
+bool RingBuffer<T>::ConstIterator::operator==(const ConstIterator& other) const
+{
+    return _index == other._index;
+}
+
+/**
+ * @brief Order two iterators
+ *
+ * @tparam T
+ * @param other
+ * @return std::strong_ordering
+ */
+template <typename T>
+auto RingBuffer<T>::ConstIterator::operator<=>(const ConstIterator& other
+) const
+{
+    return _index <=> other._index;
+}
+
+#endif   // __COMMON__INCLUDE__COMMON__CONTAINER__RING_BUFFER_TPP__
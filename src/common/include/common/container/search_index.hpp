@@ -0,0 +1,75 @@
+#ifndef __COMMON__INCLUDE__COMMON__CONTAINER__SEARCH_INDEX_HPP__
+#define __COMMON__INCLUDE__COMMON__CONTAINER__SEARCH_INDEX_HPP__
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "common/container/set.hpp"
+
+/**
+ * @brief An incrementally updated, case-insensitive search index over a set of
+ * strings, e.g. ticker symbols.
+ *
+ * The values are kept in an array sorted by their upper-case key, so prefix
+ * matches are found by binary search. Substring matches are looked up in a
+ * trigram index: every value is listed under each three-character sequence of
+ * its key, a query only verifies the values of its rarest trigram. Queries
+ * shorter than a trigram fall back to a scan that stops at the result limit.
+ *
+ * Case folding is ASCII only, which is sufficient for ticker symbols.
+ */
+class SearchIndex
+{
+   public:
+    /// Default maximum number of results of a search
+    static constexpr std::size_t DefaultLimit = 50;
+
+   private:
+    /// Internal id of an indexed value
+    using Id = std::uint32_t;
+
+    /// The indexed values by id, removed values leave an empty slot
+    std::vector<std::string> _values;
+    /// The upper-case search keys by id
+    std::vector<std::string> _keys;
+    /// Slots of removed values, reused by later additions
+    std::vector<Id> _freeIds;
+    /// Id of every indexed value
+    std::unordered_map<std::string, Id> _ids;
+    /// The ids sorted by key (and value for equal keys)
+    std::vector<Id> _sorted;
+    /// Sorted ids by the trigrams of their keys
+    std::unordered_map<std::uint32_t, std::vector<Id>> _trigrams;
+
+   public:
+    SearchIndex() = default;
+    explicit SearchIndex(const Set<std::string>& values);
+
+    bool add(const std::string& value);
+    bool remove(const std::string& value);
+    void update(const Set<std::string>& values);
+    void clear();
+
+    [[nodiscard]] bool        contains(const std::string& value) const;
+    [[nodiscard]] std::size_t size() const;
+    [[nodiscard]] bool        empty() const;
+
+    [[nodiscard]] std::vector<std::string> search(
+        std::string_view query,
+        std::size_t      limit = DefaultLimit
+    ) const;
+
+   private:
+    [[nodiscard]] bool _lessById(Id lhs, Id rhs) const;
+
+    [[nodiscard]] static std::string _toKey(std::string_view value);
+    [[nodiscard]] static std::vector<std::uint32_t> _trigramsOf(
+        std::string_view key
+    );
+};
+
+#endif   // __COMMON__INCLUDE__COMMON__CONTAINER__SEARCH_INDEX_HPP__
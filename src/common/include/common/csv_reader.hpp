@@ -0,0 +1,49 @@
+#ifndef __COMMON__INCLUDE__COMMON__CSV_READER_HPP__
+#define __COMMON__INCLUDE__COMMON__CSV_READER_HPP__
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/**
+ * @brief Streaming reader for RFC 4180 style CSV data.
+ *
+ * The reader walks a contiguous buffer (e.g. a MappedFile) row by row. The
+ * fields of a row are returned as views into the buffer, only quoted fields
+ * containing escaped quotes are unescaped into a scratch buffer that is
+ * reused for every row. Reading a row therefore does not allocate once the
+ * field vector and the scratch buffer have grown to the widest row.
+ *
+ * Quoted fields may contain delimiters and line breaks, CRLF line endings
+ * and a leading UTF-8 byte order mark are accepted. Empty lines are skipped.
+ */
+class CsvReader
+{
+   private:
+    /// The CSV data
+    std::string_view _data;
+    /// The offset of the next unread byte
+    std::size_t _offset = 0;
+    /// The field delimiter
+    char _delimiter;
+    /// The line number of the last row read, 1-based
+    std::size_t _line = 0;
+    /// The line number of the next unread byte, 1-based
+    std::size_t _nextLine = 1;
+    /// Unescaped quoted fields of the current row
+    std::string _scratch;
+
+   public:
+    explicit CsvReader(std::string_view data, char delimiter = ',');
+
+    [[nodiscard]] bool next(std::vector<std::string_view>& fields);
+
+    [[nodiscard]] std::size_t getLine() const;
+    [[nodiscard]] std::size_t getOffset() const;
+    [[nodiscard]] std::size_t getSize() const;
+
+    [[nodiscard]] static std::string_view trim(std::string_view field);
+};
+
+#endif   // __COMMON__INCLUDE__COMMON__CSV_READER_HPP__
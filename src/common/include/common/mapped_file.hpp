@@ -0,0 +1,45 @@
+#ifndef __COMMON__INCLUDE__COMMON__MAPPED_FILE_HPP__
+#define __COMMON__INCLUDE__COMMON__MAPPED_FILE_HPP__
+
+#include <cstddef>
+#include <filesystem>
+#include <string>
+#include <string_view>
+
+/**
+ * @brief A read-only view of a whole file.
+ *
+ * On POSIX systems the file is memory-mapped, so large files are paged in by
+ * the kernel while they are read instead of being copied into a buffer
+ * first. On other platforms the file is read into memory once.
+ */
+class MappedFile
+{
+   private:
+    /// The first byte of the file contents
+    const char* _data = nullptr;
+    /// The size of the file in bytes
+    std::size_t _size = 0;
+    /// Whether _data points to a mapping that has to be unmapped
+    bool _mapped = false;
+    /// The file contents if the file is not mapped
+    std::string _buffer;
+
+   public:
+    explicit MappedFile(const std::filesystem::path& path);
+    ~MappedFile();
+
+    MappedFile(const MappedFile&)            = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+    MappedFile(MappedFile&& other) noexcept;
+    MappedFile& operator=(MappedFile&& other) noexcept;
+
+    [[nodiscard]] std::string_view view() const;
+    [[nodiscard]] std::size_t      size() const;
+    [[nodiscard]] bool             empty() const;
+
+   private:
+    void _release() noexcept;
+};
+
+#endif   // __COMMON__INCLUDE__COMMON__MAPPED_FILE_HPP__
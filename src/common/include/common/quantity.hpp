@@ -3,6 +3,7 @@
 
 #include <cstdint>
 #include <string>
+#include <string_view>
 
 using micro_units = std::int64_t;
 
@@ -34,6 +35,9 @@ struct intPow<0>
  * @brief Represents a quantity of a financial instrument, with a fixed
  * precision.
  *
+ * The arithmetic is defined inline and constexpr in quantity.tpp, so that
+ * hot loops (e.g. the PnL fold) can inline it across translation units.
+ *
  */
 class Quantity
 {
@@ -49,27 +53,36 @@ class Quantity
 
    public:
     Quantity() = default;
-    explicit Quantity(micro_units value);
+    constexpr explicit Quantity(micro_units value);
 
-    [[nodiscard]] double getValue() const;
+    [[nodiscard]] constexpr double getValue() const;
 
-    [[nodiscard]] micro_units toMicroUnits() const;
+    [[nodiscard]] constexpr micro_units toMicroUnits() const;
 
     [[nodiscard]] std::string toString() const;
 
-    [[nodiscard]] bool isZero() const;
-
-    [[nodiscard]] Quantity abs() const;
-
-    [[nodiscard]] bool operator==(const Quantity& other) const;
-    [[nodiscard]] bool operator>(const Quantity& other) const;
-    Quantity&          operator+=(const Quantity& other);
-    Quantity&          operator-=(const Quantity& other);
-
-    friend Quantity operator+(const Quantity& lhs, const Quantity& rhs);
-    friend Quantity operator-(const Quantity& lhs, const Quantity& rhs);
-    friend Quantity operator*(const Quantity& lhs, const Quantity& rhs);
-    friend Quantity operator*(const Quantity& lhs, micro_units rhs);
+    [[nodiscard]] constexpr bool isZero() const;
+
+    [[nodiscard]] constexpr Quantity abs() const;
+
+    [[nodiscard]] constexpr bool operator==(const Quantity& other) const;
+    [[nodiscard]] constexpr bool operator>(const Quantity& other) const;
+    constexpr Quantity&          operator+=(const Quantity& other);
+    constexpr Quantity&          operator-=(const Quantity& other);
+
+    friend constexpr Quantity operator+(
+        const Quantity& lhs,
+        const Quantity& rhs
+    );
+    friend constexpr Quantity operator-(
+        const Quantity& lhs,
+        const Quantity& rhs
+    );
+    friend constexpr Quantity operator*(
+        const Quantity& lhs,
+        const Quantity& rhs
+    );
+    friend constexpr Quantity operator*(const Quantity& lhs, micro_units rhs);
 
     /********************
      * friend operators *
@@ -78,18 +91,18 @@ class Quantity
     template <typename T>
     friend auto operator<=>(const Quantity& lhs, const T& rhs);
 
-    friend Quantity operator-(const Quantity& quantity);
+    friend constexpr Quantity operator-(const Quantity& quantity);
 };
 
-[[nodiscard]] micro_units mulDiv(
+[[nodiscard]] constexpr micro_units mulDiv(
     micro_units lhs,
     micro_units rhs,
     micro_units divisor
 );
 
-[[nodiscard]] micro_units mulDiv(micro_units lhs, Quantity rhs);
+[[nodiscard]] constexpr micro_units mulDiv(micro_units lhs, Quantity rhs);
 
-[[nodiscard]] micro_units divBy(micro_units lhs, Quantity rhs);
+[[nodiscard]] constexpr micro_units divBy(micro_units lhs, Quantity rhs);
 
 [[nodiscard]] micro_units microUnitsFromString(
     std::string_view value,
@@ -1,8 +1,164 @@
 #ifndef __COMMON__INCLUDE__COMMON__QUANTITY_TPP__
 #define __COMMON__INCLUDE__COMMON__QUANTITY_TPP__
 
+#include <stdexcept>
+
 #include "quantity.hpp"
 
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#endif
+
+/**
+ * @brief Construct a new Quantity:: Quantity object
+ *
+ * @param value
+ */
+constexpr Quantity::Quantity(micro_units value) : _value(value) {}
+
+/**
+ * @brief get the value of the quantity as a double
+ *
+ * @return double
+ */
+constexpr double Quantity::getValue() const
+{
+    return static_cast<double>(_value) / static_cast<double>(factor);
+}
+
+/**
+ * @brief get the raw value of the quantity in micro_units
+ *
+ * @return micro_units
+ */
+constexpr micro_units Quantity::toMicroUnits() const { return _value; }
+
+/**
+ * @brief Check if the quantity is zero.
+ *
+ * @return true if the quantity is zero, false otherwise.
+ */
+constexpr bool Quantity::isZero() const { return _value == 0; }
+
+/**
+ * @brief Get the absolute value of the quantity.
+ *
+ * @return A new Quantity object representing the absolute value of this
+ * quantity.
+ */
+constexpr Quantity Quantity::abs() const
+{
+    return Quantity(_value < 0 ? -_value : _value);
+}
+
+/**
+ * @brief Compare this quantity to another quantity for equality.
+ *
+ * @param other The other quantity to compare against.
+ * @return true if the quantities are equal, false otherwise.
+ */
+constexpr bool Quantity::operator==(const Quantity& other) const
+{
+    return _value == other._value;
+}
+
+/**
+ * @brief Compare this quantity to another quantity for greater-than.
+ *
+ * @param other The other quantity to compare against.
+ * @return true if this quantity is greater than the other, false otherwise.
+ */
+constexpr bool Quantity::operator>(const Quantity& other) const
+{
+    return _value > other._value;
+}
+
+/**
+ * @brief Adds another quantity to this quantity.
+ *
+ * @param other The other quantity to add.
+ * @return A reference to this quantity.
+ */
+constexpr Quantity& Quantity::operator+=(const Quantity& other)
+{
+    _value += other._value;
+    return *this;
+}
+
+/**
+ * @brief Subtracts another quantity from this quantity.
+ *
+ * @param other The other quantity to subtract.
+ * @return A reference to this quantity.
+ */
+constexpr Quantity& Quantity::operator-=(const Quantity& other)
+{
+    _value -= other._value;
+    return *this;
+}
+
+/**
+ * @brief Adds two quantities together.
+ *
+ * @param lhs The left-hand side quantity.
+ * @param rhs The right-hand side quantity.
+ * @return A new Quantity object representing the sum of the two quantities.
+ */
+constexpr Quantity operator+(const Quantity& lhs, const Quantity& rhs)
+{
+    return Quantity(lhs._value + rhs._value);
+}
+
+/**
+ * @brief Subtracts one quantity from another.
+ *
+ * @param lhs The left-hand side quantity.
+ * @param rhs The right-hand side quantity.
+ * @return A new Quantity object representing the difference between the two
+ * quantities.
+ */
+constexpr Quantity operator-(const Quantity& lhs, const Quantity& rhs)
+{
+    return Quantity(lhs._value - rhs._value);
+}
+
+/**
+ * @brief Multiplies a quantity by a micro_units value.
+ *
+ * @param lhs The left-hand side quantity.
+ * @param rhs The right-hand side micro_units value.
+ * @return A new Quantity object representing the product of the quantity and
+ * the micro_units value.
+ */
+constexpr Quantity operator*(const Quantity& lhs, micro_units rhs)
+{
+    return Quantity(lhs._value * rhs);
+}
+
+/**
+ * @brief Multiplies two quantities together.
+ *
+ * @param lhs The left-hand side quantity.
+ * @param rhs The right-hand side quantity.
+ * @return A new Quantity object representing the product of the two
+ * quantities.
+ */
+constexpr Quantity operator*(const Quantity& lhs, const Quantity& rhs)
+{
+    return lhs * rhs._value;
+}
+
+/**
+ * @brief Negate the quantity.
+ *
+ * @param quantity The quantity to negate.
+ * @return A new quantity representing the negated value.
+ */
+constexpr Quantity operator-(const Quantity& quantity)
+{
+    return Quantity(-quantity._value);
+}
+
 /**
  * @brief Compare this quantity to a scalar value for greater-than.
  *
@@ -18,4 +174,76 @@ auto operator<=>(const Quantity& lhs, const T& rhs)
     return lhs.getValue() <=> rhs;
 }
 
-#endif   // __COMMON__INCLUDE__COMMON__QUANTITY_TPP__
\ No newline at end of file
+/**
+ * @brief Multiply two micro_units values and divide by a third.
+ *
+ * The intermediate product is computed with 128 bit precision.
+ *
+ * @param lhs The left-hand side value.
+ * @param rhs The right-hand side value.
+ * @param divisor The divisor.
+ * @return The result of the multiplication and division.
+ */
+constexpr micro_units mulDiv(
+    micro_units lhs,
+    micro_units rhs,
+    micro_units divisor
+)
+{
+#if defined(_MSC_VER) && !defined(__clang__)
+    if !consteval
+    {
+        int64_t    high = 0;
+        const auto low  = static_cast<uint64_t>(_mul128(lhs, rhs, &high));
+        int64_t    remainder = 0;
+        return _div128(high, low, divisor, &remainder);
+    }
+
+    // the intrinsics are not usable in constant expressions, an overflowing
+    // product is a compile error there
+    return lhs * rhs / divisor;
+#else
+    // clang-format off
+    _Pragma("GCC diagnostic push")
+    _Pragma("GCC diagnostic ignored \"-Wpedantic\"")
+    const auto result =
+        static_cast<micro_units>(static_cast<__int128>(lhs) * rhs / divisor);
+    _Pragma("GCC diagnostic pop")
+    return result;
+    // clang-format on
+#endif
+}
+
+/**
+ * @brief Multiply two a micro_unit with a Quantity and divide by the Quantity's
+ * factor.
+ *
+ * @param lhs The left-hand side micro_unit value.
+ * @param rhs The right-hand side Quantity value.
+ * @return The result of the multiplication and division.
+ */
+constexpr micro_units mulDiv(micro_units lhs, Quantity rhs)
+{
+    return mulDiv(lhs, rhs.toMicroUnits(), Quantity::factor);
+}
+
+/**
+ * @brief Divide a micro_unit by a Quantity.
+ *
+ * @param lhs The left-hand side micro_unit value.
+ * @param rhs The right-hand side Quantity value.
+ * @return The result of the division.
+ */
+constexpr micro_units divBy(micro_units lhs, Quantity rhs)
+{
+    if (rhs.isZero())
+        throw std::domain_error("Division by zero");
+
+    return mulDiv(
+        lhs,
+        static_cast<micro_units>(Quantity::factor),
+        rhs.toMicroUnits()
+    );
+}
+
+#endif   // __COMMON__INCLUDE__COMMON__QUANTITY_TPP__
@@ -1,11 +1,17 @@
 #ifndef __COMMON__INCLUDE__COMMON__RING_FILE_HPP__
 #define __COMMON__INCLUDE__COMMON__RING_FILE_HPP__
 
+#include <chrono>
+#include <condition_variable>
 #include <cstddef>
 #include <cstdint>
 #include <filesystem>
 #include <fstream>
+#include <mutex>
+#include <stop_token>
 #include <string>
+#include <string_view>
+#include <thread>
 
 #include "common/ring_file_config.hpp"
 
@@ -20,6 +26,13 @@
  * opened. The oldest file is deleted when the maximum number of files is
  * reached.
  *
+ * With the Fd backend (see RingFileBackend) lines are collected in a
+ * user-space buffer and written out with writev, either when the buffer is
+ * full or by group commit after RingFileConfig::flushInterval. A flusher
+ * thread writes buffered lines out once the interval has passed without a
+ * new write, and the buffer is written out when the RingFile is destroyed.
+ * Files are preallocated and rotated by renaming only the files known to
+ * exist.
  */
 class RingFile
 {
@@ -43,6 +56,28 @@ class RingFile
     /// The total number of bytes written to the current file
     std::uintmax_t _bytesWritten{0};
 
+    /// The file descriptor of the current file (Fd backend)
+    int _fd{-1};
+
+    /// Bytes written but not yet passed to the file descriptor (Fd backend)
+    std::string _buffer;
+
+    /// Time of the last write out of the buffer (Fd backend)
+    std::chrono::steady_clock::time_point _lastFlush;
+
+    /// Number of rotated files (index 1 and above) known to exist, rotation
+    /// renames only these instead of probing the file system (Fd backend)
+    std::size_t _rotatedFiles{0};
+
+    /// Guards the state of the Fd backend against the flusher thread
+    std::mutex _mutex;
+    /// Wakes the flusher thread once the buffer holds unwritten lines
+    std::condition_variable_any _flushCondition;
+    /// Writes the buffer out once the flush interval has passed (Fd backend
+    /// with a flush interval only), must be stopped before the state above
+    /// is destroyed or moved
+    std::jthread _flusher;
+
    public:
     // TODO(97gamjak): as soon as migration to mstd is done, create a nice Sink
     // interface, so that std::cerr can be passed as a sink
@@ -73,6 +108,17 @@ class RingFile
     bool _wouldExceed(std::uintmax_t additionalBytes) const;
     void _ensureOpenAndRotateIfNeeded(std::uintmax_t additionalBytes);
     void _rotateNow();
+    void _updateSymlink(const std::filesystem::path& path);
+
+    void _writeFd(std::string_view text, bool newline);
+    void _openCurrentFd(bool truncate);
+    void _flushFd();
+    void _closeFd();
+    void _rotateNowFd();
+    void _countRotatedFiles();
+    void _startFlusher();
+    void _stopFlusher();
+    void _runFlusher(const std::stop_token& stopToken);
 
     std::filesystem::path _pathForIndex(std::size_t index) const;
 };
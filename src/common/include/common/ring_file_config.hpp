@@ -1,10 +1,26 @@
 #ifndef __COMMON__INCLUDE__COMMON__RING_FILE_CONFIG_HPP__
 #define __COMMON__INCLUDE__COMMON__RING_FILE_CONFIG_HPP__
 
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
 #include <filesystem>
 #include <optional>
 #include <string>
 
+/**
+ * @brief The way a RingFile writes to its files
+ *
+ * Stream writes through a std::ofstream and is available on every platform.
+ * Fd writes through a raw POSIX file descriptor with a user-space buffer, it
+ * falls back to Stream on platforms without POSIX file descriptors.
+ */
+enum class RingFileBackend : std::uint8_t
+{
+    Stream,
+    Fd
+};
+
 /**
  * @brief Configuration for the RingFile
  *
@@ -22,6 +38,9 @@ struct RingFileConfig
     /// Conversion factor from megabytes to bytes
     static constexpr int MBtoBytes = 1024 * 1024;
 
+    /// Default size of the user-space buffer of the Fd backend in bytes
+    static constexpr std::size_t DefaultBufferSize = 64 * 1024;
+
     /// The directory where the log files will be stored
     std::filesystem::path directory;
 
@@ -55,6 +74,23 @@ struct RingFileConfig
     /// its name, if the symlink already exists, it will be updated to point to
     /// the new current log file when it changes
     std::optional<std::filesystem::path> symlinkPath{std::nullopt};
+
+    /// The backend used for writing the files
+    RingFileBackend backend{RingFileBackend::Stream};
+
+    /// The size of the user-space buffer of the Fd backend in bytes, lines
+    /// are collected in this buffer and written out with a single writev
+    std::size_t bufferSize{DefaultBufferSize};
+
+    /// Group-commit interval of the Fd backend, buffered lines are written
+    /// out at the latest this interval after the last flush, by the next
+    /// write or by the flusher thread. Zero only writes them out when the
+    /// buffer is full, on an explicit flush or on destruction
+    std::chrono::milliseconds flushInterval{0};
+
+    /// Whether the Fd backend preallocates each file up to maxSizeMB (Linux
+    /// only), the reported file size still only grows with written data
+    bool preallocate{true};
 };
 
 #endif   // __COMMON__INCLUDE__COMMON__RING_FILE_CONFIG_HPP__
\ No newline at end of file
@@ -0,0 +1,61 @@
+#ifndef __COMMON__INCLUDE__COMMON__WORKER_POOL_HPP__
+#define __COMMON__INCLUDE__COMMON__WORKER_POOL_HPP__
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <stop_token>
+#include <thread>
+#include <vector>
+
+/**
+ * @brief A fixed set of worker threads for data parallel work.
+ *
+ * The threads are started once and reused by every call of parallelFor(),
+ * so splitting a batch over the pool does not pay for creating and joining
+ * threads. The calling thread takes part in the work, hence parallelFor()
+ * always makes progress, also if it is called from a worker of the pool or
+ * while all workers are busy.
+ */
+class WorkerPool
+{
+   private:
+    struct Batch;
+
+    /// Guards the queue
+    std::mutex _mutex;
+    /// Signaled when a batch is queued or the pool is stopped
+    std::condition_variable_any _wakeUp;
+    /// Batches that may still have unclaimed tasks, in submission order
+    std::deque<std::shared_ptr<Batch>> _queue;
+
+    /// The worker threads, declared last so that they are stopped before the
+    /// queue is destroyed
+    std::vector<std::jthread> _workers;
+
+   public:
+    explicit WorkerPool(std::size_t nWorkers);
+    ~WorkerPool();
+
+    WorkerPool(const WorkerPool&)            = delete;
+    WorkerPool& operator=(const WorkerPool&) = delete;
+    WorkerPool(WorkerPool&&)                 = delete;
+    WorkerPool& operator=(WorkerPool&&)      = delete;
+
+    static WorkerPool& getInstance();
+
+    [[nodiscard]] std::size_t size() const;
+
+    void parallelFor(
+        std::size_t                             nTasks,
+        const std::function<void(std::size_t)>& task
+    );
+
+   private:
+    void _run(const std::stop_token& stopToken);
+};
+
+#endif   // __COMMON__INCLUDE__COMMON__WORKER_POOL_HPP__
@@ -0,0 +1,157 @@
+#include "common/atomic_file.hpp"
+
+#include <system_error>
+
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <cerrno>
+#else
+#include <fstream>
+#endif
+
+namespace common
+{
+    namespace
+    {
+#if !defined(_WIN32)
+        /**
+         * @brief Writes the whole content to a file descriptor, retrying
+         * partial and interrupted writes
+         *
+         * @param fd
+         * @param content
+         * @return true if all bytes were written
+         */
+        bool _writeAll(int fd, std::string_view content)
+        {
+            while (!content.empty())
+            {
+                const auto written =
+                    ::write(fd, content.data(), content.size());
+
+                if (written < 0)
+                {
+                    if (errno == EINTR)
+                        continue;
+
+                    return false;
+                }
+
+                content.remove_prefix(static_cast<std::size_t>(written));
+            }
+
+            return true;
+        }
+
+        /**
+         * @brief Writes the content to a new file and syncs it to disk
+         *
+         * @param path
+         * @param content
+         * @return true on success
+         */
+        bool _writeSynced(
+            const std::filesystem::path& path,
+            std::string_view             content
+        )
+        {
+            const int fd = ::open(
+                path.c_str(),
+                O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC,
+                0644   // NOLINT(readability-magic-numbers)
+            );
+
+            if (fd < 0)
+                return false;
+
+            const bool written = _writeAll(fd, content) && ::fsync(fd) == 0;
+
+            return ::close(fd) == 0 && written;
+        }
+
+        /**
+         * @brief Syncs a directory, which makes a rename inside it durable.
+         * Failures are ignored, not every file system supports it.
+         *
+         * @param directory
+         */
+        void _syncDirectory(const std::filesystem::path& directory)
+        {
+            const int fd = ::open(
+                directory.c_str(),
+                O_RDONLY | O_DIRECTORY | O_CLOEXEC
+            );
+
+            if (fd < 0)
+                return;
+
+            ::fsync(fd);
+            ::close(fd);
+        }
+#else
+        /**
+         * @brief Writes the content to a new file and flushes it
+         *
+         * @param path
+         * @param content
+         * @return true on success
+         */
+        bool _writeSynced(
+            const std::filesystem::path& path,
+            std::string_view             content
+        )
+        {
+            std::ofstream file{path, std::ios::binary | std::ios::trunc};
+            file.write(
+                content.data(),
+                static_cast<std::streamsize>(content.size())
+            );
+            file.flush();
+
+            return file.good();
+        }
+#endif
+    }   // namespace
+
+    /**
+     * @brief Replace a file atomically: the content is written to a temporary
+     * file next to it, synced to disk and renamed over the file
+     *
+     * @param path
+     * @param content
+     * @return true on success, on failure the file is left untouched
+     */
+    bool writeFileAtomically(
+        const std::filesystem::path& path,
+        std::string_view             content
+    )
+    {
+        auto tempPath = path;
+        tempPath += ".tmp";
+
+        std::error_code error;
+
+        if (!_writeSynced(tempPath, content))
+        {
+            std::filesystem::remove(tempPath, error);
+            return false;
+        }
+
+        std::filesystem::rename(tempPath, path, error);
+
+        if (error)
+        {
+            std::filesystem::remove(tempPath, error);
+            return false;
+        }
+
+#if !defined(_WIN32)
+        _syncDirectory(path.parent_path());
+#endif
+
+        return true;
+    }
+
+}   // namespace common
@@ -0,0 +1,351 @@
+#include "common/container/search_index.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <cstddef>
+#include <ranges>
+
+namespace
+{
+    /// Length of the character sequences in the substring index
+    constexpr std::size_t TRIGRAM = 3;
+
+    /// Bits per character in a packed trigram
+    constexpr unsigned CHAR_BITS = 8;
+
+    /**
+     * @brief Inserts the id into the sorted id list, if not yet contained
+     *
+     * @param ids
+     * @param id
+     */
+    void _insertSorted(std::vector<std::uint32_t>& ids, std::uint32_t id)
+    {
+        const auto it = std::ranges::lower_bound(ids, id);
+        if (it == ids.end() || *it != id)
+            ids.insert(it, id);
+    }
+
+    /**
+     * @brief Removes the id from the sorted id list
+     *
+     * @param ids
+     * @param id
+     */
+    void _eraseSorted(std::vector<std::uint32_t>& ids, std::uint32_t id)
+    {
+        const auto it = std::ranges::lower_bound(ids, id);
+        if (it != ids.end() && *it == id)
+            ids.erase(it);
+    }
+}   // namespace
+
+/**
+ * @brief Construct a new Search Index object containing the given values
+ *
+ * @param values
+ */
+SearchIndex::SearchIndex(const Set<std::string>& values) { update(values); }
+
+/**
+ * @brief Adds a value to the index
+ *
+ * @param value
+ * @return true If the value was added
+ * @return false If the value was already indexed
+ */
+bool SearchIndex::add(const std::string& value)
+{
+    if (_ids.contains(value))
+        return false;
+
+    Id id = 0;
+    if (_freeIds.empty())
+    {
+        id = static_cast<Id>(_values.size());
+        _values.emplace_back();
+        _keys.emplace_back();
+    }
+    else
+    {
+        id = _freeIds.back();
+        _freeIds.pop_back();
+    }
+
+    _values[id] = value;
+    _keys[id]   = _toKey(value);
+    _ids.emplace(value, id);
+
+    const auto it = std::ranges::lower_bound(
+        _sorted,
+        id,
+        [this](Id lhs, Id rhs) { return _lessById(lhs, rhs); }
+    );
+    _sorted.insert(it, id);
+
+    for (const auto trigram : _trigramsOf(_keys[id]))
+        _insertSorted(_trigrams[trigram], id);
+
+    return true;
+}
+
+/**
+ * @brief Removes a value from the index
+ *
+ * @param value
+ * @return true If the value was removed
+ * @return false If the value was not indexed
+ */
+bool SearchIndex::remove(const std::string& value)
+{
+    const auto found = _ids.find(value);
+    if (found == _ids.end())
+        return false;
+
+    const auto id = found->second;
+    _ids.erase(found);
+
+    const auto it = std::ranges::lower_bound(
+        _sorted,
+        id,
+        [this](Id lhs, Id rhs) { return _lessById(lhs, rhs); }
+    );
+    if (it != _sorted.end() && *it == id)
+        _sorted.erase(it);
+
+    for (const auto trigram : _trigramsOf(_keys[id]))
+    {
+        auto& ids = _trigrams[trigram];
+        _eraseSorted(ids, id);
+
+        if (ids.empty())
+            _trigrams.erase(trigram);
+    }
+
+    _values[id].clear();
+    _keys[id].clear();
+    _freeIds.push_back(id);
+
+    return true;
+}
+
+/**
+ * @brief Updates the index to contain exactly the given values, only the
+ * difference to the current content is added and removed
+ *
+ * @param values
+ */
+void SearchIndex::update(const Set<std::string>& values)
+{
+    std::vector<std::string> removed;
+    for (const auto& [value, id] : _ids)
+        if (!values.contains(value))
+            removed.push_back(value);
+
+    for (const auto& value : removed)
+        remove(value);
+
+    for (const auto& value : values)
+        add(value);
+}
+
+/**
+ * @brief Removes all values from the index
+ *
+ */
+void SearchIndex::clear()
+{
+    _values.clear();
+    _keys.clear();
+    _freeIds.clear();
+    _ids.clear();
+    _sorted.clear();
+    _trigrams.clear();
+}
+
+/**
+ * @brief Checks whether the exact value is indexed
+ *
+ * @param value
+ * @return true
+ * @return false
+ */
+bool SearchIndex::contains(const std::string& value) const
+{
+    return _ids.contains(value);
+}
+
+/**
+ * @brief Get the number of indexed values
+ *
+ * @return std::size_t
+ */
+std::size_t SearchIndex::size() const { return _ids.size(); }
+
+/**
+ * @brief Checks whether the index is empty
+ *
+ * @return true
+ * @return false
+ */
+bool SearchIndex::empty() const { return _ids.empty(); }
+
+/**
+ * @brief Searches the values containing the query, ignoring case
+ *
+ * Values starting with the query come first, followed by the values
+ * containing it elsewhere, both in key order. An empty query matches every
+ * value.
+ *
+ * @param query The text to search for
+ * @param limit The maximum number of results
+ * @return std::vector<std::string> The matching values
+ */
+std::vector<std::string> SearchIndex::search(
+    std::string_view query,
+    std::size_t      limit
+) const
+{
+    std::vector<std::string> results;
+    if (limit == 0)
+        return results;
+
+    const auto key = _toKey(query);
+
+    // prefix matches, a contiguous range of the sorted ids
+    auto it = std::ranges::lower_bound(
+        _sorted,
+        std::string_view{key},
+        std::ranges::less{},
+        [this](Id id) { return std::string_view{_keys[id]}; }
+    );
+    for (; it != _sorted.end() && results.size() < limit; ++it)
+    {
+        if (!_keys[*it].starts_with(key))
+            break;
+
+        results.push_back(_values[*it]);
+    }
+
+    if (results.size() == limit || key.empty())
+        return results;
+
+    const auto isInfixMatch = [this, &key](Id id)
+    {
+        const auto position = _keys[id].find(key);
+        return position != std::string::npos && position != 0;
+    };
+
+    const auto trigrams = _trigramsOf(key);
+    if (trigrams.empty())
+    {
+        // too short for the trigram index, scan in key order
+        for (const auto id : _sorted)
+        {
+            if (results.size() == limit)
+                break;
+
+            if (isInfixMatch(id))
+                results.push_back(_values[id]);
+        }
+        return results;
+    }
+
+    // every match is listed under all trigrams of the query, it is
+    // sufficient to verify the values of the rarest one
+    const std::vector<Id>* candidates = nullptr;
+    for (const auto trigram : trigrams)
+    {
+        const auto found = _trigrams.find(trigram);
+        if (found == _trigrams.end())
+            return results;
+
+        if (candidates == nullptr || found->second.size() < candidates->size())
+            candidates = &found->second;
+    }
+
+    std::vector<Id> matches;
+    for (const auto id : *candidates)
+        if (isInfixMatch(id))
+            matches.push_back(id);
+
+    const auto remaining = std::min(limit - results.size(), matches.size());
+    const auto middle =
+        matches.begin() + static_cast<std::ptrdiff_t>(remaining);
+    std::ranges::partial_sort(
+        matches,
+        middle,
+        [this](Id lhs, Id rhs) { return _lessById(lhs, rhs); }
+    );
+
+    for (const auto id : std::ranges::subrange(matches.begin(), middle))
+        results.push_back(_values[id]);
+
+    return results;
+}
+
+/**
+ * @brief Orders ids by their keys, and by their values for equal keys
+ *
+ * @param lhs
+ * @param rhs
+ * @return true If lhs is ordered before rhs
+ * @return false Otherwise
+ */
+bool SearchIndex::_lessById(Id lhs, Id rhs) const
+{
+    if (_keys[lhs] != _keys[rhs])
+        return _keys[lhs] < _keys[rhs];
+
+    return _values[lhs] < _values[rhs];
+}
+
+/**
+ * @brief Builds the case-insensitive search key of a value
+ *
+ * @param value
+ * @return std::string The upper-case value
+ */
+std::string SearchIndex::_toKey(std::string_view value)
+{
+    std::string key{value};
+    std::ranges::transform(
+        key,
+        key.begin(),
+        [](unsigned char character)
+        { return static_cast<char>(std::toupper(character)); }
+    );
+    return key;
+}
+
+/**
+ * @brief Get the distinct trigrams of a key, each packed into an integer
+ *
+ * @param key
+ * @return std::vector<std::uint32_t> The trigrams, empty for keys shorter
+ * than a trigram
+ */
+std::vector<std::uint32_t> SearchIndex::_trigramsOf(std::string_view key)
+{
+    std::vector<std::uint32_t> trigrams;
+    if (key.size() < TRIGRAM)
+        return trigrams;
+
+    trigrams.reserve(key.size() - TRIGRAM + 1);
+    for (std::size_t i = 0; i + TRIGRAM <= key.size(); ++i)
+    {
+        std::uint32_t trigram = 0;
+        for (std::size_t j = 0; j < TRIGRAM; ++j)
+        {
+            trigram <<= CHAR_BITS;
+            trigram  |= static_cast<unsigned char>(key[i + j]);
+        }
+        trigrams.push_back(trigram);
+    }
+
+    std::ranges::sort(trigrams);
+    const auto [first, last] = std::ranges::unique(trigrams);
+    trigrams.erase(first, last);
+
+    return trigrams;
+}
@@ -0,0 +1,183 @@
+#include "common/csv_reader.hpp"
+
+namespace
+{
+    /// UTF-8 byte order mark written by some spreadsheet exports
+    constexpr std::string_view BYTE_ORDER_MARK = "\xEF\xBB\xBF";
+    /// The quote character
+    constexpr char QUOTE = '"';
+}   // namespace
+
+/**
+ * @brief Construct a new Csv Reader object
+ *
+ * @param data The CSV data, it has to outlive the reader and the returned
+ * fields
+ * @param delimiter The field delimiter
+ */
+CsvReader::CsvReader(std::string_view data, char delimiter)
+    : _data(data), _delimiter(delimiter)
+{
+    if (_data.starts_with(BYTE_ORDER_MARK))
+        _offset = BYTE_ORDER_MARK.size();
+}
+
+/**
+ * @brief Reads the next row
+ *
+ * The returned fields stay valid until the next call. Unquoted fields are
+ * returned as they are, quoted fields without their quotes.
+ *
+ * @param fields The fields of the row, cleared before reading
+ * @return true if a row was read
+ * @return false if the end of the data is reached
+ */
+bool CsvReader::next(std::vector<std::string_view>& fields)
+{
+    fields.clear();
+
+    // skip empty lines
+    while (_offset < _data.size() &&
+           (_data[_offset] == '\n' || _data[_offset] == '\r'))
+    {
+        if (_data[_offset] == '\n')
+            ++_nextLine;
+        ++_offset;
+    }
+
+    if (_offset >= _data.size())
+        return false;
+
+    _line = _nextLine;
+
+    // find the end of the row first, line breaks in quoted fields belong to
+    // the row
+    const auto begin    = _offset;
+    auto       end      = begin;
+    bool       inQuotes = false;
+
+    while (end < _data.size() && (inQuotes || _data[end] != '\n'))
+    {
+        if (_data[end] == QUOTE)
+            inQuotes = !inQuotes;
+        else if (_data[end] == '\n')
+            ++_nextLine;
+        ++end;
+    }
+
+    _offset = end < _data.size() ? end + 1 : end;
+    if (end < _data.size())
+        ++_nextLine;
+
+    if (end > begin && _data[end - 1] == '\r')
+        --end;
+
+    // unescaped fields are never longer than the row, so reserving the row
+    // length keeps the views into the scratch buffer valid
+    _scratch.clear();
+    _scratch.reserve(end - begin);
+
+    auto pos = begin;
+    while (true)
+    {
+        std::string_view field;
+
+        if (pos < end && _data[pos] == QUOTE)
+        {
+            const auto start   = ++pos;
+            bool       escaped = false;
+
+            while (pos < end)
+            {
+                if (_data[pos] == QUOTE)
+                {
+                    if (pos + 1 < end && _data[pos + 1] == QUOTE)
+                    {
+                        escaped  = true;
+                        pos     += 2;
+                        continue;
+                    }
+                    break;
+                }
+                ++pos;
+            }
+
+            field = _data.substr(start, pos - start);
+
+            if (escaped)
+            {
+                const auto first = _scratch.size();
+
+                for (std::size_t i = 0; i < field.size(); ++i)
+                {
+                    _scratch.push_back(field[i]);
+                    if (field[i] == QUOTE)
+                        ++i;
+                }
+
+                field = std::string_view{_scratch}.substr(first);
+            }
+
+            // anything between the closing quote and the delimiter is dropped
+            while (pos < end && _data[pos] != _delimiter)
+                ++pos;
+        }
+        else
+        {
+            const auto start = pos;
+
+            while (pos < end && _data[pos] != _delimiter)
+                ++pos;
+
+            field = _data.substr(start, pos - start);
+        }
+
+        fields.push_back(field);
+
+        if (pos >= end)
+            break;
+
+        ++pos;   // skip the delimiter
+    }
+
+    return true;
+}
+
+/**
+ * @brief Get the line number the last row started at, 1-based
+ *
+ * @return std::size_t
+ */
+std::size_t CsvReader::getLine() const { return _line; }
+
+/**
+ * @brief Get the number of bytes consumed so far, e.g. for progress reports
+ *
+ * @return std::size_t
+ */
+std::size_t CsvReader::getOffset() const { return _offset; }
+
+/**
+ * @brief Get the size of the data in bytes
+ *
+ * @return std::size_t
+ */
+std::size_t CsvReader::getSize() const { return _data.size(); }
+
+/**
+ * @brief Strips leading and trailing spaces and tabs of a field
+ *
+ * @param field
+ * @return std::string_view
+ */
+std::string_view CsvReader::trim(std::string_view field)
+{
+    const auto first = field.find_first_not_of(" \t");
+
+    if (first == std::string_view::npos)
+        return {};
+
+    const auto last = field.find_last_not_of(" \t");
+
+    return field.substr(first, last - first + 1);
+}
@@ -0,0 +1,174 @@
+#include "common/mapped_file.hpp"
+
+#include <cerrno>
+#include <fstream>
+#include <iterator>
+#include <system_error>
+#include <utility>
+
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+/**
+ * @brief Maps the given file into memory
+ *
+ * @param path The file to map
+ *
+ * @throws std::system_error if the file cannot be opened or mapped
+ */
+MappedFile::MappedFile(const std::filesystem::path& path)
+{
+#if !defined(_WIN32)
+    const int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+
+    if (fd < 0)
+        throw std::system_error(errno, std::generic_category(), path.string());
+
+    struct stat status{};
+    if (::fstat(fd, &status) != 0)
+    {
+        const int error = errno;
+        ::close(fd);
+        throw std::system_error(error, std::generic_category(), path.string());
+    }
+
+    _size = static_cast<std::size_t>(status.st_size);
+
+    if (_size > 0)
+    {
+        void* mapping = ::mmap(nullptr, _size, PROT_READ, MAP_PRIVATE, fd, 0);
+
+        if (mapping == MAP_FAILED)
+        {
+            const int error = errno;
+            ::close(fd);
+            throw std::system_error(
+                error,
+                std::generic_category(),
+                path.string()
+            );
+        }
+
+        // the file is read front to back, let the kernel read ahead
+        ::madvise(mapping, _size, MADV_SEQUENTIAL);
+
+        _data   = static_cast<const char*>(mapping);
+        _mapped = true;
+    }
+
+    // the mapping stays valid after the descriptor is closed
+    ::close(fd);
+#else
+    std::ifstream file{path, std::ios::binary};
+
+    if (!file)
+    {
+        throw std::system_error(
+            std::make_error_code(std::errc::no_such_file_or_directory),
+            path.string()
+        );
+    }
+
+    _buffer.assign(
+        std::istreambuf_iterator<char>{file},
+        std::istreambuf_iterator<char>{}
+    );
+
+    _data = _buffer.data();
+    _size = _buffer.size();
+#endif
+}
+
+/**
+ * @brief Unmaps the file
+ *
+ */
+MappedFile::~MappedFile() { _release(); }
+
+/**
+ * @brief Move constructor, the other file is left empty
+ *
+ * @param other
+ */
+MappedFile::MappedFile(MappedFile&& other) noexcept
+    : _data(std::exchange(other._data, nullptr)),
+      _size(std::exchange(other._size, 0)),
+      _mapped(std::exchange(other._mapped, false)),
+      _buffer(std::move(other._buffer))
+{
+    if (!_mapped && _data != nullptr)
+        _data = _buffer.data();
+}
+
+/**
+ * @brief Move assignment, the other file is left empty
+ *
+ * @param other
+ * @return MappedFile&
+ */
+MappedFile& MappedFile::operator=(MappedFile&& other) noexcept
+{
+    if (this != &other)
+    {
+        _release();
+
+        _data   = std::exchange(other._data, nullptr);
+        _size   = std::exchange(other._size, 0);
+        _mapped = std::exchange(other._mapped, false);
+        _buffer = std::move(other._buffer);
+
+        if (!_mapped && _data != nullptr)
+            _data = _buffer.data();
+    }
+
+    return *this;
+}
+
+/**
+ * @brief Get the contents of the file
+ *
+ * @return std::string_view
+ */
+std::string_view MappedFile::view() const
+{
+    if (_data == nullptr)
+        return {};
+
+    return {_data, _size};
+}
+
+/**
+ * @brief Get the size of the file in bytes
+ *
+ * @return std::size_t
+ */
+std::size_t MappedFile::size() const { return _size; }
+
+/**
+ * @brief Checks whether the file is empty
+ *
+ * @return true
+ * @return false
+ */
+bool MappedFile::empty() const { return _size == 0; }
+
+/**
+ * @brief Unmaps the file and resets the view
+ *
+ */
+void MappedFile::_release() noexcept
+{
+#if !defined(_WIN32)
+    if (_mapped)
+        ::munmap(const_cast<char*>(_data), _size);
+#endif
+
+    _data   = nullptr;
+    _size   = 0;
+    _mapped = false;
+    _buffer.clear();
+}
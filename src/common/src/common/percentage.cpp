@@ -12,7 +12,7 @@ Percentage::Percentage(double value) : _value(value) {}
 
 /**
  * @brief Returns a string representation of the percentage, formatted with two
- * decimal places and a percent sign, with a "+" sign for positive values.
+ * decimal places and a percent sign, always carrying its sign.
  *
  * @param nDecimals The number of decimal places to include in the formatted
  * percentage string (default is 2).
@@ -23,5 +23,5 @@ std::string Percentage::toString(size_t nDecimals) const
     if (std::isnan(_value))
         return "-";
 
-    return std::format("+{:.{}f}%", _value * _base, nDecimals);
+    return std::format("{:+.{}f}%", _value * _base, nDecimals);
 }
\ No newline at end of file
@@ -22,16 +22,30 @@ RingFile::RingFile(Config config) : _config(std::move(config))
 {
     _normalizeConfig();
     std::filesystem::create_directories(_config.directory);
-    _openCurrent();
+
+    if (_config.backend == RingFileBackend::Fd)
+    {
+        _countRotatedFiles();
+        _openCurrentFd(!_config.append);
+        _startFlusher();
+    }
+    else
+    {
+        _openCurrent();
+    }
 }
 
 /**
  * @brief Destructor for RingFile
  *
  * @note Flushes and closes the file if open, unless writing to std::cerr.
+ * The flusher thread is stopped first, buffered lines of the Fd backend are
+ * written out by the close.
  */
 RingFile::~RingFile()
 {
+    _stopFlusher();
+
     // if we don't have a file we decided to write to std::cerr
     if (_file)
     {
@@ -58,15 +72,28 @@ RingFile& RingFile::operator=(RingFile&& other) noexcept
     if (this == &other)
         return *this;
 
+    // the flusher threads refer to their RingFile, restarted below
+    _stopFlusher();
+    other._stopFlusher();
+
     close();
     _config             = std::move(other._config);
     _file               = std::move(other._file);
     _initialFileSize    = other._initialFileSize;
     _bytesWritten       = other._bytesWritten;
     _currentSymlinkPath = std::move(other._currentSymlinkPath);
+    _fd                 = std::exchange(other._fd, -1);
+    _buffer             = std::move(other._buffer);
+    _lastFlush          = other._lastFlush;
+    _rotatedFiles       = other._rotatedFiles;
 
     other._initialFileSize = 0;
     other._bytesWritten    = 0;
+    other._buffer.clear();
+
+    if (_config.backend == RingFileBackend::Fd)
+        _startFlusher();
+
     return *this;
 }
 
@@ -81,7 +108,12 @@ RingFile& RingFile::operator=(RingFile&& other) noexcept
  */
 void RingFile::writeLine(const std::string& line)
 {
-    if (_file)
+    if (_config.backend == RingFileBackend::Fd)
+    {
+        const std::scoped_lock lock{_mutex};
+        _writeFd(line, true);
+    }
+    else if (_file)
     {
         const auto additional = line.size() + 1;
 
@@ -107,7 +139,12 @@ void RingFile::writeLine(const std::string& line)
  */
 void RingFile::write(const std::string& text)
 {
-    if (_file)
+    if (_config.backend == RingFileBackend::Fd)
+    {
+        const std::scoped_lock lock{_mutex};
+        _writeFd(text, false);
+    }
+    else if (_file)
     {
         const auto additional = text.size();
 
@@ -128,7 +165,12 @@ void RingFile::write(const std::string& text)
  */
 void RingFile::flush()
 {
-    if (_file && _file.is_open())
+    if (_config.backend == RingFileBackend::Fd)
+    {
+        const std::scoped_lock lock{_mutex};
+        _flushFd();
+    }
+    else if (_file && _file.is_open())
         _file.flush();
 }
 
@@ -137,7 +179,12 @@ void RingFile::flush()
  */
 void RingFile::close()
 {
-    if (_file && _file.is_open())
+    if (_config.backend == RingFileBackend::Fd)
+    {
+        const std::scoped_lock lock{_mutex};
+        _closeFd();
+    }
+    else if (_file && _file.is_open())
         _file.close();
 }
 
@@ -167,6 +214,11 @@ void RingFile::_normalizeConfig()
 
     if (_config.directory.empty())
         _config.directory = ".";
+
+#if defined(_WIN32)
+    // no POSIX file descriptors, always write through the stream
+    _config.backend = RingFileBackend::Stream;
+#endif
 }
 
 /**
@@ -293,36 +345,44 @@ void RingFile::_openCurrent()
 
     _file.open(path, mode);
 
-    if (_config.symlinkPath.has_value())
-    {
-        if (_currentSymlinkPath != path)
-        {
-            std::error_code errorCode;
-            std::filesystem::remove(_config.symlinkPath.value(), errorCode);
-            if (errorCode)
-            {
-                std::cerr << "Failed to remove existing symlink: "
-                          << errorCode.message() << "\n";
-                return;
-            }
+    _updateSymlink(path);
+}
 
-            // Create new symlink pointing to the current log file
-            auto target = std::filesystem::absolute(path);
-            std::filesystem::create_symlink(
-                target,
-                _config.symlinkPath.value(),
-                errorCode
-            );
-            if (errorCode)
-            {
-                std::cerr << "Failed to create symlink: " << errorCode.message()
-                          << "\n";
-                return;
-            }
+/**
+ * @brief Points the configured symlink to the given file, if it does not
+ * already point there
+ *
+ * @param path The path of the current file
+ */
+void RingFile::_updateSymlink(const std::filesystem::path& path)
+{
+    if (!_config.symlinkPath.has_value() || _currentSymlinkPath == path)
+        return;
 
-            _currentSymlinkPath = path;
-        }
+    std::error_code errorCode;
+    std::filesystem::remove(_config.symlinkPath.value(), errorCode);
+    if (errorCode)
+    {
+        std::cerr << "Failed to remove existing symlink: "
+                  << errorCode.message() << "\n";
+        return;
     }
+
+    // Create new symlink pointing to the current log file
+    auto target = std::filesystem::absolute(path);
+    std::filesystem::create_symlink(
+        target,
+        _config.symlinkPath.value(),
+        errorCode
+    );
+    if (errorCode)
+    {
+        std::cerr << "Failed to create symlink: " << errorCode.message()
+                  << "\n";
+        return;
+    }
+
+    _currentSymlinkPath = path;
 }
 
 /**
@@ -0,0 +1,390 @@
+#include "common/ring_file.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <iostream>
+#include <mutex>
+#include <span>
+#include <stop_token>
+#include <string_view>
+#include <system_error>
+#include <thread>
+
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <sys/uio.h>
+#include <time.h>
+#include <unistd.h>
+#endif
+
+// The raw file descriptor backend of RingFile, see RingFileBackend::Fd
+
+#if !defined(_WIN32)
+
+namespace
+{
+    /// Permissions of newly created files (rw-r--r--)
+    constexpr mode_t FILE_MODE = 0644;
+
+    /**
+     * @brief Writes all given buffers, retrying on partial writes and EINTR
+     *
+     * @param fd The file descriptor to write to
+     * @param iov The buffers to write, modified in place on partial writes
+     * @return true If everything was written
+     * @return false If writing failed
+     */
+    bool _writeAll(int fd, std::span<iovec> iov)
+    {
+        while (!iov.empty())
+        {
+            const auto written =
+                ::writev(fd, iov.data(), static_cast<int>(iov.size()));
+
+            if (written < 0)
+            {
+                if (errno == EINTR)
+                    continue;
+
+                return false;
+            }
+
+            auto remaining = static_cast<std::size_t>(written);
+            while (!iov.empty() && remaining >= iov.front().iov_len)
+            {
+                remaining -= iov.front().iov_len;
+                iov        = iov.subspan(1);
+            }
+
+            if (!iov.empty())
+            {
+                auto& front    = iov.front();
+                front.iov_base = static_cast<char*>(front.iov_base) + remaining;
+                front.iov_len -= remaining;
+            }
+        }
+
+        return true;
+    }
+
+    /**
+     * @brief A cheap reading of the steady clock, precise enough for the
+     * group-commit interval which is checked on every write
+     *
+     * @return std::chrono::steady_clock::time_point
+     */
+    std::chrono::steady_clock::time_point _coarseNow()
+    {
+#if defined(__linux__)
+        timespec now{};
+        if (::clock_gettime(CLOCK_MONOTONIC_COARSE, &now) == 0)
+        {
+            return std::chrono::steady_clock::time_point{
+                std::chrono::seconds{now.tv_sec} +
+                std::chrono::nanoseconds{now.tv_nsec}
+            };
+        }
+#endif
+        return std::chrono::steady_clock::now();
+    }
+
+    /**
+     * @brief Creates an iovec for the given bytes
+     *
+     * @param bytes
+     * @return iovec
+     */
+    iovec _toIovec(std::string_view bytes)
+    {
+        // writev does not modify the buffers, the cast only satisfies the
+        // C interface
+        return iovec{
+            .iov_base = const_cast<char*>(bytes.data()),   // NOLINT
+            .iov_len  = bytes.size()
+        };
+    }
+}   // namespace
+
+/**
+ * @brief Writes text through the user-space buffer, rotating first if the
+ * text would exceed the maximum file size
+ *
+ * If the text does not fit into the buffer, the buffer and the text are
+ * written out together with a single writev without copying the text. The
+ * buffer is also written out once the flush interval has passed.
+ *
+ * @param text The text to write
+ * @param newline Whether a newline is appended
+ */
+void RingFile::_writeFd(std::string_view text, bool newline)
+{
+    const auto additional = text.size() + (newline ? 1 : 0);
+
+    if (_fd < 0)
+        _openCurrentFd(false);
+
+    if (_wouldExceed(additional))
+        _rotateNowFd();
+
+    if (_buffer.size() + additional > _config.bufferSize)
+    {
+        static constexpr std::string_view lineEnd{"\n"};
+
+        std::array<iovec, 3> iov{
+            _toIovec(_buffer),
+            _toIovec(text),
+            _toIovec(newline ? lineEnd : std::string_view{})
+        };
+
+        if (_fd >= 0 && !_writeAll(_fd, iov))
+            std::cerr << "Failed to write log file: " << errno << "\n";
+
+        _buffer.clear();
+        _lastFlush = _coarseNow();
+    }
+    else
+    {
+        const bool wasEmpty = _buffer.empty();
+
+        _buffer += text;
+        if (newline)
+            _buffer += '\n';
+
+        // the flusher only waits for a deadline while lines are buffered
+        if (wasEmpty && !_buffer.empty())
+            _flushCondition.notify_all();
+    }
+
+    _bytesWritten += additional;
+
+    if (_config.flushInterval.count() > 0 &&
+        _coarseNow() - _lastFlush >= _config.flushInterval)
+        _flushFd();
+}
+
+/**
+ * @brief Writes the user-space buffer out to the file descriptor
+ */
+void RingFile::_flushFd()
+{
+    _lastFlush = _coarseNow();
+
+    if (_buffer.empty() || _fd < 0)
+        return;
+
+    auto iov = _toIovec(_buffer);
+    if (!_writeAll(_fd, std::span{&iov, 1}))
+        std::cerr << "Failed to write log file: " << errno << "\n";
+
+    _buffer.clear();
+}
+
+/**
+ * @brief Opens the current ring file (index 0) as raw file descriptor
+ *
+ * @note Sets the initial file size, resets the bytes written counter and
+ * preallocates the file up to the maximum size on Linux.
+ *
+ * @param truncate Whether an existing file is truncated instead of appended
+ */
+void RingFile::_openCurrentFd(bool truncate)
+{
+    const auto path = _pathForIndex(0);
+
+    const int flags = O_WRONLY | O_CREAT | O_APPEND | O_CLOEXEC |
+                      (truncate ? O_TRUNC : 0);
+
+    _fd = ::open(path.c_str(), flags, FILE_MODE);
+    if (_fd < 0)
+    {
+        std::cerr << "Failed to open log file " << path << ": " << errno
+                  << "\n";
+        return;
+    }
+
+    struct stat info{};
+    _initialFileSize =
+        ::fstat(_fd, &info) == 0 ? static_cast<std::uintmax_t>(info.st_size)
+                                 : 0;
+    _bytesWritten = 0;
+    _lastFlush    = _coarseNow();
+
+#if defined(__linux__)
+    // keep the reported size, so readers never see trailing zeros, failing
+    // is fine as the preallocation is only an optimization
+    if (_config.preallocate && _config.maxSizeMB > 0)
+    {
+        const auto size = _config.maxSizeMB * Config::MBtoBytes;
+        static_cast<void>(
+            ::fallocate(_fd, FALLOC_FL_KEEP_SIZE, 0, static_cast<off_t>(size))
+        );
+    }
+#endif
+
+    _updateSymlink(path);
+}
+
+/**
+ * @brief Writes out the buffer and closes the file descriptor
+ *
+ * @note The file is truncated to its written size to release the
+ * preallocated space.
+ */
+void RingFile::_closeFd()
+{
+    if (_fd < 0)
+        return;
+
+    _flushFd();
+
+    struct stat info{};
+    if (_config.preallocate && ::fstat(_fd, &info) == 0 &&
+        ::ftruncate(_fd, info.st_size) != 0)
+        std::cerr << "Failed to release preallocated log file space\n";
+
+    ::close(_fd);
+    _fd = -1;
+}
+
+/**
+ * @brief Rotates the ring file (Fd backend)
+ *
+ * @note Only the rotated files known to exist are shifted, each by a single
+ * rename which replaces the oldest file. With maxFiles == 1 the current file
+ * is truncated in place.
+ */
+void RingFile::_rotateNowFd()
+{
+    if (_config.maxFiles == 1)
+    {
+        _flushFd();
+
+        if (_fd >= 0 && ::ftruncate(_fd, 0) == 0)
+        {
+            _initialFileSize = 0;
+            _bytesWritten    = 0;
+        }
+        return;
+    }
+
+    _closeFd();
+
+    // Shift: (n-1)->n, ..., 0->1 where n is the number of rotated files,
+    // rename replaces the oldest file once the ring is full
+    const auto last = std::min(_rotatedFiles + 1, _config.maxFiles - 1);
+    for (std::size_t i = last; i > 0; --i)
+    {
+        const auto src = _pathForIndex(i - 1);
+        const auto dst = _pathForIndex(i);
+
+        if (::rename(src.c_str(), dst.c_str()) != 0 && errno != ENOENT)
+            std::cerr << "Failed to rotate log file " << src << ": " << errno
+                      << "\n";
+    }
+    _rotatedFiles = last;
+
+    _openCurrentFd(true);
+}
+
+/**
+ * @brief Counts the rotated files of a previous run, so that they are
+ * shifted on rotation
+ *
+ * @note This is the only place probing the file system for rotated files.
+ */
+void RingFile::_countRotatedFiles()
+{
+    _rotatedFiles = 0;
+
+    for (std::size_t i = 1; i < _config.maxFiles; ++i)
+    {
+        std::error_code errorCode;
+        if (std::filesystem::exists(_pathForIndex(i), errorCode))
+            _rotatedFiles = i;
+    }
+}
+
+/**
+ * @brief Starts the flusher thread if a flush interval is configured
+ */
+void RingFile::_startFlusher()
+{
+    if (_config.flushInterval.count() <= 0)
+        return;
+
+    _flusher = std::jthread{[this](std::stop_token stopToken)
+                            { _runFlusher(stopToken); }};
+}
+
+/**
+ * @brief Stops and joins the flusher thread, lines it did not write out yet
+ * stay in the buffer
+ */
+void RingFile::_stopFlusher()
+{
+    if (!_flusher.joinable())
+        return;
+
+    _flusher.request_stop();
+    _flusher.join();
+}
+
+/**
+ * @brief Thread entry point of the flusher, writes the buffer out once the
+ * flush interval has passed since the last flush
+ *
+ * @note Writes arriving in the meantime do not move the deadline, so lines
+ * are never held back longer than the flush interval. A flush in between
+ * may lead to an early flush of the next lines, which is harmless.
+ *
+ * @param stopToken
+ */
+void RingFile::_runFlusher(const std::stop_token& stopToken)
+{
+    std::unique_lock lock{_mutex};
+
+    while (!stopToken.stop_requested())
+    {
+        _flushCondition.wait(
+            lock,
+            stopToken,
+            [this] { return !_buffer.empty(); }
+        );
+
+        // _lastFlush is read while the lock is released, wait on a copy
+        const auto deadline = _lastFlush + _config.flushInterval;
+
+        const bool flushed = _flushCondition.wait_until(
+            lock,
+            stopToken,
+            deadline,
+            [this] { return _buffer.empty(); }
+        );
+
+        if (!flushed && !stopToken.stop_requested())
+            _flushFd();
+    }
+}
+
+#else
+
+// Not reachable, the Fd backend falls back to Stream on Windows, see
+// RingFile::_normalizeConfig
+
+void RingFile::_writeFd(std::string_view /*text*/, bool /*newline*/) {}
+void RingFile::_openCurrentFd(bool /*truncate*/) {}
+void RingFile::_flushFd() {}
+void RingFile::_closeFd() {}
+void RingFile::_rotateNowFd() {}
+void RingFile::_countRotatedFiles() {}
+void RingFile::_startFlusher() {}
+void RingFile::_stopFlusher() {}
+void RingFile::_runFlusher(const std::stop_token& /*stopToken*/) {}
+
+#endif
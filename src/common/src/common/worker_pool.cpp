@@ -0,0 +1,203 @@
+#include "common/worker_pool.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <utility>
+
+/**
+ * @brief The tasks of a single parallelFor() call, shared by the calling
+ * thread and the workers helping with it
+ *
+ */
+struct WorkerPool::Batch
+{
+    /// The task run for every index
+    std::function<void(std::size_t)> task;
+    /// The number of tasks
+    std::size_t nTasks = 0;
+    /// The next unclaimed index
+    std::atomic<std::size_t> next{0};
+
+    /// Guards the state below
+    std::mutex mutex;
+    /// Signaled when the last task has finished
+    std::condition_variable finished;
+    /// The number of finished tasks
+    std::size_t nFinished = 0;
+    /// The first exception thrown by a task
+    std::exception_ptr error;
+
+    /**
+     * @brief Claims and runs tasks until none is left
+     *
+     */
+    void work()
+    {
+        for (auto index = next++; index < nTasks; index = next++)
+        {
+            std::exception_ptr taskError;
+
+            try
+            {
+                task(index);
+            }
+            catch (...)
+            {
+                taskError = std::current_exception();
+            }
+
+            const std::scoped_lock lock{mutex};
+
+            if (taskError && !error)
+                error = std::move(taskError);
+
+            if (++nFinished == nTasks)
+                finished.notify_all();
+        }
+    }
+
+    /**
+     * @brief Checks whether all tasks are claimed
+     *
+     * @return true
+     * @return false
+     */
+    [[nodiscard]] bool claimed() const { return next.load() >= nTasks; }
+};
+
+/**
+ * @brief Construct a new WorkerPool object and start its workers
+ *
+ * @param nWorkers The number of worker threads, the calling thread of
+ * parallelFor() works in addition to them
+ */
+WorkerPool::WorkerPool(std::size_t nWorkers)
+{
+    _workers.reserve(nWorkers);
+
+    for (std::size_t i = 0; i < nWorkers; ++i)
+    {
+        _workers.emplace_back([this](const std::stop_token& stopToken)
+                              { _run(stopToken); });
+    }
+}
+
+/**
+ * @brief Destroy the WorkerPool object, the workers finish the task they
+ * are running and are joined
+ *
+ */
+WorkerPool::~WorkerPool()
+{
+    for (auto& worker : _workers)
+        worker.request_stop();
+
+    _workers.clear();
+}
+
+/**
+ * @brief Get the process wide pool, it has one worker less than the
+ * hardware concurrency as the calling thread works as well
+ *
+ * @return WorkerPool&
+ */
+WorkerPool& WorkerPool::getInstance()
+{
+    static WorkerPool instance{
+        std::max(1U, std::thread::hardware_concurrency()) - 1
+    };
+    return instance;
+}
+
+/**
+ * @brief Get the number of worker threads
+ *
+ * @return std::size_t
+ */
+std::size_t WorkerPool::size() const { return _workers.size(); }
+
+/**
+ * @brief Runs task(0) to task(nTasks - 1) on the calling thread and the
+ * workers and blocks until all of them have finished.
+ *
+ * Every index is run exactly once, in no particular order. The first
+ * exception thrown by a task is rethrown on the calling thread once all
+ * tasks have finished.
+ *
+ * @param nTasks The number of tasks
+ * @param task The task, it must be safe to run concurrently for different
+ * indices
+ */
+void WorkerPool::parallelFor(
+    std::size_t                             nTasks,
+    const std::function<void(std::size_t)>& task
+)
+{
+    if (nTasks == 0)
+        return;
+
+    auto batch    = std::make_shared<Batch>();
+    batch->task   = task;
+    batch->nTasks = nTasks;
+
+    if (nTasks > 1 && !_workers.empty())
+    {
+        {
+            const std::scoped_lock lock{_mutex};
+            _queue.push_back(batch);
+        }
+
+        _wakeUp.notify_all();
+    }
+
+    batch->work();
+
+    std::unique_lock lock{batch->mutex};
+    batch->finished.wait(
+        lock,
+        [&batch] { return batch->nFinished == batch->nTasks; }
+    );
+
+    if (batch->error)
+        std::rethrow_exception(batch->error);
+}
+
+/**
+ * @brief Worker loop, helps with the oldest batch that has unclaimed tasks
+ * until a stop is requested
+ *
+ * @param stopToken
+ */
+void WorkerPool::_run(const std::stop_token& stopToken)
+{
+    while (true)
+    {
+        std::shared_ptr<Batch> batch;
+        {
+            std::unique_lock lock{_mutex};
+
+            // batches whose tasks are all claimed are only finishing, they
+            // are dropped from the queue
+            _wakeUp.wait(
+                lock,
+                stopToken,
+                [this]
+                {
+                    std::erase_if(
+                        _queue,
+                        [](const auto& queued) { return queued->claimed(); }
+                    );
+                    return !_queue.empty();
+                }
+            );
+
+            if (stopToken.stop_requested())
+                return;
+
+            batch = _queue.front();
+        }
+
+        batch->work();
+    }
+}
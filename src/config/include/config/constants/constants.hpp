@@ -89,6 +89,8 @@ class Constants
     [[nodiscard]] std::filesystem::path getDataPath() const;
     [[nodiscard]] std::filesystem::path getDatabasePath() const;
     [[nodiscard]] std::filesystem::path getImagesPath() const;
+    [[nodiscard]] std::filesystem::path getTickerCachePath() const;
+    [[nodiscard]] std::filesystem::path getFxRatesPath() const;
 
     [[nodiscard]] static std::string getAppName();
     [[nodiscard]] static std::string getAppDisplayName();
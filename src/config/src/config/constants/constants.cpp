@@ -111,6 +111,28 @@ std::filesystem::path Constants::getImagesPath() const
     return _dataPath / "pictures";
 }
 
+/**
+ * @brief Get the ticker cache path, this is the file where looked up ticker
+ * metadata is persisted between runs
+ *
+ * @return std::filesystem::path
+ */
+std::filesystem::path Constants::getTickerCachePath() const
+{
+    return _dataPath / "ticker_cache.json";
+}
+
+/**
+ * @brief Get the fx rates path, this is the file where the cached exchange
+ * rates are persisted between runs
+ *
+ * @return std::filesystem::path
+ */
+std::filesystem::path Constants::getFxRatesPath() const
+{
+    return _dataPath / "fx_rates.json";
+}
+
 /**
  * @brief Get the application name
  *
@@ -1,5 +1,7 @@
 #include "controller/main_controller.hpp"
 
+#include <QTimer>
+#include <chrono>
 #include <filesystem>
 #include <memory>
 
@@ -15,9 +17,13 @@
 #include "controller/side_bar/side_bar_controller.hpp"
 #include "controller/transaction_controller.hpp"
 #include "controller/vcs_controller.hpp"
+#include "finance/fx_rate_cache.hpp"
+#include "finance/fx_rate_source.hpp"
 #include "finance/price_cache.hpp"
+#include "finance/ticker_lookup_service.hpp"
 #include "gateway/position_gateway.hpp"
 #include "logging/log_manager.hpp"
+#include "logging/startup_phases.hpp"
 #include "settings/settings.hpp"
 #include "store/store_container.hpp"
 #include "ui/main_window.hpp"
@@ -49,6 +55,12 @@ namespace controller
 
         /// price cache for managing stock prices
         std::shared_ptr<finance::PriceCache> _priceCache;
+        /// exchange rate cache for converting between currencies
+        std::shared_ptr<finance::FxRateCache> _fxRateCache;
+        /// feeds the exchange rate cache from currency pair quotes
+        finance::FxRateSource _fxRateSource;
+        /// ticker lookup service for looking up ticker metadata
+        std::shared_ptr<finance::TickerLookupService> _tickerLookupService;
         /// position gateway for managing positions
         gateway::PositionGateway _positionGateway;
 
@@ -84,6 +96,17 @@ namespace controller
               ),
               _handlers(_settings),
               _priceCache(std::make_shared<finance::PriceCache>()),
+              _fxRateCache(
+                  std::make_shared<finance::FxRateCache>(
+                      Constants::getInstance().getFxRatesPath()
+                  )
+              ),
+              _fxRateSource(_priceCache, _fxRateCache),
+              _tickerLookupService(
+                  std::make_shared<finance::TickerLookupService>(
+                      Constants::getInstance().getTickerCachePath()
+                  )
+              ),
               _positionGateway(
                   _storeContainer.getTransactionStore(),
                   _storeContainer.getPositionStore(),
@@ -135,12 +158,25 @@ namespace controller
                   _mainWindow->getCentralWidget(),
                   _accountController,
                   _transactionController,
-                  std::make_shared<gateway::PositionGateway>(_positionGateway)
+                  std::make_shared<gateway::PositionGateway>(_positionGateway),
+                  _tickerLookupService
               )
         {
             _handlers.getDirtyStateHandler()
                 .subscribe(_storeContainer, _settings, _mainWindow.get());
         }
+
+        /**
+         * @brief Destroy the Impl object, the ticker lookup worker is stopped
+         * before the controllers subscribed to it are destroyed
+         *
+         */
+        ~Impl() { _tickerLookupService->stop(); }
+
+        Impl(const Impl&)            = delete;
+        Impl& operator=(const Impl&) = delete;
+        Impl(Impl&&)                 = delete;
+        Impl& operator=(Impl&&)      = delete;
     };
 
     /**
@@ -156,6 +192,10 @@ namespace controller
         // NOTE: _impl is initialized with nullptr in order to have logging
         // already initialized while constructing AppContext
 
+        // anchors the startup time before anything is loaded
+        auto&      startupPhases = logging::StartupPhases::getInstance();
+        const auto settingsStart = std::chrono::steady_clock::now();
+
         settings::Settings settings{Constants::getInstance().getConfigPath()};
 
         // initialize settings
@@ -167,6 +207,12 @@ namespace controller
             loggingSettings
         );
 
+        startupPhases.record(
+            "Startup.Settings",
+            std::chrono::steady_clock::now() - settingsStart
+        );
+
+        STARTUP_PHASE("Startup.MainController");
         _impl = std::make_unique<Impl>(std::move(settings));
     }
 
@@ -182,24 +228,41 @@ namespace controller
      * @brief Start the main controller, this function shows the main window
      * and ensures that a profile exists by using the EnsureProfileController,
      * this is typically called after the main controller has been initialized
-     * to start the application and display the UI to the user.
+     * to start the application and display the UI to the user. Once the event
+     * loop runs, a summary of all startup phase timings is logged.
      */
     void MainController::start()
     {
-        _impl->_mainWindow->show();
+        {
+            STARTUP_PHASE("Startup.ShowWindow");
+            _impl->_mainWindow->show();
+        }
 
-        auto controller = controller::EnsureProfileController{
-            _impl->_mainWindow,
-            _impl->_storeContainer,
-            _impl->_undoStack,
-            _impl->_settings
-        };
+        {
+            STARTUP_PHASE("Startup.EnsureProfile");
 
-        controller.ensureProfileExists();
+            auto controller = controller::EnsureProfileController{
+                _impl->_mainWindow,
+                _impl->_storeContainer,
+                _impl->_undoStack,
+                _impl->_settings
+            };
 
-        _impl->_sideBarController.refresh();
+            controller.ensureProfileExists();
+        }
+
+        {
+            STARTUP_PHASE("Startup.SideBar");
+            _impl->_sideBarController.refresh();
+        }
 
         _impl->_vcsController.start();
+
+        // queued behind the deferred controller initializations
+        QTimer::singleShot(
+            0,
+            []() { logging::StartupPhases::getInstance().finish(); }
+        );
     }
 
 }   // namespace controller
\ No newline at end of file
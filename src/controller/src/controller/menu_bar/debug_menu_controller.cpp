@@ -1,19 +1,27 @@
 #include "debug_menu_controller.hpp"
 
+#include <QFileDialog>
 #include <QMainWindow>
 #include <QMenuBar>
 #include <QObject>
 #include <QStatusBar>
+#include <format>
 
 #include "commands/undo_stack.hpp"
 #include "commands/update_debug_flags_command.hpp"
 #include "common/qt_helpers.hpp"
+#include "common/timestamp.hpp"
+#include "config/constants/constants.hpp"
+#include "db/sql_statistics.hpp"
 #include "logging/log_macros.hpp"
 #include "logging/log_manager.hpp"
+#include "logging/tracer.hpp"
 #include "settings/settings.hpp"
 #include "ui/logging/debug_slots_dialog.hpp"
 #include "ui/logging/log_viewer_dialog.hpp"
+#include "ui/logging/sql_statistics_dialog.hpp"
 #include "ui/menu_bar/debug_menu.hpp"
+#include "ui/utils/error.hpp"
 
 REGISTER_LOG_CATEGORY("UI.Controller.DebugMenuController");
 
@@ -53,6 +61,20 @@ namespace controller
             this,
             &DebugMenuController::_onRequestLogViewer
         );
+
+        connect(
+            &debugMenu,
+            &ui::DebugMenu::requestTraceCapture,
+            this,
+            &DebugMenuController::_onRequestTraceCapture
+        );
+
+        connect(
+            &debugMenu,
+            &ui::DebugMenu::requestSqlStatistics,
+            this,
+            &DebugMenuController::_onRequestSqlStatistics
+        );
     }
 
     /**
@@ -129,6 +151,86 @@ namespace controller
             statusBar->showMessage("Log File opened");
     }
 
+    /**
+     * @brief Handle SQL statistics request
+     *
+     */
+    void DebugMenuController::_onRequestSqlStatistics()
+    {
+        _ensureSqlStatisticsDialog();
+        _onRefreshSqlStatistics();
+
+        _sqlStatisticsDialog->show();
+        _sqlStatisticsDialog->raise();
+        _sqlStatisticsDialog->activateWindow();
+
+        auto* statusBar = _mainWindow.statusBar();
+
+        if (statusBar != nullptr)
+            statusBar->showMessage("SQL statistics opened");
+    }
+
+    /**
+     * @brief Reload the SQL statistics shown in the dialog
+     *
+     */
+    void DebugMenuController::_onRefreshSqlStatistics()
+    {
+        _sqlStatisticsDialog->setStatistics(
+            db::SqlStatistics::getInstance().getStatistics()
+        );
+    }
+
+    /**
+     * @brief Discard all recorded SQL statistics
+     *
+     */
+    void DebugMenuController::_onResetSqlStatistics()
+    {
+        db::SqlStatistics::getInstance().clear();
+        _onRefreshSqlStatistics();
+
+        LOG_INFO("SQL statistics reset");
+    }
+
+    /**
+     * @brief Start or stop a performance trace capture, a stopped capture is
+     * saved as Chrome trace-event JSON
+     *
+     * @param enabled Whether to start (true) or stop (false) the capture
+     */
+    void DebugMenuController::_onRequestTraceCapture(bool enabled)
+    {
+        auto& tracer    = logging::Tracer::getInstance();
+        auto* statusBar = _mainWindow.statusBar();
+
+        if (enabled)
+        {
+            tracer.start();
+
+            if (statusBar != nullptr)
+                statusBar->showMessage("Performance trace capture started");
+
+            return;
+        }
+
+        const auto info = tracer.stop();
+
+        if (statusBar != nullptr)
+        {
+            statusBar->showMessage(
+                QString::fromStdString(
+                    std::format(
+                        "Performance trace capture stopped ({} events)",
+                        info.events
+                    )
+                )
+            );
+        }
+
+        _saveTraceCapture();
+    }
+
     /**
      * @brief Ensures that the Debug Slots dialog is created
      *
@@ -178,6 +280,35 @@ namespace controller
         _logViewerDialog->setModal(false);
     }
 
+    /**
+     * @brief Ensures that the SQL statistics dialog is created
+     *
+     */
+    void DebugMenuController::_ensureSqlStatisticsDialog()
+    {
+        if (_sqlStatisticsDialog != nullptr)
+            return;
+
+        _sqlStatisticsDialog =
+            common::makeQChild<ui::SqlStatisticsDialog>(&_mainWindow);
+
+        _sqlStatisticsDialog->setModal(false);
+
+        connect(
+            _sqlStatisticsDialog,
+            &ui::SqlStatisticsDialog::requestRefresh,
+            this,
+            &DebugMenuController::_onRefreshSqlStatistics
+        );
+
+        connect(
+            _sqlStatisticsDialog,
+            &ui::SqlStatisticsDialog::requestReset,
+            this,
+            &DebugMenuController::_onResetSqlStatistics
+        );
+    }
+
     /**
      * @brief Reset debug flags to default values
      *
@@ -253,6 +384,45 @@ namespace controller
         _debugSlotsDialog->accept();
     }
 
+    /**
+     * @brief Prompt for a location and save the last trace capture
+     *
+     */
+    void DebugMenuController::_saveTraceCapture()
+    {
+        const auto path      = Constants::getInstance().getDataPath().string();
+        const auto timestamp = Timestamp().fileSafe();
+        const auto filename =
+            Constants::getFilePrefix() + "_trace_" + timestamp + ".json";
+
+        const QString filePath = QFileDialog::getSaveFileName(
+            &_mainWindow,
+            "Save Performance Trace",
+            QString::fromStdString(path + "/" + filename),
+            "Chrome Trace Files (*.json)"
+        );
+
+        if (filePath.isEmpty())
+        {
+            LOG_INFO("Saving performance trace canceled by user");
+            return;
+        }
+
+        if (!logging::Tracer::getInstance().writeChromeTrace(
+                filePath.toStdString()
+            ))
+        {
+            ui::ErrorDialog::show(
+                std::string{"Performance Trace Error"},
+                std::format(
+                    "Failed to save performance trace to '{}'",
+                    filePath.toStdString()
+                ),
+                &_mainWindow
+            );
+        }
+    }
+
     /**
      * @brief Apply log viewer settings to the dialog
      *
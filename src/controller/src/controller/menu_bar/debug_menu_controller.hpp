@@ -5,6 +5,7 @@
 
 #include "ui/logging/debug_slots_dialog.hpp"
 #include "ui/logging/log_viewer_dialog.hpp"
+#include "ui/logging/sql_statistics_dialog.hpp"
 
 class QMainWindow;   // Forward declaration
 
@@ -55,6 +56,8 @@ namespace controller
         ui::DebugSlotsDialog* _debugSlotsDialog = nullptr;
         /// Pointer to the log viewer dialog
         ui::LogViewerDialog* _logViewerDialog = nullptr;
+        /// Pointer to the SQL statistics dialog
+        ui::SqlStatisticsDialog* _sqlStatisticsDialog = nullptr;
 
        private slots:
         void _onRequestDebugSlots();
@@ -64,6 +67,10 @@ namespace controller
             bool                                persistChanges
         );
         void _onRequestLogViewer();
+        void _onRequestTraceCapture(bool enabled);
+        void _onRequestSqlStatistics();
+        void _onRefreshSqlStatistics();
+        void _onResetSqlStatistics();
 
        public:
         explicit DebugMenuController(
@@ -76,6 +83,7 @@ namespace controller
        private:
         void _ensureDebugSlotsDialog();
         void _ensureLogViewerDialog();
+        void _ensureSqlStatisticsDialog();
         void _resetDefaultDebugFlags();
         void _applyDebugFlagChanges(
             const logging::LogCategories& categories,
@@ -86,6 +94,7 @@ namespace controller
             bool                          persistChanges
         );
         void _applyLogViewerSettings();
+        void _saveTraceCapture();
     };
 
 }   // namespace controller
@@ -3,12 +3,14 @@
 #include <QFuture>
 #include <QTimer>
 #include <QtConcurrent>
+#include <algorithm>
 #include <memory>
 
 #include "connections/connection.hpp"
 #include "finance/price_cache.hpp"
 #include "finance/transaction/transaction_filter.hpp"
 #include "logging/log_macros.hpp"
+#include "logging/startup_phases.hpp"
 #include "store/i_position_store.hpp"
 #include "store/i_stock_store.hpp"
 #include "store/i_transaction_store.hpp"
@@ -36,7 +38,6 @@ namespace controller
           _positionStore(positionStore),
           _transactionStore(transactionStore),
           _stockStore(stockStore),
-          _expectedSymbolCount(0),
           _connections(std::make_unique<Connections>())
     {
         connect(
@@ -54,8 +55,6 @@ namespace controller
             &PositionController::_fetchPrices
         );
 
-        _initTickers();
-
         _connections->add(_transactionStore->subscribeToTransactionAdded(
             [this](const finance::Transactions& transactions)
             {
@@ -65,37 +64,93 @@ namespace controller
             this
         ));
 
+        // newly watched symbols (e.g. of a watchlist quote board) are fetched
+        // right away instead of waiting for the next poll
+        _connections->add(_priceCache->subscribeToWatchedSymbolsAdded(
+            [this]() { _fetchUncachedWatchedPrices(); },
+            this
+        ));
+
         const auto timeInterval = 60'000;   // 1 minute
         _pollTimer->setInterval(timeInterval);
 
-        _fetchPrices();
-        _pollTimer->start();
+        // the open positions and their transactions are loaded once the event
+        // loop runs, so that the window is not blocked by the initial load
+        QTimer::singleShot(
+            0,
+            this,
+            [this]()
+            {
+                STARTUP_PHASE("Controllers.Position.InitTickers");
+
+                _initTickers();
+                _fetchPrices();
+                _pollTimer->start();
+            }
+        );
     }
 
     PositionController::~PositionController() = default;
 
     /**
-     * @brief Fetches the latest price quotes for the tracked tickers and
-     * updates the price cache.
+     * @brief Fetches the latest price quotes for the tracked tickers and the
+     * watched symbols of the price cache and updates the price cache.
      *
      * This function is triggered by a timer and runs asynchronously to avoid
      * blocking the UI. It uses QtConcurrent to fetch the prices in a separate
-     * thread and updates the price cache once the fetch is complete.
+     * thread and updates the price cache once the fetch is complete. Symbols
+     * that are both position tickers and watched are fetched once.
      */
     void PositionController::_fetchPrices()
+    {
+        auto symbols = _priceCache->getWatchedSymbols();
+        symbols.insert(_tickers.begin(), _tickers.end());
+
+        _startFetch(std::move(symbols), _tickers);
+    }
+
+    /**
+     * @brief Fetches the watched symbols that have no cached quote yet, the
+     * other symbols are refreshed by the next poll.
+     *
+     */
+    void PositionController::_fetchUncachedWatchedPrices()
+    {
+        auto symbols = _priceCache->getWatchedSymbols();
+        std::erase_if(
+            symbols,
+            [this](const std::string& symbol)
+            { return _priceCache->get(symbol).has_value(); }
+        );
+
+        _startFetch(std::move(symbols), {});
+    }
+
+    /**
+     * @brief Starts fetching the given symbols in the background, unless a
+     * fetch is already running.
+     *
+     * @param symbols The symbols to fetch
+     * @param requiredSymbols The symbols that must all be fetched for the
+     * result to be applied
+     */
+    void PositionController::_startFetch(
+        std::unordered_set<std::string> symbols,
+        std::unordered_set<std::string> requiredSymbols
+    )
     {
         if (_priceWatcher.isRunning())
             return;   // don't stack concurrent fetches
 
-        if (_tickers.empty())
+        if (symbols.empty())
             return;
 
-        _expectedSymbolCount = _tickers.size();
+        _requiredSymbols = std::move(requiredSymbols);
 
         _priceWatcher.setFuture(
             QtConcurrent::run(
-                [tickers = _tickers]()
-                { return finance::PriceFeedService::fetchBatch(tickers); }
+                [symbols = std::move(symbols)]()
+                { return finance::PriceFeedService::fetchBatch(symbols); }
             )
         );
     }
@@ -108,8 +163,14 @@ namespace controller
     void PositionController::_onPricesFetched()
     {
         const auto result = _priceWatcher.result();
-        // Gate: only update if we got back the full symbol set
-        if (result.size() == _expectedSymbolCount)
+        // Gate: only update if we got back all position tickers
+        const auto complete = std::ranges::all_of(
+            _requiredSymbols,
+            [&result](const std::string& symbol)
+            { return result.contains(symbol); }
+        );
+
+        if (complete && !result.empty())
             _priceCache->update(result);
     }
 
@@ -54,9 +54,10 @@ namespace controller
         /// tickers)
         std::shared_ptr<store::IStockStore> _stockStore;
 
-        /// The expected number of symbols to be fetched in the price update,
-        /// used for gating updates to the price cache
-        std::size_t _expectedSymbolCount;
+        /// The position tickers of the running price fetch, the result is
+        /// only applied to the price cache if it contains all of them, watched
+        /// symbols are best effort
+        std::unordered_set<std::string> _requiredSymbols;
 
         /// Connections object for managing signal-slot connections and ensuring
         /// they are properly cleaned up
@@ -76,6 +77,11 @@ namespace controller
 
        private:
         void _fetchPrices();
+        void _fetchUncachedWatchedPrices();
+        void _startFetch(
+            std::unordered_set<std::string> symbols,
+            std::unordered_set<std::string> requiredSymbols
+        );
         void _onPricesFetched();
         void _collectTickers(const finance::Transactions& transactions);
         void _initTickers();
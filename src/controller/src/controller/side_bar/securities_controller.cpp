@@ -1,9 +1,11 @@
 #include "securities_controller.hpp"
 
+#include <QMetaObject>
 #include <qpushbutton.h>
 #include <qstackedwidget.h>
 
 #include "finance/instrument/stock.hpp"
+#include "finance/ticker_lookup_service.hpp"
 #include "mapper/stock_mapper.hpp"
 #include "store/i_stock_store.hpp"
 #include "ui/securities/stock_info_model.hpp"
@@ -19,21 +21,44 @@ namespace controller
      *
      * @param mainWindow
      * @param stockStore
+     * @param tickerLookupService
      * @param stackedWidget
      */
     SecuritiesSideBarController::SecuritiesSideBarController(
         QMainWindow*                               mainWindow,
         const std::shared_ptr<store::IStockStore>& stockStore,
-        QStackedWidget*                            stackedWidget
+        const std::shared_ptr<finance::TickerLookupService>&
+                        tickerLookupService,
+        QStackedWidget* stackedWidget
     )
         : SideBarCategoryController(new ui::SecuritiesCategory(), mainWindow),
           _stockOverviewWidget(new ui::StockOverviewWidget()),
           _tickerLookupWidget(new ui::TickerLookupWidget()),
           _stockStore(stockStore),
+          _tickerLookupService(tickerLookupService),
           _stackedWidget(stackedWidget)
     {
         _stackedWidget->addWidget(_stockOverviewWidget);
 
+        // lookups finish on the worker thread of the service, the result is
+        // queued to the GUI thread -- destroying the connection waits for a
+        // running notification, so this is never used after it is destroyed
+        _tickerLookupConnection = _tickerLookupService->subscribeToLookup(
+            [this](
+                const std::string&                             ticker,
+                const finance::YFinanceResult<finance::Stock>& result
+            )
+            {
+                QMetaObject::invokeMethod(
+                    this,
+                    [this, ticker, result]()
+                    { _onTickerLookedUp(ticker, result); },
+                    Qt::QueuedConnection
+                );
+            },
+            this
+        );
+
         connect(
             _tickerLookupWidget->getFindButton(),
             &QPushButton::clicked,
@@ -90,25 +115,60 @@ namespace controller
     }
 
     /**
-     * @brief Slot called when the find ticker button is clicked.
+     * @brief Slot called when the find ticker button is clicked, cached
+     * tickers are displayed immediately, all others are looked up in the
+     * background without blocking the GUI.
      *
      */
     void SecuritiesSideBarController::_onFindTickerButtonClicked()
     {
-        const auto ticker = _tickerLookupWidget->getTickerInput();
+        _pendingTicker = finance::TickerLookupService::normalize(
+            _tickerLookupWidget->getTickerInput()
+        );
+        _acceptedQuote = std::nullopt;
+        _tickerLookupWidget->clearResult();
 
-        const auto result = finance::Stock::retrieveTickerInfo(ticker);
+        if (const auto stock = _tickerLookupService->request(_pendingTicker))
+            _displayStock(stock.value());
+    }
+
+    /**
+     * @brief Called on the GUI thread when a ticker lookup has finished,
+     * results of lookups that are no longer displayed are ignored.
+     *
+     * @param ticker The normalized ticker
+     * @param result The lookup result
+     */
+    void SecuritiesSideBarController::_onTickerLookedUp(
+        const std::string&                             ticker,
+        const finance::YFinanceResult<finance::Stock>& result
+    )
+    {
+        if (ticker != _pendingTicker)
+            return;
 
         if (!result)
         {
+            _pendingTicker.clear();
             _tickerLookupWidget->displayError(result.error().toString());
             _acceptedQuote = std::nullopt;
             return;
         }
 
-        _acceptedQuote = result.value();
+        _displayStock(result.value());
+    }
+
+    /**
+     * @brief Displays a looked up stock and remembers it for acceptance
+     *
+     * @param stock
+     */
+    void SecuritiesSideBarController::_displayStock(const finance::Stock& stock)
+    {
+        _pendingTicker.clear();
+        _acceptedQuote = stock;
         _tickerLookupWidget->displayQuote(
-            mapper::StockMapper::toStockInfoDraft(result.value())
+            mapper::StockMapper::toStockInfoDraft(stock)
         );
     }
 
@@ -2,7 +2,12 @@
 #define __CONTROLLER__SRC__CONTROLLER__SIDE_BAR__SECURITIES_CONTROLLER_HPP__
 
 #include <QObject>
+#include <memory>
+#include <optional>
+#include <string>
 
+#include "connections/connection.hpp"
+#include "error/finance_error.hpp"
 #include "finance/instrument/stock.hpp"
 #include "side_bar_category_controller.hpp"
 
@@ -18,6 +23,11 @@ namespace store
     class IStockStore;   // Forward declaration
 }   // namespace store
 
+namespace finance
+{
+    class TickerLookupService;   // Forward declaration
+}   // namespace finance
+
 class QStackedWidget;   // Forward declaration
 class QAction;          // Forward declaration
 
@@ -46,6 +56,13 @@ namespace controller
         /// Reference to the stock store
         std::shared_ptr<store::IStockStore> _stockStore;
 
+        /// Service looking up tickers off the GUI thread
+        std::shared_ptr<finance::TickerLookupService> _tickerLookupService;
+        /// Subscription to finished ticker lookups
+        Connection _tickerLookupConnection;
+        /// Normalized ticker of the lookup the widget is waiting for
+        std::string _pendingTicker;
+
         /// Pointer to the stacked widget
         QStackedWidget* _stackedWidget;
 
@@ -53,7 +70,9 @@ namespace controller
         explicit SecuritiesSideBarController(
             QMainWindow*                               mainWindow,
             const std::shared_ptr<store::IStockStore>& stockStore,
-            QStackedWidget*                            stackedWidget
+            const std::shared_ptr<finance::TickerLookupService>&
+                            tickerLookupService,
+            QStackedWidget* stackedWidget
         );
 
         void refresh() override;
@@ -78,6 +97,12 @@ namespace controller
        private:
         void _onFindTickerButtonClicked();
         void _onAcceptTickerButtonClicked();
+
+        void _onTickerLookedUp(
+            const std::string&                             ticker,
+            const finance::YFinanceResult<finance::Stock>& result
+        );
+        void _displayStock(const finance::Stock& stock);
     };
 
 }   // namespace controller
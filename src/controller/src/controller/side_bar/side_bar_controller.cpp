@@ -29,6 +29,7 @@ namespace controller
      * @param accountController
      * @param transactionController
      * @param positionGateway
+     * @param tickerLookupService
      */
     // TODO(97gamjak): would be probably best to remove dependency on central
     // stack here
@@ -40,7 +41,8 @@ namespace controller
         QStackedWidget*                                  centralStack,
         AccountController&                               accountController,
         TransactionController&                           transactionController,
-        const std::shared_ptr<gateway::PositionGateway>& positionGateway
+        const std::shared_ptr<gateway::PositionGateway>& positionGateway,
+        const std::shared_ptr<finance::TickerLookupService>& tickerLookupService
     )
         : _sideBar(sideBar),
           _centralStack(centralStack),
@@ -53,6 +55,7 @@ namespace controller
           _securitiesSideBarController(
               mainWindow,
               storeContainer.getStockStore(),
+              tickerLookupService,
               centralStack
           ),
           _transactionSideBarController(
@@ -72,7 +72,9 @@ namespace controller
             QStackedWidget*        centralStack,
             AccountController&     accountController,
             TransactionController& transactionController,
-            const std::shared_ptr<gateway::PositionGateway>& positionGateway
+            const std::shared_ptr<gateway::PositionGateway>& positionGateway,
+            const std::shared_ptr<finance::TickerLookupService>&
+                tickerLookupService
         );
 
         void refresh();
@@ -3,6 +3,7 @@
 #include <stdexcept>
 #include <string>
 
+#include "common/container/search_index.hpp"
 #include "common/finance.hpp"
 #include "common/qt_helpers.hpp"
 #include "config/constants/github_constants.hpp"
@@ -67,10 +68,10 @@ namespace controller
         QPointer<ui::OptionWidget> option = nullptr;
 
         Dialogs(
-            const std::vector<drafts::AccountDraft>& cashAccounts,
-            const std::vector<drafts::AccountDraft>& securityAccounts,
-            const Set<std::string>&                  tickers,
-            QMainWindow*                             mainWindow
+            const std::vector<drafts::AccountDraft>&  cashAccounts,
+            const std::vector<drafts::AccountDraft>&  securityAccounts,
+            const std::shared_ptr<const SearchIndex>& tickers,
+            QMainWindow*                              mainWindow
         );
     };
 
@@ -84,10 +85,10 @@ namespace controller
      * @param mainWindow
      */
     TransactionSideBarController::Dialogs::Dialogs(
-        const std::vector<drafts::AccountDraft>& cashAccounts,
-        const std::vector<drafts::AccountDraft>& securityAccounts,
-        const Set<std::string>&                  tickers,
-        QMainWindow*                             mainWindow
+        const std::vector<drafts::AccountDraft>&  cashAccounts,
+        const std::vector<drafts::AccountDraft>&  securityAccounts,
+        const std::shared_ptr<const SearchIndex>& tickers,
+        QMainWindow*                              mainWindow
     )
         : cash(new DepositWithdrawalWidget(
               TransactionType::Deposit,   // dummy type
@@ -145,6 +146,9 @@ namespace controller
           _positionStore(positionStore),
           _stockStore(stockStore),
           _optionStore(optionStore),
+          _tickerIndex(
+              std::make_shared<SearchIndex>(_stockStore->getAllTickers())
+          ),
           _dialogs(nullptr),
           _transactionController(transactionController),
           _stockController(stockController),
@@ -160,7 +164,7 @@ namespace controller
         _dialogs = std::make_unique<Dialogs>(
             cashAccounts,
             securityAccounts,
-            _stockStore->getAllTickers(),
+            _tickerIndex,
             mainWindow
         );
 
@@ -202,8 +206,10 @@ namespace controller
         _connections->add(_stockStore->subscribeToStoreChange(
             [&]()
             {
-                _dialogs->stock->updateTickers(_stockStore->getAllTickers());
-                _dialogs->option->updateTickers(_stockStore->getAllTickers());
+                // only the difference to the indexed tickers is applied
+                _tickerIndex->update(_stockStore->getAllTickers());
+                _dialogs->stock->refreshTickers();
+                _dialogs->option->refreshTickers();
             },
             this
         ));
@@ -266,7 +272,6 @@ namespace controller
                 mapper::AccountMapper::toDrafts(_accountStore->getCashAccounts()
                 )
             );
-            _dialogs->stock->updateTickers(_stockStore->getAllTickers());
             _dialogs->stock->refresh();
 
             _dialogs->stock->show();
@@ -282,7 +287,6 @@ namespace controller
                 mapper::AccountMapper::toDrafts(_accountStore->getCashAccounts()
                 )
             );
-            _dialogs->option->updateTickers(_stockStore->getAllTickers());
             _dialogs->option->refresh();
 
             _dialogs->option->show();
@@ -52,6 +52,7 @@ namespace finance
 
 class QMainWindow;   // Forward declaration
 class Connections;   // Forward declaration
+class SearchIndex;   // Forward declaration
 
 namespace controller
 {
@@ -82,6 +83,9 @@ namespace controller
         /// The option store for the application
         std::shared_ptr<store::IOptionStore> _optionStore;
 
+        /// The ticker search index shared by the ticker fields of the dialogs
+        std::shared_ptr<SearchIndex> _tickerIndex;
+
         struct Dialogs;
         /// Pointer to the dialogs struct
         std::unique_ptr<Dialogs> _dialogs;
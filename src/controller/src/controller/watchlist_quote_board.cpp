@@ -0,0 +1,97 @@
+#include "watchlist_quote_board.hpp"
+
+#include <unordered_map>
+
+#include "connections/connection.hpp"
+#include "finance/price_cache.hpp"
+#include "finance/watchlist.hpp"
+#include "ui/watchlist/watchlist_quote_model.hpp"
+
+namespace controller
+{
+    /**
+     * @brief Construct a new Watchlist Quote Board object
+     *
+     * @param priceCache The price cache providing the quotes
+     * @param model The model showing the quotes, it has to outlive the board
+     */
+    WatchlistQuoteBoard::WatchlistQuoteBoard(
+        std::shared_ptr<finance::PriceCache> priceCache,
+        ui::WatchlistQuoteModel*             model
+    )
+        : _priceCache(std::move(priceCache)),
+          _model(model),
+          _connections(std::make_unique<Connections>())
+    {
+        _connections->add(_priceCache->subscribeToPriceChange(
+            [this]() { _queueCachedQuotes(); },
+            this
+        ));
+    }
+
+    /**
+     * @brief Destroy the Watchlist Quote Board object, the symbols of the
+     * shown watchlist are no longer watched
+     *
+     */
+    WatchlistQuoteBoard::~WatchlistQuoteBoard()
+    {
+        _priceCache->unwatch(_symbols);
+    }
+
+    /**
+     * @brief Shows the quotes of a watchlist, the symbols of the previously
+     * shown watchlist are no longer watched
+     *
+     * @param watchlist
+     */
+    void WatchlistQuoteBoard::setWatchlist(const finance::Watchlist& watchlist)
+    {
+        // watch the new symbols first, so that symbols shared with the
+        // previous watchlist are not dropped in between
+        _priceCache->watch(watchlist.getSymbols());
+        _priceCache->unwatch(_symbols);
+
+        _symbols = watchlist.getSymbols();
+        _model->setSymbols(_symbols);
+
+        _queueCachedQuotes();
+        _model->flush();
+    }
+
+    /**
+     * @brief Clears the board, no symbols are watched afterwards
+     *
+     */
+    void WatchlistQuoteBoard::clear()
+    {
+        _priceCache->unwatch(_symbols);
+        _symbols.clear();
+        _model->setSymbols(_symbols);
+    }
+
+    /**
+     * @brief Queues the cached quotes of all shown symbols in the model, the
+     * cache is read once for the whole batch
+     *
+     */
+    void WatchlistQuoteBoard::_queueCachedQuotes()
+    {
+        if (_symbols.empty())
+            return;
+
+        std::unordered_map<std::string, ui::WatchlistQuote> quotes;
+        for (const auto& [symbol, quote] : _priceCache->get(_symbols))
+        {
+            quotes.emplace(
+                symbol,
+                ui::WatchlistQuote{
+                    quote.getMarketPrice().value_or(quote.getPrice()),
+                    quote.getPrice()
+                }
+            );
+        }
+
+        _model->queueQuotes(quotes);
+    }
+}   // namespace controller
@@ -0,0 +1,63 @@
+#ifndef __CONTROLLER__SRC__CONTROLLER__WATCHLIST_QUOTE_BOARD_HPP__
+#define __CONTROLLER__SRC__CONTROLLER__WATCHLIST_QUOTE_BOARD_HPP__
+
+#include <memory>
+#include <string>
+#include <vector>
+
+class Connections;   // Forward declaration
+
+namespace finance
+{
+    class PriceCache;   // Forward declaration
+    class Watchlist;    // Forward declaration
+}   // namespace finance
+
+namespace ui
+{
+    class WatchlistQuoteModel;   // Forward declaration
+}   // namespace ui
+
+namespace controller
+{
+    /**
+     * @brief Feeds the quote model of a watchlist from the price cache.
+     *
+     * The symbols of the shown watchlist are watched in the price cache, so
+     * that the regular price refresh cycle fetches them. Every cache update
+     * queues the quotes of all symbols in the model in a single batch, the
+     * model coalesces the batches into one repaint per frame.
+     */
+    class WatchlistQuoteBoard
+    {
+       private:
+        /// The price cache providing the quotes
+        std::shared_ptr<finance::PriceCache> _priceCache;
+        /// The model showing the quotes, not owned
+        ui::WatchlistQuoteModel* _model;
+        /// The symbols of the shown watchlist
+        std::vector<std::string> _symbols;
+        /// Connections to the price cache
+        std::unique_ptr<Connections> _connections;
+
+       public:
+        WatchlistQuoteBoard(
+            std::shared_ptr<finance::PriceCache> priceCache,
+            ui::WatchlistQuoteModel*             model
+        );
+        ~WatchlistQuoteBoard();
+
+        WatchlistQuoteBoard(const WatchlistQuoteBoard&)            = delete;
+        WatchlistQuoteBoard& operator=(const WatchlistQuoteBoard&) = delete;
+        WatchlistQuoteBoard(WatchlistQuoteBoard&&)                 = delete;
+        WatchlistQuoteBoard& operator=(WatchlistQuoteBoard&&)      = delete;
+
+        void setWatchlist(const finance::Watchlist& watchlist);
+        void clear();
+
+       private:
+        void _queueCachedQuotes();
+    };
+}   // namespace controller
+
+#endif   // __CONTROLLER__SRC__CONTROLLER__WATCHLIST_QUOTE_BOARD_HPP__
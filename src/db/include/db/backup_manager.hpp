@@ -2,9 +2,15 @@
 #define __DB__INCLUDE__DB__BACKUP_MANAGER_HPP__
 
 #include <cstddef>
+#include <filesystem>
+#include <functional>
+#include <optional>
+#include <stop_token>
 #include <string>
 #include <vector>
 
+struct sqlite3;   // Forward declaration
+
 namespace settings
 {
     class BackupSettings;   // Forward declaration
@@ -16,6 +22,24 @@ namespace db
 {
     class Database;   // Forward declaration
 
+    /**
+     * @brief Progress snapshot of a running backup.
+     *
+     * For page-wise backups both values are SQLite page counts. For compact
+     * (`VACUUM INTO`) backups the total is unknown, therefore only
+     * `totalPages == 0` is reported until the backup is finished.
+     */
+    struct BackupProgress
+    {
+        /// Number of pages still to be copied
+        int remainingPages = 0;
+        /// Total number of pages of the source database
+        int totalPages = 0;
+    };
+
+    /// Callback type used to report backup progress
+    using BackupProgressCallback = std::function<void(const BackupProgress&)>;
+
     /**
      * @brief Manages timestamped SQLite backups with a tiered retention policy.
      *
@@ -25,6 +49,10 @@ namespace db
      *   - Monthly: for each calendar month older than the weekly window, keep
      *              the newest backup from that month (unbounded)
      *
+     * Backups on a worker thread are copied in chunks of
+     * `BackupOptions::pagesPerStep` pages with a short sleep in between, so
+     * that the source database lock is only held for a brief moment at a time.
+     * Synchronous backups copy the whole database in a single step.
      */
     class BackupManager
     {
@@ -41,11 +69,61 @@ namespace db
             std::size_t weeklyCount;
         };
 
+        /**
+         * @brief Plain snapshot of everything needed to run a backup.
+         *
+         * This decouples the backup itself from the settings object, so that
+         * it can safely be handed over to a worker thread.
+         */
+        struct BackupOptions
+        {
+            /// Directory where the backup files are written to
+            std::filesystem::path backupDir;
+            /// Retention policy applied after a successful backup
+            RetentionPolicy policy{};
+            /// Produce a compacted backup via `VACUUM INTO`
+            bool compact = false;
+            /// Number of pages copied per `sqlite3_backup_step` call
+            int pagesPerStep = 64;
+            /// Sleep in milliseconds between two backup steps
+            int stepSleepMs = 5;
+
+            /// Page count copying the whole database in one step
+            static constexpr int ALL_PAGES = -1;
+
+            [[nodiscard]] static BackupOptions fromSettings(
+                const settings::BackupSettings& backupSettings
+            );
+
+            [[nodiscard]] BackupOptions unthrottled() const;
+        };
+
         static void createBackup(
             Database&                       db,
             const settings::BackupSettings& backupSettings
         );
 
+        static std::optional<std::filesystem::path> createBackup(
+            const std::filesystem::path&  sourcePath,
+            const BackupOptions&          options,
+            const std::stop_token&        stopToken  = {},
+            const BackupProgressCallback& onProgress = {}
+        );
+
+        static bool copyDatabase(
+            sqlite3*                      source,
+            const std::filesystem::path&  destPath,
+            const BackupOptions&          options,
+            const std::stop_token&        stopToken  = {},
+            const BackupProgressCallback& onProgress = {}
+        );
+
+        static bool vacuumInto(
+            sqlite3*                     source,
+            const std::filesystem::path& destPath,
+            const std::stop_token&       stopToken = {}
+        );
+
         [[nodiscard]]
         static std::vector<std::string> listBackups(
             const settings::BackupSettings& backupSettings
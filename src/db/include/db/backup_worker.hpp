@@ -0,0 +1,64 @@
+#ifndef __DB__INCLUDE__DB__BACKUP_WORKER_HPP__
+#define __DB__INCLUDE__DB__BACKUP_WORKER_HPP__
+
+#include <atomic>
+#include <filesystem>
+#include <thread>
+
+#include "db/backup_manager.hpp"
+
+namespace db
+{
+    /**
+     * @brief Runs a single database backup on a background thread.
+     *
+     * The worker opens its own read-only connection to the database file and
+     * copies it page-chunk-wise (or via `VACUUM INTO` for compact backups),
+     * so the main connection is never blocked for long. The backup is
+     * cancelled and joined on destruction, which makes it safe to keep the
+     * worker alongside the database it backs up.
+     */
+    class BackupWorker
+    {
+       private:
+        /// Number of pages still to be copied
+        std::atomic<int> _remainingPages{0};
+        /// Total number of pages of the source database
+        std::atomic<int> _totalPages{0};
+        /// Whether the worker has finished (completed, cancelled or failed)
+        std::atomic<bool> _finished{false};
+
+        /// The worker thread running the backup, must be the last member so
+        /// that it is joined before the state above is destroyed
+        std::jthread _thread;
+
+       public:
+        BackupWorker(
+            std::filesystem::path        sourcePath,
+            BackupManager::BackupOptions options,
+            BackupProgressCallback       onProgress = {}
+        );
+        ~BackupWorker();
+
+        BackupWorker(const BackupWorker&)            = delete;
+        BackupWorker& operator=(const BackupWorker&) = delete;
+        BackupWorker(BackupWorker&&)                 = delete;
+        BackupWorker& operator=(BackupWorker&&)      = delete;
+
+        void cancel();
+
+        [[nodiscard]] bool           isFinished() const;
+        [[nodiscard]] BackupProgress getProgress() const;
+
+       private:
+        void _run(
+            const std::stop_token&              stopToken,
+            const std::filesystem::path&        sourcePath,
+            const BackupManager::BackupOptions& options,
+            const BackupProgressCallback&       onProgress
+        );
+    };
+
+}   // namespace db
+
+#endif   // __DB__INCLUDE__DB__BACKUP_WORKER_HPP__
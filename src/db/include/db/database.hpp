@@ -1,12 +1,14 @@
 #ifndef __DB__INCLUDE__DB__DATABASE_HPP__
 #define __DB__INCLUDE__DB__DATABASE_HPP__
 
+#include <cstddef>
 #include <cstdint>
 #include <filesystem>
+#include <memory>
 #include <optional>
 #include <string>
 #include <string_view>
-#include <vector>
+#include <unordered_map>
 
 struct sqlite3;   // Forward declaration
 
@@ -14,6 +16,16 @@ namespace db
 {
     class Statement;   // Forward declaration
 
+    /**
+     * @brief The mode a database connection is opened with
+     *
+     */
+    enum class OpenMode : std::uint8_t
+    {
+        ReadWrite,
+        ReadOnly
+    };
+
     /**
      * @brief A wrapper around an SQLite database connection
      *
@@ -27,15 +39,23 @@ namespace db
         /// The path to the database file
         std::string _dbPath;
 
-        /// Log of executed SQL statements for debugging or auditing purposes
-        std::vector<std::string> _executions;
-
         /// Indicates whether a database transaction is currently active
         bool _transactionStarted = false;
 
+        /// The mode the connection is opened with
+        OpenMode _openMode = OpenMode::ReadWrite;
+
+        /// Prepared statements reused by prepareCached, keyed by their SQL
+        /// text and finalized before the connection is closed
+        std::unordered_map<std::string, std::unique_ptr<Statement>>
+            _statementCache;
+
        public:
         Database() = delete;
-        explicit Database(const std::filesystem::path& dbPath);
+        explicit Database(
+            const std::filesystem::path& dbPath,
+            OpenMode                     openMode = OpenMode::ReadWrite
+        );
 
         ~Database();
 
@@ -49,14 +69,17 @@ namespace db
         void close();
 
         [[nodiscard]] bool     isOpen() const;
+        [[nodiscard]] bool     isReadOnly() const;
         [[nodiscard]] sqlite3* nativeHandle() const;
 
         void execute(std::string_view sql);
 
-        [[nodiscard]] Statement prepare(std::string_view sql);
+        [[nodiscard]] Statement  prepare(std::string_view sql);
+        [[nodiscard]] Statement& prepareCached(const std::string& sql);
 
         [[nodiscard]] std::optional<std::int64_t> getLastInsertRowid() const;
         [[nodiscard]] std::int64_t getNumberOfLastChanges() const;
+        [[nodiscard]] std::size_t  getVariableLimit() const;
 
         void setBusyTimeout(int timeout_milliseconds);
         void enableForeignKeys(bool enabled);
@@ -78,7 +101,10 @@ namespace db
         [[nodiscard]] std::string _sqliteErrorMessage() const;
         void                      _moveFrom(Database&& other);
 
-        [[nodiscard]] static sqlite3* _open(const std::string& path);
+        [[nodiscard]] static sqlite3* _open(
+            const std::string& path,
+            OpenMode           openMode
+        );
     };
 }   // namespace db
 
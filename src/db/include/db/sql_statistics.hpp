@@ -0,0 +1,161 @@
+#ifndef __DB__INCLUDE__DB__SQL_STATISTICS_HPP__
+#define __DB__INCLUDE__DB__SQL_STATISTICS_HPP__
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "common/container/ring_buffer.hpp"
+
+namespace db
+{
+    /**
+     * @brief A single executed SQL statement
+     *
+     */
+    struct SqlExecution
+    {
+        /// The SQL text as it was prepared
+        std::string sql;
+        /// Time spent in sqlite3_step (or sqlite3_exec)
+        std::chrono::nanoseconds duration{0};
+        /// Number of rows returned
+        std::int64_t rows = 0;
+    };
+
+    /**
+     * @brief SQL text of a prepared statement together with its normalized
+     * form
+     *
+     * Computed once when a statement is prepared and shared by all of its
+     * executions, so recording an execution neither normalizes nor copies
+     * the SQL text.
+     */
+    struct SqlKey
+    {
+        /// The SQL text as it was prepared
+        std::string sql;
+        /// The normalized SQL text, see SqlStatistics::normalize
+        std::string normalized;
+    };
+
+    /// Shared, immutable statistics key of a prepared statement
+    using SqlKeyPtr = std::shared_ptr<const SqlKey>;
+
+    /**
+     * @brief Aggregated latency statistics of one normalized SQL statement
+     *
+     */
+    struct SqlStatementStats
+    {
+        /// The normalized SQL text, literals replaced by '?'
+        std::string sql;
+        /// Number of executions
+        std::size_t count = 0;
+        /// Summed execution time
+        std::chrono::nanoseconds totalTime{0};
+        /// Fastest execution
+        std::chrono::nanoseconds minTime{0};
+        /// Slowest execution
+        std::chrono::nanoseconds maxTime{0};
+        /// 95th percentile over the most recent executions
+        std::chrono::nanoseconds p95Time{0};
+        /// Summed number of returned rows
+        std::int64_t rows = 0;
+    };
+
+    /**
+     * @brief Process wide, bounded record of executed SQL statements
+     *
+     * Keeps the last HISTORY_CAPACITY executions in a ring buffer and a
+     * statistics table keyed by the normalized SQL text. The table itself is
+     * capped at MAX_STATEMENTS entries, further distinct statements are
+     * accounted under OTHER_STATEMENTS. All methods are thread safe.
+     */
+    class SqlStatistics
+    {
+       public:
+        /// Number of executions kept in the history
+        static constexpr std::size_t HISTORY_CAPACITY = 1000;
+        /// Number of samples per statement used for the p95 estimate
+        static constexpr std::size_t SAMPLE_CAPACITY = 128;
+        /// Maximum number of distinct statements in the statistics table
+        static constexpr std::size_t MAX_STATEMENTS = 512;
+        /// Key collecting all statements beyond MAX_STATEMENTS
+        static constexpr std::string_view OTHER_STATEMENTS = "<other>";
+
+       private:
+        /**
+         * @brief Running statistics of one normalized statement
+         *
+         */
+        struct Entry
+        {
+            /// Number of executions
+            std::size_t count = 0;
+            /// Summed execution time
+            std::chrono::nanoseconds totalTime{0};
+            /// Fastest execution
+            std::chrono::nanoseconds minTime{std::chrono::nanoseconds::max()};
+            /// Slowest execution
+            std::chrono::nanoseconds maxTime{0};
+            /// Summed number of returned rows
+            std::int64_t rows = 0;
+            /// The most recent execution times
+            RingBuffer<std::chrono::nanoseconds> samples{SAMPLE_CAPACITY};
+        };
+
+        /**
+         * @brief A recorded execution, sharing the key of its statement
+         *
+         */
+        struct Execution
+        {
+            /// Key of the executed statement
+            SqlKeyPtr key;
+            /// Time spent executing the statement
+            std::chrono::nanoseconds duration{0};
+            /// Number of rows returned
+            std::int64_t rows = 0;
+        };
+
+        /// Guards the history and the statistics table
+        mutable std::mutex _mutex;
+        /// The most recent executions
+        RingBuffer<Execution> _history{HISTORY_CAPACITY};
+        /// Statistics keyed by the normalized SQL text
+        std::unordered_map<std::string, Entry> _statements;
+
+        SqlStatistics() = default;
+
+       public:
+        static SqlStatistics& getInstance();
+
+        void record(
+            const SqlKeyPtr&         key,
+            std::chrono::nanoseconds duration,
+            std::int64_t             rows
+        );
+        void record(
+            std::string_view         sql,
+            std::chrono::nanoseconds duration,
+            std::int64_t             rows
+        );
+        void clear();
+
+        [[nodiscard]] std::vector<SqlExecution>      getHistory() const;
+        [[nodiscard]] std::vector<SqlStatementStats> getStatistics() const;
+
+        [[nodiscard]] static std::string normalize(std::string_view sql);
+        [[nodiscard]] static SqlKeyPtr   makeKey(std::string_view sql);
+    };
+
+}   // namespace db
+
+#endif   // __DB__INCLUDE__DB__SQL_STATISTICS_HPP__
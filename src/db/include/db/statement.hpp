@@ -3,13 +3,16 @@
 
 #include <sqlite3.h>
 
+#include <chrono>
 #include <cstdint>
+#include <memory>
 #include <string>
 #include <string_view>
 
 namespace db
 {
     class SqliteError;
+    struct SqlKey;
 
     /**
      * @brief Result of stepping a prepared statement
@@ -48,6 +51,19 @@ namespace db
         /// reporting purposes
         std::string _sqlForErrors;
 
+        /// The SQL text with its normalized form, computed once when the
+        /// statement is prepared and shared with SqlStatistics
+        std::shared_ptr<const SqlKey> _statisticsKey;
+
+        /// Time spent in sqlite3_step since the last reset
+        std::chrono::nanoseconds _stepTime{0};
+
+        /// Number of rows returned since the last reset
+        std::int64_t _rows = 0;
+
+        /// Whether the statement was stepped since the last reset
+        bool _stepped = false;
+
        public:
         Statement() = default;
         Statement(
@@ -89,6 +105,7 @@ namespace db
             int              result
         ) const;
 
+        void _recordExecution();
         void _finalize();
         void _moveFrom(Statement&& other);
     };
@@ -5,9 +5,12 @@
 #include <algorithm>
 #include <cstddef>
 #include <filesystem>
+#include <format>
 #include <map>
 #include <optional>
+#include <ranges>
 #include <set>
+#include <stop_token>
 #include <string>
 #include <vector>
 
@@ -39,10 +42,65 @@ namespace db
                 nullptr
             );
             if (result != SQLITE_OK)
+            {
+                sqlite3_close(handle);
                 throw SqliteError("BackupManager: failed to open dest " + path);
+            }
             return handle;
         }
 
+        /**
+         * @brief Opens a dedicated read-only SQLite connection to the source
+         * database. Using an own connection makes it possible to run the
+         * backup on a worker thread without sharing the main connection.
+         * Caller must close the handle.
+         */
+        sqlite3* _openSource(const std::string& path)
+        {
+            sqlite3*   handle = nullptr;
+            const auto result = sqlite3_open_v2(
+                path.c_str(),
+                &handle,
+                SQLITE_OPEN_READONLY,
+                nullptr
+            );
+            if (result != SQLITE_OK)
+            {
+                sqlite3_close(handle);
+                throw SqliteError(
+                    "BackupManager: failed to open source " + path
+                );
+            }
+
+            sqlite3_busy_timeout(handle, Constants::getDbBusyTimeoutMs());
+            return handle;
+        }
+
+        /**
+         * @brief Build a new timestamped backup file path inside `dir`.
+         */
+        std::filesystem::path _makeDestPath(const std::filesystem::path& dir)
+        {
+            const auto destName = Constants::getFilePrefix() + "_" +
+                                  Timestamp().fileSafe() +
+                                  Constants::getDatabaseFileExtension();
+
+            return dir / destName;
+        }
+
+        /**
+         * @brief SQLite progress handler used to interrupt a running `VACUUM
+         * INTO` as soon as a stop was requested.
+         *
+         * @param data Pointer to the std::stop_token of the backup
+         * @return non-zero to interrupt the running statement
+         */
+        int _interruptOnStop(void* data)
+        {
+            const auto* stopToken = static_cast<const std::stop_token*>(data);
+            return stopToken->stop_requested() ? 1 : 0;
+        }
+
         std::optional<Timestamp> _parseTimestamp(
             const std::filesystem::path& path
         )
@@ -146,14 +204,9 @@ namespace db
          * @return Paths sorted newest first
          */
         std::vector<std::filesystem::path> _listBackups(
-            const settings::BackupSettings& backupSettings
+            const std::filesystem::path& backupDir
         )
         {
-            if (!backupSettings.isBackupEnabled())
-                return {};
-
-            const auto backupDir = backupSettings.getBackupPath();
-
             if (!std::filesystem::exists(backupDir))
                 return {};
 
@@ -221,8 +274,51 @@ namespace db
     }   // namespace
 
     /**
-     * @brief Create a timestamped backup copy using `sqlite3_backup_*` and
-     * then apply the tiered retention policy.
+     * @brief Take a plain snapshot of the backup relevant settings.
+     *
+     * @param backupSettings Settings controlling backup directory and retention
+     * policy
+     * @return BackupOptions
+     */
+    BackupManager::BackupOptions BackupManager::BackupOptions::fromSettings(
+        const settings::BackupSettings& backupSettings
+    )
+    {
+        return BackupOptions{
+            .backupDir = backupSettings.getBackupPath(),
+            .policy =
+                RetentionPolicy{
+                    .recentCount = backupSettings.getRecentCount(),
+                    .weeklyCount = backupSettings.getWeeklyCount()
+                },
+            .compact = backupSettings.isCompactBackup()
+        };
+    }
+
+    /**
+     * @brief Copy of these options copying the whole database in one step
+     * without sleeping.
+     *
+     * Used by the synchronous backups, where the caller waits for the backup
+     * anyway and throttling would only delay it.
+     *
+     * @return BackupOptions
+     */
+    BackupManager::BackupOptions BackupManager::BackupOptions::unthrottled(
+    ) const
+    {
+        auto options         = *this;
+        options.pagesPerStep = ALL_PAGES;
+        options.stepSleepMs  = 0;
+        return options;
+    }
+
+    /**
+     * @brief Create a timestamped backup copy of the open database on the
+     * calling thread and then apply the tiered retention policy.
+     *
+     * This is the synchronous variant, used whenever the backup has to be
+     * finished before the database is modified (e.g. before migrations).
      *
      * @param db        Live, open source database
      * @param backupSettings Settings controlling backup directory and retention
@@ -239,43 +335,253 @@ namespace db
             return;
         }
 
-        const auto dir = backupSettings.getBackupPath();
-        std::filesystem::create_directories(dir);
+        const auto options =
+            BackupOptions::fromSettings(backupSettings).unthrottled();
+        std::filesystem::create_directories(options.backupDir);
 
-        const auto destName = Constants::getFilePrefix() + "_" +
-                              Timestamp().fileSafe() +
-                              Constants::getDatabaseFileExtension();
+        const auto destPath = _makeDestPath(options.backupDir);
 
-        const auto destPath = (dir / destName).string();
+        LOG_INFO("Creating database backup: " + destPath.string());
+
+        if (options.compact)
+            vacuumInto(db.nativeHandle(), destPath);
+        else
+            copyDatabase(db.nativeHandle(), destPath, options);
+
+        LOG_INFO("Backup complete: " + destPath.string());
+
+        _prune(_listBackups(options.backupDir), options.policy);
+    }
+
+    /**
+     * @brief Create a timestamped backup copy of the database file at
+     * `sourcePath` through a dedicated connection and then apply the tiered
+     * retention policy.
+     *
+     * This variant is safe to run on a worker thread. If a stop is requested
+     * the partially written backup file is removed again.
+     *
+     * @param sourcePath Path of the live database file
+     * @param options    Snapshot of the backup options
+     * @param stopToken  Token used to cancel the running backup
+     * @param onProgress Optional callback reporting the backup progress
+     * @return The path of the new backup, std::nullopt if cancelled
+     */
+    std::optional<std::filesystem::path> BackupManager::createBackup(
+        const std::filesystem::path&  sourcePath,
+        const BackupOptions&          options,
+        const std::stop_token&        stopToken,
+        const BackupProgressCallback& onProgress
+    )
+    {
+        std::filesystem::create_directories(options.backupDir);
 
-        LOG_INFO("Creating database backup: " + destPath);
+        const auto destPath = _makeDestPath(options.backupDir);
 
-        sqlite3* destHandle = _openDest(destPath);
+        LOG_INFO("Creating database backup: " + destPath.string());
+
+        sqlite3* sourceHandle = _openSource(sourcePath.string());
+
+        bool completed = false;
+        try
+        {
+            if (options.compact)
+                completed = vacuumInto(sourceHandle, destPath, stopToken);
+            else
+                completed = copyDatabase(
+                    sourceHandle,
+                    destPath,
+                    options,
+                    stopToken,
+                    onProgress
+                );
+        }
+        catch (...)
+        {
+            sqlite3_close(sourceHandle);
+            std::error_code errorCode;
+            std::filesystem::remove(destPath, errorCode);
+            throw;
+        }
+
+        sqlite3_close(sourceHandle);
+
+        if (!completed)
+        {
+            LOG_INFO("Backup cancelled: " + destPath.string());
+            std::error_code errorCode;
+            std::filesystem::remove(destPath, errorCode);
+            return std::nullopt;
+        }
+
+        LOG_INFO("Backup complete: " + destPath.string());
+
+        _prune(_listBackups(options.backupDir), options.policy);
+
+        return destPath;
+    }
+
+    /**
+     * @brief Copy the `main` schema of `source` into a new database file at
+     * `destPath` using `sqlite3_backup_*`.
+     *
+     * The copy is performed in chunks of `options.pagesPerStep` pages with a
+     * `sqlite3_sleep` of `options.stepSleepMs` in between, so that the read
+     * lock on the source is released regularly and writers are never blocked
+     * for long. A non-positive page count copies the whole database in one
+     * step. If the source is modified by another connection in between,
+     * SQLite restarts the backup transparently.
+     *
+     * @param source     Open source database handle
+     * @param destPath   Destination file path
+     * @param options    Backup options (chunk size and sleep)
+     * @param stopToken  Token used to cancel the running backup
+     * @param onProgress Optional callback reporting the backup progress
+     * @return true if the backup completed, false if it was cancelled
+     */
+    bool BackupManager::copyDatabase(
+        sqlite3*                      source,
+        const std::filesystem::path&  destPath,
+        const BackupOptions&          options,
+        const std::stop_token&        stopToken,
+        const BackupProgressCallback& onProgress
+    )
+    {
+        sqlite3* destHandle = _openDest(destPath.string());
 
         sqlite3_backup* backup =
-            sqlite3_backup_init(destHandle, "main", db.nativeHandle(), "main");
+            sqlite3_backup_init(destHandle, "main", source, "main");
 
         if (backup == nullptr)
         {
             sqlite3_close(destHandle);
             throw SqliteError(
-                "BackupManager: sqlite3_backup_init failed for " + destPath
+                "BackupManager: sqlite3_backup_init failed for " +
+                destPath.string()
             );
         }
 
-        sqlite3_backup_step(backup, -1);
+        const auto pagesPerStep = options.pagesPerStep > 0
+                                      ? options.pagesPerStep
+                                      : BackupOptions::ALL_PAGES;
+
+        bool completed = false;
+        int  result    = SQLITE_OK;
+
+        while (!stopToken.stop_requested())
+        {
+            result = sqlite3_backup_step(backup, pagesPerStep);
+
+            if (onProgress)
+            {
+                onProgress(
+                    BackupProgress{
+                        .remainingPages = sqlite3_backup_remaining(backup),
+                        .totalPages     = sqlite3_backup_pagecount(backup)
+                    }
+                );
+            }
+
+            if (result == SQLITE_DONE)
+            {
+                completed = true;
+                break;
+            }
+
+            if (result != SQLITE_OK && result != SQLITE_BUSY &&
+                result != SQLITE_LOCKED)
+                break;
+
+            if (options.stepSleepMs > 0)
+                sqlite3_sleep(options.stepSleepMs);
+        }
+
         sqlite3_backup_finish(backup);
         sqlite3_close(destHandle);
 
-        LOG_INFO("Backup complete: " + destPath);
+        if (!completed && !stopToken.stop_requested())
+        {
+            throw SqliteError(
+                std::format(
+                    "BackupManager: sqlite3_backup_step failed for {}: {}",
+                    destPath.string(),
+                    sqlite3_errstr(result)
+                )
+            );
+        }
 
-        const auto all = _listBackups(backupSettings);
-        _prune(
-            all,
-            BackupManager::RetentionPolicy{
-                .recentCount = backupSettings.getRecentCount(),
-                .weeklyCount = backupSettings.getWeeklyCount()
-            }
+        return completed;
+    }
+
+    /**
+     * @brief Write a compacted copy of `source` to `destPath` via
+     * `VACUUM INTO`.
+     *
+     * Free pages are dropped and the content is defragmented, which makes
+     * these backups smaller than page-wise copies at the cost of holding a
+     * single read transaction for the duration of the vacuum. A stop request
+     * interrupts the statement through a SQLite progress handler.
+     *
+     * @param source    Open source database handle
+     * @param destPath  Destination file path (must not exist yet)
+     * @param stopToken Token used to cancel the running backup
+     * @return true if the backup completed, false if it was cancelled
+     */
+    bool BackupManager::vacuumInto(
+        sqlite3*                     source,
+        const std::filesystem::path& destPath,
+        const std::stop_token&       stopToken
+    )
+    {
+        // the number of virtual machine instructions between two checks of
+        // the stop token
+        constexpr int progressInterval = 1000;
+
+        std::stop_token token = stopToken;
+        sqlite3_progress_handler(
+            source,
+            progressInterval,
+            _interruptOnStop,
+            &token
+        );
+
+        sqlite3_stmt* statement = nullptr;
+        auto          result    = sqlite3_prepare_v2(
+            source,
+            "VACUUM INTO ?1;",
+            -1,
+            &statement,
+            nullptr
+        );
+
+        if (result == SQLITE_OK)
+        {
+            const auto path = destPath.string();
+            sqlite3_bind_text(
+                statement,
+                1,
+                path.c_str(),
+                static_cast<int>(path.size()),
+                SQLITE_TRANSIENT
+            );
+            result = sqlite3_step(statement);
+        }
+
+        sqlite3_finalize(statement);
+        sqlite3_progress_handler(source, 0, nullptr, nullptr);
+
+        if (result == SQLITE_DONE)
+            return true;
+
+        if (result == SQLITE_INTERRUPT && stopToken.stop_requested())
+            return false;
+
+        throw SqliteError(
+            std::format(
+                "BackupManager: VACUUM INTO failed for {}: {}",
+                destPath.string(),
+                sqlite3_errmsg(source)
+            )
         );
     }
 
@@ -291,7 +597,10 @@ namespace db
         const settings::BackupSettings& backupSettings
     )
     {
-        auto backups = _listBackups(backupSettings) |
+        if (!backupSettings.isBackupEnabled())
+            return {};
+
+        auto backups = _listBackups(backupSettings.getBackupPath()) |
                        std::views::transform([](const auto& path)
                                              { return path.string(); });
 
@@ -0,0 +1,122 @@
+#include "db/backup_worker.hpp"
+
+#include <exception>
+#include <utility>
+
+#include "logging/log_macros.hpp"
+
+REGISTER_LOG_CATEGORY("DB.BackupWorker");
+
+namespace db
+{
+    /**
+     * @brief Construct a new BackupWorker and immediately start the backup on
+     * a background thread.
+     *
+     * @param sourcePath Path of the live database file
+     * @param options    Snapshot of the backup options
+     * @param onProgress Optional callback reporting the backup progress, it is
+     * invoked on the worker thread
+     */
+    BackupWorker::BackupWorker(
+        std::filesystem::path        sourcePath,
+        BackupManager::BackupOptions options,
+        BackupProgressCallback       onProgress
+    )
+        : _thread{
+              [this,
+               sourcePath = std::move(sourcePath),
+               options    = std::move(options),
+               onProgress = std::move(onProgress)](std::stop_token stopToken)
+              { _run(stopToken, sourcePath, options, onProgress); }
+          }
+    {
+    }
+
+    /**
+     * @brief Destroy the BackupWorker, cancelling a running backup and waiting
+     * for the worker thread to finish.
+     */
+    BackupWorker::~BackupWorker() { cancel(); }
+
+    /**
+     * @brief Request cancellation of a running backup and wait until the
+     * worker thread has stopped. The partial backup file is removed.
+     */
+    void BackupWorker::cancel()
+    {
+        if (!_thread.joinable())
+            return;
+
+        if (!_finished.load())
+            LOG_INFO("Cancelling running database backup");
+
+        _thread.request_stop();
+        _thread.join();
+    }
+
+    /**
+     * @brief Whether the backup has finished (completed, cancelled or failed)
+     *
+     * @return true if the worker thread is done
+     */
+    bool BackupWorker::isFinished() const { return _finished.load(); }
+
+    /**
+     * @brief Get the latest reported progress of the backup
+     *
+     * @return BackupProgress
+     */
+    BackupProgress BackupWorker::getProgress() const
+    {
+        return BackupProgress{
+            .remainingPages = _remainingPages.load(),
+            .totalPages     = _totalPages.load()
+        };
+    }
+
+    /**
+     * @brief Thread entry point running the backup
+     *
+     * Exceptions never leave the worker thread, a failed backup is only
+     * logged, matching the behaviour of the former synchronous startup backup.
+     */
+    void BackupWorker::_run(
+        const std::stop_token&              stopToken,
+        const std::filesystem::path&        sourcePath,
+        const BackupManager::BackupOptions& options,
+        const BackupProgressCallback&       onProgress
+    )
+    {
+        LOG_TIMED_ENTRY;
+
+        try
+        {
+            const auto progress = [this, &onProgress](const BackupProgress& p)
+            {
+                _remainingPages.store(p.remainingPages);
+                _totalPages.store(p.totalPages);
+
+                if (onProgress)
+                    onProgress(p);
+            };
+
+            BackupManager::createBackup(
+                sourcePath,
+                options,
+                stopToken,
+                progress
+            );
+        }
+        catch (const std::exception& e)
+        {
+            LOG_WARNING(
+                std::string{"Background backup failed (continuing): "} +
+                e.what()
+            );
+        }
+
+        _finished.store(true);
+    }
+
+}   // namespace db
@@ -2,18 +2,22 @@
 
 #include <sqlite3.h>
 
+#include <chrono>
 #include <cstdint>
 #include <filesystem>
 #include <format>
 #include <fstream>
-#include <ranges>
+#include <memory>
 #include <string>
 #include <utility>
 
 #include "config/constants/constants.hpp"
+#include "db/backup_manager.hpp"
 #include "db/db_exception.hpp"
+#include "db/sql_statistics.hpp"
 #include "db/statement.hpp"
 #include "logging/log_macros.hpp"
+#include "logging/tracer.hpp"
 
 REGISTER_LOG_CATEGORY("DB.Database");
 
@@ -22,15 +26,24 @@ namespace db
     /**
      * @brief Construct a new Database:: Database object
      *
+     * A read-only connection never creates a missing database file, it can be
+     * used from a worker thread next to the main connection to read data
+     * concurrently.
+     *
      * @param dbPath
+     * @param openMode
      */
-    Database::Database(const std::filesystem::path& dbPath)
+    Database::Database(
+        const std::filesystem::path& dbPath,
+        OpenMode                     openMode
+    )
+        : _openMode{openMode}
     {
         std::filesystem::path path = dbPath;
         if (!path.is_absolute())
             path = std::filesystem::absolute(path);
 
-        if (!std::filesystem::exists(path))
+        if (_openMode == OpenMode::ReadWrite && !std::filesystem::exists(path))
         {
             LOG_INFO("Database file does not exist at path: " + path.string());
             LOG_INFO("Creating new database file at path: " + path.string());
@@ -115,10 +128,12 @@ namespace db
     {
         _db                 = std::exchange(other._db, nullptr);
         _dbPath             = std::move(other._dbPath);
-        _executions         = std::move(other._executions);
         _transactionStarted = other._transactionStarted;
+        _openMode           = other._openMode;
+        _statementCache     = std::move(other._statementCache);
 
         other._dbPath.clear();
+        other._statementCache.clear();
     }
 
     /**
@@ -137,7 +152,7 @@ namespace db
             );
         }
 
-        _db     = _open(dbPath);
+        _db     = _open(dbPath, _openMode);
         _dbPath = dbPath;
 
         LOG_DEBUG("Opened database at path: " + dbPath);
@@ -152,6 +167,8 @@ namespace db
      */
     void Database::close()
     {
+        _statementCache.clear();
+
         if (_db != nullptr)
         {
             int returnCode = sqlite3_close(_db);
@@ -180,6 +197,14 @@ namespace db
      */
     bool Database::isOpen() const { return _db != nullptr; }
 
+    /**
+     * @brief check if the database connection is read-only
+     *
+     * @return true
+     * @return false
+     */
+    bool Database::isReadOnly() const { return _openMode == OpenMode::ReadOnly; }
+
     /**
      * @brief get the native sqlite3 database handle
      *
@@ -194,10 +219,13 @@ namespace db
      */
     void Database::execute(std::string_view sql)
     {
+        TRACE_SCOPE("DB.Execute");
+
         _ensureOpen();
 
         char* rawError = nullptr;
 
+        const auto start  = std::chrono::steady_clock::now();
         const auto result = sqlite3_exec(
             _db,
             std::string(sql).c_str(),
@@ -228,19 +256,8 @@ namespace db
             throw SqliteError(msg);
         }
 
-        constexpr size_t MAX_EXECUTIONS_HISTORY = 1000;
-        _executions.emplace_back(sql);
-        if (_executions.size() > MAX_EXECUTIONS_HISTORY)
-        {
-            _executions.erase(
-                _executions.begin(),
-                _executions.begin() +
-                    (static_cast<
-                        std::ranges::range_difference_t<decltype(_executions)>>(
-                        _executions.size() - MAX_EXECUTIONS_HISTORY
-                    ))
-            );
-        }
+        SqlStatistics::getInstance()
+            .record(sql, std::chrono::steady_clock::now() - start, 0);
     }
 
     /**
@@ -291,6 +308,8 @@ namespace db
      */
     Statement Database::prepare(std::string_view sql)
     {
+        TRACE_SCOPE("DB.Prepare");
+
         _ensureOpen();
 
         sqlite3_stmt* preparedStatement = nullptr;
@@ -318,6 +337,43 @@ namespace db
         return Statement{_db, preparedStatement, std::string(sql)};
     }
 
+    /**
+     * @brief prepare a SQL statement once per connection and reuse it
+     *
+     * The returned statement is reset, every parameter has to be bound again
+     * before it is stepped. It stays valid until the connection is closed.
+     *
+     * @param sql
+     * @return Statement&
+     */
+    Statement& Database::prepareCached(const std::string& sql)
+    {
+        TRACE_SCOPE("DB.PrepareCached");
+
+        _ensureOpen();
+
+        const auto found = _statementCache.find(sql);
+        if (found == _statementCache.end())
+        {
+            auto statement = std::make_unique<Statement>(prepare(sql));
+            return *_statementCache.emplace(sql, std::move(statement))
+                        .first->second;
+        }
+
+        auto& statement = *found->second;
+        try
+        {
+            statement.reset();
+        }
+        catch (const SqliteError&)
+        {
+            // sqlite3_reset reports the error of a failed previous execution
+            // again, the statement is reset regardless
+        }
+
+        return statement;
+    }
+
     /**
      * @brief get the row ID of the last inserted row
      *
@@ -346,6 +402,20 @@ namespace db
         return static_cast<int64_t>(sqlite3_changes64(_db));
     }
 
+    /**
+     * @brief get the maximum number of host parameters a single statement of
+     * this connection may bind
+     *
+     * @return std::size_t
+     */
+    std::size_t Database::getVariableLimit() const
+    {
+        _ensureOpen();
+
+        const auto limit = sqlite3_limit(_db, SQLITE_LIMIT_VARIABLE_NUMBER, -1);
+        return static_cast<std::size_t>(limit);
+    }
+
     /**
      * @brief set the busy timeout in milliseconds
      *
@@ -399,31 +469,21 @@ namespace db
     }
 
     /**
-     * @brief Create a backup copy of the database
+     * @brief Create a backup copy of the database next to the database file
+     *
+     * The caller waits for the copy, so the whole database is copied in one
+     * step without throttling, see BackupManager::copyDatabase.
      *
      */
     void Database::makeBackup()
     {
         _ensureOpen();
 
-        sqlite3* backupDb = _open(_dbPath + ".bck");
-
-        // Use SQLite's backup API to create a backup copy of the database
-        sqlite3_backup* backup =
-            sqlite3_backup_init(backupDb, "main", _db, "main");
-
-        if (backup == nullptr)
-        {
-            throw SqliteError(
-                "Failed to initialize backup: " + _sqliteErrorMessage()
-            );
-        }
-
-        // Perform the backup
-        sqlite3_backup_step(backup, -1);
-        sqlite3_backup_finish(backup);
-
-        sqlite3_close(backupDb);
+        BackupManager::copyDatabase(
+            _db,
+            _dbPath + ".bck",
+            BackupManager::BackupOptions{}.unthrottled()
+        );
     }
 
     //
@@ -464,18 +524,19 @@ namespace db
      * @brief Open a SQLite database connection
      *
      * @param path The path to the database file
+     * @param openMode Whether to open the connection read-only
      * @return sqlite3* The opened database handle
      */
-    sqlite3* Database::_open(const std::string& path)
+    sqlite3* Database::_open(const std::string& path, OpenMode openMode)
     {
         sqlite3* openedHandle = nullptr;
 
-        const auto result = sqlite3_open_v2(
-            path.c_str(),
-            &openedHandle,
-            SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE,
-            nullptr
-        );
+        const auto flags = openMode == OpenMode::ReadOnly
+                               ? SQLITE_OPEN_READONLY
+                               : SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE;
+
+        const auto result =
+            sqlite3_open_v2(path.c_str(), &openedHandle, flags, nullptr);
 
         if (result != SQLITE_OK)
         {
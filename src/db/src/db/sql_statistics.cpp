@@ -0,0 +1,334 @@
+#include "db/sql_statistics.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <memory>
+#include <ranges>
+#include <string>
+#include <string_view>
+
+namespace db
+{
+    namespace
+    {
+        /**
+         * @brief Whether the character is a decimal digit
+         */
+        bool _isDigit(char character)
+        {
+            return std::isdigit(static_cast<unsigned char>(character)) != 0;
+        }
+
+        /**
+         * @brief Whether the character can be part of an SQL identifier
+         */
+        bool _isIdentifierChar(char character)
+        {
+            return std::isalnum(static_cast<unsigned char>(character)) != 0 ||
+                   character == '_';
+        }
+
+        /**
+         * @brief Remove trailing spaces from the text
+         */
+        void _trimBack(std::string& text)
+        {
+            while (!text.empty() && text.back() == ' ')
+                text.pop_back();
+        }
+
+        /**
+         * @brief Position in front of the spaces preceding end
+         */
+        std::size_t _skipSpacesBack(std::string_view text, std::size_t end)
+        {
+            while (end > 0 && text[end - 1] == ' ')
+                --end;
+
+            return end;
+        }
+
+        /**
+         * @brief Fold a repetition of unit at the end of the text, e.g.
+         * "?, ?" becomes "?" and "(?), (?)" becomes "(?)"
+         *
+         * This keeps IN lists and multi-row VALUES of different lengths in a
+         * single statistics entry. As it is applied after every appended
+         * unit, at most one repetition has to be folded and only the tail of
+         * the text is inspected, so normalizing stays a single pass.
+         */
+        void _foldRepetition(std::string& text, std::string_view unit)
+        {
+            const std::string_view view{text};
+
+            if (!view.ends_with(unit))
+                return;
+
+            auto end = _skipSpacesBack(view, view.size() - unit.size());
+
+            if (end == 0 || view[end - 1] != ',')
+                return;
+
+            end = _skipSpacesBack(view, end - 1);
+
+            if (view.substr(0, end).ends_with(unit))
+                text.resize(end);
+        }
+
+        /**
+         * @brief Compute the 95th percentile of the given samples
+         */
+        std::chrono::nanoseconds _p95(
+            const RingBuffer<std::chrono::nanoseconds>& samples
+        )
+        {
+            if (samples.empty())
+                return std::chrono::nanoseconds{0};
+
+            constexpr std::size_t PERCENTILE = 95;
+            constexpr std::size_t HUNDRED    = 100;
+
+            auto       sorted = samples.toVector();
+            const auto rank   = (sorted.size() - 1) * PERCENTILE / HUNDRED;
+            const auto nth =
+                sorted.begin() + static_cast<std::ptrdiff_t>(rank);
+
+            std::ranges::nth_element(sorted, nth);
+            return *nth;
+        }
+    }   // namespace
+
+    /**
+     * @brief Get the singleton instance
+     *
+     * @return SqlStatistics&
+     */
+    SqlStatistics& SqlStatistics::getInstance()
+    {
+        static SqlStatistics instance;
+        return instance;
+    }
+
+    /**
+     * @brief Record a single execution of a prepared SQL statement
+     *
+     * @param key Key of the statement, see makeKey
+     * @param duration Time spent executing the statement
+     * @param rows Number of rows returned by the statement
+     */
+    void SqlStatistics::record(
+        const SqlKeyPtr&         key,
+        std::chrono::nanoseconds duration,
+        std::int64_t             rows
+    )
+    {
+        const std::lock_guard lock{_mutex};
+
+        _history.push(
+            Execution{.key = key, .duration = duration, .rows = rows}
+        );
+
+        auto iter = _statements.find(key->normalized);
+        if (iter == _statements.end())
+        {
+            if (_statements.size() >= MAX_STATEMENTS)
+                iter = _statements
+                           .try_emplace(std::string{OTHER_STATEMENTS})
+                           .first;
+            else
+                iter = _statements.try_emplace(key->normalized).first;
+        }
+
+        auto& entry      = iter->second;
+        entry.count     += 1;
+        entry.totalTime += duration;
+        entry.minTime    = std::min(entry.minTime, duration);
+        entry.maxTime    = std::max(entry.maxTime, duration);
+        entry.rows      += rows;
+        entry.samples.push(duration);
+    }
+
+    /**
+     * @brief Record a single execution of an unprepared SQL statement
+     *
+     * @param sql The SQL text as it was executed
+     * @param duration Time spent executing the statement
+     * @param rows Number of rows returned by the statement
+     */
+    void SqlStatistics::record(
+        std::string_view         sql,
+        std::chrono::nanoseconds duration,
+        std::int64_t             rows
+    )
+    {
+        record(makeKey(sql), duration, rows);
+    }
+
+    /**
+     * @brief Drop the history and all statistics
+     *
+     */
+    void SqlStatistics::clear()
+    {
+        const std::lock_guard lock{_mutex};
+
+        _history.clear();
+        _statements.clear();
+    }
+
+    /**
+     * @brief Get the most recent executions, the oldest first
+     *
+     * @return std::vector<SqlExecution>
+     */
+    std::vector<SqlExecution> SqlStatistics::getHistory() const
+    {
+        std::vector<SqlExecution> result;
+
+        const std::lock_guard lock{_mutex};
+        result.reserve(_history.size());
+
+        for (const auto& execution : _history)
+        {
+            result.push_back(
+                SqlExecution{
+                    .sql      = execution.key->sql,
+                    .duration = execution.duration,
+                    .rows     = execution.rows
+                }
+            );
+        }
+
+        return result;
+    }
+
+    /**
+     * @brief Get the statistics of all recorded statements, sorted by their
+     * total execution time (slowest first)
+     *
+     * @return std::vector<SqlStatementStats>
+     */
+    std::vector<SqlStatementStats> SqlStatistics::getStatistics() const
+    {
+        std::vector<SqlStatementStats> result;
+
+        {
+            const std::lock_guard lock{_mutex};
+            result.reserve(_statements.size());
+
+            for (const auto& [sql, entry] : _statements)
+            {
+                result.push_back(
+                    SqlStatementStats{
+                        .sql       = sql,
+                        .count     = entry.count,
+                        .totalTime = entry.totalTime,
+                        .minTime   = entry.minTime,
+                        .maxTime   = entry.maxTime,
+                        .p95Time   = _p95(entry.samples),
+                        .rows      = entry.rows
+                    }
+                );
+            }
+        }
+
+        std::ranges::sort(
+            result,
+            std::ranges::greater{},
+            &SqlStatementStats::totalTime
+        );
+
+        return result;
+    }
+
+    /**
+     * @brief Normalize a SQL statement for grouping
+     *
+     * String and numeric literals are replaced by '?', whitespace is
+     * collapsed and repeated placeholders ("?, ?, ?" or "(?), (?)") are
+     * folded into one, so statements differing only in their values or list
+     * lengths share one statistics entry.
+     *
+     * @param sql The SQL text
+     * @return std::string The normalized SQL text
+     */
+    std::string SqlStatistics::normalize(std::string_view sql)
+    {
+        std::string result;
+        result.reserve(sql.size());
+
+        std::size_t pos = 0;
+        while (pos < sql.size())
+        {
+            const char character = sql[pos];
+
+            if (std::isspace(static_cast<unsigned char>(character)) != 0)
+            {
+                if (!result.empty() && result.back() != ' ')
+                    result += ' ';
+                ++pos;
+            }
+            else if (character == '\'')
+            {
+                // skip the string literal, '' is an escaped quote
+                ++pos;
+                while (pos < sql.size())
+                {
+                    if (sql[pos] == '\'' &&
+                        (pos + 1 >= sql.size() || sql[pos + 1] != '\''))
+                        break;
+
+                    pos += sql[pos] == '\'' ? 2U : 1U;
+                }
+                ++pos;
+
+                result += '?';
+                _foldRepetition(result, "?");
+            }
+            else if (_isDigit(character) &&
+                     (result.empty() || !_isIdentifierChar(result.back())))
+            {
+                // numeric placeholders like ?1 are folded into plain '?'
+                const bool isPlaceholder =
+                    !result.empty() && result.back() == '?';
+
+                while (pos < sql.size() &&
+                       (_isDigit(sql[pos]) || sql[pos] == '.'))
+                    ++pos;
+
+                if (!isPlaceholder)
+                {
+                    result += '?';
+                    _foldRepetition(result, "?");
+                }
+            }
+            else
+            {
+                result += character;
+                ++pos;
+
+                if (character == '?')
+                    _foldRepetition(result, "?");
+                else if (character == ')')
+                    _foldRepetition(result, "(?)");
+            }
+        }
+
+        _trimBack(result);
+        return result;
+    }
+
+    /**
+     * @brief Create the statistics key of a SQL statement
+     *
+     * @param sql The SQL text
+     * @return SqlKeyPtr The SQL text together with its normalized form
+     */
+    SqlKeyPtr SqlStatistics::makeKey(std::string_view sql)
+    {
+        return std::make_shared<const SqlKey>(
+            SqlKey{.sql = std::string{sql}, .normalized = normalize(sql)}
+        );
+    }
+
+}   // namespace db
@@ -2,10 +2,13 @@
 
 #include <sqlite3.h>
 
+#include <chrono>
 #include <string>
 #include <utility>
 
 #include "db/db_exception.hpp"
+#include "db/sql_statistics.hpp"
+#include "logging/tracer.hpp"
 
 namespace db
 {
@@ -42,7 +45,10 @@ namespace db
         sqlite3_stmt* statement,
         std::string   sqlForErrors
     )
-        : _db(db), _statement(statement), _sqlForErrors(std::move(sqlForErrors))
+        : _db(db),
+          _statement(statement),
+          _sqlForErrors(std::move(sqlForErrors)),
+          _statisticsKey(SqlStatistics::makeKey(_sqlForErrors))
     {
     }
 
@@ -91,14 +97,26 @@ namespace db
     /**
      * @brief take a step in the execution of the prepared statement
      *
+     * The time spent in sqlite3_step and the returned rows are accumulated
+     * and reported to SqlStatistics once the statement is reset or finalized.
+     *
      * @return StepResult
      */
     StepResult Statement::step()
     {
+        TRACE_SCOPE("DB.Step");
+
         _ensureValid();
 
+        const auto start  = std::chrono::steady_clock::now();
         const auto result = sqlite3_step(_statement);
 
+        _stepTime += std::chrono::steady_clock::now() - start;
+        _stepped   = true;
+
+        if (result == SQLITE_ROW)
+            ++_rows;
+
         if (StepResultMeta::isValid(result))
             return static_cast<StepResult>(result);
 
@@ -128,6 +146,7 @@ namespace db
     void Statement::reset()
     {
         _ensureValid();
+        _recordExecution();
 
         const auto reset_result = sqlite3_reset(_statement);
         if (reset_result != SQLITE_OK)
@@ -333,13 +352,34 @@ namespace db
     {
         _db           = other._db;
         _statement    = other._statement;
-        _sqlForErrors = std::move(other._sqlForErrors);
+        _sqlForErrors  = std::move(other._sqlForErrors);
+        _statisticsKey = std::move(other._statisticsKey);
+        _stepTime      = std::exchange(other._stepTime, {});
+        _rows          = std::exchange(other._rows, 0);
+        _stepped       = std::exchange(other._stepped, false);
 
         other._db        = nullptr;
         other._statement = nullptr;
         other._sqlForErrors.clear();
     }
 
+    /**
+     * @brief report the accumulated step time and rows of the current
+     * execution to SqlStatistics and start a new execution
+     *
+     */
+    void Statement::_recordExecution()
+    {
+        if (!_stepped)
+            return;
+
+        SqlStatistics::getInstance().record(_statisticsKey, _stepTime, _rows);
+
+        _stepTime = {};
+        _rows     = 0;
+        _stepped  = false;
+    }
+
     /**
      * @brief finalize the statement by resetting and finalizing the native
      * sqlite3_stmt handle, and clearing the SQL string for errors
@@ -349,6 +389,7 @@ namespace db
     {
         if (_statement != nullptr)
         {
+            _recordExecution();
             sqlite3_reset(_statement);
             sqlite3_finalize(_statement);
             _statement = nullptr;
@@ -356,6 +397,7 @@ namespace db
 
         _db = nullptr;
         _sqlForErrors.clear();
+        _statisticsKey.reset();
     }
 
 }   // namespace db
@@ -25,6 +25,8 @@
     X(PriceOverflow)               \
     X(UnknownOption)               \
     X(PnlError)                    \
+    X(InvalidStatement)            \
+    X(ImportCancelled)             \
     GENERIC_ERRORS(X)
 
 #define PNL_ERROR_TYPE_LIST(X)  \
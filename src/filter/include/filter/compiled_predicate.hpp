@@ -0,0 +1,114 @@
+#ifndef __FILTER__INCLUDE__FILTER__COMPILED_PREDICATE_HPP__
+#define __FILTER__INCLUDE__FILTER__COMPILED_PREDICATE_HPP__
+
+#include <cstdint>
+#include <mstd/enum.hpp>
+#include <vector>
+
+#include "leaves.hpp"
+#include "predicate.hpp"
+
+namespace filter
+{
+// NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
+#define OP_CODE_LIST(X) \
+    X(True)             \
+    X(IdSet)            \
+    X(StringEqual)      \
+    X(Flag)             \
+    X(Call)             \
+    X(JumpIfFalse)      \
+    X(JumpIfTrue)       \
+    X(Not)
+
+    MSTD_ENUM(OpCode, std::uint8_t, OP_CODE_LIST);
+
+    /**
+     * @brief A single instruction of a compiled predicate program, the operand
+     * is either an index into the leaf table of the opcode or a jump target.
+     *
+     * The leaf opcodes (True, IdSet, StringEqual, Flag, Call) store their
+     * result in the result register, JumpIfFalse/JumpIfTrue implement the
+     * short-circuit of AND/OR and Not negates the result register.
+     */
+    struct Instruction
+    {
+        /// The opcode of the instruction
+        OpCode opCode;
+        /// The leaf index or the jump target
+        std::uint32_t operand = 0;
+    };
+
+    /**
+     * @brief A predicate flattened into a contiguous program.
+     *
+     * The expression tree is emitted in postfix order, operands before their
+     * operator, where AND/OR become conditional jumps over the right operand
+     * so short-circuiting is preserved and a single result register suffices.
+     * Typed leaves (see leaves.hpp) are stored in typed tables and evaluated
+     * without going through std::function, all other leaves are kept as
+     * opaque calls.
+     *
+     * Predicates consisting only of ANDs, by far the most common case in the
+     * stores, skip the program entirely and evaluate the typed tables one
+     * after another, cheapest leaf kind first.
+     *
+     * @tparam T The type of the filtered values.
+     */
+    template <typename T>
+    class CompiledPredicate
+    {
+       private:
+        /// The flattened program
+        std::vector<Instruction> _program;
+
+        /// Typed id-set membership leaves
+        std::vector<IdSetLeaf<T>> _idSetLeaves;
+        /// Typed string equality leaves
+        std::vector<StringEqualLeaf<T>> _stringEqualLeaves;
+        /// Typed state leaves
+        std::vector<FlagLeaf<T>> _flagLeaves;
+        /// Opaque predicate functions
+        std::vector<PredicateFunc<T>> _callLeaves;
+
+        /// Whether the predicate is a pure conjunction of leaves
+        bool _conjunctive = true;
+
+       public:
+        CompiledPredicate();
+
+        [[nodiscard]] static CompiledPredicate compile(
+            const Predicate<T>& predicate
+        );
+
+        [[nodiscard]] bool operator()(const T& value) const;
+
+        [[nodiscard]] bool                            isConjunctive() const;
+        [[nodiscard]] const std::vector<Instruction>& getProgram() const;
+
+       private:
+        void _emit(const Predicate<T>& predicate);
+        void _emitLeaf(const PredicateFunc<T>& func);
+        void _emitJump(
+            const BiNode<PredicateFunc<T>>& node,
+            OpCode                          jumpCode
+        );
+
+        [[nodiscard]] bool _evaluateConjunction(const T& value) const;
+        [[nodiscard]] bool _evaluateProgram(const T& value) const;
+        [[nodiscard]] bool _evaluateLeaf(
+            const Instruction& instruction,
+            const T&           value
+        ) const;
+
+        template <typename Leaves>
+        [[nodiscard]] static bool _allOf(const Leaves& leaves, const T& value);
+    };
+
+}   // namespace filter
+
+#ifndef __FILTER__INCLUDE__FILTER__COMPILED_PREDICATE_TPP__
+#include "compiled_predicate.tpp"
+#endif
+
+#endif   // __FILTER__INCLUDE__FILTER__COMPILED_PREDICATE_HPP__
@@ -0,0 +1,292 @@
+#ifndef __FILTER__INCLUDE__FILTER__COMPILED_PREDICATE_TPP__
+#define __FILTER__INCLUDE__FILTER__COMPILED_PREDICATE_TPP__
+
+#include <algorithm>
+#include <type_traits>
+#include <utility>
+#include <variant>
+
+#include "compiled_predicate.hpp"
+
+namespace filter
+{
+    /**
+     * @brief Construct an empty compiled predicate matching everything
+     *
+     * @tparam T The type of the filtered values.
+     */
+    template <typename T>
+    CompiledPredicate<T>::CompiledPredicate()
+        : _program{Instruction{OpCode::True}}
+    {
+    }
+
+    /**
+     * @brief Compile a predicate expression tree into a flat program
+     *
+     * @tparam T The type of the filtered values.
+     * @param predicate The predicate to compile
+     * @return CompiledPredicate<T>
+     */
+    template <typename T>
+    CompiledPredicate<T> CompiledPredicate<T>::compile(
+        const Predicate<T>& predicate
+    )
+    {
+        CompiledPredicate<T> compiled;
+        compiled._program.clear();
+        compiled._emit(predicate);
+
+        return compiled;
+    }
+
+    /**
+     * @brief Evaluate the compiled predicate against a value
+     *
+     * @tparam T The type of the filtered values.
+     * @param value The value to evaluate
+     * @return true if the value matches the predicate, false otherwise
+     */
+    template <typename T>
+    bool CompiledPredicate<T>::operator()(const T& value) const
+    {
+        if (_conjunctive)
+            return _evaluateConjunction(value);
+
+        return _evaluateProgram(value);
+    }
+
+    /**
+     * @brief Whether the predicate is a pure conjunction and is evaluated via
+     * the typed fast path
+     *
+     * @tparam T The type of the filtered values.
+     * @return true if the predicate only contains ANDs, false otherwise
+     */
+    template <typename T>
+    bool CompiledPredicate<T>::isConjunctive() const
+    {
+        return _conjunctive;
+    }
+
+    /**
+     * @brief Get the flattened program, mainly for testing and debugging
+     *
+     * @tparam T The type of the filtered values.
+     * @return const std::vector<Instruction>&
+     */
+    template <typename T>
+    const std::vector<Instruction>& CompiledPredicate<T>::getProgram() const
+    {
+        return _program;
+    }
+
+    /**
+     * @brief Recursively emit the instructions of a predicate node
+     *
+     * @tparam T The type of the filtered values.
+     * @param predicate The predicate node
+     */
+    template <typename T>
+    void CompiledPredicate<T>::_emit(const Predicate<T>& predicate)
+    {
+        using Func = PredicateFunc<T>;
+
+        std::visit(
+            [this](const auto& node)
+            {
+                using NodeType = std::decay_t<decltype(node)>;
+
+                if constexpr (std::is_same_v<NodeType, EmptyNode<Func>>)
+                {
+                    _program.push_back(Instruction{OpCode::True});
+                }
+                else if constexpr (std::is_same_v<NodeType, Func>)
+                {
+                    _emitLeaf(node);
+                }
+                else if constexpr (std::is_same_v<NodeType, AndNode<Func>>)
+                {
+                    _emitJump(node, OpCode::JumpIfFalse);
+                }
+                else if constexpr (std::is_same_v<NodeType, OrNode<Func>>)
+                {
+                    _conjunctive = false;
+                    _emitJump(node, OpCode::JumpIfTrue);
+                }
+                else
+                {
+                    _conjunctive = false;
+                    _emit(*node.value);
+                    _program.push_back(Instruction{OpCode::Not});
+                }
+            },
+            predicate
+        );
+    }
+
+    /**
+     * @brief Emit a leaf, typed leaves are moved into their typed tables,
+     * everything else is kept as an opaque call
+     *
+     * @tparam T The type of the filtered values.
+     * @param func The leaf function
+     */
+    template <typename T>
+    void CompiledPredicate<T>::_emitLeaf(const PredicateFunc<T>& func)
+    {
+        const auto emit = [this](OpCode opCode, auto& table, auto leaf)
+        {
+            const auto index = static_cast<std::uint32_t>(table.size());
+            table.push_back(std::move(leaf));
+            _program.push_back(Instruction{opCode, index});
+        };
+
+        if (const auto* idSet = func.template target<IdSetLeaf<T>>())
+            emit(OpCode::IdSet, _idSetLeaves, *idSet);
+        else if (const auto* str = func.template target<StringEqualLeaf<T>>())
+            emit(OpCode::StringEqual, _stringEqualLeaves, *str);
+        else if (const auto* flag = func.template target<FlagLeaf<T>>())
+            emit(OpCode::Flag, _flagLeaves, *flag);
+        else
+            emit(OpCode::Call, _callLeaves, func);
+    }
+
+    /**
+     * @brief Emit a binary node as left operand, conditional jump and right
+     * operand, the jump target is patched once the right operand is emitted
+     *
+     * @tparam T The type of the filtered values.
+     * @param node The binary node
+     * @param jumpCode JumpIfFalse for AND, JumpIfTrue for OR
+     */
+    template <typename T>
+    void CompiledPredicate<T>::_emitJump(
+        const BiNode<PredicateFunc<T>>& node,
+        OpCode                          jumpCode
+    )
+    {
+        _emit(*node.left);
+
+        const auto jump = _program.size();
+        _program.push_back(Instruction{jumpCode});
+
+        _emit(*node.right);
+
+        _program[jump].operand = static_cast<std::uint32_t>(_program.size());
+    }
+
+    /**
+     * @brief Typed fast path for pure conjunctions, the opcodes are irrelevant
+     * here, only the leaf tables are evaluated
+     *
+     * @tparam T The type of the filtered values.
+     * @param value The value to evaluate
+     * @return true if all leaves match, false otherwise
+     */
+    template <typename T>
+    bool CompiledPredicate<T>::_evaluateConjunction(const T& value) const
+    {
+        return _allOf(_flagLeaves, value) && _allOf(_idSetLeaves, value) &&
+               _allOf(_stringEqualLeaves, value) &&
+               _allOf(_callLeaves, value);
+    }
+
+    /**
+     * @brief Run the flattened program
+     *
+     * @tparam T The type of the filtered values.
+     * @param value The value to evaluate
+     * @return true if the value matches the predicate, false otherwise
+     */
+    template <typename T>
+    bool CompiledPredicate<T>::_evaluateProgram(const T& value) const
+    {
+        bool result = true;
+
+        for (std::size_t pc = 0; pc < _program.size(); ++pc)
+        {
+            const auto& instruction = _program[pc];
+
+            switch (instruction.opCode)
+            {
+                case OpCode::JumpIfFalse:
+                    if (!result)
+                        pc = instruction.operand - 1;
+                    break;
+                case OpCode::JumpIfTrue:
+                    if (result)
+                        pc = instruction.operand - 1;
+                    break;
+                case OpCode::Not:
+                    result = !result;
+                    break;
+                case OpCode::True:
+                case OpCode::IdSet:
+                case OpCode::StringEqual:
+                case OpCode::Flag:
+                case OpCode::Call:
+                    result = _evaluateLeaf(instruction, value);
+                    break;
+            }
+        }
+
+        return result;
+    }
+
+    /**
+     * @brief Evaluate a single leaf instruction
+     *
+     * @tparam T The type of the filtered values.
+     * @param instruction The leaf instruction
+     * @param value The value to evaluate
+     * @return the result of the leaf
+     */
+    template <typename T>
+    bool CompiledPredicate<T>::_evaluateLeaf(
+        const Instruction& instruction,
+        const T&           value
+    ) const
+    {
+        switch (instruction.opCode)
+        {
+            case OpCode::IdSet:
+                return _idSetLeaves[instruction.operand](value);
+            case OpCode::StringEqual:
+                return _stringEqualLeaves[instruction.operand](value);
+            case OpCode::Flag:
+                return _flagLeaves[instruction.operand](value);
+            case OpCode::Call:
+                return _callLeaves[instruction.operand](value);
+            case OpCode::True:
+            case OpCode::JumpIfFalse:
+            case OpCode::JumpIfTrue:
+            case OpCode::Not:
+                return true;
+        }
+
+        std::unreachable();
+    }
+
+    /**
+     * @brief Check whether all leaves of a typed table match a value
+     *
+     * @tparam T The type of the filtered values.
+     * @tparam Leaves The typed leaf table
+     * @param leaves The leaves
+     * @param value The value to evaluate
+     * @return true if all leaves match, false otherwise
+     */
+    template <typename T>
+    template <typename Leaves>
+    bool CompiledPredicate<T>::_allOf(const Leaves& leaves, const T& value)
+    {
+        return std::ranges::all_of(
+            leaves,
+            [&value](const auto& leaf) { return leaf(value); }
+        );
+    }
+
+}   // namespace filter
+
+#endif   // __FILTER__INCLUDE__FILTER__COMPILED_PREDICATE_TPP__
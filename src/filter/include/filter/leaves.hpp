@@ -0,0 +1,120 @@
+#ifndef __FILTER__INCLUDE__FILTER__LEAVES_HPP__
+#define __FILTER__INCLUDE__FILTER__LEAVES_HPP__
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "predicate.hpp"
+
+namespace filter
+{
+    /**
+     * @brief A sorted, duplicate free list of raw ids shared between all
+     * copies of a predicate, membership is checked via binary search.
+     *
+     */
+    class IdList
+    {
+       private:
+        /// The sorted ids, shared so copying a predicate never copies the ids
+        std::shared_ptr<const std::vector<std::int64_t>> _ids;
+
+       public:
+        IdList();
+        explicit IdList(std::vector<std::int64_t> ids);
+
+        template <typename Range>
+        [[nodiscard]] static IdList fromIds(const Range& ids);
+
+        [[nodiscard]] bool        contains(std::int64_t id) const;
+        [[nodiscard]] bool        empty() const;
+        [[nodiscard]] std::size_t size() const;
+    };
+
+    /**
+     * @brief Typed leaf checking whether any id of a value is contained in an
+     * id list, e.g. "transaction involves one of these accounts".
+     *
+     * @tparam T The type of the filtered values.
+     */
+    template <typename T>
+    struct IdSetLeaf
+    {
+        /// Returns true if any id of the value is contained in the list
+        using AnyOf = bool (*)(const T&, const IdList&);
+
+        /// Projection checking the ids of a value against the list
+        AnyOf anyOf;
+        /// The ids to match
+        IdList ids;
+
+        bool operator()(const T& value) const;
+    };
+
+    /**
+     * @brief Typed leaf comparing a string field of a value for equality,
+     * e.g. "stock has ticker".
+     *
+     * @tparam T The type of the filtered values.
+     */
+    template <typename T>
+    struct StringEqualLeaf
+    {
+        /// Projection returning the compared field
+        using Field = std::string (*)(const T&);
+
+        /// Projection returning the compared field
+        Field field;
+        /// The expected value
+        std::string expected;
+
+        bool operator()(const T& value) const;
+    };
+
+    /**
+     * @brief Typed leaf checking a boolean state of a value, e.g. "position is
+     * open".
+     *
+     * @tparam T The type of the filtered values.
+     */
+    template <typename T>
+    struct FlagLeaf
+    {
+        /// Projection returning the checked state
+        using Flag = bool (*)(const T&);
+
+        /// Projection returning the checked state
+        Flag flag;
+        /// The expected state
+        bool expected = true;
+
+        bool operator()(const T& value) const;
+    };
+
+    template <typename T>
+    Predicate<T> makeIdSetPredicate(
+        typename IdSetLeaf<T>::AnyOf anyOf,
+        IdList                       ids
+    );
+
+    template <typename T>
+    Predicate<T> makeStringEqualPredicate(
+        typename StringEqualLeaf<T>::Field field,
+        std::string                        expected
+    );
+
+    template <typename T>
+    Predicate<T> makeFlagPredicate(
+        typename FlagLeaf<T>::Flag flag,
+        bool                       expected = true
+    );
+
+}   // namespace filter
+
+#ifndef __FILTER__INCLUDE__FILTER__LEAVES_TPP__
+#include "leaves.tpp"
+#endif
+
+#endif   // __FILTER__INCLUDE__FILTER__LEAVES_HPP__
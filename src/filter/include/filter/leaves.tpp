@@ -0,0 +1,167 @@
+#ifndef __FILTER__INCLUDE__FILTER__LEAVES_TPP__
+#define __FILTER__INCLUDE__FILTER__LEAVES_TPP__
+
+#include <algorithm>
+#include <utility>
+
+#include "leaves.hpp"
+
+namespace filter
+{
+    /**
+     * @brief Construct an empty id list
+     *
+     */
+    inline IdList::IdList()
+        : _ids{std::make_shared<const std::vector<std::int64_t>>()}
+    {
+    }
+
+    /**
+     * @brief Construct an id list, the ids are sorted and deduplicated
+     *
+     * @param ids The raw ids
+     */
+    inline IdList::IdList(std::vector<std::int64_t> ids)
+    {
+        std::ranges::sort(ids);
+        const auto [first, last] = std::ranges::unique(ids);
+        ids.erase(first, last);
+
+        _ids = std::make_shared<const std::vector<std::int64_t>>(std::move(ids)
+        );
+    }
+
+    /**
+     * @brief Create an id list from a range of strong ids
+     *
+     * @tparam Range A range of ids providing value()
+     * @param ids The ids
+     * @return IdList
+     */
+    template <typename Range>
+    IdList IdList::fromIds(const Range& ids)
+    {
+        std::vector<std::int64_t> raw;
+        for (const auto& id : ids)
+            raw.push_back(id.value());
+
+        return IdList{std::move(raw)};
+    }
+
+    /**
+     * @brief Check whether the list contains the given id
+     *
+     * @param id The raw id
+     * @return true if the id is contained, false otherwise
+     */
+    inline bool IdList::contains(std::int64_t id) const
+    {
+        return std::ranges::binary_search(*_ids, id);
+    }
+
+    /**
+     * @brief Check whether the list is empty
+     *
+     * @return true if the list is empty, false otherwise
+     */
+    inline bool IdList::empty() const { return _ids->empty(); }
+
+    /**
+     * @brief Get the number of ids in the list
+     *
+     * @return std::size_t
+     */
+    inline std::size_t IdList::size() const { return _ids->size(); }
+
+    /**
+     * @brief Evaluate the leaf against a value
+     *
+     * @tparam T The type of the filtered values.
+     * @param value The value
+     * @return true if any id of the value is contained in the list
+     */
+    template <typename T>
+    bool IdSetLeaf<T>::operator()(const T& value) const
+    {
+        return anyOf(value, ids);
+    }
+
+    /**
+     * @brief Evaluate the leaf against a value
+     *
+     * @tparam T The type of the filtered values.
+     * @param value The value
+     * @return true if the field equals the expected value
+     */
+    template <typename T>
+    bool StringEqualLeaf<T>::operator()(const T& value) const
+    {
+        return field(value) == expected;
+    }
+
+    /**
+     * @brief Evaluate the leaf against a value
+     *
+     * @tparam T The type of the filtered values.
+     * @param value The value
+     * @return true if the state equals the expected state
+     */
+    template <typename T>
+    bool FlagLeaf<T>::operator()(const T& value) const
+    {
+        return flag(value) == expected;
+    }
+
+    /**
+     * @brief Create a predicate with a typed id-set membership leaf
+     *
+     * @tparam T The type of the filtered values.
+     * @param anyOf Projection checking the ids of a value against the list
+     * @param ids The ids to match
+     * @return Predicate<T>
+     */
+    template <typename T>
+    Predicate<T> makeIdSetPredicate(
+        typename IdSetLeaf<T>::AnyOf anyOf,
+        IdList                       ids
+    )
+    {
+        return makePredicate<T>(IdSetLeaf<T>{anyOf, std::move(ids)});
+    }
+
+    /**
+     * @brief Create a predicate with a typed string equality leaf
+     *
+     * @tparam T The type of the filtered values.
+     * @param field Projection returning the compared field
+     * @param expected The expected value
+     * @return Predicate<T>
+     */
+    template <typename T>
+    Predicate<T> makeStringEqualPredicate(
+        typename StringEqualLeaf<T>::Field field,
+        std::string                        expected
+    )
+    {
+        return makePredicate<T>(StringEqualLeaf<T>{field, std::move(expected)}
+        );
+    }
+
+    /**
+     * @brief Create a predicate with a typed state leaf
+     *
+     * @tparam T The type of the filtered values.
+     * @param flag Projection returning the checked state
+     * @param expected The expected state
+     * @return Predicate<T>
+     */
+    template <typename T>
+    Predicate<T> makeFlagPredicate(typename FlagLeaf<T>::Flag flag, bool expected)
+    {
+        return makePredicate<T>(FlagLeaf<T>{flag, expected});
+    }
+
+}   // namespace filter
+
+#endif   // __FILTER__INCLUDE__FILTER__LEAVES_TPP__
@@ -1,6 +1,10 @@
 #ifndef __FINANCE__INCLUDE__FINANCE__ACCOUNT__ACCOUNTS_HPP__
 #define __FINANCE__INCLUDE__FINANCE__ACCOUNT__ACCOUNTS_HPP__
 
+#include <map>
+#include <ranges>
+#include <type_traits>
+
 #include "common/container/id_map.hpp"
 #include "common/container/set.hpp"
 #include "finance/account/account.hpp"
@@ -9,11 +13,44 @@ namespace finance
 {
     /**
      * @brief A collection of financial accounts.
+     *
+     * Next to the accounts the collection keeps an index of the external
+     * account per currency, which is maintained by all mutators below. This
+     * makes resolving the external account of a cash account a constant time
+     * lookup, which matters when whole transaction sets are converted.
      */
     class Accounts : public IdObjectMap<Account>
     {
+       private:
+        /// The base class type
+        using Base = IdObjectMap<Account>;
+
+        /// The external account of each currency, the smallest id wins if a
+        /// currency has more than one external account
+        std::map<Currency, AccountId> _externalAccountIds;
+
        public:
-        using IdObjectMap<Account>::IdObjectMap;
+        Accounts() = default;
+
+        // NOLINTBEGIN(google-explicit-constructor, hicpp-explicit-conversions)
+        template <std::ranges::range R>
+        requires(!std::same_as<std::remove_cvref_t<R>, Accounts>)
+        Accounts(R&& accounts);
+        // NOLINTEND(google-explicit-constructor, hicpp-explicit-conversions)
+
+        [[nodiscard]] bool add(const Account& account);
+        void               addUnchecked(const Account& account);
+        template <std::ranges::range R>
+        void addUnchecked(R&& accounts);
+        template <std::ranges::range R>
+        void setUnchecked(R&& accounts);
+
+        [[nodiscard]] bool remove(const AccountId& id);
+        void               removeUnchecked(const AccountId& id);
+        template <std::ranges::range R>
+        void removeUnchecked(const R& ids);
+
+        void clear();
 
         [[nodiscard]]
         Accounts filterExternal(bool external) const;
@@ -27,7 +64,15 @@ namespace finance
         AccountId getCorrespondingExternalAccountId(
             const AccountId& cashAccountId
         ) const;
+
+       private:
+        void _indexAccount(const Account& account);
+        void _rebuildIndex();
     };
 }   // namespace finance
 
+#ifndef __FINANCE__INCLUDE__FINANCE__ACCOUNT__ACCOUNTS_TPP__
+#include "accounts.tpp"
+#endif
+
 #endif   // __FINANCE__INCLUDE__FINANCE__ACCOUNT__ACCOUNTS_HPP__
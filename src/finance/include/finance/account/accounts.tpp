@@ -0,0 +1,73 @@
+#ifndef __FINANCE__INCLUDE__FINANCE__ACCOUNT__ACCOUNTS_TPP__
+#define __FINANCE__INCLUDE__FINANCE__ACCOUNT__ACCOUNTS_TPP__
+
+#include "accounts.hpp"
+
+namespace finance
+{
+    /**
+     * @brief Construct a new Accounts object from a range of accounts
+     *
+     * @tparam R A range of accounts
+     * @param accounts The accounts to add
+     */
+    template <std::ranges::range R>
+    requires(!std::same_as<std::remove_cvref_t<R>, Accounts>)
+    Accounts::Accounts(R&& accounts)
+    {
+        addUnchecked(std::forward<R>(accounts));
+    }
+
+    /**
+     * @brief Add a range of accounts without checking for duplicates
+     *
+     * @tparam R A range of accounts
+     * @param accounts The accounts to add
+     */
+    template <std::ranges::range R>
+    void Accounts::addUnchecked(R&& accounts)
+    {
+        if constexpr (std::derived_from<
+                          std::remove_cvref_t<R>,
+                          IdObjectMap<Account>>)
+        {
+            for (const auto& [id, account] : accounts)
+                addUnchecked(account);
+        }
+        else
+        {
+            for (const auto& account : std::forward<R>(accounts))
+                addUnchecked(account);
+        }
+    }
+
+    /**
+     * @brief Set the accounts of the collection, see addUnchecked
+     *
+     * @tparam R A range of accounts
+     * @param accounts The accounts to add
+     */
+    template <std::ranges::range R>
+    void Accounts::setUnchecked(R&& accounts)
+    {
+        addUnchecked(std::forward<R>(accounts));
+    }
+
+    /**
+     * @brief Remove a range of accounts without checking if they exist
+     *
+     * The external account index is rebuilt once after all removals.
+     *
+     * @tparam R A range of account ids
+     * @param ids The ids of the accounts to remove
+     */
+    template <std::ranges::range R>
+    void Accounts::removeUnchecked(const R& ids)
+    {
+        Base::removeUnchecked(ids);
+        _rebuildIndex();
+    }
+
+}   // namespace finance
+
+#endif   // __FINANCE__INCLUDE__FINANCE__ACCOUNT__ACCOUNTS_TPP__
@@ -0,0 +1,187 @@
+#ifndef __FINANCE__INCLUDE__FINANCE__FX_RATE_CACHE_HPP__
+#define __FINANCE__INCLUDE__FINANCE__FX_RATE_CACHE_HPP__
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <nlohmann/json.hpp>
+#include <optional>
+#include <shared_mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "common/cash.hpp"
+#include "common/finance.hpp"
+#include "connections/observable.hpp"
+
+namespace settings
+{
+    class SettingsWriter;   // Forward declaration
+}   // namespace settings
+
+namespace finance
+{
+    /**
+     * @brief Event triggered when at least one exchange rate of the
+     * FxRateCache changed, carries the currencies with a changed conversion.
+     *
+     */
+    struct OnFxRatesUpdated
+    {
+        /// Callback function type for exchange rate updates.
+        using func =
+            std::function<void(const std::vector<Currency>& currencies)>;
+    };
+
+    /**
+     * @brief An exchange rate, one unit of the source currency is worth rate
+     * units of the target currency.
+     *
+     */
+    struct FxRate
+    {
+        /// Clock used for the fetch time of a rate
+        using Clock = std::chrono::system_clock;
+
+        /// The source currency
+        Currency from = Currency::Unknown;
+        /// The target currency
+        Currency to = Currency::Unknown;
+        /// Units of the target currency per unit of the source currency
+        double rate = 0.0;
+        /// Time point of the fetch
+        Clock::time_point fetchedAt{};
+    };
+
+    /**
+     * @brief Dense snapshot of the conversion rates between all currencies.
+     *
+     * The matrix is a plain value, so it can be handed to aggregations that
+     * convert many amounts without touching the FxRateCache lock again.
+     * Missing rates are stored as NaN.
+     */
+    class ConversionMatrix
+    {
+       private:
+        /// Number of currencies
+        static constexpr std::size_t N = CurrencyMeta::size;
+
+        /// Rates indexed by [from * N + to]
+        std::array<double, N * N> _rates{};
+
+       public:
+        ConversionMatrix();
+
+        void set(Currency from, Currency to, double rate);
+
+        [[nodiscard]] std::optional<double> rate(
+            Currency from,
+            Currency to
+        ) const;
+
+        [[nodiscard]] std::optional<Cash> convert(
+            const Cash& amount,
+            Currency    to
+        ) const;
+
+        [[nodiscard]] static Cash convert(
+            const Cash& amount,
+            Currency    to,
+            double      rate
+        );
+
+        [[nodiscard]] std::vector<Currency> getChangedCurrencies(
+            const ConversionMatrix& previous
+        ) const;
+
+       private:
+        [[nodiscard]] static std::size_t _index(Currency from, Currency to);
+    };
+
+    /**
+     * @brief Caches exchange rates between currencies.
+     *
+     * Rates are keyed by their Yahoo Finance currency pair symbol (e.g.
+     * "EURUSD=X") and persisted to a JSON file, so that a portfolio total can
+     * be shown right after startup, before the first quotes arrived. Rates
+     * that are not cached directly are derived from their inverse or crossed
+     * over a third currency.
+     *
+     * The conversion matrix is rebuilt once per changed update and cached.
+     * The file is written by a settings::SettingsWriter on its own thread,
+     * so an update on the UI thread never waits for the disk and updates in
+     * quick succession are coalesced into one write.
+     */
+    class FxRateCache : public Observable<OnFxRatesUpdated>
+    {
+       private:
+        /// Mutex for synchronizing access to the rates.
+        mutable std::shared_mutex _mutex;
+        /// Mutex serializing the snapshots handed to the writer, always
+        /// locked before _mutex
+        mutable std::mutex _fileMutex;
+
+        /// Cached rates by their pair symbol
+        std::unordered_map<std::string, FxRate> _rates;
+        /// All conversions derived from the cached rates
+        ConversionMatrix _matrix;
+
+        /// The JSON file the rates are persisted to
+        std::filesystem::path _path;
+        /// Writes the persisted rates in the background, null if the rates
+        /// are kept in memory only
+        std::unique_ptr<settings::SettingsWriter> _writer;
+
+       public:
+        explicit FxRateCache(std::filesystem::path path = {});
+        ~FxRateCache();
+
+        FxRateCache(const FxRateCache&)            = delete;
+        FxRateCache& operator=(const FxRateCache&) = delete;
+        FxRateCache(FxRateCache&&)                 = delete;
+        FxRateCache& operator=(FxRateCache&&)      = delete;
+
+        bool update(const std::vector<FxRate>& rates);
+
+        [[nodiscard]] std::optional<FxRate> get(
+            Currency from,
+            Currency to
+        ) const;
+
+        [[nodiscard]] std::optional<double> getRate(
+            Currency from,
+            Currency to
+        ) const;
+
+        [[nodiscard]] ConversionMatrix getMatrix() const;
+
+        [[nodiscard]]
+        Connection subscribeToRatesUpdated(
+            OnFxRatesUpdated::func callback,
+            void*                  user
+        );
+
+        [[nodiscard]] static std::string pairSymbol(
+            Currency from,
+            Currency to
+        );
+
+        [[nodiscard]] static std::optional<std::pair<Currency, Currency>>
+        parsePairSymbol(const std::string& symbol);
+
+       private:
+        void _load();
+        void _save() const;
+
+        [[nodiscard]] ConversionMatrix _buildMatrix() const;
+        [[nodiscard]] nlohmann::json   _toJson() const;
+    };
+
+}   // namespace finance
+
+#endif   // __FINANCE__INCLUDE__FINANCE__FX_RATE_CACHE_HPP__
@@ -0,0 +1,69 @@
+#ifndef __FINANCE__INCLUDE__FINANCE__FX_RATE_SOURCE_HPP__
+#define __FINANCE__INCLUDE__FINANCE__FX_RATE_SOURCE_HPP__
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "common/finance.hpp"
+#include "connections/connection.hpp"
+#include "finance/fx_rate_cache.hpp"
+#include "finance/price_quote.hpp"
+
+namespace finance
+{
+    class PriceCache;   // Forward declaration
+
+    /**
+     * @brief Feeds the FxRateCache from Yahoo Finance currency pair quotes.
+     *
+     * The pairs of every known currency against a pivot currency (e.g.
+     * "EURUSD=X") are watched in the PriceCache, so that they are fetched by
+     * the regular price refresh cycle together with the position tickers.
+     * Whenever the PriceCache is updated, the pair quotes are copied into the
+     * FxRateCache, which derives all other conversions from them.
+     */
+    class FxRateSource
+    {
+       private:
+        /// The price cache the pair quotes are fetched into
+        std::shared_ptr<PriceCache> _priceCache;
+        /// The rate cache fed by this source
+        std::shared_ptr<FxRateCache> _fxRateCache;
+
+        /// The watched pair symbols
+        std::vector<std::string> _pairSymbols;
+
+        /// Subscription to the price updates of the price cache
+        Connection _priceConnection;
+
+       public:
+        FxRateSource(
+            std::shared_ptr<PriceCache>  priceCache,
+            std::shared_ptr<FxRateCache> fxRateCache,
+            Currency                     pivot = Currency::USD
+        );
+        ~FxRateSource();
+
+        FxRateSource(const FxRateSource&)            = delete;
+        FxRateSource& operator=(const FxRateSource&) = delete;
+        FxRateSource(FxRateSource&&)                 = delete;
+        FxRateSource& operator=(FxRateSource&&)      = delete;
+
+        void refresh();
+
+        [[nodiscard]] const std::vector<std::string>& getPairSymbols() const;
+
+        [[nodiscard]] static std::vector<std::string> pairSymbols(
+            Currency pivot
+        );
+
+        [[nodiscard]] static std::vector<FxRate> toRates(
+            const std::unordered_map<std::string, PriceQuote>& quotes
+        );
+    };
+
+}   // namespace finance
+
+#endif   // __FINANCE__INCLUDE__FINANCE__FX_RATE_SOURCE_HPP__
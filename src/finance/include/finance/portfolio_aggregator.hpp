@@ -0,0 +1,103 @@
+#ifndef __FINANCE__INCLUDE__FINANCE__PORTFOLIO_AGGREGATOR_HPP__
+#define __FINANCE__INCLUDE__FINANCE__PORTFOLIO_AGGREGATOR_HPP__
+
+#include <array>
+#include <cstddef>
+#include <optional>
+#include <vector>
+
+#include "common/cash.hpp"
+#include "common/container/id_map.hpp"
+#include "common/finance.hpp"
+#include "config/id_types.hpp"
+#include "finance/fx_rate_cache.hpp"
+
+namespace finance
+{
+    /**
+     * @brief Aggregates position values and account balances of different
+     * currencies into a single total in a base currency.
+     *
+     * Position values and balances are summed up exactly per currency, each
+     * per-currency subtotal is converted once with the cached rate of its
+     * currency. Changing a single value therefore only reconverts the
+     * subtotals of its currency, and an exchange rate update only reconverts
+     * the currencies reported by OnFxRatesUpdated whose rate to the base
+     * currency actually changed.
+     */
+    class PortfolioAggregator
+    {
+       private:
+        /// Number of currencies
+        static constexpr std::size_t N = CurrencyMeta::size;
+
+        /// The aggregated amounts of a single currency
+        struct Bucket
+        {
+            /// Exact sum of all position values in the native currency
+            micro_units positions = 0;
+            /// Exact sum of all balances in the native currency
+            micro_units balances = 0;
+            /// The position sum converted into the base currency
+            micro_units convertedPositions = 0;
+            /// The balance sum converted into the base currency
+            micro_units convertedBalances = 0;
+            /// Rate to the base currency, std::nullopt if unknown
+            std::optional<double> rate;
+            /// Number of values and balances in the bucket
+            std::size_t count = 0;
+        };
+
+        /// The currency the total is expressed in
+        Currency _baseCurrency;
+
+        /// Position values by position id
+        IdMap<PositionId, Cash> _positionValues;
+        /// Account balances by account id
+        IdMap<AccountId, Cash> _balances;
+
+        /// Aggregated amounts indexed by currency
+        std::array<Bucket, N> _buckets{};
+
+       public:
+        explicit PortfolioAggregator(Currency baseCurrency);
+
+        void setPositionValue(PositionId id, const Cash& value);
+        bool removePosition(PositionId id);
+
+        void setBalance(AccountId id, const Cash& balance);
+        bool removeBalance(AccountId id);
+
+        void clear();
+
+        std::size_t updateRates(const ConversionMatrix& matrix);
+        std::size_t updateRates(
+            const ConversionMatrix&      matrix,
+            const std::vector<Currency>& currencies
+        );
+
+        [[nodiscard]] Currency getBaseCurrency() const;
+        [[nodiscard]] Cash     getTotal() const;
+        [[nodiscard]] Cash     getPositionsTotal() const;
+        [[nodiscard]] Cash     getBalancesTotal() const;
+        [[nodiscard]] Cash     getPositionSubtotal(Currency currency) const;
+        [[nodiscard]] Cash     getBalanceSubtotal(Currency currency) const;
+        [[nodiscard]] std::optional<Cash> getSubtotal(Currency currency) const;
+        [[nodiscard]] std::optional<Cash> getConvertedPositionValue(
+            PositionId id
+        ) const;
+        [[nodiscard]] std::vector<Currency> getUnconvertedCurrencies() const;
+
+       private:
+        void _add(const Cash& amount, micro_units Bucket::* sum);
+        void _subtract(const Cash& amount, micro_units Bucket::* sum);
+        bool _updateRate(const ConversionMatrix& matrix, Currency currency);
+        void _reconvert(Bucket& bucket, Currency currency) const;
+
+        [[nodiscard]] Bucket&       _bucket(Currency currency);
+        [[nodiscard]] const Bucket& _bucket(Currency currency) const;
+    };
+
+}   // namespace finance
+
+#endif   // __FINANCE__INCLUDE__FINANCE__PORTFOLIO_AGGREGATOR_HPP__
@@ -1,23 +1,44 @@
 #ifndef __FINANCE__INCLUDE__FINANCE__PREDICATES__PREDICATES_TPP__
 #define __FINANCE__INCLUDE__FINANCE__PREDICATES__PREDICATES_TPP__
 
+#include "filter/leaves.hpp"
 #include "predicates.hpp"
 
 namespace finance
 {
+    namespace details
+    {
+        /**
+         * @brief Check whether the instrument id of an item is contained in an
+         * id list
+         *
+         * @tparam T
+         * @param item
+         * @param ids
+         * @return true if the instrument id is contained, false otherwise
+         */
+        template <HasInstrumentIdConcept T>
+        bool hasAnyInstrumentId(const T& item, const filter::IdList& ids)
+        {
+            return ids.contains(item.getInstrumentId().value());
+        }
+    }   // namespace details
+
     template <HasInstrumentIdConcept T>
     filter::Predicate<T> HasInstrumentId(InstrumentId id)
     {
-        return filter::Predicate<T>([id](const T& item)
-                                    { return item.getInstrumentId() == id; });
+        return filter::makeIdSetPredicate<T>(
+            &details::hasAnyInstrumentId<T>,
+            filter::IdList{{id.value()}}
+        );
     }
 
     template <HasInstrumentIdConcept T>
     filter::Predicate<T> HasInstrumentIds(const IdSet<InstrumentId>& ids)
     {
-        return filter::Predicate<T>(
-            [ids](const T& item)
-            { return ids.contains(item.getInstrumentId()); }
+        return filter::makeIdSetPredicate<T>(
+            &details::hasAnyInstrumentId<T>,
+            filter::IdList::fromIds(ids)
         );
     }
 
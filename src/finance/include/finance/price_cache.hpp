@@ -6,6 +6,7 @@
 #include <string>
 #include <unordered_map>
 #include <unordered_set>
+#include <vector>
 
 #include "connections/observable.hpp"
 #include "price_quote.hpp"
@@ -22,11 +23,28 @@ namespace finance
         using func = std::function<void()>;
     };
 
+    /**
+     * @brief Event triggered when symbols are watched that were not watched
+     * before.
+     *
+     */
+    struct OnWatchedSymbolsAdded
+    {
+        /// Callback function type for newly watched symbols.
+        using func = std::function<void()>;
+    };
+
     /**
      * @brief Caches price quotes for financial instruments.
      *
+     * Besides the tickers of the open positions, clients (e.g. watchlist
+     * quote boards) can watch additional symbols, the price refresh cycle
+     * fetches all watched symbols together with the position tickers.
+     * Watching is reference counted, a symbol stays watched until every
+     * client unwatched it.
      */
-    class PriceCache : public Observable<OnPriceUpdated>
+    class PriceCache
+        : public Observable<OnPriceUpdated, OnWatchedSymbolsAdded>
     {
        private:
         /// Mutex for synchronizing access to the cache.
@@ -39,6 +57,9 @@ namespace finance
         /// gate updates until all expected quotes are received.
         std::unordered_set<std::string> _tickersNotYetFetched;
 
+        /// Number of clients watching each symbol.
+        std::unordered_map<std::string, std::size_t> _watchedSymbols;
+
        public:
         void update(const std::unordered_map<std::string, PriceQuote>& quotes);
 
@@ -47,13 +68,30 @@ namespace finance
         [[nodiscard]]
         std::optional<PriceQuote> get(const std::string& yahooSymbol) const;
 
+        [[nodiscard]]
+        std::unordered_map<std::string, PriceQuote> get(
+            const std::vector<std::string>& yahooSymbols
+        ) const;
+
         void clear();
 
+        void watch(const std::vector<std::string>& yahooSymbols);
+        void unwatch(const std::vector<std::string>& yahooSymbols);
+
+        [[nodiscard]]
+        std::unordered_set<std::string> getWatchedSymbols() const;
+
         [[nodiscard]]
         Connection subscribeToPriceChange(
             OnPriceUpdated::func callback,
             void*                user
         );
+
+        [[nodiscard]]
+        Connection subscribeToWatchedSymbolsAdded(
+            OnWatchedSymbolsAdded::func callback,
+            void*                       user
+        );
     };
 
     /**
@@ -2,6 +2,7 @@
 #define __FINANCE__INCLUDE__FINANCE__PRICE_QUOTE_HPP__
 
 #include <nlohmann/json.hpp>
+#include <optional>
 
 #include "common/cash.hpp"
 #include "common/timestamp.hpp"
@@ -22,14 +23,25 @@ namespace finance
         /// The timestamp of the price quote.
         Timestamp _timestamp;
 
+        /// The current market price, the change against the price is the
+        /// intraday change.
+        std::optional<Cash> _marketPrice;
+
        public:
-        PriceQuote(Cash price, Timestamp timestamp);
+        PriceQuote(
+            Cash                price,
+            Timestamp           timestamp,
+            std::optional<Cash> marketPrice = std::nullopt
+        );
 
         [[nodiscard]]
         static FinanceResult<PriceQuote> fromJson(const nlohmann::json& json);
 
         [[nodiscard]]
         const Cash& getPrice() const;
+
+        [[nodiscard]]
+        const std::optional<Cash>& getMarketPrice() const;
     };
 }   // namespace finance
 
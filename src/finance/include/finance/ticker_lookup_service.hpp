@@ -0,0 +1,158 @@
+#ifndef __FINANCE__INCLUDE__FINANCE__TICKER_LOOKUP_SERVICE_HPP__
+#define __FINANCE__INCLUDE__FINANCE__TICKER_LOOKUP_SERVICE_HPP__
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <filesystem>
+#include <functional>
+#include <mutex>
+#include <nlohmann/json.hpp>
+#include <optional>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+
+#include "connections/observable.hpp"
+#include "error/finance_error.hpp"
+#include "finance/instrument/stock.hpp"
+
+namespace finance
+{
+    /**
+     * @brief Event triggered when a ticker lookup has finished, the callback
+     * is invoked on the worker thread of the TickerLookupService.
+     *
+     */
+    struct OnTickerLookedUp
+    {
+        /// Callback function type for finished ticker lookups.
+        using func = std::function<void(
+            const std::string&           ticker,
+            const YFinanceResult<Stock>& result
+        )>;
+    };
+
+    /**
+     * @brief Looks up the metadata of ticker symbols off the calling thread.
+     *
+     * Successful lookups are cached for a limited time and persisted to a JSON
+     * file, so repeated lookups of the same symbol are answered without a
+     * network round trip, also across application restarts. Concurrent
+     * requests for a symbol that is already being fetched are coalesced into
+     * a single fetch. Failed lookups are reported but never cached.
+     *
+     * Symbols are case-insensitive, they are normalized to upper case.
+     *
+     * Subscriptions are connected and disconnected under the same mutex the
+     * worker notifies under, so a subscriber that disconnects before it is
+     * destroyed is never called afterwards. Owners of the service have to
+     * call stop() before tearing down subscribers that cannot disconnect
+     * themselves in time.
+     */
+    class TickerLookupService : public Observable<OnTickerLookedUp>
+    {
+       public:
+        /// Function fetching the metadata of a single ticker
+        using Fetcher =
+            std::function<YFinanceResult<Stock>(const std::string& ticker)>;
+
+        /// Clock used for the expiry of cache entries
+        using Clock = std::chrono::system_clock;
+
+        /// Default lifetime of a cache entry
+        static constexpr std::chrono::hours DefaultTtl{24};
+
+       private:
+        /// A cached lookup result
+        struct CacheEntry
+        {
+            /// The looked up stock
+            Stock stock;
+            /// Time point of the fetch
+            Clock::time_point fetchedAt;
+        };
+
+        /// Mutex for synchronizing access to the cache and the queue
+        mutable std::mutex _mutex;
+        /// Mutex serializing subscriptions, disconnects and notifications
+        std::mutex _signalMutex;
+        /// Mutex serializing snapshots and writes of the persisted cache,
+        /// always locked before _mutex
+        mutable std::mutex _fileMutex;
+        /// Signaled when a ticker is queued or the worker is stopped
+        std::condition_variable_any _wakeUp;
+
+        /// Cached lookup results by their normalized ticker
+        std::unordered_map<std::string, CacheEntry> _cache;
+        /// Tickers queued or currently being fetched
+        std::unordered_set<std::string> _inFlight;
+        /// Tickers waiting to be fetched, in request order
+        std::deque<std::string> _queue;
+
+        /// Function fetching a single ticker
+        Fetcher _fetcher;
+        /// Lifetime of a cache entry
+        std::chrono::seconds _ttl;
+        /// Path of the persisted cache, empty for an in-memory cache
+        std::filesystem::path _cachePath;
+
+        /// Subscriptions to the lookup signal by their id, guarded by
+        /// _signalMutex
+        std::unordered_map<std::size_t, Connection> _subscriptions;
+        /// Id of the next subscription, guarded by _signalMutex
+        std::size_t _nextSubscriptionId = 0;
+
+        /// Worker thread fetching the queued tickers, declared last so that
+        /// it is stopped before the state it uses is destroyed
+        std::jthread _worker;
+
+       public:
+        explicit TickerLookupService(
+            std::filesystem::path cachePath = {},
+            std::chrono::seconds  ttl       = DefaultTtl,
+            Fetcher               fetcher   = &Stock::retrieveTickerInfo
+        );
+
+        ~TickerLookupService();
+
+        TickerLookupService(const TickerLookupService&)            = delete;
+        TickerLookupService& operator=(const TickerLookupService&) = delete;
+        TickerLookupService(TickerLookupService&&)                 = delete;
+        TickerLookupService& operator=(TickerLookupService&&)      = delete;
+
+        [[nodiscard]]
+        std::optional<Stock> request(const std::string& ticker);
+
+        [[nodiscard]]
+        std::optional<Stock> getCached(const std::string& ticker) const;
+
+        [[nodiscard]] bool isPending(const std::string& ticker) const;
+
+        void clear();
+        void stop();
+
+        [[nodiscard]]
+        Connection subscribeToLookup(OnTickerLookedUp::func func, void* user);
+
+        [[nodiscard]]
+        static std::string normalize(const std::string& ticker);
+
+       private:
+        void _run(const std::stop_token& stopToken);
+
+        [[nodiscard]]
+        std::optional<Stock> _findFresh(const std::string& ticker) const;
+
+        static void _unsubscribe(void* owner, std::size_t id);
+
+        void _load();
+        void _persist() const;
+        void _save(const nlohmann::json& json) const;
+        [[nodiscard]] nlohmann::json _toJson() const;
+    };
+}   // namespace finance
+
+#endif   // __FINANCE__INCLUDE__FINANCE__TICKER_LOOKUP_SERVICE_HPP__
@@ -0,0 +1,136 @@
+#ifndef __FINANCE__INCLUDE__FINANCE__TRANSACTION__BROKER_STATEMENT_HPP__
+#define __FINANCE__INCLUDE__FINANCE__TRANSACTION__BROKER_STATEMENT_HPP__
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <mstd/enum.hpp>
+#include <optional>
+#include <string_view>
+#include <vector>
+
+#include "common/cash.hpp"
+#include "common/csv_reader.hpp"
+#include "common/finance.hpp"
+#include "common/quantity.hpp"
+#include "common/timestamp.hpp"
+#include "error/finance_error.hpp"
+
+namespace finance
+{
+// NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
+#define BROKER_LAYOUT_LIST(X) \
+    X(Generic)                \
+    X(InteractiveBrokers)
+
+    MSTD_ENUM(BrokerLayout, std::uint8_t, BROKER_LAYOUT_LIST);
+
+// NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
+#define STATEMENT_ROW_KIND_LIST(X) \
+    X(Trade)                       \
+    X(Cash)
+
+    MSTD_ENUM(StatementRowKind, std::uint8_t, STATEMENT_ROW_KIND_LIST);
+
+// NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
+#define STATEMENT_COLUMN_LIST(X) \
+    X(Date)                      \
+    X(Type)                      \
+    X(Account)                   \
+    X(CashAccount)               \
+    X(Symbol)                    \
+    X(Quantity)                  \
+    X(Price)                     \
+    X(Amount)                    \
+    X(Fees)                      \
+    X(Currency)                  \
+    X(Comment)
+
+    MSTD_ENUM(StatementColumn, std::uint8_t, STATEMENT_COLUMN_LIST);
+
+    /**
+     * @brief A single row of a broker statement.
+     *
+     * The text fields are views into the statement data, they are only valid
+     * as long as the data is.
+     */
+    struct StatementRow
+    {
+        /// The line the row starts at, 1-based
+        std::size_t line = 0;
+        /// Whether the row is a trade or a cash movement
+        StatementRowKind kind = StatementRowKind::Trade;
+        /// The trade or booking time
+        Timestamp timestamp = Timestamp::Null();
+        /// The security account of a trade or the cash account of a cash
+        /// movement, empty if the statement has no account column
+        std::string_view account;
+        /// The cash account of a trade, empty if not given
+        std::string_view cashAccount;
+        /// The ticker of a trade
+        std::string_view symbol;
+        /// The currency of the price, amount and fees
+        Currency currency = Currency::Unknown;
+        /// The traded quantity, negative for sells
+        Quantity quantity{0};
+        /// The unit price of a trade
+        Cash price;
+        /// The signed amount of a cash movement, negative for withdrawals
+        Cash amount;
+        /// The fees, always positive
+        Cash fees;
+        /// The comment or description
+        std::string_view comment;
+    };
+
+    /**
+     * @brief Streaming parser for CSV exports of brokers.
+     *
+     * Each BrokerLayout maps the columns of a broker export onto the
+     * StatementColumn values by their header names. The header is read once,
+     * afterwards rows are parsed straight from the data: text fields stay
+     * views into the data and numbers are parsed in place, so parsing a row
+     * does not allocate. Repeated header rows, as written by exports with
+     * several sections, are skipped.
+     */
+    class StatementParser
+    {
+       private:
+        /// Marks a column that is not part of the statement
+        static constexpr std::size_t NO_COLUMN = static_cast<std::size_t>(-1);
+
+        /// The reader of the statement data
+        CsvReader _reader;
+        /// The layout of the statement
+        BrokerLayout _layout;
+        /// The field index of each column
+        std::array<std::size_t, StatementColumnMeta::size> _columns{};
+        /// The fields of the current row, reused for every row
+        std::vector<std::string_view> _fields;
+
+       public:
+        StatementParser(std::string_view data, BrokerLayout layout);
+
+        [[nodiscard]] FinanceResult<void> readHeader();
+
+        [[nodiscard]] std::optional<FinanceResult<StatementRow>> next();
+
+        [[nodiscard]] bool hasColumn(StatementColumn column) const;
+
+        [[nodiscard]] std::size_t getOffset() const;
+        [[nodiscard]] std::size_t getSize() const;
+
+        [[nodiscard]] static std::optional<Timestamp> parseTimestamp(
+            std::string_view value
+        );
+
+       private:
+        [[nodiscard]] std::string_view _field(StatementColumn column) const;
+        [[nodiscard]] bool             _isHeaderRow() const;
+
+        [[nodiscard]] FinanceResult<StatementRow> _parseRow() const;
+    };
+
+}   // namespace finance
+
+#endif   // __FINANCE__INCLUDE__FINANCE__TRANSACTION__BROKER_STATEMENT_HPP__
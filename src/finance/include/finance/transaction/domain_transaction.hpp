@@ -4,6 +4,7 @@
 #include <optional>
 #include <string>
 
+#include "common/container/id_id_map.hpp"
 #include "common/timestamp.hpp"
 #include "config/id_types.hpp"
 #include "finance/transaction/transaction.hpp"
@@ -41,6 +42,8 @@ namespace finance
         [[nodiscard]] TransactionDataType    getType() const;
         [[nodiscard]] const TransactionData& getData() const;
 
+        [[nodiscard]] std::optional<PositionId> getPositionId() const;
+
         [[nodiscard]] bool hasPositionId(PositionId id) const;
         [[nodiscard]] bool hasInstrumentId(InstrumentId id) const;
 
@@ -52,6 +55,12 @@ namespace finance
         void                           addLeg(const TradeLeg& leg);
         void                           setLegs(const TradeLegs& legs);
 
+        bool remapIds(
+            const IdIdMap<AccountId>&    accountRemap,
+            const IdIdMap<InstrumentId>& instrumentRemap,
+            const IdIdMap<PositionId>&   positionRemap
+        );
+
         [[nodiscard]] std::string toString() const override;
 
         [[nodiscard]] bool isAccountInvolved(AccountId accountId) const;
@@ -1,6 +1,8 @@
 #ifndef __FINANCE__INCLUDE__FINANCE__TRANSACTION__PNL_HPP__
 #define __FINANCE__INCLUDE__FINANCE__TRANSACTION__PNL_HPP__
 
+#include <cstddef>
+#include <span>
 #include <variant>
 #include <vector>
 
@@ -230,6 +232,16 @@ namespace finance
         std::optional<Cash>  markPrice
     );
 
+    /// Minimum number of positions per worker of foldPositions, smaller
+    /// batches are not worth a thread
+    inline constexpr std::size_t MIN_POSITIONS_PER_WORKER = 32;
+
+    [[nodiscard]]
+    std::vector<PnLResult<PositionState>> foldPositions(
+        std::span<const PositionEvents> positions,
+        std::size_t                     maxWorkers = 0
+    );
+
 }   // namespace finance
 
 #endif   // __FINANCE__INCLUDE__FINANCE__TRANSACTION__PNL_HPP__
\ No newline at end of file
@@ -1,12 +1,15 @@
 #ifndef __FINANCE__INCLUDE__FINANCE__TRANSACTION__TRANSACTION_CONVERTER_HPP__
 #define __FINANCE__INCLUDE__FINANCE__TRANSACTION__TRANSACTION_CONVERTER_HPP__
 
+#include <vector>
+
 #include "error/finance_error.hpp"
 #include "finance/account/accounts.hpp"
 #include "finance/transaction/cash_transaction.hpp"
 #include "finance/transaction/domain_transaction.hpp"
 #include "finance/transaction/option_transaction.hpp"
 #include "finance/transaction/stock_transaction.hpp"
+#include "finance/transaction/transactions.hpp"
 
 namespace finance
 {
@@ -36,6 +39,12 @@ namespace finance
             const Accounts&          accounts
         );
 
+        [[nodiscard]]
+        static std::vector<DomainTransaction> toDomain(
+            const Transactions& transactions,
+            const Accounts&     accounts
+        );
+
         [[nodiscard]]
         static FinanceResult<CashTransaction> toCash(
             const DomainTransaction& transaction,
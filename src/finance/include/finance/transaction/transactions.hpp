@@ -1,10 +1,13 @@
 #ifndef __FINANCE__INCLUDE__FINANCE__TRANSACTION__TRANSACTIONS_HPP__
 #define __FINANCE__INCLUDE__FINANCE__TRANSACTION__TRANSACTIONS_HPP__
 
+#include <cstddef>
 #include <memory>
+#include <span>
 #include <vector>
 
 #include "common/container/id_map.hpp"
+#include "common/container/index_view.hpp"
 #include "common/container/set.hpp"
 #include "error/finance_error.hpp"
 #include "finance/transaction/cash_transaction.hpp"
@@ -14,8 +17,9 @@
 
 namespace finance
 {
-    class Accounts;   // forward declaration
-    class Options;    // forward declaration
+    class Accounts;           // forward declaration
+    class Options;            // forward declaration
+    class TransactionsView;   // forward declaration
 
     /**
      * @brief Interface for managing security-related transactions.
@@ -75,22 +79,23 @@ namespace finance
     };
 
     /**
-     * @brief Class for managing security transactions.
+     * @brief Non-owning view over the stock and option transactions of a
+     * Transactions object, it must not outlive the viewed transactions.
      *
      */
     class SecurityView : public ISecurityTransactions
     {
        private:
         /// The stock transactions that are part of the security view
-        StockTransactions _stockTransactions;
+        std::span<const StockTransaction> _stockTransactions;
 
         /// The option transactions that are part of the security view
-        OptionTransactions _optionTransactions;
+        std::span<const OptionTransaction> _optionTransactions;
 
        public:
         explicit SecurityView(
-            StockTransactions  stockTransactions,
-            OptionTransactions optionTransactions
+            std::span<const StockTransaction>  stockTransactions,
+            std::span<const OptionTransaction> optionTransactions
         );
         ~SecurityView() override = default;
 
@@ -152,7 +157,7 @@ namespace finance
         [[nodiscard]] bool containsOptions() const;
 
         [[nodiscard]]
-        IdMap<PositionId, Transactions> groupByPosition() const;
+        IdMap<PositionId, TransactionsView> groupByPosition() const;
 
         [[nodiscard]]
         Transactions filter(const IdSet<AccountId>& accountIds) const;
@@ -163,6 +168,46 @@ namespace finance
         [[nodiscard]]
         IdSet<InstrumentId> getOptionInstrumentIds() const;
     };
+
+    /**
+     * @brief A sub-view of the stock and option transactions of a
+     * Transactions object.
+     *
+     * The view selects the transactions by their index and shares the storage
+     * of the viewed transactions, so creating it copies no transaction.
+     * Transactions added to the viewed object later on are not part of the
+     * view.
+     */
+    class TransactionsView
+    {
+       private:
+        /// The viewed transactions, shares their storage
+        Transactions _transactions;
+        /// The indices of the selected stock transactions
+        std::vector<std::size_t> _stockIndices;
+        /// The indices of the selected option transactions
+        std::vector<std::size_t> _optionIndices;
+
+       public:
+        TransactionsView() = default;
+        TransactionsView(
+            const Transactions&      transactions,
+            std::vector<std::size_t> stockIndices,
+            std::vector<std::size_t> optionIndices
+        );
+
+        [[nodiscard]] IndexView<StockTransaction>  stocks() const;
+        [[nodiscard]] IndexView<OptionTransaction> options() const;
+
+        [[nodiscard]] bool empty() const;
+        [[nodiscard]] bool containsOptions() const;
+
+        [[nodiscard]]
+        IdSet<InstrumentId> getStockInstrumentIds() const;
+
+        [[nodiscard]]
+        IdSet<InstrumentId> getOptionInstrumentIds() const;
+    };
 }   // namespace finance
 
 #endif   // __FINANCE__INCLUDE__FINANCE__TRANSACTION__TRANSACTIONS_HPP__
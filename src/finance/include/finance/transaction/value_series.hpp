@@ -0,0 +1,75 @@
+#ifndef __FINANCE__INCLUDE__FINANCE__TRANSACTION__VALUE_SERIES_HPP__
+#define __FINANCE__INCLUDE__FINANCE__TRANSACTION__VALUE_SERIES_HPP__
+
+#include <chrono>
+#include <span>
+#include <vector>
+
+#include "common/cash.hpp"
+#include "common/timestamp.hpp"
+#include "config/id_types.hpp"
+#include "error/finance_error.hpp"
+#include "finance/fx_rate_cache.hpp"
+#include "finance/transaction/pnl.hpp"
+
+namespace finance
+{
+    /**
+     * @brief The closing price of an instrument on a single day
+     *
+     */
+    struct DailyClose
+    {
+        /// The trading day (UTC)
+        std::chrono::sys_days day;
+        /// The closing price of the day
+        Cash close;
+    };
+
+    /**
+     * @brief The input of a value series for a single position, its events
+     * and the daily closes of its (underlying) instrument. All trades of a
+     * position share one currency, closes in another currency are converted
+     * into it.
+     *
+     */
+    struct SeriesPosition
+    {
+        /// The ID of the position
+        PositionId id;
+        /// The trades of the position, in any order
+        PositionEvents events;
+        /// The daily closes of the instrument, in any order
+        std::vector<DailyClose> closes;
+    };
+
+    /**
+     * @brief The value of a portfolio at the end of a single day, in the base
+     * currency of the series
+     *
+     */
+    struct PortfolioValuePoint
+    {
+        /// The day (UTC)
+        std::chrono::sys_days day;
+        /// The market value of all held positions, positions without a close
+        /// yet are valued at their cost basis
+        Cash marketValue;
+        /// The cost basis of all held positions
+        Cash costBasis;
+    };
+
+    [[nodiscard]] std::chrono::sys_days toDay(const Timestamp& timestamp);
+
+    [[nodiscard]]
+    FinanceResult<std::vector<PortfolioValuePoint>> buildValueSeries(
+        std::span<const SeriesPosition> positions,
+        std::chrono::sys_days           from,
+        std::chrono::sys_days           to,
+        Currency                        baseCurrency,
+        const ConversionMatrix&         rates
+    );
+
+}   // namespace finance
+
+#endif   // __FINANCE__INCLUDE__FINANCE__TRANSACTION__VALUE_SERIES_HPP__
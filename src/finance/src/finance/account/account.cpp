@@ -4,6 +4,7 @@
 #include <utility>
 
 #include "common/finance.hpp"
+#include "filter/leaves.hpp"
 
 namespace finance
 {
@@ -154,7 +155,7 @@ namespace finance
      */
     filter::Predicate<Account> IsAccountActive()
     {
-        return filter::makePredicate<Account>(
+        return filter::makeFlagPredicate<Account>(
             [](const Account& account)
             { return account.getStatus() != AccountStatus::Closed; }
         );
@@ -167,8 +168,9 @@ namespace finance
      */
     filter::Predicate<Account> IsExternal()
     {
-        return filter::makePredicate<Account>([](const Account& account)
-                                              { return account.isExternal(); });
+        return filter::makeFlagPredicate<Account>(
+            [](const Account& account) { return account.isExternal(); }
+        );
     }
 
     /**
@@ -193,8 +195,10 @@ namespace finance
      */
     filter::Predicate<Account> HasAccountId(AccountId id)
     {
-        return filter::makePredicate<Account>([id](const Account& account)
-                                              { return account.getId() == id; }
+        return filter::makeIdSetPredicate<Account>(
+            [](const Account& account, const filter::IdList& ids)
+            { return ids.contains(account.getId().value()); },
+            filter::IdList{{id.value()}}
         );
     }
 
@@ -206,8 +210,9 @@ namespace finance
      */
     filter::Predicate<Account> HasName(const std::string& name)
     {
-        return filter::makePredicate<Account>(
-            [name](const Account& account) { return account.getName() == name; }
+        return filter::makeStringEqualPredicate<Account>(
+            [](const Account& account) { return account.getName(); },
+            name
         );
     }
 
@@ -1,5 +1,8 @@
 #include "finance/account/accounts.hpp"
 
+#include <algorithm>
+#include <ranges>
+
 namespace finance
 {
     /**
@@ -48,6 +51,10 @@ namespace finance
      * @brief Get the corresponding external account ID for a given internal
      * cash account ID.
      *
+     * The external account is resolved via the currency of the cash account
+     * from the maintained index. If there is no external account in that
+     * currency, the external account with the smallest id is used.
+     *
      * @param cashAccountId The internal cash account ID to find the
      * corresponding external account for.
      * @return AccountId The corresponding external account ID, or an invalid
@@ -57,21 +64,119 @@ namespace finance
         const AccountId& cashAccountId
     ) const
     {
-        for (const auto& [id, account] : *this)
-        {
-            if (!account.isExternal() &&
-                account.getKind() == AccountKind::Cash &&
-                account.getId() == cashAccountId)
-            {
-                // find the corresponding external account
-                for (const auto& [externalId, externalAccount] : *this)
-                {
-                    if (externalAccount.isExternal())
-                        return externalId;
-                }
-            }
-        }
+        if (_externalAccountIds.empty() || !contains(cashAccountId))
+            return AccountId::invalid();
+
+        const auto& account = at(cashAccountId);
+        if (account.getKind() != AccountKind::Cash)
+            return AccountId::invalid();
+
+        const auto iter = _externalAccountIds.find(account.getCurrency());
+        if (iter != _externalAccountIds.end())
+            return iter->second;
+
+        return std::ranges::min(_externalAccountIds | std::views::values);
+    }
+
+    /**
+     * @brief Add an account, see IdObjectMap::add
+     *
+     * @param account The account to add
+     * @return true if the account was added, false if an account with the same
+     * id already exists
+     */
+    bool Accounts::add(const Account& account)
+    {
+        if (!Base::add(account))
+            return false;
+
+        _indexAccount(account);
+        return true;
+    }
+
+    /**
+     * @brief Add an account without checking for duplicates
+     *
+     * @param account The account to add
+     */
+    void Accounts::addUnchecked(const Account& account)
+    {
+        // an existing entry is kept, so the index must not change either
+        const bool existed = contains(account.getId());
+
+        Base::addUnchecked(account);
+
+        if (!existed)
+            _indexAccount(account);
+    }
+
+    /**
+     * @brief Remove an account
+     *
+     * @param id The id of the account to remove
+     * @return true if the account was removed, false if it does not exist
+     */
+    bool Accounts::remove(const AccountId& id)
+    {
+        const bool wasExternal = contains(id) && at(id).isExternal();
+
+        if (!Base::remove(id))
+            return false;
 
-        return AccountId::invalid();
+        if (wasExternal)
+            _rebuildIndex();
+
+        return true;
+    }
+
+    /**
+     * @brief Remove an account without checking if it exists
+     *
+     * @param id The id of the account to remove
+     */
+    void Accounts::removeUnchecked(const AccountId& id)
+    {
+        static_cast<void>(remove(id));
+    }
+
+    /**
+     * @brief Remove all accounts
+     *
+     */
+    void Accounts::clear()
+    {
+        Base::clear();
+        _externalAccountIds.clear();
+    }
+
+    /**
+     * @brief Add an account to the external account index if it is external
+     *
+     * @param account The account that was added to the collection
+     */
+    void Accounts::_indexAccount(const Account& account)
+    {
+        if (!account.isExternal())
+            return;
+
+        const auto [iter, inserted] = _externalAccountIds.try_emplace(
+            account.getCurrency(),
+            account.getId()
+        );
+
+        if (!inserted && account.getId() < iter->second)
+            iter->second = account.getId();
+    }
+
+    /**
+     * @brief Rebuild the external account index from all accounts
+     *
+     */
+    void Accounts::_rebuildIndex()
+    {
+        _externalAccountIds.clear();
+
+        for (const auto& [id, account] : *this)
+            _indexAccount(account);
     }
 }   // namespace finance
@@ -0,0 +1,493 @@
+#include "finance/fx_rate_cache.hpp"
+
+#include <cmath>
+#include <format>
+#include <fstream>
+#include <limits>
+#include <system_error>
+
+#include "common/currency.hpp"
+#include "logging/log_macros.hpp"
+#include "settings/settings_writer.hpp"
+
+REGISTER_LOG_CATEGORY("Finance.FxRateCache");
+
+namespace finance
+{
+    namespace
+    {
+        /// Suffix of the Yahoo Finance currency pair symbols
+        constexpr std::string_view PAIR_SUFFIX = "=X";
+        /// Length of an ISO 4217 currency code
+        constexpr std::size_t CODE_LENGTH = 3;
+
+        /**
+         * @brief Checks whether a rate can be used for conversions
+         *
+         * @param rate
+         * @return true
+         * @return false
+         */
+        bool isValidRate(double rate)
+        {
+            return std::isfinite(rate) && rate > 0.0;
+        }
+    }   // namespace
+
+    /**
+     * @brief Construct a new Conversion Matrix object, only the identity
+     * conversions of the known currencies are set.
+     *
+     */
+    ConversionMatrix::ConversionMatrix()
+    {
+        _rates.fill(std::numeric_limits<double>::quiet_NaN());
+
+        for (const auto currency : CurrencyMeta::values)
+            if (currency != Currency::Unknown)
+                _rates[_index(currency, currency)] = 1.0;
+    }
+
+    /**
+     * @brief Sets the rate of a conversion, invalid rates are ignored
+     *
+     * @param from
+     * @param to
+     * @param rate
+     */
+    void ConversionMatrix::set(Currency from, Currency to, double rate)
+    {
+        if (from == Currency::Unknown || to == Currency::Unknown)
+            return;
+
+        if (isValidRate(rate))
+            _rates[_index(from, to)] = rate;
+    }
+
+    /**
+     * @brief Get the rate of a conversion
+     *
+     * @param from
+     * @param to
+     * @return std::optional<double> std::nullopt if the rate is unknown
+     */
+    std::optional<double> ConversionMatrix::rate(Currency from, Currency to)
+        const
+    {
+        const auto value = _rates[_index(from, to)];
+
+        if (std::isnan(value))
+            return std::nullopt;
+
+        return value;
+    }
+
+    /**
+     * @brief Converts an amount into another currency
+     *
+     * @param amount
+     * @param to
+     * @return std::optional<Cash> std::nullopt if the rate is unknown
+     */
+    std::optional<Cash> ConversionMatrix::convert(
+        const Cash& amount,
+        Currency    to
+    ) const
+    {
+        const auto conversionRate = rate(amount.getCurrency(), to);
+
+        if (!conversionRate)
+            return std::nullopt;
+
+        return convert(amount, to, conversionRate.value());
+    }
+
+    /**
+     * @brief Converts an amount into another currency with the given rate,
+     * the result is rounded to the nearest micro unit of the target currency
+     *
+     * @param amount
+     * @param to
+     * @param rate
+     * @return Cash
+     */
+    Cash ConversionMatrix::convert(const Cash& amount, Currency to, double rate)
+    {
+        const int scale =
+            getMicroUnit(to) - getMicroUnit(amount.getCurrency());
+
+        const auto converted = static_cast<double>(amount.getAmount()) *
+                               rate * std::pow(10.0, scale);
+
+        return Cash{to, static_cast<micro_units>(std::llround(converted))};
+    }
+
+    /**
+     * @brief Get the currencies with at least one conversion that differs
+     * from the previous matrix.
+     *
+     * A currency is reported if any of its conversions into another currency
+     * changed, so every amount in a currency that is not reported converts
+     * into any target currency exactly as before.
+     *
+     * @param previous
+     * @return std::vector<Currency>
+     */
+    std::vector<Currency> ConversionMatrix::getChangedCurrencies(
+        const ConversionMatrix& previous
+    ) const
+    {
+        std::vector<Currency> currencies;
+
+        for (const auto from : CurrencyMeta::values)
+        {
+            for (const auto to : CurrencyMeta::values)
+            {
+                if (rate(from, to) != previous.rate(from, to))
+                {
+                    currencies.push_back(from);
+                    break;
+                }
+            }
+        }
+
+        return currencies;
+    }
+
+    /**
+     * @brief Get the index of a conversion in the rate array
+     *
+     * @param from
+     * @param to
+     * @return std::size_t
+     */
+    std::size_t ConversionMatrix::_index(Currency from, Currency to)
+    {
+        return (static_cast<std::size_t>(from) * N) +
+               static_cast<std::size_t>(to);
+    }
+
+    /**
+     * @brief Construct a new Fx Rate Cache object, loads the persisted rates
+     *
+     * @param path The JSON file the rates are persisted to, an empty path
+     * keeps the rates in memory only
+     */
+    FxRateCache::FxRateCache(std::filesystem::path path)
+        : _path(std::move(path))
+    {
+        _load();
+        _matrix = _buildMatrix();
+
+        if (_path.empty())
+            return;
+
+        std::error_code errorCode;
+        std::filesystem::create_directories(_path.parent_path(), errorCode);
+
+        _writer = std::make_unique<settings::SettingsWriter>(_path);
+    }
+
+    /**
+     * @brief Destroy the Fx Rate Cache object, pending rates are written
+     * before the writer thread stops
+     *
+     */
+    FxRateCache::~FxRateCache() = default;
+
+    /**
+     * @brief Updates the cache with new rates, the rates are persisted and
+     * subscribers are notified only if at least one rate changed.
+     *
+     * Subscribers receive the currencies whose conversions changed, see
+     * ConversionMatrix::getChangedCurrencies(). The rates are handed to the
+     * background writer, the call does not wait for the file.
+     *
+     * @param rates The new rates, invalid rates are ignored.
+     * @return true if at least one rate changed
+     * @return false otherwise
+     */
+    bool FxRateCache::update(const std::vector<FxRate>& rates)
+    {
+        bool                  changed = false;
+        std::vector<Currency> currencies;
+        {
+            std::unique_lock lock{_mutex};
+
+            for (const auto& rate : rates)
+            {
+                if (!isValidRate(rate.rate) || rate.from == rate.to ||
+                    rate.from == Currency::Unknown ||
+                    rate.to == Currency::Unknown)
+                    continue;
+
+                auto& cached = _rates[pairSymbol(rate.from, rate.to)];
+                if (cached.rate != rate.rate)
+                    changed = true;
+
+                cached = rate;
+            }
+
+            if (changed)
+            {
+                auto matrix = _buildMatrix();
+                currencies  = matrix.getChangedCurrencies(_matrix);
+                _matrix     = matrix;
+            }
+        }
+
+        if (!changed)
+            return false;
+
+        _save();
+        notify<OnFxRatesUpdated>(currencies);
+        return true;
+    }
+
+    /**
+     * @brief Get the directly cached rate of a currency pair
+     *
+     * @param from
+     * @param to
+     * @return std::optional<FxRate>
+     */
+    std::optional<FxRate> FxRateCache::get(Currency from, Currency to) const
+    {
+        std::shared_lock lock{_mutex};
+
+        const auto it = _rates.find(pairSymbol(from, to));
+        if (it == _rates.end())
+            return std::nullopt;
+
+        return it->second;
+    }
+
+    /**
+     * @brief Get the rate of a conversion, derived from the inverse or crossed
+     * over a third currency if it is not cached directly
+     *
+     * @param from
+     * @param to
+     * @return std::optional<double>
+     */
+    std::optional<double> FxRateCache::getRate(Currency from, Currency to)
+        const
+    {
+        return getMatrix().rate(from, to);
+    }
+
+    /**
+     * @brief Get a snapshot of all conversion rates, the cached matrix is
+     * copied without deriving the rates again.
+     *
+     * @return ConversionMatrix
+     */
+    ConversionMatrix FxRateCache::getMatrix() const
+    {
+        std::shared_lock lock{_mutex};
+        return _matrix;
+    }
+
+    /**
+     * @brief Derives all conversions from the cached rates -- the caller has
+     * to hold the mutex.
+     *
+     * Cached rates are set together with their inverses first, the remaining
+     * conversions are crossed over a third currency. Cached rates always take
+     * precedence over derived ones.
+     *
+     * @return ConversionMatrix
+     */
+    ConversionMatrix FxRateCache::_buildMatrix() const
+    {
+        ConversionMatrix matrix;
+
+        for (const auto& [_, rate] : _rates)
+            if (!matrix.rate(rate.to, rate.from))
+                matrix.set(rate.to, rate.from, 1.0 / rate.rate);
+
+        for (const auto& [_, rate] : _rates)
+            matrix.set(rate.from, rate.to, rate.rate);
+
+        for (const auto pivot : CurrencyMeta::values)
+        {
+            for (const auto from : CurrencyMeta::values)
+            {
+                const auto toPivot = matrix.rate(from, pivot);
+                if (!toPivot)
+                    continue;
+
+                for (const auto to : CurrencyMeta::values)
+                {
+                    const auto fromPivot = matrix.rate(pivot, to);
+                    if (fromPivot && !matrix.rate(from, to))
+                        matrix.set(from, to, *toPivot * *fromPivot);
+                }
+            }
+        }
+
+        return matrix;
+    }
+
+    /**
+     * @brief subscribe to exchange rate changes, the callback is called on
+     * the thread that updated the cache.
+     *
+     * @param callback
+     * @param user
+     * @return Connection
+     */
+    Connection FxRateCache::subscribeToRatesUpdated(
+        OnFxRatesUpdated::func callback,
+        void*                  user
+    )
+    {
+        return on<OnFxRatesUpdated>(std::move(callback), user);
+    }
+
+    /**
+     * @brief Get the Yahoo Finance symbol of a currency pair, e.g. "EURUSD=X"
+     *
+     * @param from
+     * @param to
+     * @return std::string
+     */
+    std::string FxRateCache::pairSymbol(Currency from, Currency to)
+    {
+        return std::format(
+            "{}{}{}",
+            CurrencyMeta::toString(from),
+            CurrencyMeta::toString(to),
+            PAIR_SUFFIX
+        );
+    }
+
+    /**
+     * @brief Parses a Yahoo Finance currency pair symbol
+     *
+     * @param symbol e.g. "EURUSD=X"
+     * @return std::optional<std::pair<Currency, Currency>> std::nullopt if the
+     * symbol is not a pair of known currencies
+     */
+    std::optional<std::pair<Currency, Currency>> FxRateCache::parsePairSymbol(
+        const std::string& symbol
+    )
+    {
+        if (symbol.size() != (2 * CODE_LENGTH) + PAIR_SUFFIX.size() ||
+            !symbol.ends_with(PAIR_SUFFIX))
+            return std::nullopt;
+
+        const auto from =
+            CurrencyMeta::from_string(symbol.substr(0, CODE_LENGTH));
+        const auto to =
+            CurrencyMeta::from_string(symbol.substr(CODE_LENGTH, CODE_LENGTH));
+
+        if (!from || !to || from == Currency::Unknown ||
+            to == Currency::Unknown)
+            return std::nullopt;
+
+        return std::pair{from.value(), to.value()};
+    }
+
+    /**
+     * @brief Loads the persisted rates, malformed entries are skipped
+     *
+     */
+    void FxRateCache::_load()
+    {
+        if (_path.empty() || !std::filesystem::exists(_path))
+            return;
+
+        std::ifstream file{_path};
+        const auto    json = nlohmann::json::parse(file, nullptr, false);
+
+        if (!json.is_array())
+        {
+            LOG_WARNING(
+                std::format("Ignoring malformed fx rates: {}", _path.string())
+            );
+            return;
+        }
+
+        for (const auto& entry : json)
+        {
+            try
+            {
+                const auto symbol = entry.at("pair").get<std::string>();
+                const auto pair   = parsePairSymbol(symbol);
+                const auto rate   = entry.at("rate").get<double>();
+
+                if (!pair || !isValidRate(rate))
+                    continue;
+
+                const auto fetchedAt = FxRate::Clock::time_point{
+                    std::chrono::seconds{
+                        entry.at("fetchedAt").get<std::int64_t>()
+                    }
+                };
+
+                _rates.insert_or_assign(
+                    symbol,
+                    FxRate{pair->first, pair->second, rate, fetchedAt}
+                );
+            }
+            catch (const nlohmann::json::exception&)
+            {
+                continue;
+            }
+        }
+    }
+
+    /**
+     * @brief Hands a snapshot of the rates to the background writer, which
+     * writes it atomically once no newer snapshot follows. The snapshot is
+     * taken and scheduled under the file mutex, so an older snapshot never
+     * replaces a newer one.
+     *
+     */
+    void FxRateCache::_save() const
+    {
+        if (!_writer)
+            return;
+
+        std::scoped_lock fileLock{_fileMutex};
+
+        nlohmann::json json;
+        {
+            std::shared_lock lock{_mutex};
+            json = _toJson();
+        }
+
+        _writer->schedule(std::move(json));
+    }
+
+    /**
+     * @brief Serializes the rates -- the caller has to hold the mutex
+     *
+     * @return nlohmann::json
+     */
+    nlohmann::json FxRateCache::_toJson() const
+    {
+        using std::chrono::duration_cast;
+        using std::chrono::seconds;
+
+        auto json = nlohmann::json::array();
+
+        for (const auto& [symbol, rate] : _rates)
+        {
+            const auto epoch =
+                duration_cast<seconds>(rate.fetchedAt.time_since_epoch());
+
+            json.push_back(
+                nlohmann::json{
+                    {"pair", symbol},
+                    {"rate", rate.rate},
+                    {"fetchedAt", epoch.count()}
+                }
+            );
+        }
+
+        return json;
+    }
+
+}   // namespace finance
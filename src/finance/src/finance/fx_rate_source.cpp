@@ -0,0 +1,122 @@
+#include "finance/fx_rate_source.hpp"
+
+#include <cmath>
+
+#include "common/currency.hpp"
+#include "finance/price_cache.hpp"
+
+namespace finance
+{
+    /**
+     * @brief Construct a new Fx Rate Source object, watches the pair symbols
+     * and copies the pair quotes that are already cached
+     *
+     * @param priceCache The price cache the pair quotes are fetched into
+     * @param fxRateCache The rate cache fed by this source
+     * @param pivot The currency all pairs are quoted against
+     */
+    FxRateSource::FxRateSource(
+        std::shared_ptr<PriceCache>  priceCache,
+        std::shared_ptr<FxRateCache> fxRateCache,
+        Currency                     pivot
+    )
+        : _priceCache(std::move(priceCache)),
+          _fxRateCache(std::move(fxRateCache)),
+          _pairSymbols(pairSymbols(pivot))
+    {
+        _priceConnection = _priceCache->subscribeToPriceChange(
+            [this]() { refresh(); },
+            this
+        );
+
+        _priceCache->watch(_pairSymbols);
+        refresh();
+    }
+
+    /**
+     * @brief Destroy the Fx Rate Source object, unwatches the pair symbols
+     *
+     */
+    FxRateSource::~FxRateSource() { _priceCache->unwatch(_pairSymbols); }
+
+    /**
+     * @brief Copies the cached pair quotes into the rate cache, the rate
+     * cache only notifies its subscribers if a rate actually changed
+     *
+     */
+    void FxRateSource::refresh()
+    {
+        const auto rates = toRates(_priceCache->get(_pairSymbols));
+
+        if (!rates.empty())
+            _fxRateCache->update(rates);
+    }
+
+    /**
+     * @brief Get the watched pair symbols
+     *
+     * @return const std::vector<std::string>&
+     */
+    const std::vector<std::string>& FxRateSource::getPairSymbols() const
+    {
+        return _pairSymbols;
+    }
+
+    /**
+     * @brief Get the pair symbols of all known currencies against a pivot
+     * currency
+     *
+     * @param pivot
+     * @return std::vector<std::string> e.g. {"EURUSD=X", "GBPUSD=X", ...}
+     */
+    std::vector<std::string> FxRateSource::pairSymbols(Currency pivot)
+    {
+        std::vector<std::string> symbols;
+
+        for (const auto currency : CurrencyMeta::values)
+        {
+            if (currency != Currency::Unknown && currency != pivot)
+                symbols.push_back(FxRateCache::pairSymbol(currency, pivot));
+        }
+
+        return symbols;
+    }
+
+    /**
+     * @brief Converts currency pair quotes into rates, the current market
+     * price is preferred over the last close. Quotes that are not quoted in
+     * the target currency of their pair are skipped.
+     *
+     * @param quotes The quotes by their pair symbol
+     * @return std::vector<FxRate>
+     */
+    std::vector<FxRate> FxRateSource::toRates(
+        const std::unordered_map<std::string, PriceQuote>& quotes
+    )
+    {
+        std::vector<FxRate> rates;
+        rates.reserve(quotes.size());
+
+        const auto now = FxRate::Clock::now();
+
+        for (const auto& [symbol, quote] : quotes)
+        {
+            const auto pair = FxRateCache::parsePairSymbol(symbol);
+            if (!pair)
+                continue;
+
+            const auto& marketPrice = quote.getMarketPrice();
+            const auto& price = marketPrice ? *marketPrice : quote.getPrice();
+            if (price.getCurrency() != pair->second)
+                continue;
+
+            const auto rate = static_cast<double>(price.getAmount()) /
+                              std::pow(10.0, getMicroUnit(price.getCurrency()));
+
+            rates.push_back(FxRate{pair->first, pair->second, rate, now});
+        }
+
+        return rates;
+    }
+
+}   // namespace finance
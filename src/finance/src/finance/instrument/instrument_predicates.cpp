@@ -1,5 +1,6 @@
 #include "finance/instrument/instrument_predicates.hpp"
 
+#include "filter/leaves.hpp"
 #include "filter/predicate.hpp"
 #include "finance/instrument/option.hpp"
 #include "finance/instrument/stock.hpp"
@@ -14,8 +15,9 @@ namespace finance
      */
     filter::Predicate<Stock> HasTicker(const std::string& ticker)
     {
-        return filter::makePredicate<Stock>(
-            [ticker](const Stock& stock) { return stock.getTicker() == ticker; }
+        return filter::makeStringEqualPredicate<Stock>(
+            [](const Stock& stock) { return stock.getTicker(); },
+            ticker
         );
     }
 
@@ -27,8 +29,10 @@ namespace finance
      */
     filter::Predicate<Stock> HasInstrumentId(InstrumentId id)
     {
-        return filter::makePredicate<Stock>(
-            [id](const Stock& stock) { return stock.getInstrumentId() == id; }
+        return filter::makeIdSetPredicate<Stock>(
+            [](const Stock& stock, const filter::IdList& ids)
+            { return ids.contains(stock.getInstrumentId().value()); },
+            filter::IdList{{id.value()}}
         );
     }
 
@@ -40,16 +44,18 @@ namespace finance
      */
     filter::Predicate<Stock> HasInstrumentId(const IdSet<InstrumentId>& ids)
     {
-        return filter::makePredicate<Stock>(
-            [ids](const Stock& stock)
-            { return ids.contains(stock.getInstrumentId()); }
+        return filter::makeIdSetPredicate<Stock>(
+            [](const Stock& stock, const filter::IdList& idList)
+            { return idList.contains(stock.getInstrumentId().value()); },
+            filter::IdList::fromIds(ids)
         );
     }
 
     filter::Predicate<Option> HasOptionName(const std::string& name)
     {
-        return filter::makePredicate<Option>(
-            [name](const Option& option) { return option.getName() == name; }
+        return filter::makeStringEqualPredicate<Option>(
+            [](const Option& option) { return option.getName(); },
+            name
         );
     }
 
@@ -0,0 +1,414 @@
+#include "finance/portfolio_aggregator.hpp"
+
+namespace finance
+{
+    /**
+     * @brief Construct a new Portfolio Aggregator object, only amounts in the
+     * base currency are convertible until the first rates are set
+     *
+     * @param baseCurrency The currency the total is expressed in
+     */
+    PortfolioAggregator::PortfolioAggregator(Currency baseCurrency)
+        : _baseCurrency(baseCurrency)
+    {
+        _bucket(_baseCurrency).rate = 1.0;
+    }
+
+    /**
+     * @brief Sets the value of a position, replacing its previous value
+     *
+     * @param id
+     * @param value
+     */
+    void PortfolioAggregator::setPositionValue(PositionId id, const Cash& value)
+    {
+        if (_positionValues.contains(id))
+        {
+            _subtract(_positionValues.at(id), &Bucket::positions);
+            _positionValues.at(id) = value;
+        }
+        else
+        {
+            _positionValues.addUnchecked(id, value);
+        }
+
+        _add(value, &Bucket::positions);
+    }
+
+    /**
+     * @brief Removes the value of a position
+     *
+     * @param id
+     * @return true if the position was aggregated
+     * @return false otherwise
+     */
+    bool PortfolioAggregator::removePosition(PositionId id)
+    {
+        if (!_positionValues.contains(id))
+            return false;
+
+        _subtract(_positionValues.at(id), &Bucket::positions);
+        _positionValues.removeUnchecked(id);
+        return true;
+    }
+
+    /**
+     * @brief Sets the balance of an account, replacing its previous balance
+     *
+     * @param id
+     * @param balance
+     */
+    void PortfolioAggregator::setBalance(AccountId id, const Cash& balance)
+    {
+        if (_balances.contains(id))
+        {
+            _subtract(_balances.at(id), &Bucket::balances);
+            _balances.at(id) = balance;
+        }
+        else
+        {
+            _balances.addUnchecked(id, balance);
+        }
+
+        _add(balance, &Bucket::balances);
+    }
+
+    /**
+     * @brief Removes the balance of an account
+     *
+     * @param id
+     * @return true if the account was aggregated
+     * @return false otherwise
+     */
+    bool PortfolioAggregator::removeBalance(AccountId id)
+    {
+        if (!_balances.contains(id))
+            return false;
+
+        _subtract(_balances.at(id), &Bucket::balances);
+        _balances.removeUnchecked(id);
+        return true;
+    }
+
+    /**
+     * @brief Removes all position values and balances, the rates are kept
+     *
+     */
+    void PortfolioAggregator::clear()
+    {
+        _positionValues.clear();
+        _balances.clear();
+
+        for (auto& bucket : _buckets)
+        {
+            bucket.positions          = 0;
+            bucket.balances           = 0;
+            bucket.convertedPositions = 0;
+            bucket.convertedBalances  = 0;
+            bucket.count              = 0;
+        }
+    }
+
+    /**
+     * @brief Takes the rates of all currencies to the base currency from a
+     * conversion matrix, e.g. on startup
+     *
+     * @param matrix
+     * @return std::size_t The number of reconverted currencies
+     */
+    std::size_t PortfolioAggregator::updateRates(const ConversionMatrix& matrix)
+    {
+        std::size_t changed = 0;
+
+        for (const auto currency : CurrencyMeta::values)
+            if (_updateRate(matrix, currency))
+                ++changed;
+
+        return changed;
+    }
+
+    /**
+     * @brief Takes the rates of the given currencies to the base currency from
+     * a conversion matrix, meant for the currencies reported by
+     * OnFxRatesUpdated. All other subtotals are left untouched.
+     *
+     * @param matrix The updated matrix, e.g. FxRateCache::getMatrix()
+     * @param currencies The currencies whose conversions changed
+     * @return std::size_t The number of reconverted currencies
+     */
+    std::size_t PortfolioAggregator::updateRates(
+        const ConversionMatrix&      matrix,
+        const std::vector<Currency>& currencies
+    )
+    {
+        std::size_t changed = 0;
+
+        for (const auto currency : currencies)
+            if (_updateRate(matrix, currency))
+                ++changed;
+
+        return changed;
+    }
+
+    /**
+     * @brief Get the base currency
+     *
+     * @return Currency
+     */
+    Currency PortfolioAggregator::getBaseCurrency() const
+    {
+        return _baseCurrency;
+    }
+
+    /**
+     * @brief Get the total of all convertible position values and balances in
+     * the base currency, amounts of currencies without a rate are left out
+     *
+     * @return Cash
+     */
+    Cash PortfolioAggregator::getTotal() const
+    {
+        return getPositionsTotal() + getBalancesTotal();
+    }
+
+    /**
+     * @brief Get the total of all convertible position values in the base
+     * currency
+     *
+     * @return Cash
+     */
+    Cash PortfolioAggregator::getPositionsTotal() const
+    {
+        micro_units total = 0;
+
+        for (const auto& bucket : _buckets)
+            if (bucket.rate)
+                total += bucket.convertedPositions;
+
+        return Cash{_baseCurrency, total};
+    }
+
+    /**
+     * @brief Get the total of all convertible balances in the base currency
+     *
+     * @return Cash
+     */
+    Cash PortfolioAggregator::getBalancesTotal() const
+    {
+        micro_units total = 0;
+
+        for (const auto& bucket : _buckets)
+            if (bucket.rate)
+                total += bucket.convertedBalances;
+
+        return Cash{_baseCurrency, total};
+    }
+
+    /**
+     * @brief Get the exact sum of the position values of a currency, in that
+     * currency
+     *
+     * @param currency
+     * @return Cash
+     */
+    Cash PortfolioAggregator::getPositionSubtotal(Currency currency) const
+    {
+        return Cash{currency, _bucket(currency).positions};
+    }
+
+    /**
+     * @brief Get the exact sum of the balances of a currency, in that currency
+     *
+     * @param currency
+     * @return Cash
+     */
+    Cash PortfolioAggregator::getBalanceSubtotal(Currency currency) const
+    {
+        return Cash{currency, _bucket(currency).balances};
+    }
+
+    /**
+     * @brief Get the position values and balances of a currency converted
+     * into the base currency
+     *
+     * @param currency
+     * @return std::optional<Cash> std::nullopt if the rate is unknown
+     */
+    std::optional<Cash> PortfolioAggregator::getSubtotal(Currency currency)
+        const
+    {
+        const auto& bucket = _bucket(currency);
+
+        if (!bucket.rate)
+            return std::nullopt;
+
+        return Cash{
+            _baseCurrency,
+            bucket.convertedPositions + bucket.convertedBalances
+        };
+    }
+
+    /**
+     * @brief Get the value of a position converted into the base currency
+     *
+     * @param id
+     * @return std::optional<Cash> std::nullopt if the position is not
+     * aggregated or the rate of its currency is unknown
+     */
+    std::optional<Cash> PortfolioAggregator::getConvertedPositionValue(
+        PositionId id
+    ) const
+    {
+        if (!_positionValues.contains(id))
+            return std::nullopt;
+
+        const auto& value  = _positionValues.at(id);
+        const auto& bucket = _bucket(value.getCurrency());
+
+        if (!bucket.rate)
+            return std::nullopt;
+
+        return ConversionMatrix::convert(
+            value,
+            _baseCurrency,
+            bucket.rate.value()
+        );
+    }
+
+    /**
+     * @brief Get the currencies holding amounts that cannot be converted,
+     * because their rate to the base currency is unknown
+     *
+     * @return std::vector<Currency>
+     */
+    std::vector<Currency> PortfolioAggregator::getUnconvertedCurrencies() const
+    {
+        std::vector<Currency> currencies;
+
+        for (const auto currency : CurrencyMeta::values)
+        {
+            const auto& bucket = _bucket(currency);
+            if (bucket.count > 0 && !bucket.rate)
+                currencies.push_back(currency);
+        }
+
+        return currencies;
+    }
+
+    /**
+     * @brief Adds an amount to a sum of the bucket of its currency
+     *
+     * @param amount
+     * @param sum The position or the balance sum of the bucket
+     */
+    void PortfolioAggregator::_add(
+        const Cash& amount,
+        micro_units Bucket::* sum
+    )
+    {
+        auto& bucket   = _bucket(amount.getCurrency());
+        bucket.*sum   += amount.getAmount();
+        ++bucket.count;
+
+        _reconvert(bucket, amount.getCurrency());
+    }
+
+    /**
+     * @brief Subtracts an amount from a sum of the bucket of its currency
+     *
+     * @param amount
+     * @param sum The position or the balance sum of the bucket
+     */
+    void PortfolioAggregator::_subtract(
+        const Cash& amount,
+        micro_units Bucket::* sum
+    )
+    {
+        auto& bucket   = _bucket(amount.getCurrency());
+        bucket.*sum   -= amount.getAmount();
+        --bucket.count;
+
+        _reconvert(bucket, amount.getCurrency());
+    }
+
+    /**
+     * @brief Takes the rate of a currency to the base currency from a
+     * conversion matrix, its subtotals are reconverted if the rate changed
+     *
+     * @param matrix
+     * @param currency
+     * @return true if the rate changed
+     * @return false otherwise
+     */
+    bool PortfolioAggregator::_updateRate(
+        const ConversionMatrix& matrix,
+        Currency                currency
+    )
+    {
+        auto&      bucket = _bucket(currency);
+        const auto rate   = matrix.rate(currency, _baseCurrency);
+
+        if (bucket.rate == rate)
+            return false;
+
+        bucket.rate = rate;
+        _reconvert(bucket, currency);
+        return true;
+    }
+
+    /**
+     * @brief Converts the native subtotals of a bucket into the base currency
+     *
+     * @param bucket
+     * @param currency The currency of the bucket
+     */
+    void PortfolioAggregator::_reconvert(Bucket& bucket, Currency currency)
+        const
+    {
+        if (!bucket.rate)
+        {
+            bucket.convertedPositions = 0;
+            bucket.convertedBalances  = 0;
+            return;
+        }
+
+        const auto positions = ConversionMatrix::convert(
+            Cash{currency, bucket.positions},
+            _baseCurrency,
+            bucket.rate.value()
+        );
+        const auto balances = ConversionMatrix::convert(
+            Cash{currency, bucket.balances},
+            _baseCurrency,
+            bucket.rate.value()
+        );
+
+        bucket.convertedPositions = positions.getAmount();
+        bucket.convertedBalances  = balances.getAmount();
+    }
+
+    /**
+     * @brief Get the bucket of a currency
+     *
+     * @param currency
+     * @return Bucket&
+     */
+    PortfolioAggregator::Bucket& PortfolioAggregator::_bucket(Currency currency)
+    {
+        return _buckets[static_cast<std::size_t>(currency)];
+    }
+
+    /**
+     * @brief Get the bucket of a currency
+     *
+     * @param currency
+     * @return const Bucket&
+     */
+    const PortfolioAggregator::Bucket& PortfolioAggregator::_bucket(
+        Currency currency
+    ) const
+    {
+        return _buckets[static_cast<std::size_t>(currency)];
+    }
+
+}   // namespace finance
@@ -2,6 +2,8 @@
 
 #include <format>
 
+#include "filter/leaves.hpp"
+
 namespace finance
 {
     /**
@@ -51,10 +53,11 @@ namespace finance
      */
     filter::Predicate<Position> IsPositionOpen(bool isOpen)
     {
-        return filter::Predicate<Position>{
-            [isOpen](const Position& position)
-            { return isOpen == !position.getClosedAt().has_value(); }
-        };
+        return filter::makeFlagPredicate<Position>(
+            [](const Position& position)
+            { return !position.getClosedAt().has_value(); },
+            isOpen
+        );
     }
 
     /**
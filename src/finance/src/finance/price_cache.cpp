@@ -25,7 +25,7 @@ namespace finance
                 _quotes.insert_or_assign(symbol, quote);
         }
 
-        Observable<OnPriceUpdated>::template notify<OnPriceUpdated>();
+        notify<OnPriceUpdated>();
     }
 
     /**
@@ -60,6 +60,31 @@ namespace finance
         return std::nullopt;
     }
 
+    /**
+     * @brief Retrieves the cached price quotes of several symbols under a
+     * single lock, symbols without a quote are left out.
+     *
+     * @param yahooSymbols The Yahoo Finance symbols to look up.
+     * @return The cached price quotes, indexed by their symbols.
+     */
+    std::unordered_map<std::string, PriceQuote> PriceCache::get(
+        const std::vector<std::string>& yahooSymbols
+    ) const
+    {
+        std::unordered_map<std::string, PriceQuote> quotes;
+        quotes.reserve(yahooSymbols.size());
+
+        std::shared_lock lock{_mutex};
+
+        for (const auto& symbol : yahooSymbols)
+        {
+            if (auto it = _quotes.find(symbol); it != _quotes.end())
+                quotes.emplace(symbol, it->second);
+        }
+
+        return quotes;
+    }
+
     /**
      * @brief Clears all cached price quotes.
      *
@@ -70,6 +95,60 @@ namespace finance
         _quotes.clear();
     }
 
+    /**
+     * @brief Watches symbols, so that they are fetched by the price refresh
+     * cycle. Subscribers are notified if a symbol was not watched before.
+     *
+     * @param yahooSymbols The Yahoo Finance symbols to watch.
+     */
+    void PriceCache::watch(const std::vector<std::string>& yahooSymbols)
+    {
+        bool added = false;
+        {
+            std::unique_lock lock{_mutex};
+            for (const auto& symbol : yahooSymbols)
+                added |= ++_watchedSymbols[symbol] == 1;
+        }
+
+        if (added)
+            notify<OnWatchedSymbolsAdded>();
+    }
+
+    /**
+     * @brief Stops watching symbols, a symbol is no longer fetched once every
+     * client that watched it unwatched it. Cached quotes are kept.
+     *
+     * @param yahooSymbols The Yahoo Finance symbols to unwatch.
+     */
+    void PriceCache::unwatch(const std::vector<std::string>& yahooSymbols)
+    {
+        std::unique_lock lock{_mutex};
+        for (const auto& symbol : yahooSymbols)
+        {
+            auto it = _watchedSymbols.find(symbol);
+            if (it != _watchedSymbols.end() && --it->second == 0)
+                _watchedSymbols.erase(it);
+        }
+    }
+
+    /**
+     * @brief Get the symbols watched by at least one client.
+     *
+     * @return std::unordered_set<std::string>
+     */
+    std::unordered_set<std::string> PriceCache::getWatchedSymbols() const
+    {
+        std::shared_lock lock{_mutex};
+
+        std::unordered_set<std::string> symbols;
+        symbols.reserve(_watchedSymbols.size());
+
+        for (const auto& [symbol, _] : _watchedSymbols)
+            symbols.insert(symbol);
+
+        return symbols;
+    }
+
     /**
      * @brief Fetches a price quote from Yahoo Finance.
      *
@@ -132,10 +211,24 @@ namespace finance
         void*                user
     )
     {
-        return Observable<OnPriceUpdated>::template on<OnPriceUpdated>(
-            std::move(callback),
-            user
-        );
+        return on<OnPriceUpdated>(std::move(callback), user);
+    }
+
+    /**
+     * @brief subscribe to newly watched symbols, the callback will be called
+     * whenever a symbol is watched that was not watched before, so that the
+     * refresh cycle can fetch it without waiting for the next poll.
+     *
+     * @param callback
+     * @param user
+     * @return Connection
+     */
+    Connection PriceCache::subscribeToWatchedSymbolsAdded(
+        OnWatchedSymbolsAdded::func callback,
+        void*                       user
+    )
+    {
+        return on<OnWatchedSymbolsAdded>(std::move(callback), user);
     }
 
 }   // namespace finance
@@ -12,14 +12,60 @@ REGISTER_LOG_CATEGORY("Finance.PriceQuote");
 
 namespace finance
 {
+    namespace
+    {
+        /**
+         * @brief Parses the raw value of a price field of the quote JSON.
+         *
+         * @param field The price field, e.g. regularMarketPrice.
+         * @param currency The currency of the price.
+         * @return FinanceResult<Cash>
+         */
+        FinanceResult<Cash> parsePrice(
+            const nlohmann::json& field,
+            Currency              currency
+        )
+        {
+            const auto priceStr =
+                std::to_string(json::safeGet<double>(field, "raw"));
+
+            try
+            {
+                return Cash{
+                    currency,
+                    microUnitsFromString(priceStr, getMicroUnit(currency))
+                };
+            }
+            catch (const std::overflow_error& e)
+            {
+                return FinanceError(
+                    FinanceErrorType::PriceOverflow,
+                    "Invalid price " + priceStr + ": " + e.what()
+                );
+            }
+            catch (const std::invalid_argument& e)
+            {
+                return FinanceError(
+                    FinanceErrorType::InvalidPriceString,
+                    "Invalid price " + priceStr + ": " + e.what()
+                );
+            }
+        }
+    }   // namespace
+
     /**
      * @brief Constructs a PriceQuote object.
      *
      * @param price The price of the financial instrument.
      * @param timestamp The timestamp of the price quote.
+     * @param marketPrice The current market price, if known.
      */
-    PriceQuote::PriceQuote(Cash price, Timestamp timestamp)
-        : _price(price), _timestamp(timestamp)
+    PriceQuote::PriceQuote(
+        Cash                price,
+        Timestamp           timestamp,
+        std::optional<Cash> marketPrice
+    )
+        : _price(price), _timestamp(timestamp), _marketPrice(marketPrice)
     {
     }
 
@@ -48,38 +94,24 @@ namespace finance
         }
         const auto currency = currencyOpt.value();
 
-        const auto priceStr = std::to_string(
-            json::safeGet<double>(data.at("regularMarketPreviousClose"), "raw")
-        );
+        const auto price =
+            parsePrice(data.at("regularMarketPreviousClose"), currency);
 
-        micro_units price = 0;
+        if (!price)
+            return price.error();
 
-        try
-        {
-            price = microUnitsFromString(priceStr, getMicroUnit(currency));
-        }
-        catch (const std::overflow_error& e)
-        {
-            return FinanceError(
-                FinanceErrorType::PriceOverflow,
-                "Invalid price " + priceStr + ": " + e.what()
-            );
-        }
-        catch (const std::invalid_argument& e)
+        // the market price is optional, a quote without it is still valid
+        std::optional<Cash> marketPrice;
+        if (const auto it = data.find("regularMarketPrice"); it != data.end())
         {
-            return FinanceError(
-                FinanceErrorType::InvalidPriceString,
-                "Invalid price " + priceStr + ": " + e.what()
-            );
+            if (auto parsed = parsePrice(*it, currency))
+                marketPrice = parsed.value();
         }
 
         const auto time = json::safeGet<int64_t>(data, "regularMarketTime");
         const auto timeStamp = Timestamp::fromInt64(time);
 
-        return PriceQuote{
-            Cash{currency, price},
-            timeStamp,
-        };
+        return PriceQuote{price.value(), timeStamp, marketPrice};
     }
 
     /**
@@ -93,4 +125,15 @@ namespace finance
         return _price;
     }
 
+    /**
+     * @brief Get the current market price, if it was part of the quote.
+     *
+     * @return const std::optional<Cash>&
+     */
+    [[nodiscard]]
+    const std::optional<Cash>& PriceQuote::getMarketPrice() const
+    {
+        return _marketPrice;
+    }
+
 }   // namespace finance
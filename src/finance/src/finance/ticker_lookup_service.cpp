@@ -0,0 +1,437 @@
+#include "finance/ticker_lookup_service.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <cstdint>
+#include <format>
+#include <fstream>
+#include <system_error>
+
+#include "common/atomic_file.hpp"
+#include "logging/log_macros.hpp"
+
+REGISTER_LOG_CATEGORY("Finance.TickerLookupService");
+
+namespace finance
+{
+    namespace
+    {
+        /**
+         * @brief Serializes a cache entry to JSON
+         *
+         * @param stock
+         * @param fetchedAt
+         * @return nlohmann::json
+         */
+        nlohmann::json _entryToJson(
+            const Stock&                           stock,
+            TickerLookupService::Clock::time_point fetchedAt
+        )
+        {
+            using std::chrono::duration_cast;
+            using std::chrono::seconds;
+
+            const auto epoch =
+                duration_cast<seconds>(fetchedAt.time_since_epoch());
+
+            return nlohmann::json{
+                {"ticker", stock.getTicker()},
+                {"currency", CurrencyMeta::toString(stock.getCurrency())},
+                {"shortName", stock.getShortName()},
+                {"longName", stock.getLongName()},
+                {"exchange", stock.getExchange()},
+                {"industry", stock.getIndustry()},
+                {"sector", stock.getSector()},
+                {"assetClass", AssetClassMeta::toString(stock.getAssetClass())},
+                {"fetchedAt", epoch.count()}
+            };
+        }
+    }   // namespace
+
+    /**
+     * @brief Construct a new Ticker Lookup Service object, loads the persisted
+     * cache and starts the worker thread
+     *
+     * @param cachePath The JSON file the cache is persisted to, an empty path
+     * keeps the cache in memory only
+     * @param ttl The lifetime of a cache entry
+     * @param fetcher The function fetching a single ticker
+     */
+    TickerLookupService::TickerLookupService(
+        std::filesystem::path cachePath,
+        std::chrono::seconds  ttl,
+        Fetcher               fetcher
+    )
+        : _fetcher(std::move(fetcher)),
+          _ttl(ttl),
+          _cachePath(std::move(cachePath))
+    {
+        _load();
+
+        _worker = std::jthread{[this](const std::stop_token& stopToken)
+                               { _run(stopToken); }};
+    }
+
+    /**
+     * @brief Destroy the Ticker Lookup Service object, the worker finishes
+     * the fetch in progress and drops the remaining queue
+     *
+     */
+    TickerLookupService::~TickerLookupService() { stop(); }
+
+    /**
+     * @brief Requests the metadata of a ticker.
+     *
+     * A fresh cached result is returned immediately. Otherwise the ticker is
+     * queued for fetching, unless a fetch of it is already pending, and the
+     * result is delivered to the OnTickerLookedUp subscribers.
+     *
+     * @param ticker
+     * @return std::optional<Stock> The cached stock, std::nullopt if the result
+     * is delivered asynchronously
+     */
+    std::optional<Stock> TickerLookupService::request(const std::string& ticker)
+    {
+        const auto symbol = normalize(ticker);
+
+        {
+            std::scoped_lock lock{_mutex};
+
+            if (auto stock = _findFresh(symbol))
+                return stock;
+
+            if (!_inFlight.insert(symbol).second)
+                return std::nullopt;
+
+            _queue.push_back(symbol);
+        }
+
+        _wakeUp.notify_one();
+        return std::nullopt;
+    }
+
+    /**
+     * @brief Get the cached metadata of a ticker, if it is not expired
+     *
+     * @param ticker
+     * @return std::optional<Stock>
+     */
+    std::optional<Stock> TickerLookupService::getCached(
+        const std::string& ticker
+    ) const
+    {
+        std::scoped_lock lock{_mutex};
+        return _findFresh(normalize(ticker));
+    }
+
+    /**
+     * @brief Checks whether a fetch of the ticker is queued or in progress
+     *
+     * @param ticker
+     * @return true
+     * @return false
+     */
+    bool TickerLookupService::isPending(const std::string& ticker) const
+    {
+        std::scoped_lock lock{_mutex};
+        return _inFlight.contains(normalize(ticker));
+    }
+
+    /**
+     * @brief Clears the cache, including the persisted one
+     *
+     */
+    void TickerLookupService::clear()
+    {
+        {
+            std::scoped_lock lock{_mutex};
+            _cache.clear();
+        }
+
+        _persist();
+    }
+
+    /**
+     * @brief Stops the worker thread, the fetch in progress is finished and
+     * the remaining queue is dropped. No subscriber is notified after this
+     * call returns, calling it more than once is a no-op.
+     *
+     */
+    void TickerLookupService::stop()
+    {
+        _worker.request_stop();
+        if (_worker.joinable())
+            _worker.join();
+    }
+
+    /**
+     * @brief subscribe to finished ticker lookups, the callback is invoked on
+     * the worker thread, clients have to marshal the result to their own
+     * thread
+     *
+     * @param func
+     * @param user
+     * @return Connection
+     */
+    Connection TickerLookupService::subscribeToLookup(
+        OnTickerLookedUp::func func,
+        void*                  user
+    )
+    {
+        std::scoped_lock lock{_signalMutex};
+
+        const auto id = _nextSubscriptionId++;
+        _subscriptions.emplace(
+            id,
+            Observable<OnTickerLookedUp>::template on<OnTickerLookedUp>(
+                std::move(func),
+                user
+            )
+        );
+
+        return Connection::make(this, id, &TickerLookupService::_unsubscribe);
+    }
+
+    /**
+     * @brief Normalizes a ticker symbol, i.e. converts it to upper case
+     *
+     * @param ticker
+     * @return std::string
+     */
+    std::string TickerLookupService::normalize(const std::string& ticker)
+    {
+        std::string symbol{ticker};
+        std::ranges::transform(
+            symbol,
+            symbol.begin(),
+            [](unsigned char character)
+            { return static_cast<char>(std::toupper(character)); }
+        );
+        return symbol;
+    }
+
+    /**
+     * @brief Worker loop, fetches the queued tickers one after another until
+     * a stop is requested
+     *
+     * @param stopToken
+     */
+    void TickerLookupService::_run(const std::stop_token& stopToken)
+    {
+        while (true)
+        {
+            std::string symbol;
+            {
+                std::unique_lock lock{_mutex};
+                _wakeUp.wait(
+                    lock,
+                    stopToken,
+                    [this] { return !_queue.empty(); }
+                );
+
+                // the wait also returns true for a stop with a non-empty
+                // queue, the remaining queue is dropped
+                if (stopToken.stop_requested())
+                    return;
+
+                symbol = std::move(_queue.front());
+                _queue.pop_front();
+            }
+
+            const auto result = _fetcher(symbol);
+
+            {
+                std::scoped_lock lock{_mutex};
+                _inFlight.erase(symbol);
+
+                if (result)
+                {
+                    _cache.insert_or_assign(
+                        symbol,
+                        CacheEntry{result.value(), Clock::now()}
+                    );
+                }
+            }
+
+            if (result)
+                _persist();
+            else
+                LOG_WARNING(
+                    std::format("Could not look up ticker: {}", symbol)
+                );
+
+            std::scoped_lock lock{_signalMutex};
+            Observable<OnTickerLookedUp>::template notify<OnTickerLookedUp>(
+                symbol,
+                result
+            );
+        }
+    }
+
+    /**
+     * @brief Disconnects a subscription under the signal mutex, so that it
+     * never races with a notification of the worker
+     *
+     * @param owner The service the subscription belongs to
+     * @param id The id of the subscription
+     */
+    void TickerLookupService::_unsubscribe(void* owner, std::size_t id)
+    {
+        auto* self = static_cast<TickerLookupService*>(owner);
+
+        std::scoped_lock lock{self->_signalMutex};
+        self->_subscriptions.erase(id);
+    }
+
+    /**
+     * @brief Finds the cached stock of a normalized ticker, expired entries
+     * are ignored -- the caller has to hold the mutex
+     *
+     * @param ticker
+     * @return std::optional<Stock>
+     */
+    std::optional<Stock> TickerLookupService::_findFresh(
+        const std::string& ticker
+    ) const
+    {
+        const auto it = _cache.find(ticker);
+
+        if (it == _cache.end() || Clock::now() - it->second.fetchedAt >= _ttl)
+            return std::nullopt;
+
+        return it->second.stock;
+    }
+
+    /**
+     * @brief Loads the persisted cache, expired and malformed entries are
+     * skipped
+     *
+     */
+    void TickerLookupService::_load()
+    {
+        if (_cachePath.empty() || !std::filesystem::exists(_cachePath))
+            return;
+
+        std::ifstream file{_cachePath};
+        const auto    json = nlohmann::json::parse(file, nullptr, false);
+
+        if (!json.is_array())
+        {
+            LOG_WARNING(
+                std::format(
+                    "Ignoring malformed ticker cache: {}",
+                    _cachePath.string()
+                )
+            );
+            return;
+        }
+
+        const auto now = Clock::now();
+        for (const auto& entry : json)
+        {
+            try
+            {
+                const auto fetchedAt = Clock::time_point{std::chrono::seconds{
+                    entry.at("fetchedAt").get<std::int64_t>()
+                }};
+                if (now - fetchedAt >= _ttl)
+                    continue;
+
+                const auto currency = CurrencyMeta::from_string(
+                    entry.at("currency").get<std::string>()
+                );
+                const auto assetClass = AssetClassMeta::from_string(
+                    entry.at("assetClass").get<std::string>()
+                );
+                if (!currency || !assetClass)
+                    continue;
+
+                Stock stock{
+                    entry.at("ticker").get<std::string>(),
+                    currency.value(),
+                    entry.at("shortName").get<std::string>(),
+                    entry.at("longName").get<std::string>(),
+                    entry.at("exchange").get<std::string>(),
+                    entry.at("industry").get<std::string>(),
+                    entry.at("sector").get<std::string>(),
+                    assetClass.value()
+                };
+
+                auto symbol = normalize(stock.getTicker());
+                _cache.insert_or_assign(
+                    std::move(symbol),
+                    CacheEntry{std::move(stock), fetchedAt}
+                );
+            }
+            catch (const nlohmann::json::exception&)
+            {
+                continue;
+            }
+        }
+    }
+
+    /**
+     * @brief Snapshots and persists the cache under the file mutex, so that
+     * an older snapshot never overwrites a newer one
+     *
+     */
+    void TickerLookupService::_persist() const
+    {
+        if (_cachePath.empty())
+            return;
+
+        std::scoped_lock fileLock{_fileMutex};
+
+        nlohmann::json json;
+        {
+            std::scoped_lock lock{_mutex};
+            json = _toJson();
+        }
+
+        _save(json);
+    }
+
+    /**
+     * @brief Persists the cache atomically, a crash never leaves a truncated
+     * cache behind -- the caller has to hold the file mutex
+     *
+     * @param json The serialized cache
+     */
+    void TickerLookupService::_save(const nlohmann::json& json) const
+    {
+        std::error_code errorCode;
+        std::filesystem::create_directories(
+            _cachePath.parent_path(),
+            errorCode
+        );
+
+        if (!common::writeFileAtomically(_cachePath, json.dump()))
+        {
+            LOG_ERROR(
+                std::format(
+                    "Could not write ticker cache: {}",
+                    _cachePath.string()
+                )
+            );
+        }
+    }
+
+    /**
+     * @brief Serializes the unexpired cache entries -- the caller has to hold
+     * the mutex
+     *
+     * @return nlohmann::json
+     */
+    nlohmann::json TickerLookupService::_toJson() const
+    {
+        const auto now  = Clock::now();
+        auto       json = nlohmann::json::array();
+
+        for (const auto& [_, entry] : _cache)
+            if (now - entry.fetchedAt < _ttl)
+                json.push_back(_entryToJson(entry.stock, entry.fetchedAt));
+
+        return json;
+    }
+
+}   // namespace finance
@@ -0,0 +1,551 @@
+#include "finance/transaction/broker_statement.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <charconv>
+#include <chrono>
+#include <exception>
+#include <format>
+#include <string>
+#include <utility>
+
+#include "common/currency.hpp"
+
+namespace finance
+{
+    namespace
+    {
+        /// Maximum number of header names of a column
+        constexpr std::size_t MAX_ALIASES = 3;
+
+        /// Header names of every column of a layout, in StatementColumn order
+        using ColumnNames = std::array<
+            std::array<std::string_view, MAX_ALIASES>,
+            StatementColumnMeta::size>;
+
+        /// Columns of the generic layout
+        constexpr ColumnNames GENERIC_COLUMNS{{
+            {"date"},
+            {"type"},
+            {"account"},
+            {"cash_account"},
+            {"symbol"},
+            {"quantity"},
+            {"price"},
+            {"amount"},
+            {"fees"},
+            {"currency"},
+            {"comment"},
+        }};
+
+        /// Columns of Interactive Brokers flex query and activity exports
+        constexpr ColumnNames INTERACTIVE_BROKERS_COLUMNS{{
+            {"DateTime", "TradeDate", "Date/Time"},
+            {"Buy/Sell", "Type"},
+            {"ClientAccountID", "Account"},
+            {},
+            {"Symbol"},
+            {"Quantity"},
+            {"TradePrice", "T. Price"},
+            {"Amount"},
+            {"IBCommission", "Comm/Fee"},
+            {"CurrencyPrimary", "Currency"},
+            {"Description"},
+        }};
+
+        /**
+         * @brief Get the header names of a layout
+         *
+         * @param layout
+         * @return const ColumnNames&
+         */
+        const ColumnNames& columnNames(BrokerLayout layout)
+        {
+            switch (layout)
+            {
+                case BrokerLayout::Generic:
+                    return GENERIC_COLUMNS;
+                case BrokerLayout::InteractiveBrokers:
+                    return INTERACTIVE_BROKERS_COLUMNS;
+            }
+
+            std::unreachable();
+        }
+
+        /**
+         * @brief Compares two strings ignoring the case of ASCII letters
+         *
+         * @param lhs
+         * @param rhs
+         * @return true
+         * @return false
+         */
+        bool equalsIgnoreCase(std::string_view lhs, std::string_view rhs)
+        {
+            return std::ranges::equal(
+                lhs,
+                rhs,
+                [](unsigned char left, unsigned char right)
+                { return std::tolower(left) == std::tolower(right); }
+            );
+        }
+
+        /**
+         * @brief Checks whether a header is one of the names of a column
+         *
+         * @param aliases The names of the column
+         * @param header
+         * @return true
+         * @return false
+         */
+        bool isAlias(
+            const std::array<std::string_view, MAX_ALIASES>& aliases,
+            std::string_view                                 header
+        )
+        {
+            return std::ranges::any_of(
+                aliases,
+                [header](std::string_view alias)
+                { return !alias.empty() && equalsIgnoreCase(alias, header); }
+            );
+        }
+
+        /**
+         * @brief Picks the delimiter of the first line, exports of European
+         * locales use semicolons since the comma is their decimal separator
+         *
+         * @param data
+         * @return char
+         */
+        char detectDelimiter(std::string_view data)
+        {
+            const auto header = data.substr(0, data.find('\n'));
+
+            const auto commas     = std::ranges::count(header, ',');
+            const auto semicolons = std::ranges::count(header, ';');
+
+            return semicolons > commas ? ';' : ',';
+        }
+
+        /**
+         * @brief Parses a fixed width unsigned number
+         *
+         * @param digits
+         * @param value
+         * @return true if all characters were digits
+         * @return false otherwise
+         */
+        bool parseDigits(std::string_view digits, int& value)
+        {
+            if (digits.empty() ||
+                !std::ranges::all_of(
+                    digits,
+                    [](unsigned char character)
+                    { return std::isdigit(character) != 0; }
+                ))
+                return false;
+
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+            const auto end = digits.data() + digits.size();
+            return std::from_chars(digits.data(), end, value).ptr == end;
+        }
+
+        /**
+         * @brief Parses a decimal number into micro units of the given
+         * precision, a leading '+' is accepted
+         *
+         * @param value
+         * @param precision
+         * @return std::optional<micro_units> std::nullopt if the value is
+         * malformed or out of range
+         */
+        std::optional<micro_units> parseNumber(
+            std::string_view value,
+            std::uint8_t     precision
+        )
+        {
+            if (value.starts_with('+'))
+                value.remove_prefix(1);
+
+            try
+            {
+                return microUnitsFromString(value, precision);
+            }
+            catch (const std::exception&)
+            {
+                return std::nullopt;
+            }
+        }
+
+        /**
+         * @brief Builds the error of a malformed row
+         *
+         * @param line
+         * @param message
+         * @return FinanceError
+         */
+        FinanceError rowError(std::size_t line, std::string_view message)
+        {
+            return FinanceError{
+                FinanceErrorType::InvalidStatement,
+                std::format("line {}: {}", line, message)
+            };
+        }
+    }   // namespace
+
+    /**
+     * @brief Construct a new Statement Parser object, the delimiter is taken
+     * from the header line
+     *
+     * @param data The statement data, it has to outlive the parser and the
+     * returned rows
+     * @param layout The layout of the statement
+     */
+    StatementParser::StatementParser(std::string_view data, BrokerLayout layout)
+        : _reader(data, detectDelimiter(data)), _layout(layout)
+    {
+        _columns.fill(NO_COLUMN);
+    }
+
+    /**
+     * @brief Reads the header and maps the columns of the layout
+     *
+     * @return FinanceResult<void> an error if the statement is empty or
+     * required columns are missing
+     */
+    FinanceResult<void> StatementParser::readHeader()
+    {
+        if (!_reader.next(_fields))
+        {
+            return FinanceError{
+                FinanceErrorType::InvalidStatement,
+                "The statement is empty"
+            };
+        }
+
+        const auto& names = columnNames(_layout);
+
+        for (std::size_t i = 0; i < _fields.size(); ++i)
+        {
+            const auto header = CsvReader::trim(_fields[i]);
+
+            for (std::size_t column = 0; column < names.size(); ++column)
+            {
+                if (isAlias(names[column], header) &&
+                    _columns[column] == NO_COLUMN)
+                    _columns[column] = i;
+            }
+        }
+
+        const bool trades = hasColumn(StatementColumn::Symbol) &&
+                            hasColumn(StatementColumn::Quantity) &&
+                            hasColumn(StatementColumn::Price);
+
+        if (!hasColumn(StatementColumn::Date) ||
+            !hasColumn(StatementColumn::Currency) ||
+            (!trades && !hasColumn(StatementColumn::Amount)))
+        {
+            return FinanceError{
+                FinanceErrorType::InvalidStatement,
+                std::format(
+                    "The header does not match the {} layout",
+                    BrokerLayoutMeta::toString(_layout)
+                )
+            };
+        }
+
+        return FinanceResult<void>{};
+    }
+
+    /**
+     * @brief Parses the next row
+     *
+     * @return std::optional<FinanceResult<StatementRow>> std::nullopt at the
+     * end of the statement, an error if the row is malformed
+     */
+    std::optional<FinanceResult<StatementRow>> StatementParser::next()
+    {
+        while (_reader.next(_fields))
+        {
+            if (_isHeaderRow())
+                continue;
+
+            return _parseRow();
+        }
+
+        return std::nullopt;
+    }
+
+    /**
+     * @brief Checks whether the statement has a column
+     *
+     * @param column
+     * @return true
+     * @return false
+     */
+    bool StatementParser::hasColumn(StatementColumn column) const
+    {
+        return _columns[static_cast<std::size_t>(column)] != NO_COLUMN;
+    }
+
+    /**
+     * @brief Get the number of bytes parsed so far
+     *
+     * @return std::size_t
+     */
+    std::size_t StatementParser::getOffset() const
+    {
+        return _reader.getOffset();
+    }
+
+    /**
+     * @brief Get the size of the statement in bytes
+     *
+     * @return std::size_t
+     */
+    std::size_t StatementParser::getSize() const { return _reader.getSize(); }
+
+    /**
+     * @brief Parses the date and optional time of a statement row.
+     *
+     * Dates are accepted as YYYY-MM-DD or YYYYMMDD, optionally followed by
+     * the time as HH:MM[:SS] or HHMMSS, separated by a space, 'T', ';' or
+     * ','. Anything after the time (e.g. a time zone) is ignored and the time
+     * is taken as UTC.
+     *
+     * @param value
+     * @return std::optional<Timestamp> std::nullopt if the date is malformed
+     */
+    std::optional<Timestamp> StatementParser::parseTimestamp(
+        std::string_view value
+    )
+    {
+        using namespace std::chrono;
+
+        int              yearValue  = 0;
+        int              monthValue = 0;
+        int              dayValue   = 0;
+        std::string_view rest;
+
+        if (value.size() >= 10 && value[4] == '-' && value[7] == '-')
+        {
+            if (!parseDigits(value.substr(0, 4), yearValue) ||
+                !parseDigits(value.substr(5, 2), monthValue) ||
+                !parseDigits(value.substr(8, 2), dayValue))
+                return std::nullopt;
+
+            rest = value.substr(10);
+        }
+        else if (value.size() >= 8)
+        {
+            if (!parseDigits(value.substr(0, 4), yearValue) ||
+                !parseDigits(value.substr(4, 2), monthValue) ||
+                !parseDigits(value.substr(6, 2), dayValue))
+                return std::nullopt;
+
+            rest = value.substr(8);
+        }
+        else
+            return std::nullopt;
+
+        const year_month_day date{
+            year{yearValue},
+            month{static_cast<unsigned>(monthValue)},
+            day{static_cast<unsigned>(dayValue)}
+        };
+
+        if (!date.ok())
+            return std::nullopt;
+
+        while (!rest.empty() && (rest.front() == ' ' || rest.front() == 'T' ||
+                                 rest.front() == ';' || rest.front() == ','))
+            rest.remove_prefix(1);
+
+        int hourValue   = 0;
+        int minuteValue = 0;
+        int secondValue = 0;
+
+        if (rest.size() >= 5 && rest[2] == ':')
+        {
+            if (!parseDigits(rest.substr(0, 2), hourValue) ||
+                !parseDigits(rest.substr(3, 2), minuteValue))
+                return std::nullopt;
+
+            if (rest.size() >= 8 && rest[5] == ':' &&
+                !parseDigits(rest.substr(6, 2), secondValue))
+                return std::nullopt;
+        }
+        else if (rest.size() >= 6)
+        {
+            if (!parseDigits(rest.substr(0, 2), hourValue) ||
+                !parseDigits(rest.substr(2, 2), minuteValue) ||
+                !parseDigits(rest.substr(4, 2), secondValue))
+                return std::nullopt;
+        }
+
+        const auto timePoint = sys_days{date} + hours{hourValue} +
+                               minutes{minuteValue} + seconds{secondValue};
+
+        return Timestamp::fromInt64(
+            duration_cast<milliseconds>(timePoint.time_since_epoch()).count()
+        );
+    }
+
+    /**
+     * @brief Get the trimmed field of a column in the current row
+     *
+     * @param column
+     * @return std::string_view empty if the column is missing
+     */
+    std::string_view StatementParser::_field(StatementColumn column) const
+    {
+        const auto index = _columns[static_cast<std::size_t>(column)];
+
+        if (index == NO_COLUMN || index >= _fields.size())
+            return {};
+
+        return CsvReader::trim(_fields[index]);
+    }
+
+    /**
+     * @brief Checks whether the current row repeats the header
+     *
+     * @return true
+     * @return false
+     */
+    bool StatementParser::_isHeaderRow() const
+    {
+        const auto& names = columnNames(_layout);
+
+        return isAlias(
+            names[static_cast<std::size_t>(StatementColumn::Date)],
+            _field(StatementColumn::Date)
+        );
+    }
+
+    /**
+     * @brief Parses the current row.
+     *
+     * A row is a trade if its type is a buy or a sell, rows without a type
+     * column are trades if they name a symbol. Sells and withdrawals are
+     * negated if the statement reports them as positive numbers, fees are
+     * always positive.
+     *
+     * @return FinanceResult<StatementRow>
+     */
+    FinanceResult<StatementRow> StatementParser::_parseRow() const
+    {
+        StatementRow row;
+        row.line = _reader.getLine();
+
+        const auto date      = _field(StatementColumn::Date);
+        const auto timestamp = parseTimestamp(date);
+
+        if (!timestamp)
+            return rowError(row.line, std::format("invalid date '{}'", date));
+
+        row.timestamp = timestamp.value();
+
+        const auto code     = _field(StatementColumn::Currency);
+        const auto currency = CurrencyMeta::from_string(std::string{code});
+
+        if (!currency || currency == Currency::Unknown)
+        {
+            return rowError(
+                row.line,
+                std::format("unknown currency '{}'", code)
+            );
+        }
+
+        row.currency    = currency.value();
+        row.account     = _field(StatementColumn::Account);
+        row.cashAccount = _field(StatementColumn::CashAccount);
+        row.symbol      = _field(StatementColumn::Symbol);
+        row.comment     = _field(StatementColumn::Comment);
+
+        const auto type = _field(StatementColumn::Type);
+        const auto is   = [type](std::string_view name)
+        { return equalsIgnoreCase(type, name); };
+
+        const bool sell  = is("sell") || is("sld");
+        const bool trade = type.empty() ? !row.symbol.empty()
+                                        : sell || is("buy") || is("bot");
+
+        const auto precision = getMicroUnit(row.currency);
+
+        if (const auto fees = _field(StatementColumn::Fees); !fees.empty())
+        {
+            const auto value = parseNumber(fees, precision);
+            if (!value)
+            {
+                return rowError(
+                    row.line,
+                    std::format("invalid fees '{}'", fees)
+                );
+            }
+
+            row.fees = Cash{row.currency, *value < 0 ? -*value : *value};
+        }
+        else
+            row.fees = Cash{row.currency, 0};
+
+        if (trade)
+        {
+            row.kind = StatementRowKind::Trade;
+
+            if (row.symbol.empty())
+                return rowError(row.line, "trade without symbol");
+
+            const auto quantityField = _field(StatementColumn::Quantity);
+            const auto quantity =
+                parseNumber(quantityField, Quantity::precision);
+
+            if (!quantity || *quantity == 0)
+            {
+                return rowError(
+                    row.line,
+                    std::format("invalid quantity '{}'", quantityField)
+                );
+            }
+
+            const auto priceField = _field(StatementColumn::Price);
+            const auto price      = parseNumber(priceField, precision);
+
+            if (!price || *price < 0)
+            {
+                return rowError(
+                    row.line,
+                    std::format("invalid price '{}'", priceField)
+                );
+            }
+
+            row.quantity =
+                Quantity{sell && *quantity > 0 ? -*quantity : *quantity};
+            row.price    = Cash{row.currency, *price};
+        }
+        else
+        {
+            row.kind = StatementRowKind::Cash;
+
+            const auto amountField = _field(StatementColumn::Amount);
+            const auto amount      = parseNumber(amountField, precision);
+
+            if (!amount || *amount == 0)
+            {
+                return rowError(
+                    row.line,
+                    std::format("invalid amount '{}'", amountField)
+                );
+            }
+
+            const bool outflow = is("withdrawal") || is("fee");
+            row.amount = Cash{
+                row.currency,
+                outflow && *amount > 0 ? -*amount : *amount
+            };
+        }
+
+        return row;
+    }
+
+}   // namespace finance
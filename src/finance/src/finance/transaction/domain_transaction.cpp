@@ -257,27 +257,108 @@ namespace finance
     }
 
     /**
-     * @brief Checks if the transaction has a specific position ID
+     * @brief Replaces remapped account, instrument and position ids in the
+     * entries and trade legs in place, ids not contained in the remaps are
+     * left untouched. This is used by the store to swap temporary ids for the
+     * ids assigned by the database after a commit.
      *
-     * @param id
-     * @return true
-     * @return false
+     * @param accountRemap Mapping of old to new account IDs
+     * @param instrumentRemap Mapping of old to new instrument IDs
+     * @param positionRemap Mapping of old to new position IDs
+     * @return true If at least one id was replaced
+     * @return false Otherwise
      */
-    bool DomainTransaction::hasPositionId(PositionId id) const
+    bool DomainTransaction::remapIds(
+        const IdIdMap<AccountId>&    accountRemap,
+        const IdIdMap<InstrumentId>& instrumentRemap,
+        const IdIdMap<PositionId>&   positionRemap
+    )
     {
+        bool modified = false;
+
+        for (auto& entry : _entries)
+        {
+            const auto accountId = entry.getAccountId();
+            if (accountRemap.contains(accountId))
+            {
+                entry.setAccountId(accountRemap.at(accountId));
+                modified = true;
+            }
+        }
+
+        TradeLegs* legs = nullptr;
         switch (getType())
         {
             case TransactionDataType::Stock:
-                return std::get<StockData>(_data).getPositionId() == id;
+                legs = &std::get<StockData>(_data).getLegs();
+                break;
             case TransactionDataType::Option:
-                return std::get<OptionData>(_data).getPositionId() == id;
+                legs = &std::get<OptionData>(_data).getLegs();
+                break;
             case TransactionDataType::Cash:
-                return false;
+                return modified;
+        }
+
+        for (auto& leg : *legs)
+        {
+            const auto accountId = leg.getAccountId();
+            if (accountRemap.contains(accountId))
+            {
+                leg.setAccountId(accountRemap.at(accountId));
+                modified = true;
+            }
+
+            const auto instrumentId = leg.getInstrumentId();
+            if (instrumentRemap.contains(instrumentId))
+            {
+                leg.setInstrumentId(instrumentRemap.at(instrumentId));
+                modified = true;
+            }
+
+            const auto positionId = leg.getPositionId();
+            if (positionRemap.contains(positionId))
+            {
+                leg.setPositionId(positionRemap.at(positionId));
+                modified = true;
+            }
+        }
+
+        return modified;
+    }
+
+    /**
+     * @brief Get the position ID of the transaction, cash transactions do not
+     * belong to any position.
+     *
+     * @return std::optional<PositionId>
+     */
+    std::optional<PositionId> DomainTransaction::getPositionId() const
+    {
+        switch (getType())
+        {
+            case TransactionDataType::Stock:
+                return std::get<StockData>(_data).getPositionId();
+            case TransactionDataType::Option:
+                return std::get<OptionData>(_data).getPositionId();
+            case TransactionDataType::Cash:
+                return std::nullopt;
         }
 
         std::unreachable();
     }
 
+    /**
+     * @brief Checks if the transaction has a specific position ID
+     *
+     * @param id
+     * @return true
+     * @return false
+     */
+    bool DomainTransaction::hasPositionId(PositionId id) const
+    {
+        return getPositionId() == id;
+    }
+
     /**
      * @brief Checks if the transaction has a specific instrument ID
      *
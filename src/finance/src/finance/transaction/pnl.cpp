@@ -4,7 +4,9 @@
 
 #include "common/cash.hpp"
 #include "common/finance.hpp"
+#include "common/worker_pool.hpp"
 #include "error/finance_error.hpp"
+#include "logging/tracer.hpp"
 
 namespace finance
 {
@@ -280,6 +282,37 @@ namespace finance
 
             return state;
         }
+
+        /**
+         * @brief Folds a sequence of position events without tracing, used
+         * for the many small folds of foldPositions()
+         *
+         * @param state The initial position state to start folding from.
+         * @param events A span of position events to be applied to the state.
+         * @return PnLResult<PositionState>
+         */
+        PnLResult<PositionState> _foldEvents(
+            PositionState                  state,
+            std::span<const PositionEvent> events
+        )
+        {
+            for (const auto& event : events)
+            {
+                if (const auto* stock = std::get_if<StockTrade>(&event.data))
+                {
+                    state = apply(std::move(state), *stock);
+                }
+                else
+                {
+                    const auto& option = std::get<OptionTrade>(event.data);
+                    auto        result = apply(std::move(state), option);
+                    if (!result)
+                        return result.error();
+                    state = std::move(result.value());
+                }
+            }
+            return state;
+        }
     }   // namespace
 
     /**
@@ -296,22 +329,9 @@ namespace finance
         std::span<const PositionEvent> events
     )
     {
-        for (const auto& event : events)
-        {
-            if (const auto* stock = std::get_if<StockTrade>(&event.data))
-            {
-                state = apply(std::move(state), *stock);
-            }
-            else
-            {
-                const auto& option = std::get<OptionTrade>(event.data);
-                auto        result = apply(std::move(state), option);
-                if (!result)
-                    return result.error();
-                state = std::move(result.value());
-            }
-        }
-        return state;
+        TRACE_SCOPE("Finance.FoldEvents");
+
+        return _foldEvents(std::move(state), events);
     }
 
     /**
@@ -379,6 +399,69 @@ namespace finance
         };
     }
 
+    /**
+     * @brief Folds the events of many independent positions, partitioned into
+     * contiguous chunks over the shared WorkerPool.
+     *
+     * The calling thread folds chunks as well. Every chunk only writes its
+     * own result slots, so the results are in the order of the input
+     * regardless of the scheduling. Small batches are folded on the calling
+     * thread.
+     *
+     * @param positions The sorted events of each position.
+     * @param maxWorkers The maximum number of chunks, i.e. threads working on
+     * the batch, 0 for the size of the pool plus the calling thread.
+     * @return std::vector<PnLResult<PositionState>> The folded state of each
+     * position, in input order.
+     */
+    std::vector<PnLResult<PositionState>> foldPositions(
+        std::span<const PositionEvents> positions,
+        std::size_t                     maxWorkers
+    )
+    {
+        TRACE_SCOPE("Finance.FoldPositions");
+
+        std::vector<PnLResult<PositionState>> results(
+            positions.size(),
+            PositionState{}
+        );
+
+        const auto foldRange = [&](std::size_t first, std::size_t last)
+        {
+            for (auto i = first; i < last; ++i)
+                results[i] = _foldEvents(PositionState{}, positions[i]);
+        };
+
+        auto& pool = WorkerPool::getInstance();
+
+        if (maxWorkers == 0)
+            maxWorkers = pool.size() + 1;
+
+        const auto nWorkers = std::min(
+            maxWorkers,
+            positions.size() / MIN_POSITIONS_PER_WORKER
+        );
+
+        if (nWorkers <= 1)
+        {
+            foldRange(0, positions.size());
+            return results;
+        }
+
+        const auto chunk = (positions.size() + nWorkers - 1) / nWorkers;
+        const auto end   = [&](std::size_t worker)
+        { return std::min(positions.size(), (worker + 1) * chunk); };
+
+        // exceptions (e.g. currency mismatches) are rethrown on the calling
+        // thread once all chunks are done
+        pool.parallelFor(
+            nWorkers,
+            [&](std::size_t worker) { foldRange(worker * chunk, end(worker)); }
+        );
+
+        return results;
+    }
+
     /**
      * @brief Get the average cost of the position, which is calculated as the
      * cost basis divided by the quantity of the position, representing the
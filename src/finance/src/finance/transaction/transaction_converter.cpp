@@ -2,6 +2,7 @@
 
 #include <cassert>
 #include <variant>
+#include <vector>
 
 #include "common/finance.hpp"
 #include "config/id_types.hpp"
@@ -11,6 +12,7 @@
 #include "finance/transaction/stock_data.hpp"
 #include "finance/transaction/stock_transaction.hpp"
 #include "finance/transaction/transaction_entries.hpp"
+#include "finance/transaction/transactions.hpp"
 #include "logging/log_macros.hpp"
 
 REGISTER_LOG_CATEGORY("Finance.Transaction.TransactionConverter")
@@ -85,6 +87,32 @@ namespace finance
             return FinanceResult<void>{};
         }
 
+        /**
+         * @brief Resolve the external account corresponding to a cash account
+         *
+         * @throws std::runtime_error if there is no corresponding external
+         * account
+         */
+        AccountId _getExternalAccountId(
+            const AccountId& cashAccountId,
+            const Accounts&  accounts
+        )
+        {
+            const auto externalAccountId =
+                accounts.getCorrespondingExternalAccountId(cashAccountId);
+
+            if (!externalAccountId.isValid())
+            {
+                throw std::runtime_error(
+                    "No corresponding external account found for cash "
+                    "account: " +
+                    cashAccountId.toString()
+                );
+            }
+
+            return externalAccountId;
+        }
+
     }   // namespace
     /**
      * @brief Converts a CashTransaction to a DomainTransaction, this
@@ -103,17 +131,7 @@ namespace finance
     )
     {
         const auto externalAccountId =
-            accounts.getCorrespondingExternalAccountId(
-                transaction.getCashAccountId()
-            );
-
-        if (!externalAccountId.isValid())
-        {
-            throw std::runtime_error(
-                "No corresponding external account found for cash account: " +
-                transaction.getCashAccountId().toString()
-            );
-        }
+            _getExternalAccountId(transaction.getCashAccountId(), accounts);
 
         return DomainTransaction{
             transaction.getId(),
@@ -141,17 +159,7 @@ namespace finance
     )
     {
         const auto externalAccountId =
-            accounts.getCorrespondingExternalAccountId(
-                transaction.getCashAccountId()
-            );
-
-        if (!externalAccountId.isValid())
-        {
-            throw std::runtime_error(
-                "No corresponding external account found for cash account: " +
-                transaction.getCashAccountId().toString()
-            );
-        }
+            _getExternalAccountId(transaction.getCashAccountId(), accounts);
         return DomainTransaction{
             transaction.getId(),
             transaction.getTimestamp(),
@@ -179,17 +187,7 @@ namespace finance
     )
     {
         const auto externalAccountId =
-            accounts.getCorrespondingExternalAccountId(
-                transaction.getCashAccountId()
-            );
-
-        if (!externalAccountId.isValid())
-        {
-            throw std::runtime_error(
-                "No corresponding external account found for cash account: " +
-                transaction.getCashAccountId().toString()
-            );
-        }
+            _getExternalAccountId(transaction.getCashAccountId(), accounts);
 
         return DomainTransaction{
             transaction.getId(),
@@ -200,6 +198,40 @@ namespace finance
         };
     }
 
+    /**
+     * @brief Converts all transactions of a Transactions set to
+     * DomainTransactions, cash transactions first, followed by stock and
+     * option transactions.
+     *
+     * @param transactions
+     * @param accounts
+     *
+     * @return std::vector<DomainTransaction>
+     */
+    std::vector<DomainTransaction> TransactionConverter::toDomain(
+        const Transactions& transactions,
+        const Accounts&     accounts
+    )
+    {
+        const auto& cash    = transactions.cash();
+        const auto& stocks  = transactions.stocks();
+        const auto& options = transactions.options();
+
+        std::vector<DomainTransaction> result;
+        result.reserve(cash.size() + stocks.size() + options.size());
+
+        for (const auto& transaction : cash)
+            result.push_back(toDomain(transaction, accounts));
+
+        for (const auto& transaction : stocks)
+            result.push_back(toDomain(transaction, accounts));
+
+        for (const auto& transaction : options)
+            result.push_back(toDomain(transaction, accounts));
+
+        return result;
+    }
+
     /**
      * @brief Converts a DomainTransaction to a CashTransaction, this
      * will take the relevant information from the DomainTransaction and format
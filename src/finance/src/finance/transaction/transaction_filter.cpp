@@ -4,6 +4,7 @@
 #include <sstream>
 
 #include "config/strong_id.hpp"
+#include "filter/leaves.hpp"
 #include "finance/transaction/domain_transaction.hpp"
 
 namespace finance
@@ -23,15 +24,14 @@ namespace finance
             const IdSet<PositionId>& positionIds
         )
         {
-            return filter::makePredicate<DomainTransaction>(
-                [positionIds](const DomainTransaction& transaction)
+            return filter::makeIdSetPredicate<DomainTransaction>(
+                [](const DomainTransaction& transaction,
+                   const filter::IdList&    ids)
                 {
-                    return std::ranges::any_of(
-                        positionIds,
-                        [&](const auto& positionId)
-                        { return transaction.hasPositionId(positionId); }
-                    );
-                }
+                    const auto positionId = transaction.getPositionId();
+                    return positionId && ids.contains(positionId->value());
+                },
+                filter::IdList::fromIds(positionIds)
             );
         }
 
@@ -46,25 +46,40 @@ namespace finance
             const IdSet<TransactionId>& transactionIds
         )
         {
-            return filter::makePredicate<DomainTransaction>(
-                [transactionIds](const DomainTransaction& transaction)
-                { return transactionIds.contains(transaction.getId()); }
+            return filter::makeIdSetPredicate<DomainTransaction>(
+                [](const DomainTransaction& transaction,
+                   const filter::IdList&    ids)
+                { return ids.contains(transaction.getId().value()); },
+                filter::IdList::fromIds(transactionIds)
             );
         }
 
+        /**
+         * @brief Get a predicate function that can be used to filter
+         * transactions involving any of the specified accounts, either via
+         * one of their entries or one of their trade legs.
+         *
+         * @param accountIds
+         * @return filter::Predicate<DomainTransaction>
+         */
         filter::Predicate<DomainTransaction> HasAccountId(
             const IdSet<AccountId>& accountIds
         )
         {
-            return filter::makePredicate<DomainTransaction>(
-                [accountIds](const DomainTransaction& transaction)
+            return filter::makeIdSetPredicate<DomainTransaction>(
+                [](const DomainTransaction& transaction,
+                   const filter::IdList&    ids)
                 {
+                    const auto involved = [&ids](const auto& item)
+                    { return ids.contains(item.getAccountId().value()); };
+
                     return std::ranges::any_of(
-                        accountIds,
-                        [&](const auto& accountId)
-                        { return transaction.isAccountInvolved(accountId); }
-                    );
-                }
+                               transaction.getEntries(),
+                               involved
+                           ) ||
+                           std::ranges::any_of(transaction.getLegs(), involved);
+                },
+                filter::IdList::fromIds(accountIds)
             );
         }
     }   // namespace
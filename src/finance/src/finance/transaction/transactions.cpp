@@ -2,6 +2,8 @@
 
 #include <algorithm>
 #include <cmath>
+#include <cstddef>
+#include <utility>
 #include <vector>
 
 #include "common/container/set.hpp"
@@ -93,11 +95,11 @@ namespace finance
      * @param optionTransactions
      */
     SecurityView::SecurityView(
-        StockTransactions  stockTransactions,
-        OptionTransactions optionTransactions
+        std::span<const StockTransaction>  stockTransactions,
+        std::span<const OptionTransaction> optionTransactions
     )
-        : _stockTransactions(std::move(stockTransactions)),
-          _optionTransactions(std::move(optionTransactions))
+        : _stockTransactions(stockTransactions),
+          _optionTransactions(optionTransactions)
     {
     }
 
@@ -108,12 +110,13 @@ namespace finance
      */
     IdSet<InstrumentId> SecurityView::getBaseInstrumentIds() const
     {
-        auto instrumentIds = _stockTransactions.getBaseInstrumentIds();
+        IdSet<InstrumentId> instrumentIds;
+        for (const auto& tx : _stockTransactions)
+            instrumentIds.insert(tx.getInstrumentId());
 
-        IdSet<InstrumentId> ids;
         for (const auto& tx : _optionTransactions)
-            ids.insert(tx.getInstrumentId());
-        instrumentIds.combine(ids);
+            instrumentIds.insert(tx.getInstrumentId());
+
         return instrumentIds;
     }
 
@@ -154,7 +157,10 @@ namespace finance
      */
     SecurityView Transactions::TransactionsImpl::securities() const
     {
-        return SecurityView(_stockTransactions, _optionTransactions);
+        return SecurityView(
+            _stockTransactions.getItems(),
+            _optionTransactions.getItems()
+        );
     }
 
     /**
@@ -468,37 +474,59 @@ namespace finance
 
     /**
      * @brief Group the transactions by position ID, this will create a map of
-     * PositionId to Transactions, where each entry in the map contains all
+     * PositionId to TransactionsView, where each entry in the map views all
      * transactions associated with that position ID.
      *
-     * @return IdMap<PositionId, Transactions>
+     * The views share the storage of this object, only their index lists are
+     * allocated.
+     *
+     * @return IdMap<PositionId, TransactionsView>
      */
-    IdMap<PositionId, Transactions> Transactions::groupByPosition() const
+    IdMap<PositionId, TransactionsView> Transactions::groupByPosition() const
     {
-        IdMap<PositionId, Transactions> positionMap;
+        // stock and option indices of one position
+        using Indices =
+            std::pair<std::vector<std::size_t>, std::vector<std::size_t>>;
 
-        for (const auto& transaction : stocks())
+        IdMap<PositionId, Indices> positionIndices;
+
+        const auto& stockItems = stocks().getItems();
+        for (std::size_t index = 0; index < stockItems.size(); ++index)
         {
-            const auto positionId = transaction.getPositionId();
-            if (positionId.isValid())
-            {
-                if (!positionMap.contains(positionId))
-                    positionMap.addUnchecked(positionId, Transactions());
+            const auto positionId = stockItems[index].getPositionId();
+            if (!positionId.isValid())
+                continue;
 
-                positionMap.at(positionId).addTransaction(transaction);
-            }
+            if (!positionIndices.contains(positionId))
+                positionIndices.addUnchecked(positionId, Indices{});
+
+            positionIndices.at(positionId).first.push_back(index);
         }
 
-        for (const auto& transaction : options())
+        const auto& optionItems = options().getItems();
+        for (std::size_t index = 0; index < optionItems.size(); ++index)
         {
-            const auto positionId = transaction.getPositionId();
-            if (positionId.isValid())
-            {
-                if (!positionMap.contains(positionId))
-                    positionMap.addUnchecked(positionId, Transactions());
+            const auto positionId = optionItems[index].getPositionId();
+            if (!positionId.isValid())
+                continue;
 
-                positionMap.at(positionId).addTransaction(transaction);
-            }
+            if (!positionIndices.contains(positionId))
+                positionIndices.addUnchecked(positionId, Indices{});
+
+            positionIndices.at(positionId).second.push_back(index);
+        }
+
+        IdMap<PositionId, TransactionsView> positionMap;
+        for (auto& [positionId, indices] : positionIndices)
+        {
+            positionMap.addUnchecked(
+                positionId,
+                TransactionsView{
+                    *this,
+                    std::move(indices.first),
+                    std::move(indices.second)
+                }
+            );
         }
 
         return positionMap;
@@ -579,4 +607,90 @@ namespace finance
         return options().getBaseInstrumentIds();
     }
 
-}   // namespace finance
\ No newline at end of file
+    /**
+     * @brief Construct a new TransactionsView over the selected transactions
+     *
+     * @param transactions The viewed transactions
+     * @param stockIndices The indices of the selected stock transactions
+     * @param optionIndices The indices of the selected option transactions
+     */
+    TransactionsView::TransactionsView(
+        const Transactions&      transactions,
+        std::vector<std::size_t> stockIndices,
+        std::vector<std::size_t> optionIndices
+    )
+        : _transactions(transactions),
+          _stockIndices(std::move(stockIndices)),
+          _optionIndices(std::move(optionIndices))
+    {
+    }
+
+    /**
+     * @brief Get the selected stock transactions
+     *
+     * @return IndexView<StockTransaction>
+     */
+    IndexView<StockTransaction> TransactionsView::stocks() const
+    {
+        return {_transactions.stocks().getItems(), _stockIndices};
+    }
+
+    /**
+     * @brief Get the selected option transactions
+     *
+     * @return IndexView<OptionTransaction>
+     */
+    IndexView<OptionTransaction> TransactionsView::options() const
+    {
+        return {_transactions.options().getItems(), _optionIndices};
+    }
+
+    /**
+     * @brief Check if the view selects no transaction
+     *
+     * @return true if the view is empty, false otherwise
+     */
+    bool TransactionsView::empty() const
+    {
+        return _stockIndices.empty() && _optionIndices.empty();
+    }
+
+    /**
+     * @brief Check if the view selects any option transaction
+     *
+     * @return true if there are option transactions, false otherwise
+     */
+    bool TransactionsView::containsOptions() const
+    {
+        return !_optionIndices.empty();
+    }
+
+    /**
+     * @brief Get the instrument IDs of the selected stock transactions
+     *
+     * @return IdSet<InstrumentId>
+     */
+    IdSet<InstrumentId> TransactionsView::getStockInstrumentIds() const
+    {
+        IdSet<InstrumentId> instrumentIds;
+        for (const auto& transaction : stocks())
+            instrumentIds.insert(transaction.getInstrumentId());
+
+        return instrumentIds;
+    }
+
+    /**
+     * @brief Get the instrument IDs of the selected option transactions
+     *
+     * @return IdSet<InstrumentId>
+     */
+    IdSet<InstrumentId> TransactionsView::getOptionInstrumentIds() const
+    {
+        IdSet<InstrumentId> instrumentIds;
+        for (const auto& transaction : options())
+            instrumentIds.insert(transaction.getInstrumentId());
+
+        return instrumentIds;
+    }
+
+}   // namespace finance
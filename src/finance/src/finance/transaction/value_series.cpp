@@ -0,0 +1,387 @@
+#include "finance/transaction/value_series.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <format>
+#include <initializer_list>
+#include <optional>
+#include <utility>
+#include <variant>
+
+#include "logging/tracer.hpp"
+
+namespace finance
+{
+    namespace
+    {
+        /**
+         * @brief An event of a position in the merged event stream
+         *
+         */
+        struct SweepEvent
+        {
+            /// The day the event takes effect
+            std::chrono::sys_days day;
+            /// The index of the position
+            std::size_t position;
+            /// The event
+            const PositionEvent* event;
+        };
+
+        /**
+         * @brief A close of a position in the merged close stream
+         *
+         */
+        struct SweepClose
+        {
+            /// The day of the close
+            std::chrono::sys_days day;
+            /// The index of the position
+            std::size_t position;
+            /// The closing price in the currency of the position
+            Cash close;
+        };
+
+        /**
+         * @brief The running state of a single position during the sweep
+         *
+         */
+        struct SweepPosition
+        {
+            /// The state folded from the events applied so far
+            PositionState state;
+            /// The latest close applied so far
+            std::optional<Cash> close;
+            /// The rate from the currency of the position to the base
+            /// currency
+            double rate = 1.0;
+            /// The contribution to the market value total, in the base
+            /// currency
+            Cash marketValue;
+            /// The contribution to the cost basis total, in the base currency
+            Cash costBasis;
+            /// Whether the position changed on the current day
+            bool dirty = false;
+        };
+
+        /**
+         * @brief Checks whether a position holds shares or open option legs
+         *
+         * @param state
+         * @return true
+         * @return false
+         */
+        bool isHeld(const PositionState& state)
+        {
+            return !state.openQuantity.isZero() ||
+                   !state.openOptionLegs.empty();
+        }
+
+        /**
+         * @brief Get the currency of the trades of a position
+         *
+         * @param position
+         * @return FinanceResult<Currency> Currency::Unknown for a position
+         * without priced trades, an error if the trades mix currencies
+         */
+        FinanceResult<Currency> _getPositionCurrency(
+            const SeriesPosition& position
+        )
+        {
+            auto currency = Currency::Unknown;
+
+            const auto check = [&](std::initializer_list<Cash> amounts)
+                -> FinanceResult<Currency>
+            {
+                for (const auto& amount : amounts)
+                {
+                    const auto other = amount.getCurrency();
+
+                    if (other == Currency::Unknown || other == currency)
+                        continue;
+
+                    if (currency != Currency::Unknown)
+                    {
+                        return FinanceError{
+                            FinanceErrorType::InvalidPosition,
+                            std::format(
+                                "Position {} mixes the currencies {} and {}",
+                                position.id.toString(),
+                                CurrencyMeta::toString(currency),
+                                CurrencyMeta::toString(other)
+                            )
+                        };
+                    }
+
+                    currency = other;
+                }
+
+                return currency;
+            };
+
+            for (const auto& event : position.events)
+            {
+                FinanceResult<Currency> result = currency;
+
+                if (const auto* stock = std::get_if<StockTrade>(&event.data))
+                {
+                    result = check({stock->unitPrice, stock->fees});
+                }
+                else
+                {
+                    const auto& option = std::get<OptionTrade>(event.data);
+                    result =
+                        check({option.strike, option.premium, option.fees});
+                }
+
+                if (!result)
+                    return result;
+            }
+
+            return currency;
+        }
+
+        /**
+         * @brief Get the rate from one currency to another, currency-less
+         * amounts and equal currencies convert 1:1
+         *
+         * @param from
+         * @param to
+         * @param rates
+         * @return FinanceResult<double> an error if the rate is unknown
+         */
+        FinanceResult<double> _getRate(
+            Currency                from,
+            Currency                to,
+            const ConversionMatrix& rates
+        )
+        {
+            if (from == Currency::Unknown || from == to)
+                return 1.0;
+
+            const auto rate = rates.rate(from, to);
+            if (!rate)
+            {
+                return FinanceError{
+                    FinanceErrorType::CurrencyUnknown,
+                    std::format(
+                        "No exchange rate from {} to {}",
+                        CurrencyMeta::toString(from),
+                        CurrencyMeta::toString(to)
+                    )
+                };
+            }
+
+            return rate.value();
+        }
+
+        /**
+         * @brief Converts an amount with a rate from _getRate()
+         *
+         * @param amount
+         * @param to The target currency
+         * @param rate The rate from the currency of the amount to the target
+         * currency
+         * @return Cash
+         */
+        Cash _convert(const Cash& amount, Currency to, double rate)
+        {
+            if (amount.getCurrency() == Currency::Unknown ||
+                amount.getCurrency() == to)
+                return Cash{to, amount.getAmount()};
+
+            return ConversionMatrix::convert(amount, to, rate);
+        }
+    }   // namespace
+
+    /**
+     * @brief Get the day (UTC) of a timestamp
+     *
+     * @param timestamp
+     * @return std::chrono::sys_days
+     */
+    std::chrono::sys_days toDay(const Timestamp& timestamp)
+    {
+        using std::chrono::milliseconds;
+
+        const auto timePoint = std::chrono::sys_time<milliseconds>{
+            milliseconds{timestamp.toInt64()}
+        };
+
+        return std::chrono::floor<std::chrono::days>(timePoint);
+    }
+
+    /**
+     * @brief Build the daily value of a set of positions over a range of days.
+     *
+     * The events of all positions and all daily closes are merged and sorted
+     * once, then a single forward sweep over the days applies them to the
+     * running position states. Only the positions touched on a day are
+     * re-evaluated, their previous contribution is replaced in the running
+     * totals, so a day without events or closes costs O(1). Events and
+     * closes before the range are applied before its first day.
+     *
+     * A close is carried forward to the following days until the next close
+     * of the instrument, so weekends and holidays keep the last value.
+     *
+     * Each position is valued in the currency of its trades and its
+     * contribution is converted into the base currency with the given rates,
+     * so positions of different currencies can be summed up.
+     *
+     * @param positions The positions with their events and daily closes
+     * @param from The first day of the series
+     * @param to The last day of the series
+     * @param baseCurrency The currency of the series
+     * @param rates The exchange rates, e.g. FxRateCache::getMatrix()
+     * @return FinanceResult<std::vector<PortfolioValuePoint>> One point per
+     * day, an error if a position mixes currencies, a rate is missing or a
+     * fold fails
+     */
+    FinanceResult<std::vector<PortfolioValuePoint>> buildValueSeries(
+        std::span<const SeriesPosition> positions,
+        std::chrono::sys_days           from,
+        std::chrono::sys_days           to,
+        Currency                        baseCurrency,
+        const ConversionMatrix&         rates
+    )
+    {
+        TRACE_SCOPE("Finance.BuildValueSeries");
+
+        std::vector<PortfolioValuePoint> series;
+        if (to < from)
+            return series;
+
+        std::vector<SweepEvent>    events;
+        std::vector<SweepClose>    closes;
+        std::vector<SweepPosition> sweep(positions.size());
+
+        for (std::size_t i = 0; i < positions.size(); ++i)
+        {
+            const auto currency = _getPositionCurrency(positions[i]);
+            if (!currency)
+                return currency.error();
+
+            const auto rate =
+                _getRate(currency.value(), baseCurrency, rates);
+            if (!rate)
+                return rate.error();
+
+            sweep[i].rate = rate.value();
+
+            for (const auto& event : positions[i].events)
+                events.push_back({toDay(event.timestamp), i, &event});
+
+            for (const auto& close : positions[i].closes)
+            {
+                auto price = close.close;
+
+                // a position without trades keeps the close as it is
+                if (currency.value() != Currency::Unknown)
+                {
+                    const auto closeRate = _getRate(
+                        price.getCurrency(),
+                        currency.value(),
+                        rates
+                    );
+                    if (!closeRate)
+                        return closeRate.error();
+
+                    price =
+                        _convert(price, currency.value(), closeRate.value());
+                }
+
+                closes.push_back({close.day, i, price});
+            }
+        }
+
+        // stable, so that events with equal timestamps keep their order
+        std::ranges::stable_sort(
+            events,
+            [](const auto& lhs, const auto& rhs)
+            { return lhs.event->timestamp < rhs.event->timestamp; }
+        );
+        std::ranges::stable_sort(closes, {}, &SweepClose::day);
+
+        std::vector<std::size_t> touched;
+
+        Cash marketValue{baseCurrency, 0};
+        Cash costBasis{baseCurrency, 0};
+
+        auto nextEvent = events.begin();
+        auto nextClose = closes.begin();
+
+        series.reserve(static_cast<std::size_t>((to - from).count()) + 1);
+
+        for (auto day = from; day <= to; day += std::chrono::days{1})
+        {
+            for (; nextEvent != events.end() && nextEvent->day <= day;
+                 ++nextEvent)
+            {
+                auto& position = sweep[nextEvent->position];
+
+                auto result = foldEvents(
+                    std::move(position.state),
+                    std::span{nextEvent->event, 1}
+                );
+                if (!result)
+                {
+                    return FromError<PnLError, FinanceError>::apply(
+                        result.error(),
+                        FinanceErrorType::PnlError
+                    );
+                }
+
+                position.state = std::move(result.value());
+
+                if (!std::exchange(position.dirty, true))
+                    touched.push_back(nextEvent->position);
+            }
+
+            for (; nextClose != closes.end() && nextClose->day <= day;
+                 ++nextClose)
+            {
+                auto& position = sweep[nextClose->position];
+                position.close = nextClose->close;
+
+                if (!std::exchange(position.dirty, true))
+                    touched.push_back(nextClose->position);
+            }
+
+            for (const auto index : touched)
+            {
+                auto& position = sweep[index];
+                position.dirty = false;
+
+                marketValue -= position.marketValue;
+                costBasis   -= position.costBasis;
+
+                if (isHeld(position.state))
+                {
+                    const auto pnl = snapshot(position.state, position.close);
+
+                    position.marketValue = _convert(
+                        pnl.costBasis + pnl.unrealizedPnL,
+                        baseCurrency,
+                        position.rate
+                    );
+                    position.costBasis =
+                        _convert(pnl.costBasis, baseCurrency, position.rate);
+                }
+                else
+                {
+                    position.marketValue = Cash{baseCurrency, 0};
+                    position.costBasis   = Cash{baseCurrency, 0};
+                }
+
+                marketValue += position.marketValue;
+                costBasis   += position.costBasis;
+            }
+            touched.clear();
+
+            series.push_back({day, marketValue, costBasis});
+        }
+
+        return series;
+    }
+
+}   // namespace finance
@@ -8,6 +8,7 @@
 #include "finance/price_quote.hpp"
 #include "finance/ticker_info.hpp"
 #include "http/http_client.hpp"
+#include "logging/tracer.hpp"
 
 namespace finance
 {
@@ -252,6 +253,8 @@ namespace finance
         const std::string& ticker
     )
     {
+        TRACE_SCOPE("Finance.FetchPrice");
+
         const std::string path =
             "/v10/finance/quoteSummary/" + ticker + "?modules=price";
 
@@ -1,13 +1,23 @@
 #ifndef __GATEWAY__INCLUDE__GATEWAY__POSITION_GATEWAY_HPP__
 #define __GATEWAY__INCLUDE__GATEWAY__POSITION_GATEWAY_HPP__
 
+#include <chrono>
+#include <cstdint>
 #include <memory>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
 
+#include "common/container/id_map.hpp"
 #include "drafts/position/position_option_draft.hpp"
 #include "drafts/position/position_stock_draft.hpp"
 #include "finance/position.hpp"
 #include "finance/transaction/pnl.hpp"
 #include "finance/transaction/transactions.hpp"   // for return value
+#include "finance/transaction/value_series.hpp"
 
 namespace store
 {
@@ -58,10 +68,58 @@ namespace gateway
      * application layer and the underlying data stores for positions, options,
      * stocks, and transactions.
      *
+     * Query results are memoized per account and folded position states per
+     * position. The caches are keyed on the versions of the contributing
+     * stores and dropped as soon as any of them changes. A memoized state is
+     * additionally tied to the transactions it was folded from, a caller
+     * passing a different view of the position gets a fresh fold.
+     *
+     * Batches of positions are folded in parallel: the position events are
+     * built from the stores on the calling thread, the folds run on worker
+     * threads (finance::foldPositions) and their results are merged into the
+     * cache in position order, so the stores and the caches are only ever
+     * accessed from the calling thread.
+     *
+     * The historical value of accounts is built in a single sweep over all
+     * their positions (finance::buildValueSeries), the daily closes of the
+     * instruments are supplied by the caller, keyed by the tickers returned
+     * from getValueSeriesTickers().
      */
     class PositionGateway
     {
        private:
+        /**
+         * @brief The versions of the stores the cached results derive from
+         *
+         */
+        struct StoreVersions
+        {
+            /// Version of the transaction store
+            std::uint64_t transactions = 0;
+            /// Version of the position store
+            std::uint64_t positions = 0;
+            /// Version of the option store
+            std::uint64_t options = 0;
+            /// Version of the stock store
+            std::uint64_t stocks = 0;
+
+            bool operator==(const StoreVersions&) const = default;
+        };
+
+        /**
+         * @brief A memoized position state together with the transactions it
+         * was folded from
+         *
+         */
+        struct CachedPositionState
+        {
+            /// The stock and option transactions of the folded view, in view
+            /// order
+            std::vector<TransactionId> transactionIds;
+            /// The folded position state
+            finance::PositionState state;
+        };
+
         /// The transaction store used to retrieve transaction data
         std::shared_ptr<store::ITransactionStore> _transactionStore;
         /// The position store used to retrieve position data
@@ -71,6 +129,18 @@ namespace gateway
         /// The stock store used to retrieve stock data
         std::shared_ptr<store::IStockStore> _stockStore;
 
+        /// The store versions the cached results below were computed for
+        mutable std::optional<StoreVersions> _cacheVersions;
+        /// Cached open stock position details per account
+        mutable IdMap<AccountId, std::vector<OpenStockPositionDetail>>
+            _stockDetailCache;
+        /// Cached open option position details per account
+        mutable IdMap<AccountId, std::vector<OpenOptionPositionDetail>>
+            _optionDetailCache;
+        /// Cached folded position states per position, only reused for a view
+        /// over the same transactions
+        mutable IdMap<PositionId, CachedPositionState> _positionStateCache;
+
        public:
         PositionGateway(
             const std::shared_ptr<store::ITransactionStore>& transactionStore,
@@ -83,12 +153,13 @@ namespace gateway
         FinanceResult<std::vector<std::pair<
             finance::Position,
             finance::
-                Transactions>>> getOpenPositionTransactions(const IdSet<AccountId>& accountIds) const;
+                TransactionsView>>> getOpenPositionTransactions(const IdSet<AccountId>& accountIds) const;
 
         [[nodiscard]]
         PnLResult<finance::PositionPnl> calculatePositionPnl(
-            const finance::Transactions& positionTxs,
-            std::optional<Cash>          markPrice
+            PositionId                       positionId,
+            const finance::TransactionsView& positionTxs,
+            std::optional<Cash>              markPrice
         ) const;
 
         [[nodiscard]]
@@ -105,6 +176,54 @@ namespace gateway
         FinanceResult<std::vector<OpenOptionPositionDetail>> getOpenOptionPositionDetails(
             AccountId account
         ) const;
+
+        [[nodiscard]]
+        FinanceResult<std::unordered_set<std::string>> getValueSeriesTickers(
+            const IdSet<AccountId>& accountIds
+        ) const;
+
+        [[nodiscard]]
+        FinanceResult<std::vector<finance::PortfolioValuePoint>> getPortfolioValueSeries(
+            const IdSet<AccountId>& accountIds,
+            const std::unordered_map<std::string, std::vector<finance::DailyClose>>&
+                                             closesByTicker,
+            std::chrono::sys_days            from,
+            std::chrono::sys_days            to,
+            Currency                         baseCurrency,
+            const finance::ConversionMatrix& rates
+        ) const;
+
+       private:
+        void _validateCache() const;
+
+        [[nodiscard]]
+        FinanceResult<IdMap<PositionId, finance::TransactionsView>> _getAccountPositionTransactions(
+            const IdSet<AccountId>& accountIds
+        ) const;
+
+        [[nodiscard]]
+        std::optional<std::string> _getTicker(
+            const finance::TransactionsView& positionTxs
+        ) const;
+
+        [[nodiscard]]
+        PnLResult<finance::PositionState> _foldPosition(
+            PositionId                       positionId,
+            const finance::TransactionsView& positionTxs
+        ) const;
+
+        [[nodiscard]]
+        const finance::PositionState* _findCachedState(
+            PositionId                        positionId,
+            const std::vector<TransactionId>& transactionIds
+        ) const;
+
+        [[nodiscard]]
+        PnLResult<std::vector<finance::PositionState>> _foldPositions(
+            const std::vector<
+                std::pair<PositionId, const finance::TransactionsView*>>&
+                positions
+        ) const;
     };
 }   // namespace gateway
 
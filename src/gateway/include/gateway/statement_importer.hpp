@@ -0,0 +1,231 @@
+#ifndef __GATEWAY__INCLUDE__GATEWAY__STATEMENT_IMPORTER_HPP__
+#define __GATEWAY__INCLUDE__GATEWAY__STATEMENT_IMPORTER_HPP__
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mstd/enum.hpp>
+#include <optional>
+#include <stop_token>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "common/quantity.hpp"
+#include "common/timestamp.hpp"
+#include "config/id_types.hpp"
+#include "error/finance_error.hpp"
+#include "finance/account/accounts.hpp"
+#include "finance/transaction/broker_statement.hpp"
+#include "finance/transaction/domain_transaction.hpp"
+
+namespace store
+{
+    class IAccountStore;       // forward declaration
+    class IStockStore;         // forward declaration
+    class IPositionStore;      // forward declaration
+    class ITransactionStore;   // forward declaration
+}   // namespace store
+
+namespace gateway
+{
+    class PositionGateway;   // forward declaration
+
+// NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
+#define STATEMENT_IMPORT_PHASE_LIST(X) \
+    X(Reading)                         \
+    X(Converting)
+
+    MSTD_ENUM(StatementImportPhase, std::uint8_t, STATEMENT_IMPORT_PHASE_LIST);
+
+    /**
+     * @brief Progress of a statement import, the bytes read while reading
+     * and the rows converted while converting
+     *
+     */
+    struct StatementImportProgress
+    {
+        /// The current phase
+        StatementImportPhase phase = StatementImportPhase::Reading;
+        /// The work done in the current phase
+        std::size_t done = 0;
+        /// The total work of the current phase
+        std::size_t total = 0;
+    };
+
+    /// Callback receiving the progress of a statement import
+    using StatementImportProgressCallback =
+        std::function<void(const StatementImportProgress& progress)>;
+
+    /**
+     * @brief Options of a statement import
+     *
+     */
+    struct StatementImportOptions
+    {
+        /// The layout of the statement
+        finance::BrokerLayout layout = finance::BrokerLayout::Generic;
+        /// The security account of all trades, replaces the account column
+        std::optional<AccountId> securityAccount;
+        /// The cash account of all rows, replaces the account columns
+        std::optional<AccountId> cashAccount;
+    };
+
+    /**
+     * @brief The converted transactions of a statement, ready to be staged
+     *
+     */
+    struct StatementImport
+    {
+        /// Marks a transaction that does not belong to a position
+        static constexpr std::size_t NO_POSITION = static_cast<std::size_t>(-1);
+
+        /**
+         * @brief A position the imported trades belong to
+         *
+         */
+        struct PositionSlot
+        {
+            /// The ID of an already open position, invalid if the position
+            /// is created when staging
+            PositionId existing = PositionId::invalid();
+            /// The time of the first trade of a new position
+            Timestamp openedAt = Timestamp::Null();
+        };
+
+        /// The converted transactions in chronological order
+        std::vector<finance::DomainTransaction> transactions;
+        /// The position slot of every transaction, NO_POSITION for cash
+        std::vector<std::size_t> positionSlots;
+        /// The positions of the trades
+        std::vector<PositionSlot> positions;
+        /// The rows that were skipped, one error per row
+        std::vector<FinanceError> rowErrors;
+    };
+
+    /**
+     * @brief The result of staging a statement import
+     *
+     */
+    struct StatementImportSummary
+    {
+        /// The number of staged transactions
+        std::size_t transactions = 0;
+        /// The number of created positions
+        std::size_t createdPositions = 0;
+        /// The number of skipped rows
+        std::size_t skippedRows = 0;
+    };
+
+    /**
+     * @brief Imports broker statements (CSV exports) into the stores.
+     *
+     * An import runs in two steps. read() memory-maps the statement and
+     * streams its rows through finance::StatementParser, accounts and
+     * tickers are resolved through in-memory indexes, the trades are
+     * assigned to positions in chronological order and every row is validated
+     * by converting it with finance::TransactionConverter. read() does not
+     * touch the stores, so it can run on a worker thread, it reports its
+     * progress and stops as soon as a stop is requested.
+     *
+     * stage() then creates the new positions and adds all transactions to
+     * the transaction store as one batch, which is persisted in a single
+     * database transaction by the next commit.
+     *
+     * The indexes are built from the stores when the importer is constructed,
+     * so an importer is created for one import on the thread owning the
+     * stores.
+     */
+    class StatementImporter
+    {
+       private:
+        /**
+         * @brief Transparent string hash, lookups with a std::string_view do
+         * not allocate
+         *
+         */
+        struct StringHash
+        {
+            /// enables heterogeneous lookup
+            using is_transparent = void;
+
+            std::size_t operator()(std::string_view value) const;
+        };
+
+        /// Map from a name to an ID with heterogeneous lookup
+        template <typename Id>
+        using NameIndex =
+            std::unordered_map<std::string, Id, StringHash, std::equal_to<>>;
+
+        /**
+         * @brief An open position of a security account and an instrument
+         *
+         */
+        struct OpenPosition
+        {
+            /// The ID of the position
+            PositionId id = PositionId::invalid();
+            /// The open quantity
+            Quantity quantity{0};
+        };
+
+        /// Key of the open positions, a security account and an instrument
+        using PositionKey = std::pair<AccountId, InstrumentId>;
+
+        /// The position store
+        std::shared_ptr<store::IPositionStore> _positionStore;
+        /// The transaction store
+        std::shared_ptr<store::ITransactionStore> _transactionStore;
+
+        /// Snapshot of the accounts, used for lookups and the conversion
+        finance::Accounts _accounts;
+        /// The security accounts by their name
+        NameIndex<AccountId> _securityAccounts;
+        /// The cash accounts by their name
+        NameIndex<AccountId> _cashAccounts;
+        /// The stock instruments by their ticker
+        NameIndex<InstrumentId> _instruments;
+        /// The stock positions that are open before the import
+        std::map<PositionKey, OpenPosition> _openPositions;
+
+       public:
+        StatementImporter(
+            const std::shared_ptr<store::IAccountStore>&     accountStore,
+            const std::shared_ptr<store::IStockStore>&       stockStore,
+            const std::shared_ptr<store::IPositionStore>&    positionStore,
+            const std::shared_ptr<store::ITransactionStore>& transactionStore,
+            const PositionGateway&                           positionGateway
+        );
+
+        [[nodiscard]]
+        FinanceResult<StatementImport> read(
+            const std::filesystem::path&           path,
+            const StatementImportOptions&          options,
+            std::stop_token                        stopToken = {},
+            const StatementImportProgressCallback& progress  = {}
+        ) const;
+
+        [[nodiscard]]
+        FinanceResult<StatementImportSummary> stage(StatementImport statement);
+
+       private:
+        [[nodiscard]] FinanceResult<void> _validateOptions(
+            const StatementImportOptions& options
+        ) const;
+
+        [[nodiscard]] FinanceResult<AccountId> _resolveAccount(
+            std::string_view                name,
+            const std::optional<AccountId>& fixed,
+            const NameIndex<AccountId>&     index,
+            std::size_t                     line
+        ) const;
+    };
+
+}   // namespace gateway
+
+#endif   // __GATEWAY__INCLUDE__GATEWAY__STATEMENT_IMPORTER_HPP__
@@ -1,10 +1,14 @@
 #include "gateway/position_gateway.hpp"
 
+#include <cstddef>
+#include <utility>
+
 #include "error/finance_error.hpp"
 #include "finance/positions.hpp"
 #include "finance/transaction/pnl.hpp"
 #include "finance/transaction/transaction_filter.hpp"
 #include "logging/log_macros.hpp"
+#include "logging/tracer.hpp"
 #include "mapper/stock_mapper.hpp"
 #include "store/i_option_store.hpp"
 #include "store/i_position_store.hpp"
@@ -43,14 +47,14 @@ namespace gateway
          * convert the transactions into position events, including stock trades
          * and option trades.
          *
-         * @param txs The Transactions object containing the transactions.
+         * @param txs The view of the position's transactions.
          * @param optionStore The option store used to retrieve option details.
          * @return FinanceResult<finance::PositionEvents> The resulting position
          * events or an error if any option is not found.
          */
         [[nodiscard]]
         FinanceResult<finance::PositionEvents> _getPositionEvents(
-            const finance::Transactions&                txs,
+            const finance::TransactionsView&            txs,
             const std::shared_ptr<store::IOptionStore>& optionStore
         )
         {
@@ -108,6 +112,30 @@ namespace gateway
             events.sort();
             return events;
         }
+
+        /**
+         * @brief Get the IDs of the transactions in a view, the stock
+         * transactions first, each in view order
+         *
+         * @param txs The view of the position's transactions.
+         * @return std::vector<TransactionId> The transaction IDs.
+         */
+        [[nodiscard]]
+        std::vector<TransactionId> _getTransactionIds(
+            const finance::TransactionsView& txs
+        )
+        {
+            std::vector<TransactionId> ids;
+            ids.reserve(txs.stocks().size() + txs.options().size());
+
+            for (const auto& tx : txs.stocks())
+                ids.push_back(tx.getId());
+
+            for (const auto& tx : txs.options())
+                ids.push_back(tx.getId());
+
+            return ids;
+        }
     }   // namespace
 
     /**
@@ -141,13 +169,15 @@ namespace gateway
      *
      * @param accountIds The set of account IDs to filter the open positions by.
      * @return FinanceResult<std::vector<std::pair<finance::Position,
-     * finance::Transactions>>> The resulting vector of pairs containing the
-     * open positions and their associated transactions, or an error if any
-     * retrieval fails.
+     * finance::TransactionsView>>> The resulting vector of pairs containing the
+     * open positions and views of their associated transactions, or an error
+     * if any retrieval fails.
      */
-    FinanceResult<std::vector<std::pair<finance::Position, finance::Transactions>>> PositionGateway::
+    FinanceResult<std::vector<std::pair<finance::Position, finance::TransactionsView>>> PositionGateway::
         getOpenPositionTransactions(const IdSet<AccountId>& accountIds) const
     {
+        TRACE_SCOPE("Gateway.Position.OpenPositionTransactions");
+
         const auto positions = _positionStore->getOpenPositions();
 
         auto filter       = _getOpenPositionsFilter(positions);
@@ -158,13 +188,14 @@ namespace gateway
         if (!txsResult)
             return txsResult.error();
 
-        std::vector<std::pair<finance::Position, finance::Transactions>> result;
-        for (const auto& [positionId, tx] : txsResult.value().groupByPosition())
-        {
-            const auto position = positions.at(positionId);
+        auto groups = txsResult.value().groupByPosition();
 
-            result.emplace_back(position, tx);
-        }
+        std::vector<std::pair<finance::Position, finance::TransactionsView>>
+            result;
+        result.reserve(groups.size());
+
+        for (auto& [positionId, view] : groups)
+            result.emplace_back(positions.at(positionId), std::move(view));
 
         return result;
     }
@@ -174,8 +205,11 @@ namespace gateway
      * compute the realized and unrealized PnL based on the trades associated
      * with the position, taking into account any fees and mark prices.
      *
-     * @param positionTxs The Transactions object containing the position's
-     * transactions.
+     * The folded position state is memoized per position, so only the cheap
+     * snapshot is computed again for a new mark price.
+     *
+     * @param positionId The ID of the position the transactions belong to.
+     * @param positionTxs The view of the position's transactions.
      * @param markPrice An optional mark price to use for calculating unrealized
      * PnL, if not provided, the calculation will be based on the last known
      * trade price.
@@ -183,22 +217,16 @@ namespace gateway
      * an error if any part of the calculation fails.
      */
     PnLResult<finance::PositionPnl> PositionGateway::calculatePositionPnl(
-        const finance::Transactions& positionTxs,
-        std::optional<Cash>          markPrice
+        PositionId                       positionId,
+        const finance::TransactionsView& positionTxs,
+        std::optional<Cash>              markPrice
     ) const
     {
-        auto eventsResult = _getPositionEvents(positionTxs, _optionStore);
-        if (!eventsResult)
-        {
-            return FromError<FinanceError, PnLError>::apply(
-                eventsResult.error(),
-                PnLErrorType::UnknownOption
-            );
-        }
+        TRACE_SCOPE("Gateway.Position.CalculatePnl");
 
-        auto stateResult =
-            foldEvents(finance::PositionState{}, eventsResult.value());
+        _validateCache();
 
+        auto stateResult = _foldPosition(positionId, positionTxs);
         if (!stateResult)
             return stateResult.error();
 
@@ -218,12 +246,24 @@ namespace gateway
     FinanceResult<std::vector<OpenStockPositionDetail>> PositionGateway::
         getOpenStockPositionDetails(AccountId account) const
     {
+        TRACE_SCOPE("Gateway.Position.OpenStockDetails");
+
+        _validateCache();
+
+        if (_stockDetailCache.contains(account))
+            return _stockDetailCache.at(account);
+
         const auto positions = getOpenPositionTransactions({account});
 
         if (!positions)
             return positions.error();
 
-        std::vector<OpenStockPositionDetail> drafts;
+        // resolve and validate every position first, the folds of all
+        // positions then run as one parallel batch
+        std::vector<std::pair<const finance::Position*, drafts::StockInfoDraft>>
+            stockPositions;
+        std::vector<std::pair<PositionId, const finance::TransactionsView*>>
+            foldInputs;
 
         for (const auto& [position, positionTransaction] : positions.value())
         {
@@ -262,39 +302,41 @@ namespace gateway
                 return error;
             }
 
-            auto eventsResult =
-                _getPositionEvents(positionTransaction, _optionStore);
-            if (!eventsResult)
-            {
-                LOG_ERROR(eventsResult.error().toString());
-                return eventsResult.error();
-            }
+            stockPositions.emplace_back(
+                &position,
+                mapper::StockMapper::toStockInfoDraft(stock.value())
+            );
+            foldInputs.emplace_back(position.getId(), &positionTransaction);
+        }
 
-            auto stateResult = finance::foldEvents(
-                finance::PositionState{},
-                eventsResult.value()
+        const auto statesResult = _foldPositions(foldInputs);
+        if (!statesResult)
+        {
+            LOG_ERROR(statesResult.error().toString());
+            return FromError<PnLError, FinanceError>::apply(
+                statesResult.error(),
+                FinanceErrorType::PnlError
             );
-            if (!stateResult)
-            {
-                LOG_ERROR(stateResult.error().toString());
-                return FromError<PnLError, FinanceError>::apply(
-                    stateResult.error(),
-                    FinanceErrorType::PnlError
-                );
-            }
+        }
 
-            const auto initialPnl =
-                finance::snapshot(stateResult.value(), std::nullopt);
-            const auto stockInfo =
-                mapper::StockMapper::toStockInfoDraft(stock.value());
+        const auto& states = statesResult.value();
+
+        std::vector<OpenStockPositionDetail> drafts;
+        drafts.reserve(stockPositions.size());
+
+        for (std::size_t i = 0; i < stockPositions.size(); ++i)
+        {
+            const auto& [position, stockInfo] = stockPositions[i];
+
+            const auto initialPnl = finance::snapshot(states[i], std::nullopt);
 
             drafts.emplace_back(
                 OpenStockPositionDetail{
                     .positionDraft =
                         drafts::PositionStockDetailDraft{
-                            position.getId(),
+                            position->getId(),
                             stockInfo,
-                            position.getCreatedAt(),
+                            position->getCreatedAt(),
                             initialPnl.quantity,
                             initialPnl.getAverageCost(),
                             initialPnl.costBasis,
@@ -302,11 +344,13 @@ namespace gateway
                             initialPnl.getRealizedPnLPercentage()
                         },
                     .ticker = stockInfo.getTicker(),
-                    .state  = stateResult.value()
+                    .state  = states[i]
                 }
             );
         }
 
+        _stockDetailCache.addUnchecked(account, drafts);
+
         return drafts;
     }
 
@@ -319,83 +363,17 @@ namespace gateway
     FinanceResult<std::vector<drafts::PositionStockDetailDraft>> PositionGateway::
         getOpenStockPosition(AccountId account) const
     {
-        const auto positions = getOpenPositionTransactions({account});
+        const auto details = getOpenStockPositionDetails(account);
 
-        if (!positions)
-            return positions.error();
+        if (!details)
+            return details.error();
 
         std::vector<drafts::PositionStockDetailDraft> drafts;
+        drafts.reserve(details.value().size());
 
-        for (const auto& [position, positionTransaction] : positions.value())
-        {
-            if (positionTransaction.containsOptions())
-                continue;
-
-            const auto instrumentIds =
-                positionTransaction.getStockInstrumentIds();
+        for (const auto& detail : details.value())
+            drafts.push_back(detail.positionDraft);
 
-            if (instrumentIds.size() != 1)
-            {
-                const auto error = FinanceError{
-                    FinanceErrorType::InvalidPosition,
-                    std::format(
-                        "Position {} has {} stock instrument ids",
-                        position.getId().toString(),
-                        instrumentIds.size()
-                    )
-                };
-                LOG_ERROR(error.toString());
-                return error;
-            }
-
-            const auto& stock = _stockStore->getStock(instrumentIds.front());
-
-            if (!stock)
-            {
-                const auto error = FinanceError{
-                    FinanceErrorType::InvalidStock,
-                    std::format(
-                        "No stock found for instrument id: {}",
-                        instrumentIds.front().toString()
-                    )
-                };
-                LOG_ERROR(error.toString());
-                return error;
-            }
-
-            auto pnlResult = calculatePositionPnl(
-                positionTransaction,
-                std::nullopt   // starting point is without any mark price, will
-                               // be updated periodically with the latest mark
-                               // price
-            );
-            if (!pnlResult)
-            {
-                const auto error = FromError<PnLError, FinanceError>::apply(
-                    pnlResult.error(),
-                    FinanceErrorType::PnlError
-                );
-                LOG_ERROR(error.toString());
-                return error;
-            }
-
-            const auto& pnl = pnlResult.value();
-
-            const auto stockInfo =
-                mapper::StockMapper::toStockInfoDraft(stock.value());
-
-            drafts.emplace_back(
-                position.getId(),
-                stockInfo,
-                position.getCreatedAt(),
-                pnl.quantity,
-                pnl.getAverageCost(),
-                pnl.costBasis,
-                pnl.realizedPnL,
-                pnl.getRealizedPnLPercentage()
-
-            );
-        }
         return drafts;
     }
 
@@ -408,12 +386,22 @@ namespace gateway
     FinanceResult<std::vector<OpenOptionPositionDetail>> PositionGateway::
         getOpenOptionPositionDetails(AccountId account) const
     {
+        TRACE_SCOPE("Gateway.Position.OpenOptionDetails");
+
+        _validateCache();
+
+        if (_optionDetailCache.contains(account))
+            return _optionDetailCache.at(account);
+
         const auto positions = getOpenPositionTransactions({account});
 
         if (!positions)
             return positions.error();
 
-        std::vector<OpenOptionPositionDetail> drafts;
+        std::vector<std::pair<const finance::Position*, drafts::StockInfoDraft>>
+            optionPositions;
+        std::vector<std::pair<PositionId, const finance::TransactionsView*>>
+            foldInputs;
 
         for (const auto& [position, positionTransaction] : positions.value())
         {
@@ -452,52 +440,373 @@ namespace gateway
                 return error;
             }
 
-            const auto& stock = option->getUnderlying();
-
-            auto eventsResult =
-                _getPositionEvents(positionTransaction, _optionStore);
-            if (!eventsResult)
-            {
-                LOG_ERROR(eventsResult.error().toString());
-                return eventsResult.error();
-            }
+            optionPositions.emplace_back(
+                &position,
+                mapper::StockMapper::toStockInfoDraft(option->getUnderlying())
+            );
+            foldInputs.emplace_back(position.getId(), &positionTransaction);
+        }
 
-            auto stateResult = finance::foldEvents(
-                finance::PositionState{},
-                eventsResult.value()
+        const auto statesResult = _foldPositions(foldInputs);
+        if (!statesResult)
+        {
+            LOG_ERROR(statesResult.error().toString());
+            return FromError<PnLError, FinanceError>::apply(
+                statesResult.error(),
+                FinanceErrorType::PnlError
             );
-            if (!stateResult)
-            {
-                LOG_ERROR(stateResult.error().toString());
-                return FromError<PnLError, FinanceError>::apply(
-                    stateResult.error(),
-                    FinanceErrorType::PnlError
-                );
-            }
+        }
 
-            const auto initialPnl =
-                finance::snapshot(stateResult.value(), std::nullopt);
+        const auto& states = statesResult.value();
 
-            const auto stockInfo = mapper::StockMapper::toStockInfoDraft(stock);
+        std::vector<OpenOptionPositionDetail> drafts;
+        drafts.reserve(optionPositions.size());
+
+        for (std::size_t i = 0; i < optionPositions.size(); ++i)
+        {
+            const auto& [position, stockInfo] = optionPositions[i];
+
+            const auto initialPnl = finance::snapshot(states[i], std::nullopt);
 
             drafts.emplace_back(
                 OpenOptionPositionDetail{
                     .positionDraft =
                         drafts::PositionOptionDetailDraft{
-                            position.getId(),
+                            position->getId(),
                             stockInfo,
-                            position.getCreatedAt(),
+                            position->getCreatedAt(),
                             initialPnl.quantity,
                             initialPnl.realizedPnL,
                             initialPnl.getRealizedPnLPercentage()
                         },
                     .ticker = stockInfo.getTicker(),
-                    .state  = stateResult.value()
+                    .state  = states[i]
                 }
             );
         }
 
+        _optionDetailCache.addUnchecked(account, drafts);
+
         return drafts;
     }
 
-}   // namespace gateway
\ No newline at end of file
+    /**
+     * @brief Get the tickers whose daily closes are needed for the value
+     * series of the given accounts, i.e. the stocks and option underlyings of
+     * all their positions, including the closed ones
+     *
+     * @param accountIds
+     * @return FinanceResult<std::unordered_set<std::string>>
+     */
+    FinanceResult<std::unordered_set<std::string>> PositionGateway::
+        getValueSeriesTickers(const IdSet<AccountId>& accountIds) const
+    {
+        const auto groups = _getAccountPositionTransactions(accountIds);
+
+        if (!groups)
+            return groups.error();
+
+        std::unordered_set<std::string> tickers;
+
+        for (const auto& [_, positionTxs] : groups.value())
+            if (auto ticker = _getTicker(positionTxs))
+                tickers.insert(std::move(ticker.value()));
+
+        return tickers;
+    }
+
+    /**
+     * @brief Get the daily market value and cost basis of the given accounts,
+     * e.g. for charting their evolution.
+     *
+     * The events of all positions, open and closed ones, are built once and
+     * swept forward together with the daily closes, instead of folding the
+     * positions again for every day of the range.
+     *
+     * @param accountIds The accounts to aggregate
+     * @param closesByTicker The daily closes by ticker, see
+     * getValueSeriesTickers(); positions without closes are valued at their
+     * cost basis
+     * @param from The first day of the series
+     * @param to The last day of the series
+     * @param baseCurrency The currency the values are expressed in
+     * @param rates The exchange rates into the base currency, e.g.
+     * FxRateCache::getMatrix()
+     * @return FinanceResult<std::vector<finance::PortfolioValuePoint>> One
+     * point per day, or an error if any retrieval or fold fails or a rate is
+     * missing
+     */
+    FinanceResult<std::vector<finance::PortfolioValuePoint>> PositionGateway::
+        getPortfolioValueSeries(
+            const IdSet<AccountId>& accountIds,
+            const std::unordered_map<std::string, std::vector<finance::DailyClose>>&
+                                             closesByTicker,
+            std::chrono::sys_days            from,
+            std::chrono::sys_days            to,
+            Currency                         baseCurrency,
+            const finance::ConversionMatrix& rates
+        ) const
+    {
+        TRACE_SCOPE("Gateway.Position.ValueSeries");
+
+        const auto groups = _getAccountPositionTransactions(accountIds);
+
+        if (!groups)
+            return groups.error();
+
+        std::vector<finance::SeriesPosition> positions;
+        positions.reserve(groups.value().size());
+
+        for (const auto& [positionId, positionTxs] : groups.value())
+        {
+            auto events = _getPositionEvents(positionTxs, _optionStore);
+            if (!events)
+                return events.error();
+
+            std::vector<finance::DailyClose> closes;
+            if (const auto ticker = _getTicker(positionTxs))
+            {
+                const auto it = closesByTicker.find(ticker.value());
+                if (it != closesByTicker.end())
+                    closes = it->second;
+            }
+
+            positions.push_back(
+                finance::SeriesPosition{
+                    .id     = positionId,
+                    .events = std::move(events.value()),
+                    .closes = std::move(closes)
+                }
+            );
+        }
+
+        auto series = finance::buildValueSeries(
+            positions,
+            from,
+            to,
+            baseCurrency,
+            rates
+        );
+        if (!series)
+            LOG_ERROR(series.error().toString());
+
+        return series;
+    }
+
+    /**
+     * @brief Drop all cached results if any of the contributing stores changed
+     * since they were computed
+     *
+     */
+    void PositionGateway::_validateCache() const
+    {
+        const auto versions = StoreVersions{
+            .transactions = _transactionStore->getVersion(),
+            .positions    = _positionStore->getVersion(),
+            .options      = _optionStore->getVersion(),
+            .stocks       = _stockStore->getVersion()
+        };
+
+        if (_cacheVersions == versions)
+            return;
+
+        _stockDetailCache.clear();
+        _optionDetailCache.clear();
+        _positionStateCache.clear();
+        _cacheVersions = versions;
+    }
+
+    /**
+     * @brief Get the transactions of all positions of the given accounts,
+     * open and closed ones, grouped by position
+     *
+     * @param accountIds
+     * @return FinanceResult<IdMap<PositionId, finance::TransactionsView>>
+     */
+    FinanceResult<IdMap<PositionId, finance::TransactionsView>> PositionGateway::
+        _getAccountPositionTransactions(const IdSet<AccountId>& accountIds) const
+    {
+        finance::TransactionFilter filter;
+        filter.accountIds = accountIds;
+
+        const auto txsResult = _transactionStore->getTransactions(filter);
+
+        if (!txsResult)
+            return txsResult.error();
+
+        return txsResult.value().groupByPosition();
+    }
+
+    /**
+     * @brief Get the ticker the value of a position follows, the stock of a
+     * stock position or the underlying of an option position
+     *
+     * @param positionTxs The view of the position's transactions
+     * @return std::optional<std::string> std::nullopt if the instrument is
+     * unknown
+     */
+    std::optional<std::string> PositionGateway::_getTicker(
+        const finance::TransactionsView& positionTxs
+    ) const
+    {
+        const auto stockIds = positionTxs.getStockInstrumentIds();
+        if (!stockIds.empty())
+        {
+            const auto stock = _stockStore->getStock(stockIds.front());
+            if (stock)
+                return stock->getTicker();
+        }
+
+        const auto optionIds = positionTxs.getOptionInstrumentIds();
+        if (!optionIds.empty())
+        {
+            const auto option = _optionStore->getOption(optionIds.front());
+            if (option)
+                return option->getUnderlying().getTicker();
+        }
+
+        return std::nullopt;
+    }
+
+    /**
+     * @brief Fold the events of a position into its price-independent state,
+     * the result is memoized per position until a contributing store changes
+     * and only reused for a view over the same transactions
+     *
+     * @param positionId The ID of the position
+     * @param positionTxs The view of the position's transactions
+     * @return PnLResult<finance::PositionState> The folded state or an error
+     * if an option is unknown or the fold fails
+     */
+    PnLResult<finance::PositionState> PositionGateway::_foldPosition(
+        PositionId                       positionId,
+        const finance::TransactionsView& positionTxs
+    ) const
+    {
+        auto transactionIds = _getTransactionIds(positionTxs);
+
+        if (const auto* cached = _findCachedState(positionId, transactionIds))
+            return *cached;
+
+        auto eventsResult = _getPositionEvents(positionTxs, _optionStore);
+        if (!eventsResult)
+        {
+            return FromError<FinanceError, PnLError>::apply(
+                eventsResult.error(),
+                PnLErrorType::UnknownOption
+            );
+        }
+
+        auto stateResult =
+            foldEvents(finance::PositionState{}, eventsResult.value());
+
+        if (stateResult)
+        {
+            _positionStateCache[positionId] = CachedPositionState{
+                .transactionIds = std::move(transactionIds),
+                .state          = stateResult.value()
+            };
+        }
+
+        return stateResult;
+    }
+
+    /**
+     * @brief Fold the events of many positions, memoized states are reused
+     * and the remaining positions are folded as one parallel batch
+     *
+     * The events are built on the calling thread, as the option store must
+     * not be accessed concurrently. The new states are added to the cache in
+     * input order once all folds are done.
+     *
+     * @param positions The IDs of the positions and views of their
+     * transactions
+     * @return PnLResult<std::vector<finance::PositionState>> The folded state
+     * of each position in input order, or the first error
+     */
+    PnLResult<std::vector<finance::PositionState>> PositionGateway::
+        _foldPositions(
+            const std::vector<
+                std::pair<PositionId, const finance::TransactionsView*>>&
+                positions
+        ) const
+    {
+        TRACE_SCOPE("Gateway.Position.FoldPositions");
+
+        std::vector<finance::PositionState>     states(positions.size());
+        std::vector<std::size_t>                pending;
+        std::vector<std::vector<TransactionId>> pendingIds;
+        std::vector<finance::PositionEvents>    events;
+
+        for (std::size_t i = 0; i < positions.size(); ++i)
+        {
+            const auto& [positionId, positionTxs] = positions[i];
+
+            auto transactionIds = _getTransactionIds(*positionTxs);
+
+            if (const auto* cached =
+                    _findCachedState(positionId, transactionIds))
+            {
+                states[i] = *cached;
+                continue;
+            }
+
+            auto eventsResult = _getPositionEvents(*positionTxs, _optionStore);
+            if (!eventsResult)
+            {
+                return FromError<FinanceError, PnLError>::apply(
+                    eventsResult.error(),
+                    PnLErrorType::UnknownOption
+                );
+            }
+
+            pending.push_back(i);
+            pendingIds.push_back(std::move(transactionIds));
+            events.push_back(std::move(eventsResult.value()));
+        }
+
+        auto results = finance::foldPositions(events);
+
+        for (std::size_t k = 0; k < pending.size(); ++k)
+        {
+            if (!results[k])
+                return results[k].error();
+
+            const auto i = pending[k];
+            states[i]    = std::move(results[k].value());
+
+            _positionStateCache[positions[i].first] = CachedPositionState{
+                .transactionIds = std::move(pendingIds[k]),
+                .state          = states[i]
+            };
+        }
+
+        return states;
+    }
+
+    /**
+     * @brief Get the memoized state of a position if it was folded from the
+     * given transactions
+     *
+     * @param positionId The ID of the position
+     * @param transactionIds The transactions of the view to fold, see
+     * _getTransactionIds()
+     * @return const finance::PositionState* The memoized state or nullptr
+     */
+    const finance::PositionState* PositionGateway::_findCachedState(
+        PositionId                        positionId,
+        const std::vector<TransactionId>& transactionIds
+    ) const
+    {
+        if (!_positionStateCache.contains(positionId))
+            return nullptr;
+
+        const auto& cached = _positionStateCache.at(positionId);
+
+        if (cached.transactionIds != transactionIds)
+            return nullptr;
+
+        return &cached.state;
+    }
+
+}   // namespace gateway
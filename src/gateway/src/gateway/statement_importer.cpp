@@ -0,0 +1,615 @@
+#include "gateway/statement_importer.hpp"
+
+#include <algorithm>
+#include <exception>
+#include <format>
+#include <system_error>
+
+#include "common/mapped_file.hpp"
+#include "finance/position.hpp"
+#include "finance/transaction/cash_transaction.hpp"
+#include "finance/transaction/stock_transaction.hpp"
+#include "finance/transaction/transaction_converter.hpp"
+#include "gateway/position_gateway.hpp"
+#include "logging/log_macros.hpp"
+#include "logging/tracer.hpp"
+#include "store/i_account_store.hpp"
+#include "store/i_position_store.hpp"
+#include "store/i_stock_store.hpp"
+#include "store/i_transaction_store.hpp"
+
+REGISTER_LOG_CATEGORY("Gateway.StatementImporter");
+
+namespace gateway
+{
+    namespace
+    {
+        /// Number of rows between two progress reports
+        constexpr std::size_t PROGRESS_INTERVAL = 4096;
+
+        /**
+         * @brief A statement row with resolved accounts and instrument
+         *
+         */
+        struct ResolvedRow
+        {
+            /// The parsed row, its text fields view the mapped statement
+            finance::StatementRow row;
+            /// The security account of a trade
+            AccountId securityAccount = AccountId::invalid();
+            /// The cash account
+            AccountId cashAccount = AccountId::invalid();
+            /// The traded instrument
+            InstrumentId instrument = InstrumentId::invalid();
+        };
+
+        /**
+         * @brief Reports the progress if a callback is given
+         *
+         * @param callback
+         * @param phase
+         * @param done
+         * @param total
+         */
+        void report(
+            const StatementImportProgressCallback& callback,
+            StatementImportPhase                   phase,
+            std::size_t                            done,
+            std::size_t                            total
+        )
+        {
+            if (callback)
+                callback(StatementImportProgress{phase, done, total});
+        }
+
+        /**
+         * @brief The error returned when an import is stopped
+         *
+         * @return FinanceError
+         */
+        FinanceError cancelled()
+        {
+            return FinanceError{
+                FinanceErrorType::ImportCancelled,
+                "The statement import was cancelled"
+            };
+        }
+
+        /**
+         * @brief Builds the error of a row that cannot be imported
+         *
+         * @param line
+         * @param message
+         * @return FinanceError
+         */
+        FinanceError rowError(std::size_t line, std::string_view message)
+        {
+            return FinanceError{
+                FinanceErrorType::InvalidStatement,
+                std::format("line {}: {}", line, message)
+            };
+        }
+
+        /**
+         * @brief Converts a resolved row with TransactionConverter, which
+         * validates its accounts
+         *
+         * @param resolved
+         * @param accounts
+         * @return FinanceResult<finance::DomainTransaction>
+         */
+        FinanceResult<finance::DomainTransaction> convert(
+            const ResolvedRow&       resolved,
+            const finance::Accounts& accounts
+        )
+        {
+            const auto& row     = resolved.row;
+            const auto  comment = row.comment.empty()
+                                      ? std::nullopt
+                                      : std::optional{std::string{row.comment}};
+
+            try
+            {
+                if (row.kind == finance::StatementRowKind::Cash)
+                {
+                    return finance::TransactionConverter::toDomain(
+                        finance::CashTransaction{
+                            TransactionId::invalid(),
+                            row.timestamp,
+                            TransactionStatus::Completed,
+                            resolved.cashAccount,
+                            AccountId::invalid(),
+                            row.amount,
+                            row.fees,
+                            comment
+                        },
+                        accounts
+                    );
+                }
+
+                // the position is assigned when staging
+                return finance::TransactionConverter::toDomain(
+                    finance::StockTransaction{
+                        TransactionId::invalid(),
+                        row.timestamp,
+                        TransactionStatus::Completed,
+                        resolved.instrument,
+                        resolved.securityAccount,
+                        resolved.cashAccount,
+                        AccountId::invalid(),
+                        row.quantity,
+                        row.price,
+                        row.fees,
+                        PositionId::invalid(),
+                        comment
+                    },
+                    accounts
+                );
+            }
+            catch (const std::exception& exception)
+            {
+                return rowError(row.line, exception.what());
+            }
+        }
+    }   // namespace
+
+    /**
+     * @brief Hashes a string
+     *
+     * @param value
+     * @return std::size_t
+     */
+    std::size_t StatementImporter::StringHash::operator()(
+        std::string_view value
+    ) const
+    {
+        return std::hash<std::string_view>{}(value);
+    }
+
+    /**
+     * @brief Construct a new Statement Importer object, the account, ticker
+     * and open position indexes are built from the current store contents
+     *
+     * @param accountStore
+     * @param stockStore
+     * @param positionStore
+     * @param transactionStore
+     * @param positionGateway Used to look up the open stock positions
+     */
+    StatementImporter::StatementImporter(
+        const std::shared_ptr<store::IAccountStore>&     accountStore,
+        const std::shared_ptr<store::IStockStore>&       stockStore,
+        const std::shared_ptr<store::IPositionStore>&    positionStore,
+        const std::shared_ptr<store::ITransactionStore>& transactionStore,
+        const PositionGateway&                           positionGateway
+    )
+        : _positionStore(positionStore),
+          _transactionStore(transactionStore),
+          _accounts(accountStore->getAccountSession())
+    {
+        TRACE_SCOPE("Gateway.StatementImporter.Index");
+
+        for (const auto& [id, account] : _accounts)
+        {
+            switch (account.getKind())
+            {
+                case AccountKind::Security:
+                    _securityAccounts.emplace(account.getName(), id);
+                    break;
+                case AccountKind::Cash:
+                    _cashAccounts.emplace(account.getName(), id);
+                    break;
+                case AccountKind::External:
+                    break;
+            }
+        }
+
+        for (const auto& [id, stock] : stockStore->getStocks())
+            _instruments.emplace(stock.getTicker(), stock.getInstrumentId());
+
+        for (const auto& [_, accountId] : _securityAccounts)
+        {
+            const auto details =
+                positionGateway.getOpenStockPositionDetails(accountId);
+
+            if (!details)
+            {
+                LOG_WARNING(details.error().toString());
+                continue;
+            }
+
+            for (const auto& detail : details.value())
+            {
+                const auto instrument = _instruments.find(detail.ticker);
+                if (instrument == _instruments.end())
+                    continue;
+
+                // with several open positions of a ticker the first one is
+                // continued, like the transaction dialog suggests it first
+                _openPositions.try_emplace(
+                    PositionKey{accountId, instrument->second},
+                    OpenPosition{
+                        detail.positionDraft.getPositionId(),
+                        detail.state.openQuantity
+                    }
+                );
+            }
+        }
+    }
+
+    /**
+     * @brief Reads and converts a statement.
+     *
+     * Rows that cannot be imported are skipped and reported in
+     * StatementImport::rowErrors, only an unreadable statement or a stop
+     * request fail the whole import.
+     *
+     * @param path The CSV file
+     * @param options The layout and account overrides
+     * @param stopToken Stops the import between two rows
+     * @param progress Receives the progress, may be empty
+     * @return FinanceResult<StatementImport>
+     */
+    FinanceResult<StatementImport> StatementImporter::read(
+        const std::filesystem::path&           path,
+        const StatementImportOptions&          options,
+        std::stop_token                        stopToken,
+        const StatementImportProgressCallback& progress
+    ) const
+    {
+        TRACE_SCOPE("Gateway.StatementImporter.Read");
+
+        if (auto valid = _validateOptions(options); !valid)
+            return valid.error();
+
+        std::optional<MappedFile> file;
+        try
+        {
+            file.emplace(path);
+        }
+        catch (const std::system_error& error)
+        {
+            return FinanceError{
+                FinanceErrorType::InvalidStatement,
+                std::format("Could not open statement: {}", error.what())
+            };
+        }
+
+        finance::StatementParser parser{file->view(), options.layout};
+
+        if (auto header = parser.readHeader(); !header)
+            return header.error();
+
+        StatementImport          statement;
+        std::vector<ResolvedRow> rows;
+        const auto               phase = StatementImportPhase::Reading;
+
+        // counts skipped rows too, so that a run of errors still reports
+        std::size_t parsedRows = 0;
+
+        while (auto next = parser.next())
+        {
+            if (stopToken.stop_requested())
+                return cancelled();
+
+            if (parsedRows++ % PROGRESS_INTERVAL == 0)
+                report(progress, phase, parser.getOffset(), parser.getSize());
+
+            if (!next.value())
+            {
+                statement.rowErrors.push_back(next.value().error());
+                continue;
+            }
+
+            ResolvedRow resolved{.row = next.value().value()};
+            const auto& row  = resolved.row;
+            const bool  cash = row.kind == finance::StatementRowKind::Cash;
+
+            auto cashAccount = _resolveAccount(
+                cash ? row.account : row.cashAccount,
+                options.cashAccount,
+                _cashAccounts,
+                row.line
+            );
+
+            if (!cashAccount)
+            {
+                statement.rowErrors.push_back(cashAccount.error());
+                continue;
+            }
+
+            resolved.cashAccount = cashAccount.value();
+
+            const auto currency =
+                _accounts.at(resolved.cashAccount).getCurrency();
+
+            if (currency != row.currency)
+            {
+                statement.rowErrors.push_back(rowError(
+                    row.line,
+                    std::format(
+                        "currency {} does not match the cash account ({})",
+                        CurrencyMeta::toString(row.currency),
+                        CurrencyMeta::toString(currency)
+                    )
+                ));
+                continue;
+            }
+
+            if (!cash)
+            {
+                auto securityAccount = _resolveAccount(
+                    row.account,
+                    options.securityAccount,
+                    _securityAccounts,
+                    row.line
+                );
+
+                if (!securityAccount)
+                {
+                    statement.rowErrors.push_back(securityAccount.error());
+                    continue;
+                }
+
+                const auto instrument = _instruments.find(row.symbol);
+                if (instrument == _instruments.end())
+                {
+                    statement.rowErrors.push_back(rowError(
+                        row.line,
+                        std::format("unknown ticker '{}'", row.symbol)
+                    ));
+                    continue;
+                }
+
+                resolved.securityAccount = securityAccount.value();
+                resolved.instrument      = instrument->second;
+            }
+
+            rows.push_back(resolved);
+        }
+
+        report(progress, phase, parser.getSize(), parser.getSize());
+
+        // brokers often export the newest rows first, positions are built in
+        // chronological order
+        std::ranges::stable_sort(
+            rows,
+            [](const ResolvedRow& lhs, const ResolvedRow& rhs)
+            { return lhs.row.timestamp < rhs.row.timestamp; }
+        );
+
+        statement.transactions.reserve(rows.size());
+        statement.positionSlots.reserve(rows.size());
+
+        auto openPositions = _openPositions;
+        std::map<PositionKey, std::size_t> openSlots;
+
+        for (std::size_t i = 0; i < rows.size(); ++i)
+        {
+            if (stopToken.stop_requested())
+                return cancelled();
+
+            if (i % PROGRESS_INTERVAL == 0)
+            {
+                report(
+                    progress,
+                    StatementImportPhase::Converting,
+                    i,
+                    rows.size()
+                );
+            }
+
+            const auto& resolved = rows[i];
+            auto        domain   = convert(resolved, _accounts);
+
+            if (!domain)
+            {
+                statement.rowErrors.push_back(domain.error());
+                continue;
+            }
+
+            auto slot = StatementImport::NO_POSITION;
+
+            if (resolved.row.kind == finance::StatementRowKind::Trade)
+            {
+                const PositionKey key{
+                    resolved.securityAccount,
+                    resolved.instrument
+                };
+
+                auto& position = openPositions[key];
+
+                // a trade on a flat position opens a new one
+                if (position.quantity.toMicroUnits() == 0)
+                {
+                    openSlots.erase(key);
+                    position.id = PositionId::invalid();
+                }
+
+                if (!openSlots.contains(key))
+                {
+                    openSlots[key] = statement.positions.size();
+                    statement.positions.push_back(
+                        StatementImport::PositionSlot{
+                            position.id,
+                            resolved.row.timestamp
+                        }
+                    );
+                }
+
+                slot               = openSlots.at(key);
+                position.quantity += resolved.row.quantity;
+            }
+
+            statement.transactions.push_back(std::move(domain.value()));
+            statement.positionSlots.push_back(slot);
+        }
+
+        report(
+            progress,
+            StatementImportPhase::Converting,
+            rows.size(),
+            rows.size()
+        );
+
+        LOG_INFO(
+            std::format(
+                "Read statement {}: {} transactions, {} skipped rows",
+                path.string(),
+                statement.transactions.size(),
+                statement.rowErrors.size()
+            )
+        );
+
+        return statement;
+    }
+
+    /**
+     * @brief Stages a read statement: the new positions are created and all
+     * transactions are added to the transaction store as one batch.
+     *
+     * @param statement The result of read()
+     * @return FinanceResult<StatementImportSummary>
+     */
+    FinanceResult<StatementImportSummary> StatementImporter::stage(
+        StatementImport statement
+    )
+    {
+        TRACE_SCOPE("Gateway.StatementImporter.Stage");
+
+        StatementImportSummary summary{
+            .transactions     = statement.transactions.size(),
+            .createdPositions = 0,
+            .skippedRows      = statement.rowErrors.size()
+        };
+
+        std::vector<PositionId> positionIds;
+        positionIds.reserve(statement.positions.size());
+
+        for (const auto& slot : statement.positions)
+        {
+            if (slot.existing.isValid())
+            {
+                positionIds.push_back(slot.existing);
+                continue;
+            }
+
+            positionIds.push_back(
+                _positionStore->createPosition(finance::Position{slot.openedAt})
+            );
+            ++summary.createdPositions;
+        }
+
+        for (std::size_t i = 0; i < statement.transactions.size(); ++i)
+        {
+            const auto slot = statement.positionSlots[i];
+            if (slot == StatementImport::NO_POSITION)
+                continue;
+
+            auto& transaction = statement.transactions[i];
+            auto  legs        = transaction.getLegs();
+
+            for (auto& leg : legs)
+                leg.setPositionId(positionIds[slot]);
+
+            transaction.setLegs(legs);
+        }
+
+        auto&      transactions = statement.transactions;
+        const auto result =
+            _transactionStore->addTransactions(std::move(transactions));
+
+        if (result != store::TransactionStoreResult::Ok)
+        {
+            return FinanceError{
+                FinanceErrorType::InvalidTransaction,
+                std::format(
+                    "Failed to stage the imported transactions: {}",
+                    store::TransactionStoreResultMeta::toString(result)
+                )
+            };
+        }
+
+        return summary;
+    }
+
+    /**
+     * @brief Resolves the account of a row
+     *
+     * @param name The account name of the row
+     * @param fixed The account of all rows, takes precedence over the name,
+     * see _validateOptions
+     * @param index The accounts of the expected kind by their name
+     * @param line The line of the row, for the error message
+     * @return FinanceResult<AccountId>
+     */
+    FinanceResult<AccountId> StatementImporter::_resolveAccount(
+        std::string_view                name,
+        const std::optional<AccountId>& fixed,
+        const NameIndex<AccountId>&     index,
+        std::size_t                     line
+    ) const
+    {
+        if (fixed)
+            return fixed.value();
+
+        if (name.empty())
+            return rowError(line, "no account given");
+
+        const auto account = index.find(name);
+        if (account == index.end())
+            return rowError(line, std::format("unknown account '{}'", name));
+
+        return account->second;
+    }
+
+    /**
+     * @brief Checks that the account overrides of the options exist and are
+     * of the expected kind
+     *
+     * @param options
+     * @return FinanceResult<void>
+     */
+    FinanceResult<void> StatementImporter::_validateOptions(
+        const StatementImportOptions& options
+    ) const
+    {
+        const auto check = [this](
+                               const std::optional<AccountId>& accountId,
+                               AccountKind                     kind
+                           ) -> FinanceResult<void>
+        {
+            if (!accountId)
+                return FinanceResult<void>{};
+
+            if (!_accounts.contains(accountId.value()))
+            {
+                return FinanceError{
+                    FinanceErrorType::AccountNotFound,
+                    std::format("Unknown account {}", accountId->toString())
+                };
+            }
+
+            if (_accounts.at(accountId.value()).getKind() != kind)
+            {
+                return FinanceError{
+                    FinanceErrorType::InvalidAccount,
+                    std::format(
+                        "Account {} is not a {} account",
+                        accountId->toString(),
+                        AccountKindMeta::toString(kind)
+                    )
+                };
+            }
+
+            return FinanceResult<void>{};
+        };
+
+        auto security = check(options.securityAccount, AccountKind::Security);
+        if (!security)
+            return security;
+
+        return check(options.cashAccount, AccountKind::Cash);
+    }
+
+}   // namespace gateway
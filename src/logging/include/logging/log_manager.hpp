@@ -1,7 +1,9 @@
 #ifndef __LOGGING__INCLUDE__LOGGING__LOG_MANAGER_HPP__
 #define __LOGGING__INCLUDE__LOGGING__LOG_MANAGER_HPP__
 
+#include <chrono>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <string_view>
 
@@ -30,6 +32,10 @@ namespace logging
         /// The name of the file where the persisted log levels are stored.
         static constexpr auto _persistedLogLevelFile = "log_levels.json";
 
+        /// Group-commit interval of the log file, buffered records are
+        /// written out at the latest with the first record after it
+        static constexpr std::chrono::milliseconds _flushInterval{500};
+
         /// The collection of log categories, organized in a hierarchical
         /// structure
         LogCategories _categories;
@@ -41,6 +47,10 @@ namespace logging
         /// The ring file logger instance used for logging to files.
         std::unique_ptr<RingFile> _ringFile;
 
+        /// Serializes writes to the ring file, records may be logged from
+        /// worker threads (e.g. the background database backup).
+        std::mutex _writeMutex;
+
         /// The directory where log files are stored.
         std::string _logDirectory;
 
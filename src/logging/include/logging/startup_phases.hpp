@@ -0,0 +1,87 @@
+#ifndef __LOGGING__INCLUDE__LOGGING__STARTUP_PHASES_HPP__
+#define __LOGGING__INCLUDE__LOGGING__STARTUP_PHASES_HPP__
+
+#include <chrono>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace logging
+{
+
+    /**
+     * @brief The measured duration of a single startup phase
+     *
+     */
+    struct StartupPhaseTiming
+    {
+        /// The name of the phase, e.g. "Stores.Hydrate.Stocks"
+        std::string name;
+        /// The wall clock duration of the phase
+        std::chrono::steady_clock::duration duration;
+    };
+
+    /**
+     * @brief Singleton collecting the timings of the application startup
+     *
+     * Every phase is logged as soon as it ends, phases may end on worker
+     * threads. Calling finish() once the application is ready logs a summary
+     * of all phases together with the total startup time, phases recorded
+     * afterwards (e.g. a store hydrated on its first access) are still logged
+     * individually.
+     */
+    class StartupPhases
+    {
+       private:
+        /// Guards the recorded timings, phases are recorded concurrently
+        mutable std::mutex _mutex;
+        /// The timings of all phases recorded so far
+        std::vector<StartupPhaseTiming> _timings;
+        /// The point in time the startup began
+        std::chrono::steady_clock::time_point _start;
+        /// Whether the startup summary was already logged
+        bool _finished = false;
+
+        StartupPhases();
+
+       public:
+        static StartupPhases& getInstance();
+
+        void record(
+            const std::string&                  name,
+            std::chrono::steady_clock::duration duration
+        );
+        void finish();
+
+        [[nodiscard]] std::vector<StartupPhaseTiming> getTimings() const;
+    };
+
+    /**
+     * @brief RAII scope recording the duration of a startup phase
+     *
+     */
+    class StartupPhaseScope
+    {
+       private:
+        /// The name of the phase
+        std::string _name;
+        /// The point in time the phase began
+        std::chrono::steady_clock::time_point _start;
+
+       public:
+        explicit StartupPhaseScope(std::string name);
+        ~StartupPhaseScope();
+
+        StartupPhaseScope(const StartupPhaseScope&)            = delete;
+        StartupPhaseScope& operator=(const StartupPhaseScope&) = delete;
+        StartupPhaseScope(StartupPhaseScope&&)                 = delete;
+        StartupPhaseScope& operator=(StartupPhaseScope&&)      = delete;
+    };
+
+}   // namespace logging
+
+// NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
+#define STARTUP_PHASE(name) \
+    logging::StartupPhaseScope __startupPhaseScope__(name)
+
+#endif   // __LOGGING__INCLUDE__LOGGING__STARTUP_PHASES_HPP__
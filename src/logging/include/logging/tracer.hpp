@@ -0,0 +1,192 @@
+#ifndef __LOGGING__INCLUDE__LOGGING__TRACER_HPP__
+#define __LOGGING__INCLUDE__LOGGING__TRACER_HPP__
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace logging
+{
+    /**
+     * @brief A single completed trace scope
+     *
+     */
+    struct TraceEvent
+    {
+        /// The name of the scope, always a string literal
+        const char* name = nullptr;
+        /// Start of the scope in nanoseconds since the capture started
+        std::int64_t startNs = 0;
+        /// Duration of the scope in nanoseconds
+        std::int64_t durationNs = 0;
+        /// The trace thread id of the recording thread
+        std::uint32_t threadId = 0;
+    };
+
+    /**
+     * @brief Fixed size event buffer owned by a single thread
+     *
+     * Only the owning thread appends, the size is published with release
+     * semantics so the tracer can read all published events without a lock.
+     */
+    struct TraceThreadBuffer
+    {
+        /// Number of events a single thread can record per capture
+        static constexpr std::size_t CAPACITY = 1U << 16U;
+
+        /// The trace thread id of the owning thread
+        std::uint32_t threadId = 0;
+        /// The capture the events belong to
+        std::atomic<std::uint64_t> session{0};
+        /// The recorded events, allocated on the first event
+        std::unique_ptr<TraceEvent[]> events;   // NOLINT(*-avoid-c-arrays)
+        /// The number of published events
+        std::atomic<std::size_t> size{0};
+        /// The number of events dropped because the buffer was full
+        std::atomic<std::size_t> dropped{0};
+    };
+
+    /**
+     * @brief Summary of a finished capture
+     *
+     */
+    struct TraceCaptureInfo
+    {
+        /// Number of recorded events
+        std::size_t events = 0;
+        /// Number of events dropped because a thread buffer was full
+        std::size_t dropped = 0;
+        /// Number of threads that recorded events
+        std::size_t threads = 0;
+    };
+
+    /**
+     * @brief Lightweight scope tracer writing Chrome trace-event JSON
+     *
+     * TRACE_SCOPE markers cost a single relaxed atomic load while no capture
+     * is running. During a capture every thread appends to its own buffer
+     * without locking, the buffers are only registered (once per thread)
+     * under a mutex. The buffer of an exited thread is handed to the next new
+     * thread, so short-lived threads do not allocate a buffer each. The
+     * result can be opened in Perfetto (ui.perfetto.dev) or chrome://tracing.
+     */
+    class Tracer
+    {
+       private:
+        /// Whether a capture is running, checked by every trace scope
+        inline static std::atomic<bool> _capturing{false};
+
+        /// Guards the registered buffers and the capture state
+        mutable std::mutex _mutex;
+        /// All thread buffers ever registered, they outlive their threads
+        std::vector<std::unique_ptr<TraceThreadBuffer>> _buffers;
+        /// The buffers of exited threads, reused by new threads
+        std::vector<TraceThreadBuffer*> _freeBuffers;
+        /// The current capture, increased on every start
+        std::atomic<std::uint64_t> _session{0};
+        /// The point in time the current capture started
+        std::atomic<std::chrono::steady_clock::rep> _captureStart{0};
+
+        Tracer() = default;
+
+       public:
+        static Tracer& getInstance();
+
+        /**
+         * @brief Whether a capture is currently running
+         *
+         * @return true if trace scopes are recorded, false otherwise
+         */
+        [[nodiscard]] static bool isCapturing()
+        {
+            return _capturing.load(std::memory_order_relaxed);
+        }
+
+        void             start();
+        TraceCaptureInfo stop();
+
+        [[nodiscard]] std::vector<TraceEvent> getEvents() const;
+        [[nodiscard]] bool writeChromeTrace(const std::filesystem::path& path
+        ) const;
+
+        void record(
+            const char*                           name,
+            std::chrono::steady_clock::time_point start,
+            std::chrono::steady_clock::time_point end
+        );
+
+       private:
+        TraceThreadBuffer& _threadBuffer();
+        TraceThreadBuffer& _acquireBuffer();
+        void               _releaseBuffer(TraceThreadBuffer& buffer);
+    };
+
+    /**
+     * @brief RAII scope recording a trace event while a capture is running
+     *
+     */
+    class TraceScope
+    {
+       private:
+        /// The name of the scope, nullptr if no capture was running
+        const char* _name = nullptr;
+        /// The point in time the scope began
+        std::chrono::steady_clock::time_point _start;
+
+       public:
+        explicit TraceScope(const char* name);
+        ~TraceScope();
+
+        TraceScope(const TraceScope&)            = delete;
+        TraceScope& operator=(const TraceScope&) = delete;
+        TraceScope(TraceScope&&)                 = delete;
+        TraceScope& operator=(TraceScope&&)      = delete;
+    };
+
+    /**
+     * @brief Construct a new Trace Scope, the start is only taken while a
+     * capture is running
+     *
+     * @param name The name of the scope, must be a string literal
+     */
+    inline TraceScope::TraceScope(const char* name)
+    {
+        if (!Tracer::isCapturing())
+            return;
+
+        _name  = name;
+        _start = std::chrono::steady_clock::now();
+    }
+
+    /**
+     * @brief Destroy the Trace Scope, recording the event
+     *
+     */
+    inline TraceScope::~TraceScope()
+    {
+        if (_name != nullptr)
+        {
+            Tracer::getInstance().record(
+                _name,
+                _start,
+                std::chrono::steady_clock::now()
+            );
+        }
+    }
+
+}   // namespace logging
+
+// NOLINTBEGIN(cppcoreguidelines-macro-usage)
+#define TRACE_CONCATENATE_DETAIL(x, y) x##y
+#define TRACE_CONCATENATE(x, y)        TRACE_CONCATENATE_DETAIL(x, y)
+
+#define TRACE_SCOPE(name) \
+    logging::TraceScope TRACE_CONCATENATE(__traceScope__, __COUNTER__)(name)
+// NOLINTEND(cppcoreguidelines-macro-usage)
+
+#endif   // __LOGGING__INCLUDE__LOGGING__TRACER_HPP__
@@ -113,6 +113,9 @@ namespace logging
         config.symlinkPath = config.directory / (settings.getLogFilePrefix() +
                                                  "latest" + config.extension);
 
+        config.backend       = RingFileBackend::Fd;
+        config.flushInterval = _flushInterval;
+
         _ringFile = std::make_unique<RingFile>(config);
     }
 
@@ -170,7 +173,11 @@ namespace logging
      * @brief Flush the log file
      *
      */
-    void LogManager::flush() { _ringFile->flush(); }
+    void LogManager::flush()
+    {
+        std::lock_guard lock{_writeMutex};
+        _ringFile->flush();
+    }
 
     /**
      * @brief Change the log level for a given category
@@ -263,13 +270,14 @@ namespace logging
             pos += prefixLength + 1;
         }
 
+        std::lock_guard lock{_writeMutex};
+
         _ringFile->writeLine(buffer);
 
-        // Flush the log file if the log level is not Info
-        // 1) on warning or error we want always to log
-        // 2) if the user selected a debug logging we also want always to log
-        if (logObject.level != LogLevel::Info)
-            flush();
+        // Warnings and errors are flushed right away, all other records are
+        // written out by group commit after _flushInterval
+        if (logObject.level <= LogLevel::Warning)
+            _ringFile->flush();
     }
 
     /**
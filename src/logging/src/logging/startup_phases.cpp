@@ -0,0 +1,132 @@
+#include "logging/startup_phases.hpp"
+
+#include <format>
+#include <utility>
+
+#include "logging/log_macros.hpp"
+
+REGISTER_LOG_CATEGORY("Logging.Startup");
+
+namespace logging
+{
+    namespace
+    {
+        /**
+         * @brief Convert a duration to fractional milliseconds for logging
+         */
+        double _toMs(std::chrono::steady_clock::duration duration)
+        {
+            return std::chrono::duration<double, std::milli>(duration).count();
+        }
+    }   // namespace
+
+    /**
+     * @brief Construct the startup phases, the startup is considered to begin
+     * with the first use of the singleton
+     *
+     */
+    StartupPhases::StartupPhases() : _start{std::chrono::steady_clock::now()}
+    {
+    }
+
+    /**
+     * @brief Get the singleton instance
+     *
+     * @return StartupPhases&
+     */
+    StartupPhases& StartupPhases::getInstance()
+    {
+        static StartupPhases instance;
+        return instance;
+    }
+
+    /**
+     * @brief Record the duration of a finished phase and log it
+     *
+     * @param name The name of the phase
+     * @param duration The duration of the phase
+     */
+    void StartupPhases::record(
+        const std::string&                  name,
+        std::chrono::steady_clock::duration duration
+    )
+    {
+        {
+            const std::lock_guard lock{_mutex};
+            _timings.push_back(
+                StartupPhaseTiming{.name = name, .duration = duration}
+            );
+        }
+
+        LOG_INFO(
+            std::format("Startup phase {} took {:.2f} ms", name, _toMs(duration))
+        );
+    }
+
+    /**
+     * @brief Mark the startup as finished and log a summary of all phases,
+     * subsequent calls are ignored
+     *
+     */
+    void StartupPhases::finish()
+    {
+        std::vector<StartupPhaseTiming> timings;
+        {
+            const std::lock_guard lock{_mutex};
+            if (_finished)
+                return;
+
+            _finished = true;
+            timings   = _timings;
+        }
+
+        const auto total = std::chrono::steady_clock::now() - _start;
+
+        LOG_INFO(std::format("Startup finished in {:.2f} ms", _toMs(total)));
+
+        for (const auto& timing : timings)
+        {
+            LOG_INFO(
+                std::format(
+                    "  {:<40} {:>10.2f} ms",
+                    timing.name,
+                    _toMs(timing.duration)
+                )
+            );
+        }
+    }
+
+    /**
+     * @brief Get a copy of all timings recorded so far
+     *
+     * @return std::vector<StartupPhaseTiming>
+     */
+    std::vector<StartupPhaseTiming> StartupPhases::getTimings() const
+    {
+        const std::lock_guard lock{_mutex};
+        return _timings;
+    }
+
+    /**
+     * @brief Construct a new Startup Phase Scope, starting the measurement
+     *
+     * @param name The name of the phase
+     */
+    StartupPhaseScope::StartupPhaseScope(std::string name)
+        : _name{std::move(name)}, _start{std::chrono::steady_clock::now()}
+    {
+    }
+
+    /**
+     * @brief Destroy the Startup Phase Scope, recording the phase duration
+     *
+     */
+    StartupPhaseScope::~StartupPhaseScope()
+    {
+        StartupPhases::getInstance().record(
+            _name,
+            std::chrono::steady_clock::now() - _start
+        );
+    }
+
+}   // namespace logging
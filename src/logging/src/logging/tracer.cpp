@@ -0,0 +1,352 @@
+#include "logging/tracer.hpp"
+
+#include <algorithm>
+#include <format>
+#include <fstream>
+#include <string>
+#include <string_view>
+
+#include "logging/log_macros.hpp"
+
+REGISTER_LOG_CATEGORY("Logging.Tracer");
+
+namespace logging
+{
+    namespace
+    {
+        /**
+         * @brief Convert nanoseconds to the microseconds used by the Chrome
+         * trace-event format, keeping the nanosecond resolution
+         */
+        double _toUs(std::int64_t nanoseconds)
+        {
+            constexpr double NS_PER_US = 1000.0;
+            return static_cast<double>(nanoseconds) / NS_PER_US;
+        }
+
+        /**
+         * @brief Escape a string for a JSON string literal
+         */
+        std::string _escapeJson(std::string_view text)
+        {
+            std::string escaped;
+            escaped.reserve(text.size());
+
+            for (const char character : text)
+            {
+                if (character == '"' || character == '\\')
+                    escaped += '\\';
+                escaped += character;
+            }
+
+            return escaped;
+        }
+    }   // namespace
+
+    /**
+     * @brief Get the singleton instance
+     *
+     * @return Tracer&
+     */
+    Tracer& Tracer::getInstance()
+    {
+        static Tracer instance;
+        return instance;
+    }
+
+    /**
+     * @brief Start a new capture, events of a previous capture are discarded
+     *
+     */
+    void Tracer::start()
+    {
+        const std::lock_guard lock{_mutex};
+
+        if (_capturing.load())
+            return;
+
+        _captureStart.store(
+            std::chrono::steady_clock::now().time_since_epoch().count()
+        );
+        _session.fetch_add(1, std::memory_order_release);
+        _capturing.store(true);
+
+        LOG_INFO("Started trace capture");
+    }
+
+    /**
+     * @brief Stop the running capture, the recorded events are kept until
+     * the next capture is started
+     *
+     * @return TraceCaptureInfo summary of the capture
+     */
+    TraceCaptureInfo Tracer::stop()
+    {
+        const std::lock_guard lock{_mutex};
+
+        _capturing.store(false);
+
+        const auto       session = _session.load();
+        TraceCaptureInfo info;
+
+        for (const auto& buffer : _buffers)
+        {
+            if (buffer->session.load(std::memory_order_acquire) != session)
+                continue;
+
+            const auto size = buffer->size.load(std::memory_order_acquire);
+            if (size == 0)
+                continue;
+
+            info.events  += size;
+            info.dropped += buffer->dropped.load();
+            ++info.threads;
+        }
+
+        LOG_INFO(
+            std::format(
+                "Stopped trace capture: {} events on {} threads ({} dropped)",
+                info.events,
+                info.threads,
+                info.dropped
+            )
+        );
+
+        return info;
+    }
+
+    /**
+     * @brief Get all events of the current (or last) capture ordered by their
+     * start time
+     *
+     * @return std::vector<TraceEvent>
+     */
+    std::vector<TraceEvent> Tracer::getEvents() const
+    {
+        const std::lock_guard lock{_mutex};
+
+        const auto              session = _session.load();
+        std::vector<TraceEvent> events;
+
+        for (const auto& buffer : _buffers)
+        {
+            if (buffer->session.load(std::memory_order_acquire) != session)
+                continue;
+
+            const auto size = buffer->size.load(std::memory_order_acquire);
+            events.insert(
+                events.end(),
+                buffer->events.get(),
+                buffer->events.get() + size
+            );
+        }
+
+        std::ranges::sort(events, {}, &TraceEvent::startNs);
+
+        return events;
+    }
+
+    /**
+     * @brief Write the events of the current (or last) capture as Chrome
+     * trace-event JSON
+     *
+     * @param path The file to write
+     * @return true if the file was written, false otherwise
+     */
+    bool Tracer::writeChromeTrace(const std::filesystem::path& path) const
+    {
+        const auto events = getEvents();
+
+        std::ofstream file{path, std::ios::trunc};
+        if (!file)
+        {
+            LOG_ERROR(
+                std::format("Failed to open trace file '{}'", path.string())
+            );
+            return false;
+        }
+
+        file << R"({"displayTimeUnit":"ns","traceEvents":[)";
+
+        std::vector<std::uint32_t> threadIds;
+        for (std::size_t i = 0; i < events.size(); ++i)
+        {
+            const auto& event = events[i];
+
+            file << std::format(
+                R"({}{{"name":"{}","cat":"MolarTracker","ph":"X","pid":1,)"
+                R"("tid":{},"ts":{:.3f},"dur":{:.3f}}})",
+                i == 0 ? "" : ",\n",
+                _escapeJson(event.name),
+                event.threadId,
+                _toUs(event.startNs),
+                _toUs(event.durationNs)
+            );
+
+            if (std::ranges::find(threadIds, event.threadId) == threadIds.end())
+                threadIds.push_back(event.threadId);
+        }
+
+        for (const auto threadId : threadIds)
+        {
+            file << std::format(
+                R"({}{{"name":"thread_name","ph":"M","pid":1,"tid":{},)"
+                R"("args":{{"name":"Thread {}"}}}})",
+                events.empty() ? "" : ",\n",
+                threadId,
+                threadId
+            );
+        }
+
+        file << "]}\n";
+
+        if (!file)
+        {
+            LOG_ERROR(
+                std::format("Failed to write trace file '{}'", path.string())
+            );
+            return false;
+        }
+
+        LOG_INFO(
+            std::format(
+                "Wrote {} trace events to '{}'",
+                events.size(),
+                path.string()
+            )
+        );
+
+        return true;
+    }
+
+    /**
+     * @brief Record a finished scope into the buffer of the calling thread,
+     * this does not lock
+     *
+     * @param name The name of the scope
+     * @param start The start of the scope
+     * @param end The end of the scope
+     */
+    void Tracer::record(
+        const char*                           name,
+        std::chrono::steady_clock::time_point start,
+        std::chrono::steady_clock::time_point end
+    )
+    {
+        auto&      buffer  = _threadBuffer();
+        const auto session = _session.load(std::memory_order_acquire);
+
+        // only the owning thread resets its buffer for a new capture
+        if (buffer.session.load(std::memory_order_relaxed) != session)
+        {
+            buffer.size.store(0, std::memory_order_relaxed);
+            buffer.dropped.store(0, std::memory_order_relaxed);
+            buffer.session.store(session, std::memory_order_release);
+        }
+
+        const auto size = buffer.size.load(std::memory_order_relaxed);
+        if (size >= TraceThreadBuffer::CAPACITY)
+        {
+            buffer.dropped.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+
+        const auto captureStart = std::chrono::steady_clock::time_point{
+            std::chrono::steady_clock::duration{
+                _captureStart.load(std::memory_order_relaxed)
+            }
+        };
+
+        using std::chrono::duration_cast;
+        using std::chrono::nanoseconds;
+
+        const auto offset = start - captureStart;
+
+        buffer.events[size] = TraceEvent{
+            .name       = name,
+            .startNs    = duration_cast<nanoseconds>(offset).count(),
+            .durationNs = duration_cast<nanoseconds>(end - start).count(),
+            .threadId   = buffer.threadId
+        };
+
+        buffer.size.store(size + 1, std::memory_order_release);
+    }
+
+    /**
+     * @brief Get the buffer of the calling thread, acquiring it on first use.
+     * The buffer is released when the thread exits.
+     *
+     * @return TraceThreadBuffer&
+     */
+    TraceThreadBuffer& Tracer::_threadBuffer()
+    {
+        /// Owns the buffer of a thread and releases it on thread exit
+        struct Lease
+        {
+            /// The buffer of the thread, nullptr before the first event
+            TraceThreadBuffer* buffer = nullptr;
+
+            Lease()                        = default;
+            Lease(const Lease&)            = delete;
+            Lease& operator=(const Lease&) = delete;
+            Lease(Lease&&)                 = delete;
+            Lease& operator=(Lease&&)      = delete;
+
+            ~Lease()
+            {
+                if (buffer != nullptr)
+                    Tracer::getInstance()._releaseBuffer(*buffer);
+            }
+        };
+
+        thread_local Lease lease;
+
+        if (lease.buffer == nullptr)
+            lease.buffer = &_acquireBuffer();
+
+        return *lease.buffer;
+    }
+
+    /**
+     * @brief Take the buffer of an exited thread or register a new one.
+     *
+     * A reused buffer keeps its trace thread id and the events it recorded in
+     * the current capture, the threads then share a track in the viewer.
+     *
+     * @return TraceThreadBuffer&
+     */
+    TraceThreadBuffer& Tracer::_acquireBuffer()
+    {
+        const std::lock_guard lock{_mutex};
+
+        if (!_freeBuffers.empty())
+        {
+            auto* buffer = _freeBuffers.back();
+            _freeBuffers.pop_back();
+            return *buffer;
+        }
+
+        auto buffer    = std::make_unique<TraceThreadBuffer>();
+        buffer->events = std::make_unique<TraceEvent[]>(   // NOLINT
+            TraceThreadBuffer::CAPACITY
+        );
+        buffer->threadId = static_cast<std::uint32_t>(_buffers.size() + 1);
+
+        _buffers.push_back(std::move(buffer));
+
+        return *_buffers.back();
+    }
+
+    /**
+     * @brief Return the buffer of an exiting thread, the mutex hands the
+     * recorded events over to the next owner
+     *
+     * @param buffer
+     */
+    void Tracer::_releaseBuffer(TraceThreadBuffer& buffer)
+    {
+        const std::lock_guard lock{_mutex};
+        _freeBuffers.push_back(&buffer);
+    }
+
+}   // namespace logging
@@ -1,15 +1,22 @@
 #ifndef __ORM__INCLUDE__ORM__CRUD_HPP__
 #define __ORM__INCLUDE__ORM__CRUD_HPP__
 
+#include <cstddef>
+#include <cstdint>
 #include <expected>
 #include <mstd/error.hpp>
 #include <optional>
+#include <span>
+#include <string>
+#include <string_view>
 #include <vector>
 
+#include "common/container/ring_buffer.hpp"
 #include "crud/crud_error.hpp"
 #include "db/database.hpp"
 #include "db/transaction.hpp"
 #include "join.hpp"
+#include "orm/concepts.hpp"
 #include "orm/type_traits.hpp"
 #include "query_options.hpp"
 
@@ -21,12 +28,16 @@ namespace orm
      */
     class Crud
     {
+       public:
+        /// Number of executed SQL statements kept by getExecutedSQL
+        static constexpr std::size_t SQL_HISTORY_CAPACITY = 1000;
+
        private:
-        /// A vector to store executed SQL statements
-        std::vector<std::string> _sqlExecutions;
+        /// The most recently executed SQL statements
+        RingBuffer<std::string> _sqlExecutions{SQL_HISTORY_CAPACITY};
 
        public:
-        [[nodiscard]] const std::vector<std::string>& getExecutedSQL() const;
+        [[nodiscard]] const RingBuffer<std::string>& getExecutedSQL() const;
 
         /******************
          * CREATE METHODS *
@@ -62,6 +73,23 @@ namespace orm
             const Models&... rows
         );
 
+        /******************
+         * UPSERT METHODS *
+         ******************/
+
+        template <db_model Model>
+        [[nodiscard]] std::expected<std::vector<std::int64_t>, CrudError> upsert(
+            db::Database&          database,
+            std::span<const Model> rows
+        );
+
+        template <db_model Model>
+        [[nodiscard]] std::expected<std::vector<std::int64_t>, CrudError> upsert(
+            db::Database& database,
+            const db::Transaction& /*transaction*/,
+            std::span<const Model> rows
+        );
+
         /******************
          * UPDATE METHODS *
          ******************/
@@ -111,6 +139,55 @@ namespace orm
             const Query&  query
         );
 
+        /*********************
+         * AGGREGATE METHODS *
+         *********************/
+
+        template <db_model Model>
+        [[nodiscard]] bool exists(db::Database& database, const Query& query);
+
+        template <db_model Model>
+        [[nodiscard]] std::int64_t count(
+            db::Database& database,
+            const Query&  query = Query{}
+        );
+
+        template <typename Field>
+        [[nodiscard]] optional_inner_t<typename Field::value_type> sum(
+            db::Database& database,
+            const Query&  query = Query{}
+        );
+
+        template <typename Field>
+        [[nodiscard]] std::optional<optional_inner_t<typename Field::value_type>>
+        minimum(db::Database& database, const Query& query = Query{});
+
+        template <typename Field>
+        [[nodiscard]] std::optional<optional_inner_t<typename Field::value_type>>
+        maximum(db::Database& database, const Query& query = Query{});
+
+        /******************
+         * SEARCH METHODS *
+         ******************/
+
+        template <db_model Model>
+        [[nodiscard]] std::vector<std::int64_t> search(
+            db::Database&    database,
+            std::string_view text,
+            std::size_t      limit
+        );
+
+        [[nodiscard]] std::vector<std::int64_t> search(
+            db::Database&    database,
+            std::string_view searchTable,
+            std::string_view text,
+            std::size_t      limit
+        );
+
+        [[nodiscard]] static std::string toMatchExpression(
+            std::string_view text
+        );
+
         /******************
          * DELETE METHODS *
          ******************/
@@ -118,6 +195,9 @@ namespace orm
         template <db_model Model>
         void deleteByPk(db::Database& database, const Model& model);
 
+        template <db_model Model>
+        void deleteWhere(db::Database& database, const Query& query);
+
         /******************
          * COLUMN METHODS *
          ******************/
@@ -135,6 +215,26 @@ namespace orm
         );
 
        private:
+        template <typename Value>
+        [[nodiscard]] std::optional<Value> _queryScalar(
+            db::Database&      database,
+            const std::string& sqlText,
+            const Query&       query
+        );
+
+        template <typename Field>
+        [[nodiscard]] std::string _aggregateSql(
+            std::string_view function,
+            const Query&     query
+        );
+
+        [[nodiscard]] static std::string _buildUpsertSql(
+            std::string_view                tableName,
+            const std::vector<std::string>& columnNames,
+            std::string_view                pkName,
+            std::size_t                     nRows
+        );
+
         bool _columnExists(
             db::Database&      database,
             const std::string& columnName,
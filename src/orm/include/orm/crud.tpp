@@ -1,11 +1,18 @@
 #ifndef __ORM__INCLUDE__ORM__CRUD_TPP__
 #define __ORM__INCLUDE__ORM__CRUD_TPP__
 
+#include <algorithm>
+#include <cstddef>
 #include <cstdint>
 #include <expected>
+#include <format>
 #include <mstd/error.hpp>
 #include <mstd/string.hpp>
 #include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <type_traits>
 #include <vector>
 
 #include "crud/crud_error.hpp"
@@ -15,6 +22,9 @@
 #include "db/transaction.hpp"
 #include "filter/expr_node.hpp"
 #include "logging/log_macros.hpp"
+#include "logging/tracer.hpp"
+#include "orm/binder.hpp"
+#include "orm/concepts.hpp"
 #include "orm/crud.hpp"
 #include "orm/crud/crud_detail.hpp"
 #include "orm/fields.hpp"
@@ -80,7 +90,7 @@ namespace orm
 
         database.execute(sqlText);
 
-        _sqlExecutions.push_back(sqlText);
+        _sqlExecutions.push(sqlText);
     }
 
     /******************
@@ -133,6 +143,8 @@ namespace orm
         const Model& row
     )
     {
+        TRACE_SCOPE("ORM.Insert");
+
         LOG_DEBUG(std::format("Inserting {} into DB.", row.toString()));
 
         std::size_t nInsertableFields = 0;
@@ -190,7 +202,7 @@ namespace orm
 
         auto statement = database.prepare(sqlText);
 
-        _sqlExecutions.push_back(sqlText);
+        _sqlExecutions.push(sqlText);
 
         std::size_t counter = 0;
 
@@ -244,6 +256,8 @@ namespace orm
         const Models&... rows
     )
     {
+        TRACE_SCOPE("ORM.BatchInsert");
+
         std::vector<std::int64_t> insertedIds;
         insertedIds.reserve(sizeof...(Models) + 1);
 
@@ -276,8 +290,254 @@ namespace orm
         return insertedIds;
     }
 
+    /******************
+     * UPSERT METHODS *
+     ******************/
+
+    /**
+     * @brief Insert or update multiple rows of a model in a single transaction
+     *
+     * @tparam Model
+     * @param database
+     * @param rows
+     * @return std::expected<std::vector<std::int64_t>, CrudError> The IDs of
+     * the rows in input order or an error
+     */
+    template <db_model Model>
+    std::expected<std::vector<std::int64_t>, CrudError> Crud::upsert(
+        db::Database&          database,
+        std::span<const Model> rows
+    )
+    {
+        db::Transaction transaction{database};
+        auto            result = upsert(database, transaction, rows);
+
+        if (result.has_value())
+            transaction.commit();
+
+        return result;
+    }
+
     /**
-     * @brief Update a row in the database
+     * @brief Insert or update multiple rows of a model with multi-row
+     * INSERT ... ON CONFLICT DO UPDATE ... RETURNING statements
+     *
+     * Rows with a positive primary key are inserted with that key or update
+     * the existing row, rows with a zero, invalid or temporary (negative) key
+     * are inserted with a new key. The rows are sent in chunks sized to the
+     * variable limit of the connection, full chunks reuse one prepared
+     * statement.
+     *
+     * SQLite does not guarantee the order of the RETURNING rows. Within a
+     * chunk the rows with a key are therefore sent first, so every new key
+     * is larger than all keys of the chunk and the new keys are the largest
+     * returned ones, ascending in input order.
+     *
+     * @tparam Model
+     * @param database
+     * @param - transaction An active transaction to use for the upsert, the
+     * caller is responsible for committing or rolling it back
+     * @param rows
+     * @return std::expected<std::vector<std::int64_t>, CrudError> The IDs of
+     * the rows in input order or an error
+     */
+    template <db_model Model>
+    std::expected<std::vector<std::int64_t>, CrudError> Crud::upsert(
+        db::Database& database,
+        const db::Transaction& /*transaction*/,
+        std::span<const Model> rows
+    )
+    {
+        TRACE_SCOPE("ORM.Upsert");
+
+        std::vector<std::string> columnNames;
+        std::string              pkName;
+        std::size_t              nPks   = 0;
+        bool                     autoPk = false;
+
+        Model::forEachColumn(
+            [&](const auto& field)
+            {
+                columnNames.push_back(std::string(field.name));
+
+                if (!field.isPk)
+                    return;
+
+                pkName = std::string(field.name);
+                autoPk = field.isAutoIncrementPk;
+                ++nPks;
+            }
+        );
+
+        if (nPks != 1 || !autoPk)
+        {
+            return std::unexpected(CrudError(
+                CrudErrorType::NoPrimaryKey,
+                "orm::upsert requires a model with a single auto increment "
+                "primary key field"
+            ));
+        }
+
+        std::vector<std::int64_t> ids(rows.size());
+        if (rows.empty())
+            return ids;
+
+        const auto chunkSize = std::max<std::size_t>(
+            1,
+            database.getVariableLimit() / columnNames.size()
+        );
+
+        const auto getPk = [](const Model& row)
+        {
+            std::int64_t pk = 0;
+            row.forEachField(
+                [&](const auto& field)
+                {
+                    using FieldType = std::decay_t<decltype(field)>;
+                    using ValueType = typename FieldType::value_type;
+
+                    if constexpr (FieldType::isPk && strong_id<ValueType>)
+                        pk = field.value().value();
+                    else if constexpr (FieldType::isPk)
+                        pk = static_cast<std::int64_t>(field.value());
+                }
+            );
+            return pk;
+        };
+
+        std::optional<db::Statement> chunkStatement;
+
+        for (std::size_t begin = 0; begin < rows.size(); begin += chunkSize)
+        {
+            const auto end = std::min(begin + chunkSize, rows.size());
+
+            // rows with a key first, see above
+            std::vector<std::size_t>  order;
+            std::vector<std::size_t>  newRows;
+            std::vector<std::int64_t> pks;
+            order.reserve(end - begin);
+
+            for (std::size_t i = begin; i < end; ++i)
+            {
+                const auto pk = getPk(rows[i]);
+                if (pk <= 0)
+                {
+                    newRows.push_back(i);
+                    continue;
+                }
+
+                order.push_back(i);
+                pks.push_back(pk);
+            }
+
+            const auto nNew = newRows.size();
+            order.insert(order.end(), newRows.begin(), newRows.end());
+
+            std::optional<db::Statement> partialStatement;
+            db::Statement*               statement = nullptr;
+
+            const auto sqlText = [&](std::size_t nRows)
+            {
+                return _buildUpsertSql(
+                    std::string_view(Model::tableName),
+                    columnNames,
+                    pkName,
+                    nRows
+                );
+            };
+
+            if (order.size() == chunkSize && chunkStatement.has_value())
+            {
+                chunkStatement->reset();
+                statement = &chunkStatement.value();
+            }
+            else
+            {
+                const auto sql = sqlText(order.size());
+                LOG_DEBUG(
+                    std::format(
+                        "Upserting into table '{}' with SQL: {}",
+                        Model::tableName,
+                        sql
+                    )
+                );
+
+                auto& target = order.size() == chunkSize ? chunkStatement
+                                                         : partialStatement;
+                target.emplace(database.prepare(sql));
+                statement = &target.value();
+
+                _sqlExecutions.push(sql);
+            }
+
+            std::size_t counter = 0;
+            for (std::size_t position = 0; position < order.size(); ++position)
+            {
+                const bool isNew = position >= pks.size();
+
+                rows[order[position]].forEachField(
+                    [&](const auto& field)
+                    {
+                        if (field.isPk && isNew)
+                            statement->bindNull(bindIndex(counter).value());
+                        else
+                            field.bind(*statement, bindIndex(counter));
+
+                        ++counter;
+                    }
+                );
+            }
+
+            std::vector<std::int64_t> returnedIds;
+            returnedIds.reserve(order.size());
+
+            try
+            {
+                while (statement->step() == db::StepResult::RowAvailable)
+                    returnedIds.push_back(statement->columnInt64(0));
+            }
+            catch (const db::SqliteError& e)
+            {
+                return std::unexpected(
+                    CrudError{CrudErrorType::UpsertFailed, e.what()}
+                );
+            }
+
+            if (returnedIds.size() != order.size())
+            {
+                return std::unexpected(CrudError(
+                    CrudErrorType::UpsertFailed,
+                    std::format(
+                        "orm::upsert returned {} IDs for {} rows",
+                        returnedIds.size(),
+                        order.size()
+                    )
+                ));
+            }
+
+            std::ranges::sort(returnedIds);
+            auto newId = returnedIds.end() - static_cast<std::ptrdiff_t>(nNew);
+
+            for (std::size_t position = 0; position < order.size(); ++position)
+            {
+                if (position < pks.size())
+                    ids[order[position]] = pks[position];
+                else
+                    ids[order[position]] = *newId++;
+            }
+        }
+
+        return ids;
+    }
+
+    /**
+     * @brief Update the dirty columns of a row in the database
+     *
+     * Only the columns set since the row was read from the database are
+     * written (see getDirtyMask), a row that was not read from the database
+     * writes all columns. The statement is cached on the connection per
+     * distinct set of columns. A row without dirty columns is not written,
+     * only checked for existence.
      *
      * @tparam Model
      * @param database
@@ -291,6 +551,8 @@ namespace orm
         const Model&  row
     )
     {
+        TRACE_SCOPE("ORM.Update");
+
         LOG_DEBUG(
             std::format(
                 "Updating table '{}' with SQL: {}",
@@ -304,19 +566,20 @@ namespace orm
         sqlText += Model::tableName;
         sqlText += " SET ";
 
+        const auto dirtyMask = getDirtyMask(row);
+        const auto isWritten = [&dirtyMask](const auto& field, std::size_t i)
+        { return !field.isPk && (dirtyMask & (ColumnMask{1} << i)) != 0; };
+
         std::vector<std::string> columnNames;
+        std::size_t              column = 0;
         Model::forEachColumn(
             [&](const auto& field)
             {
-                if (field.isPk)
-                    return;
-
-                columnNames.push_back(field.name + "=?");
+                if (isWritten(field, column++))
+                    columnNames.push_back(field.name + "=?");
             }
         );
 
-        sqlText += mstd::join(columnNames, ", ");
-
         const auto where = getPkWhere(row);
 
         if (filter::isEmpty(where))
@@ -328,7 +591,32 @@ namespace orm
             ));
         }
 
-        sqlText += Query{}.where(where).getDBOperations();
+        if (columnNames.empty())
+        {
+            LOG_DEBUG(
+                std::format(
+                    "Skipping update of table '{}', no column is dirty",
+                    Model::tableName
+                )
+            );
+
+            // nothing is written, but a missing row is still reported
+            if (!exists<Model>(database, Query{}.where(where)))
+            {
+                return std::unexpected(CrudError(
+                    CrudErrorType::NoRowsUpdated,
+                    "orm::update did not update any rows. This may be because "
+                    "the primary key value(s) did not match any existing row."
+                ));
+            }
+
+            return {};
+        }
+
+        const auto whereQuery = Query{}.where(where);
+
+        sqlText += mstd::join(columnNames, ", ");
+        sqlText += whereQuery.getDBOperations();
         sqlText += ";";
 
         LOG_DEBUG(
@@ -338,15 +626,16 @@ namespace orm
                 sqlText
             )
         );
-        db::Statement statement = database.prepare(sqlText);
+        db::Statement& statement = database.prepareCached(sqlText);
 
-        _sqlExecutions.push_back(sqlText);
+        _sqlExecutions.push(sqlText);
 
         std::size_t index = 0;
+        column            = 0;
         row.forEachField(
             [&](const auto& field)
             {
-                if (field.isPk)
+                if (!isWritten(field, column++))
                     return;
 
                 field.bind(statement, bindIndex(index));
@@ -355,7 +644,7 @@ namespace orm
         );
 
         auto whereIndex = bindIndex(index);
-        bind(where, statement, whereIndex);
+        whereQuery.bind(statement, whereIndex);
 
         try
         {
@@ -406,6 +695,8 @@ namespace orm
         const Field&  field
     )
     {
+        TRACE_SCOPE("ORM.UpdateField");
+
         std::string sqlText;
         sqlText += "UPDATE ";
         sqlText += Field::tableName;
@@ -423,7 +714,7 @@ namespace orm
         );
         db::Statement statement = database.prepare(sqlText);
 
-        _sqlExecutions.push_back(sqlText);
+        _sqlExecutions.push(sqlText);
 
         field.bind(statement, bindIndex(0));
 
@@ -472,6 +763,8 @@ namespace orm
         const Query&  query
     )
     {
+        TRACE_SCOPE("ORM.Get");
+
         std::string sqlText;
         sqlText += getSelection<Model>() + " ";
         sqlText += joins.toSQL() + " ";
@@ -487,7 +780,7 @@ namespace orm
 
         db::Statement statement = database.prepare(sqlText);
 
-        _sqlExecutions.push_back(sqlText);
+        _sqlExecutions.push(sqlText);
 
         query.bind(statement);
 
@@ -542,6 +835,8 @@ namespace orm
         const Query&      query
     )
     {
+        TRACE_SCOPE("ORM.GetJoined");
+
         std::string sql;
         sql += getSelection<Models...>(joins.isDistinct());
         sql += joins.toSQL() + " ";
@@ -550,7 +845,7 @@ namespace orm
         LOG_DEBUG(std::format("Getting joined with SQL: {}", sql));
 
         db::Statement statement = database.prepare(sql);
-        _sqlExecutions.push_back(sql);
+        _sqlExecutions.push(sql);
         query.bind(statement);
 
         std::vector<std::tuple<Models...>> results;
@@ -596,6 +891,224 @@ namespace orm
         return results.front();
     }
 
+    /*********************
+     * AGGREGATE METHODS *
+     *********************/
+
+    /**
+     * @brief Check whether any row matches the where clause of the query,
+     * evaluated as SELECT EXISTS(...) without reading the rows
+     *
+     * @tparam Model
+     * @param database
+     * @param query Only the where clause is used
+     * @return true If at least one row matches
+     * @return false Otherwise
+     */
+    template <db_model Model>
+    bool Crud::exists(db::Database& database, const Query& query)
+    {
+        TRACE_SCOPE("ORM.Exists");
+
+        const auto sqlText = std::format(
+            "SELECT EXISTS(SELECT 1 FROM {} {});",
+            Model::tableName,
+            query.getWhereDBOperations()
+        );
+
+        return _queryScalar<bool>(database, sqlText, query).value_or(false);
+    }
+
+    /**
+     * @brief Count the rows matching the where clause of the query
+     *
+     * @tparam Model
+     * @param database
+     * @param query Only the where clause is used
+     * @return std::int64_t
+     */
+    template <db_model Model>
+    std::int64_t Crud::count(db::Database& database, const Query& query)
+    {
+        TRACE_SCOPE("ORM.Count");
+
+        const auto sqlText = std::format(
+            "SELECT COUNT(*) FROM {} {};",
+            Model::tableName,
+            query.getWhereDBOperations()
+        );
+
+        return _queryScalar<std::int64_t>(database, sqlText, query)
+            .value_or(0);
+    }
+
+    /**
+     * @brief Sum a numeric column over the rows matching the where clause of
+     * the query, NULL values are ignored
+     *
+     * @tparam Field
+     * @param database
+     * @param query Only the where clause is used
+     * @return optional_inner_t<typename Field::value_type> The sum, zero if no
+     * row matches
+     */
+    template <typename Field>
+    optional_inner_t<typename Field::value_type> Crud::sum(
+        db::Database& database,
+        const Query&  query
+    )
+    {
+        TRACE_SCOPE("ORM.Sum");
+
+        using Value = optional_inner_t<typename Field::value_type>;
+        static_assert(
+            std::is_arithmetic_v<Value>,
+            "orm::sum requires a numeric field"
+        );
+
+        const auto sqlText = _aggregateSql<Field>("SUM", query);
+        return _queryScalar<Value>(database, sqlText, query).value_or(Value{});
+    }
+
+    /**
+     * @brief Get the smallest value of a column over the rows matching the
+     * where clause of the query
+     *
+     * @tparam Field
+     * @param database
+     * @param query Only the where clause is used
+     * @return std::optional<optional_inner_t<typename Field::value_type>>
+     * The smallest value, std::nullopt if no row matches
+     */
+    template <typename Field>
+    std::optional<optional_inner_t<typename Field::value_type>> Crud::minimum(
+        db::Database& database,
+        const Query&  query
+    )
+    {
+        TRACE_SCOPE("ORM.Min");
+
+        using Value = optional_inner_t<typename Field::value_type>;
+
+        const auto sqlText = _aggregateSql<Field>("MIN", query);
+        return _queryScalar<Value>(database, sqlText, query);
+    }
+
+    /**
+     * @brief Get the largest value of a column over the rows matching the
+     * where clause of the query
+     *
+     * @tparam Field
+     * @param database
+     * @param query Only the where clause is used
+     * @return std::optional<optional_inner_t<typename Field::value_type>>
+     * The largest value, std::nullopt if no row matches
+     */
+    template <typename Field>
+    std::optional<optional_inner_t<typename Field::value_type>> Crud::maximum(
+        db::Database& database,
+        const Query&  query
+    )
+    {
+        TRACE_SCOPE("ORM.Max");
+
+        using Value = optional_inner_t<typename Field::value_type>;
+
+        const auto sqlText = _aggregateSql<Field>("MAX", query);
+        return _queryScalar<Value>(database, sqlText, query);
+    }
+
+    /**
+     * @brief Build the SQL applying an aggregate function to a column of the
+     * rows matching the where clause of the query
+     *
+     * @tparam Field
+     * @param function The SQL aggregate function, e.g. "SUM"
+     * @param query
+     * @return std::string
+     */
+    template <typename Field>
+    std::string Crud::_aggregateSql(
+        std::string_view function,
+        const Query&     query
+    )
+    {
+        return std::format(
+            "SELECT {}({}) FROM {} {};",
+            function,
+            Field::getFullColumnName(),
+            Field::tableName,
+            query.getWhereDBOperations()
+        );
+    }
+
+    /**
+     * @brief Run a query returning a single value, the statement is cached on
+     * the connection and reset once the value is read
+     *
+     * @tparam Value
+     * @param database
+     * @param sqlText
+     * @param query The query whose where clause values are bound
+     * @return std::optional<Value> The value, std::nullopt if it is NULL
+     */
+    template <typename Value>
+    std::optional<Value> Crud::_queryScalar(
+        db::Database&      database,
+        const std::string& sqlText,
+        const Query&       query
+    )
+    {
+        LOG_DEBUG(std::format("Querying scalar with SQL: {}", sqlText));
+
+        db::Statement& statement = database.prepareCached(sqlText);
+
+        _sqlExecutions.push(sqlText);
+
+        query.bind(statement);
+
+        std::optional<Value> value;
+
+        const auto column = columnIndex(0);
+        if (statement.step() == db::StepResult::RowAvailable &&
+            !statement.columnIsNull(column.value()))
+            value = binder<Value>::read(statement, column);
+
+        statement.reset();
+
+        return value;
+    }
+
+    /******************
+     * SEARCH METHODS *
+     ******************/
+
+    /**
+     * @brief Full-text search over the FTS5 table of the specified model
+     *
+     * @tparam Model A model declaring the FTS5 table indexing it as
+     * searchTableName
+     * @param database
+     * @param text The text to search for, see toMatchExpression
+     * @param limit The maximum number of results
+     * @return std::vector<std::int64_t> The primary keys of the matching rows,
+     * best match first
+     */
+    template <db_model Model>
+    std::vector<std::int64_t> Crud::search(
+        db::Database&    database,
+        std::string_view text,
+        std::size_t      limit
+    )
+    {
+        return search(
+            database,
+            std::string_view(Model::searchTableName),
+            text,
+            limit
+        );
+    }
+
     /******************
      * DELETE METHODS *
      ******************/
@@ -610,6 +1123,8 @@ namespace orm
     template <db_model Model>
     void Crud::deleteByPk(db::Database& database, const Model& model)
     {
+        TRACE_SCOPE("ORM.DeleteByPk");
+
         const auto numberOfPkFields = getNumberOfPkFields<Model>();
 
         if (numberOfPkFields != 1)
@@ -639,7 +1154,9 @@ namespace orm
             );
         }
 
-        sqlText += Query{}.where(where).getDBOperations();
+        const auto whereQuery = Query{}.where(where);
+
+        sqlText += whereQuery.getDBOperations();
         sqlText += ";";
 
         LOG_DEBUG(
@@ -652,9 +1169,56 @@ namespace orm
 
         db::Statement statement = database.prepare(sqlText);
 
-        _sqlExecutions.push_back(sqlText);
+        _sqlExecutions.push(sqlText);
+
+        whereQuery.bind(statement);
 
-        bind(where, statement);
+        statement.executeToCompletion();
+    }
+
+    /**
+     * @brief Delete all rows matching the where clause of the query with a
+     * single statement
+     *
+     * @tparam Model
+     * @param database
+     * @param query only the where clause is used, it must not be empty
+     */
+    template <db_model Model>
+    void Crud::deleteWhere(db::Database& database, const Query& query)
+    {
+        TRACE_SCOPE("ORM.DeleteWhere");
+
+        const auto where = query.getWhereDBOperations();
+
+        if (where.empty())
+        {
+            throw CrudException(
+                "orm::deleteWhere requires a where clause, refusing to delete "
+                "all rows"
+            );
+        }
+
+        std::string sqlText;
+        sqlText += "DELETE FROM ";
+        sqlText += Model::tableName;
+        sqlText += " ";
+        sqlText += where;
+        sqlText += ";";
+
+        LOG_DEBUG(
+            std::format(
+                "Deleting from table '{}' with SQL: {}",
+                Model::tableName,
+                sqlText
+            )
+        );
+
+        db::Statement statement = database.prepare(sqlText);
+
+        _sqlExecutions.push(sqlText);
+
+        query.bind(statement);
 
         statement.executeToCompletion();
     }
@@ -708,7 +1272,7 @@ namespace orm
 
         db::Statement statement = database.prepare(sql);
 
-        _sqlExecutions.push_back(sql);
+        _sqlExecutions.push(sql);
 
         statement.executeToCompletion();
 
@@ -748,7 +1312,7 @@ namespace orm
 
         db::Statement statement = database.prepare(sql);
 
-        _sqlExecutions.push_back(sql);
+        _sqlExecutions.push(sql);
 
         statement.executeToCompletion();
 
@@ -16,6 +16,7 @@ namespace orm
     X(MultipleRowsUpdated) \
     X(InsertFailed)        \
     X(UpdateFailed)        \
+    X(UpsertFailed)        \
     X(NotFound)            \
     X(MultipleResults)     \
     X(ColumnAlreadyExists) \
@@ -3,6 +3,7 @@
 
 #include <format>   // IWYU pragma: keep
 #include <string>
+#include <type_traits>
 
 #include "orm/concepts.hpp"
 #include "orm/constraints.hpp"
@@ -29,6 +30,10 @@ namespace orm
         /// The value of the field
         Value _value{};
 
+        /// Whether the value differs from the one read from the database,
+        /// fields that were never read from the database are always dirty
+        bool _dirty = true;
+
        public:
         /// The name of the field as a fixed string
         static constexpr fixed_string tableName = TableName;
@@ -65,6 +70,14 @@ namespace orm
         Field() = default;
         explicit Field(Value value);
 
+        ~Field()                  = default;
+        Field(const Field& other) = default;
+        Field(Field&& other)      = default;
+        Field& operator=(const Field& other);
+        Field& operator=(Field&& other) noexcept(
+            std::is_nothrow_move_assignable_v<Value>
+        );
+
         [[nodiscard]] Value&       value();
         [[nodiscard]] Value const& value() const;
 
@@ -72,6 +85,9 @@ namespace orm
 
         Field& operator=(Value value);
 
+        [[nodiscard]] bool isDirty() const;
+        void               markClean();
+
         [[nodiscard]] static std::string ddl();
         [[nodiscard]] static std::string getFkConstraints();
 
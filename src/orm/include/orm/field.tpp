@@ -39,7 +39,65 @@ namespace orm
     }
 
     /**
-     * @brief Get the value of the field
+     * @brief Copy the value of another field, marks the field dirty
+     *
+     * @tparam Name
+     * @tparam Value
+     * @tparam TableName
+     * @tparam Options
+     * @param other
+     * @return Field&
+     */
+    template <
+        fixed_string Name,
+        typename Value,
+        fixed_string TableName,
+        typename... Options>
+    Field<Name, Value, TableName, Options...>& Field<
+        Name,
+        Value,
+        TableName,
+        Options...>::operator=(const Field& other)
+    {
+        if (this != &other)
+            _value = other._value;
+
+        _dirty = true;
+        return *this;
+    }
+
+    /**
+     * @brief Move the value of another field, marks the field dirty
+     *
+     * @tparam Name
+     * @tparam Value
+     * @tparam TableName
+     * @tparam Options
+     * @param other
+     * @return Field&
+     */
+    template <
+        fixed_string Name,
+        typename Value,
+        fixed_string TableName,
+        typename... Options>
+    Field<Name, Value, TableName, Options...>& Field<
+        Name,
+        Value,
+        TableName,
+        Options...>::operator=(Field&& other)
+        noexcept(std::is_nothrow_move_assignable_v<Value>)
+    {
+        if (this != &other)
+            _value = std::move(other._value);
+
+        _dirty = true;
+        return *this;
+    }
+
+    /**
+     * @brief Get the value of the field, marks the field dirty as the value
+     * may be modified through the returned reference
      *
      * @tparam Name
      * @tparam Value
@@ -54,6 +112,7 @@ namespace orm
         typename... Options>
     Value& Field<Name, Value, TableName, Options...>::value()
     {
+        _dirty = true;
         return _value;
     }
 
@@ -117,9 +176,49 @@ namespace orm
         Options...>::operator=(Value value)
     {
         _value = std::move(value);
+        _dirty = true;
         return *this;
     }
 
+    /**
+     * @brief Check whether the value differs from the one read from the
+     * database
+     *
+     * @tparam Name
+     * @tparam Value
+     * @tparam TableName
+     * @tparam Options
+     * @return true If the field was set or never read from the database
+     * @return false If the field still holds the value read from the database
+     */
+    template <
+        fixed_string Name,
+        typename Value,
+        fixed_string TableName,
+        typename... Options>
+    bool Field<Name, Value, TableName, Options...>::isDirty() const
+    {
+        return _dirty;
+    }
+
+    /**
+     * @brief Mark the value as matching the database
+     *
+     * @tparam Name
+     * @tparam Value
+     * @tparam TableName
+     * @tparam Options
+     */
+    template <
+        fixed_string Name,
+        typename Value,
+        fixed_string TableName,
+        typename... Options>
+    void Field<Name, Value, TableName, Options...>::markClean()
+    {
+        _dirty = false;
+    }
+
     /**
      * @brief Get the DDL string for the field
      *
@@ -254,7 +353,8 @@ namespace orm
     }
 
     /**
-     * @brief Read the field value from the specified column
+     * @brief Read the field value from the specified column, the field is clean
+     * afterwards
      *
      * @tparam Name
      * @tparam Value
@@ -280,17 +380,16 @@ namespace orm
             using inner_type = optional_inner_t<Value>;
 
             if (statement.columnIsNull(col.value()))
-            {
                 _value = std::nullopt;
-                return;
-            }
-
-            _value = binder<inner_type>::read(statement, col);
+            else
+                _value = binder<inner_type>::read(statement, col);
         }
         else
         {
             _value = binder<Value>::read(statement, col);
         }
+
+        _dirty = false;
     }
 
     /**
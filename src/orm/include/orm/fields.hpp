@@ -1,6 +1,8 @@
 #ifndef __ORM__INCLUDE__ORM__FIELDS_HPP__
 #define __ORM__INCLUDE__ORM__FIELDS_HPP__
 
+#include <cstddef>
+#include <cstdint>
 #include <vector>
 
 #include "orm/type_traits.hpp"
@@ -8,6 +10,12 @@
 
 namespace orm
 {
+    /// Bitmask over the columns of a model, bit i is the i-th column
+    using ColumnMask = std::uint64_t;
+
+    /// Maximum number of columns a ColumnMask can describe
+    inline constexpr std::size_t MAX_MASK_COLUMNS = 64;
+
     template <db_model Model>
     std::vector<std::string> getDDl();
 
@@ -32,6 +40,12 @@ namespace orm
     template <db_model Model>
     std::size_t getNumberOfFields();
 
+    template <db_model Model>
+    ColumnMask getDirtyMask(const Model& model);
+
+    template <db_model Model>
+    void markClean(Model& model);
+
     template <db_model Model>
     Model loadModelFromStatement(const db::Statement& statement);
 
@@ -1,8 +1,10 @@
 #ifndef __ORM__INCLUDE__ORM__FIELDS_TPP__
 #define __ORM__INCLUDE__ORM__FIELDS_TPP__
 
+#include <cstddef>
 #include <format>
 #include <mstd/string.hpp>
+#include <tuple>
 
 #include "fields.hpp"
 #include "logging/log_macros.hpp"
@@ -195,6 +197,51 @@ namespace orm
         return count;
     }
 
+    /**
+     * @brief Get the columns of a model whose values were set since they were
+     * read from the database
+     *
+     * @tparam Model
+     * @param model
+     * @return ColumnMask Bit i is set if the i-th column is dirty
+     */
+    template <db_model Model>
+    ColumnMask getDirtyMask(const Model& model)
+    {
+        static_assert(
+            std::tuple_size_v<decltype(model.fields())> <= MAX_MASK_COLUMNS,
+            "orm::getDirtyMask supports at most 64 columns"
+        );
+
+        ColumnMask  mask  = 0;
+        std::size_t index = 0;
+
+        model.forEachField(
+            [&](const auto& field)
+            {
+                if (field.isDirty())
+                    mask |= ColumnMask{1} << index;
+
+                ++index;
+            }
+        );
+
+        return mask;
+    }
+
+    /**
+     * @brief Mark all fields of a model as matching the database, e.g. after
+     * the model was written
+     *
+     * @tparam Model
+     * @param model
+     */
+    template <db_model Model>
+    void markClean(Model& model)
+    {
+        model.forEachField([](auto& field) { field.markClean(); });
+    }
+
     /**
      * @brief Load a model from a database statement, reading the field values
      * from the statement's columns in order
@@ -0,0 +1,97 @@
+#ifndef __ORM__INCLUDE__ORM__FLAT_WHERE_HPP__
+#define __ORM__INCLUDE__ORM__FLAT_WHERE_HPP__
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mstd/enum.hpp>
+#include <string>
+#include <vector>
+
+#include "orm/index.hpp"
+#include "orm/where_clause.hpp"
+#include "orm/where_expr.hpp"
+
+namespace db
+{
+    class Statement;   // Forward declaration
+}   // namespace db
+
+namespace orm
+{
+// NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
+#define WHERE_NODE_KIND_LIST(X) \
+    X(Leaf)                     \
+    X(And)                      \
+    X(Or)                       \
+    X(Not)
+
+    MSTD_ENUM(WhereNodeKind, std::uint8_t, WHERE_NODE_KIND_LIST);
+
+    /**
+     * @brief A single node of a flattened WHERE expression.
+     *
+     * The operand of a Leaf is the index into the leaf table, the operand of
+     * an And/Or list is its number of operands. The operands of a node follow
+     * it directly, each one spanning the size of its subtree.
+     */
+    struct WhereNode
+    {
+        /// The kind of the node
+        WhereNodeKind kind;
+        /// The leaf index or the number of operands
+        std::uint32_t operand = 0;
+        /// The number of nodes of the subtree, including the node itself
+        std::uint32_t size = 1;
+    };
+
+    /**
+     * @brief A WHERE expression flattened into contiguous n-ary nodes.
+     *
+     * The binary expression tree is stored in preorder in a single array,
+     * chains of the same operator are merged into one And/Or list, so e.g. a
+     * large OR of id filters becomes one node with n operands instead of a
+     * tree of depth n. Chains are flattened iteratively, only alternating
+     * operators recurse.
+     *
+     * The SQL is appended to a single reserved buffer, and the leaves are
+     * kept in SQL order, so binding is a linear pass over the leaf table
+     * without walking the tree again. Each operand of a list is
+     * parenthesized, so a chain renders as "(a) OR (b) OR (c)" instead of
+     * the nested "((a) OR (b)) OR (c)" of the binary tree.
+     */
+    class FlatWhere
+    {
+       private:
+        /// The nodes in preorder
+        std::vector<WhereNode> _nodes;
+        /// The leaf clauses in SQL and bind order
+        std::vector<std::shared_ptr<IWhereClause>> _leaves;
+
+       public:
+        FlatWhere() = default;
+
+        [[nodiscard]] static FlatWhere compile(const WhereExpr& expr);
+
+        [[nodiscard]] bool empty() const;
+
+        [[nodiscard]] std::string getDBOperations() const;
+        void                      appendDBOperations(std::string& sql) const;
+
+        void bind(db::Statement& statement, BindIndex& index) const;
+
+        [[nodiscard]] const std::vector<WhereNode>& getNodes() const;
+        [[nodiscard]] std::size_t                   getLeafCount() const;
+
+       private:
+        void _emit(const WhereExpr& expr);
+        void _emitList(const WhereExpr& expr, WhereNodeKind kind);
+        void _closeNode(std::size_t position);
+
+        std::size_t _appendNode(std::string& sql, std::size_t index) const;
+
+        [[nodiscard]] std::size_t _estimateSize() const;
+    };
+}   // namespace orm
+
+#endif   // __ORM__INCLUDE__ORM__FLAT_WHERE_HPP__
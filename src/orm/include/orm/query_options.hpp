@@ -8,6 +8,8 @@
 
 #include "db/statement.hpp"
 #include "filter/operators.hpp"
+#include "orm/flat_where.hpp"
+#include "orm/index.hpp"
 #include "orm/where_expr.hpp"
 
 namespace orm
@@ -31,6 +33,10 @@ namespace orm
         /// query
         WhereExpr _whereExpr = makeEmptyWhere();
 
+        /// The where expression compiled once whenever it changes, used for
+        /// both the SQL and the binding
+        FlatWhere _flatWhere;
+
        public:
         template <typename Field>
         [[nodiscard]] Query& orderBy(bool ascending);
@@ -52,6 +58,10 @@ namespace orm
         [[nodiscard]] std::string getWhereDBOperations() const;
 
         void bind(db::Statement& statement) const;
+        void bind(db::Statement& statement, BindIndex& index) const;
+
+       private:
+        void _addWhere(const WhereExpr& whereExpr);
     };
 }   // namespace orm
 
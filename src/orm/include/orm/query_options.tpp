@@ -32,7 +32,7 @@ namespace orm
     template <typename Field, typename Value>
     Query& Query::where(const Value& field, filter::Operator operator_)
     {
-        _whereExpr &= makeWhere<Field>(field, operator_);
+        _addWhere(makeWhere<Field>(field, operator_));
         return *this;
     }
 
@@ -47,7 +47,7 @@ namespace orm
     template <typename Field, std::ranges::input_range Range>
     Query& Query::in(const Range& values)
     {
-        _whereExpr &= makeInClause<Field>(values);
+        _addWhere(makeInClause<Field>(values));
         return *this;
     }
 
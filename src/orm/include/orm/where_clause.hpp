@@ -2,6 +2,7 @@
 #define __ORM__INCLUDE__ORM__WHERE_CLAUSE_HPP__
 
 #include <mstd/enum.hpp>
+#include <string>
 #include <vector>
 
 #include "filter/operators.hpp"
@@ -25,12 +26,15 @@ namespace orm
        public:
         virtual ~IWhereClause() = default;
 
+        [[nodiscard]] std::string getDBOperations() const;
+
         /**
-         * @brief Get the SQL operations for this where clause, e.g. "field = ?"
+         * @brief Append the SQL operations for this where clause, e.g.
+         * "field = ?", to the given buffer
          *
-         * @return std::string
+         * @param sql
          */
-        [[nodiscard]] virtual std::string getDBOperations() const = 0;
+        virtual void appendDBOperations(std::string& sql) const = 0;
 
         /**
          * @brief Bind the values for this where clause to the specified
@@ -63,7 +67,7 @@ namespace orm
        public:
         explicit WhereClause(Field field, filter::Operator operator_);
 
-        [[nodiscard]] std::string getDBOperations() const override;
+        void appendDBOperations(std::string& sql) const override;
 
         void bind(db::Statement& statement, BindIndex& index) const override;
     };
@@ -83,7 +87,7 @@ namespace orm
        public:
         explicit InClause(std::vector<Field> fields);
 
-        [[nodiscard]] std::string getDBOperations() const override;
+        void appendDBOperations(std::string& sql) const override;
 
         void bind(db::Statement& statement, BindIndex& index) const override;
     };
@@ -97,7 +101,7 @@ namespace orm
     class NullClause : public IWhereClause
     {
        public:
-        [[nodiscard]] std::string getDBOperations() const override;
+        void appendDBOperations(std::string& sql) const override;
 
         void bind(db::Statement& statement, BindIndex& index) const override;
     };
@@ -22,20 +22,23 @@ namespace orm
     }
 
     /**
-     * @brief Get the SQL operations for this where clause, e.g. "field = ?"
+     * @brief Append the SQL operations for this where clause, e.g.
+     * "field = ?"
      *
      * @tparam Field
-     * @return std::string
+     * @param sql
      */
     template <typename Field>
-    std::string WhereClause<Field>::getDBOperations() const
+    void WhereClause<Field>::appendDBOperations(std::string& sql) const
     {
         const auto operatorStr = whereOperatorStr(_operator);
 
         if (operatorStr.empty())
             throw ORMError("Invalid WhereOperator value");
 
-        return _field.getFullColumnName() + " " + operatorStr;
+        sql += _field.getFullColumnName();
+        sql += ' ';
+        sql += operatorStr;
     }
 
     /**
@@ -69,24 +72,26 @@ namespace orm
     }
 
     /**
-     * @brief Get the SQL operations for this IN clause, e.g. "table.field IN
-     * (?, ?)"
+     * @brief Append the SQL operations for this IN clause, e.g. "table.field
+     * IN (?, ?)"
      *
      * @tparam Field
-     * @return std::string
+     * @param sql
      */
     template <typename Field>
-    std::string InClause<Field>::getDBOperations() const
+    void InClause<Field>::appendDBOperations(std::string& sql) const
     {
-        std::string placeholders;
+        sql += Field::getFullColumnName();
+        sql += " IN (";
+
         for (std::size_t i = 0; i < _fields.size(); ++i)
         {
             if (i > 0)
-                placeholders += ", ";
-            placeholders += "?";
+                sql += ", ";
+            sql += '?';
         }
 
-        return Field::getFullColumnName() + " IN (" + placeholders + ")";
+        sql += ')';
     }
 
     /**
@@ -109,16 +114,17 @@ namespace orm
     }
 
     /**
-     * @brief Get the SQL operations for this NULL clause, e.g. "table.field IS
-     * NULL"
+     * @brief Append the SQL operations for this NULL clause, e.g.
+     * "table.field IS NULL"
      *
      * @tparam Field
-     * @return std::string
+     * @param sql
      */
     template <typename Field>
-    [[nodiscard]] std::string NullClause<Field>::getDBOperations() const
+    void NullClause<Field>::appendDBOperations(std::string& sql) const
     {
-        return Field::getFullColumnName() + " IS NULL";
+        sql += Field::getFullColumnName();
+        sql += " IS NULL";
     }
 
     /**
@@ -1,18 +1,165 @@
 #include "orm/crud.hpp"
 
+#include <cctype>
+#include <format>
+#include <mstd/string.hpp>
+#include <string>
+#include <vector>
+
+#include "db/statement.hpp"
+#include "logging/tracer.hpp"
+
 namespace orm
 {
     /**
-     * @brief Get the SQL statements that have been executed
+     * @brief Get the most recently executed SQL statements, the oldest first
+     *
+     * Only the last SQL_HISTORY_CAPACITY statements are kept, latency
+     * statistics of all statements are available from db::SqlStatistics.
      *
-     * @return const std::vector<std::string>& A reference to the vector of
-     * executed SQL statements
+     * @return const RingBuffer<std::string>& A reference to the executed SQL
+     * statements
      */
-    [[nodiscard]] const std::vector<std::string>& Crud::getExecutedSQL() const
+    [[nodiscard]] const RingBuffer<std::string>& Crud::getExecutedSQL() const
     {
         return _sqlExecutions;
     }
 
+    /**
+     * @brief Build a multi-row upsert statement returning the primary keys
+     *
+     * @param tableName
+     * @param columnNames All columns of the model, including the primary key
+     * @param pkName The name of the primary key column
+     * @param nRows The number of rows in the VALUES clause
+     * @return std::string
+     */
+    std::string Crud::_buildUpsertSql(
+        std::string_view                tableName,
+        const std::vector<std::string>& columnNames,
+        std::string_view                pkName,
+        std::size_t                     nRows
+    )
+    {
+        const std::vector<std::string> placeholders(columnNames.size(), "?");
+        const auto rowValues = "(" + mstd::join(placeholders, ", ") + ")";
+
+        const std::vector<std::string> values(nRows, rowValues);
+
+        std::vector<std::string> assignments;
+        for (const auto& column : columnNames)
+            if (column != pkName)
+                assignments.push_back(column + "=excluded." + column);
+
+        // a model without other columns still has to return its keys
+        if (assignments.empty())
+            assignments.push_back(std::format("{0}=excluded.{0}", pkName));
+
+        return std::format(
+            "INSERT INTO {} ({}) VALUES {} ON CONFLICT({}) DO UPDATE SET {} "
+            "RETURNING {};",
+            tableName,
+            mstd::join(columnNames, ", "),
+            mstd::join(values, ", "),
+            pkName,
+            mstd::join(assignments, ", "),
+            pkName
+        );
+    }
+
+    /**
+     * @brief Full-text search over an FTS5 table, ranked by bm25
+     *
+     * The FTS5 table has to use the searched table as external content with
+     * its primary key as rowid, so the matches are returned without reading
+     * the searched table.
+     *
+     * @param database
+     * @param searchTable The name of the FTS5 table
+     * @param text The text to search for, see toMatchExpression
+     * @param limit The maximum number of results
+     * @return std::vector<std::int64_t> The rowids of the matching rows, best
+     * match first
+     */
+    std::vector<std::int64_t> Crud::search(
+        db::Database&    database,
+        std::string_view searchTable,
+        std::string_view text,
+        std::size_t      limit
+    )
+    {
+        TRACE_SCOPE("ORM.Search");
+
+        std::vector<std::int64_t> rowIds;
+
+        const auto match = toMatchExpression(text);
+        if (match.empty() || limit == 0)
+            return rowIds;
+
+        const auto sql = std::format(
+            "SELECT rowid FROM {0} WHERE {0} MATCH ? ORDER BY rank LIMIT ?;",
+            searchTable
+        );
+
+        db::Statement statement = database.prepare(sql);
+        _sqlExecutions.push(sql);
+
+        statement.bindText(1, match);
+        statement.bindInt64(2, static_cast<std::int64_t>(limit));
+
+        while (statement.step() == db::StepResult::RowAvailable)
+            rowIds.push_back(statement.columnInt64(0));
+
+        return rowIds;
+    }
+
+    /**
+     * @brief Convert free user input into an FTS5 match expression
+     *
+     * Every whitespace separated word becomes a quoted prefix query, all of
+     * them have to match. Quoting keeps FTS5 operators and column filters in
+     * the input from being interpreted.
+     *
+     * @param text The user input
+     * @return std::string The match expression, empty if the input contains
+     * no words
+     */
+    std::string Crud::toMatchExpression(std::string_view text)
+    {
+        std::string expression;
+
+        const auto isSpace = [](unsigned char character)
+        { return std::isspace(character) != 0; };
+
+        std::size_t position = 0;
+        while (position < text.size())
+        {
+            while (position < text.size() && isSpace(text[position]))
+                ++position;
+
+            const auto start = position;
+            while (position < text.size() && !isSpace(text[position]))
+                ++position;
+
+            if (start == position)
+                break;
+
+            if (!expression.empty())
+                expression += ' ';
+
+            expression += '"';
+            for (const auto character : text.substr(start, position - start))
+            {
+                if (character == '"')
+                    expression += '"';
+                expression += character;
+            }
+            expression += "\"*";
+        }
+
+        return expression;
+    }
+
     /**
      * @brief Check if a column exists in the database
      *
@@ -35,7 +182,7 @@ namespace orm
 
         db::Statement statement = database.prepare(sql);
 
-        _sqlExecutions.push_back(sql);
+        _sqlExecutions.push(sql);
 
         if (statement.step() == db::StepResult::RowAvailable)
             return statement.columnInt64(0) > 0;
@@ -0,0 +1,268 @@
+#include "orm/flat_where.hpp"
+
+#include <type_traits>
+#include <utility>
+#include <variant>
+
+namespace orm
+{
+    namespace
+    {
+        /// Estimated SQL length of a leaf, e.g. "table.column = ?"
+        constexpr std::size_t LEAF_SIZE_ESTIMATE = 32;
+        /// Estimated SQL length of the operators and parentheses of a node
+        constexpr std::size_t NODE_SIZE_ESTIMATE = 8;
+
+        using IWhereClausePtr = std::shared_ptr<IWhereClause>;
+
+        /**
+         * @brief Get the binary node of an expression, if it is an And node
+         * (kind And) or an Or node (kind Or)
+         *
+         * @param expr
+         * @param kind
+         * @return const filter::BiNode<IWhereClausePtr>* nullptr if the
+         * expression is of another kind
+         */
+        const filter::BiNode<IWhereClausePtr>* asList(
+            const WhereExpr& expr,
+            WhereNodeKind    kind
+        )
+        {
+            if (kind == WhereNodeKind::And)
+                return std::get_if<filter::AndNode<IWhereClausePtr>>(&expr);
+
+            return std::get_if<filter::OrNode<IWhereClausePtr>>(&expr);
+        }
+    }   // namespace
+
+    /**
+     * @brief Flatten a WHERE expression
+     *
+     * @param expr
+     * @return FlatWhere
+     */
+    FlatWhere FlatWhere::compile(const WhereExpr& expr)
+    {
+        FlatWhere flat;
+        flat._emit(expr);
+        return flat;
+    }
+
+    /**
+     * @brief Checks whether the expression has no conditions
+     *
+     * @return true
+     * @return false
+     */
+    bool FlatWhere::empty() const { return _nodes.empty(); }
+
+    /**
+     * @brief Get the SQL operations of the expression, empty for an empty
+     * expression
+     *
+     * @return std::string
+     */
+    std::string FlatWhere::getDBOperations() const
+    {
+        std::string sql;
+        sql.reserve(_estimateSize());
+        appendDBOperations(sql);
+        return sql;
+    }
+
+    /**
+     * @brief Append the SQL operations of the expression to the given buffer
+     *
+     * @param sql
+     */
+    void FlatWhere::appendDBOperations(std::string& sql) const
+    {
+        if (_nodes.empty())
+            return;
+
+        sql.reserve(sql.size() + _estimateSize());
+        _appendNode(sql, 0);
+    }
+
+    /**
+     * @brief Bind the values of all leaves to the statement, in SQL order
+     *
+     * @param statement
+     * @param index
+     */
+    void FlatWhere::bind(db::Statement& statement, BindIndex& index) const
+    {
+        for (const auto& leaf : _leaves)
+            leaf->bind(statement, index);
+    }
+
+    /**
+     * @brief Get the nodes in preorder, mainly for testing and debugging
+     *
+     * @return const std::vector<WhereNode>&
+     */
+    const std::vector<WhereNode>& FlatWhere::getNodes() const { return _nodes; }
+
+    /**
+     * @brief Get the number of leaf clauses
+     *
+     * @return std::size_t
+     */
+    std::size_t FlatWhere::getLeafCount() const { return _leaves.size(); }
+
+    /**
+     * @brief Emit the nodes of an expression
+     *
+     * @param expr
+     */
+    void FlatWhere::_emit(const WhereExpr& expr)
+    {
+        std::visit(
+            [this, &expr](const auto& node)
+            {
+                using NodeType = std::decay_t<decltype(node)>;
+
+                if constexpr (std::is_same_v<
+                                  NodeType,
+                                  filter::EmptyNode<IWhereClausePtr>>)
+                {
+                    // empty operands are dropped when the tree is built, only
+                    // an empty root remains
+                }
+                else if constexpr (std::is_same_v<NodeType, IWhereClausePtr>)
+                {
+                    const auto leaf = static_cast<std::uint32_t>(_leaves.size());
+                    _leaves.push_back(node);
+                    _nodes.push_back(WhereNode{WhereNodeKind::Leaf, leaf});
+                }
+                else if constexpr (std::is_same_v<
+                                       NodeType,
+                                       filter::AndNode<IWhereClausePtr>>)
+                {
+                    _emitList(expr, WhereNodeKind::And);
+                }
+                else if constexpr (std::is_same_v<
+                                       NodeType,
+                                       filter::OrNode<IWhereClausePtr>>)
+                {
+                    _emitList(expr, WhereNodeKind::Or);
+                }
+                else
+                {
+                    const auto position = _nodes.size();
+                    _nodes.push_back(WhereNode{WhereNodeKind::Not, 1});
+                    _emit(*node.value);
+                    _closeNode(position);
+                }
+            },
+            expr
+        );
+    }
+
+    /**
+     * @brief Emit an And/Or node as one list, operands that are nodes of the
+     * same kind are merged into the list
+     *
+     * The chain is walked with an explicit stack, right operands are pushed
+     * first so that the operands keep their left to right order.
+     *
+     * @param expr
+     * @param kind
+     */
+    void FlatWhere::_emitList(const WhereExpr& expr, WhereNodeKind kind)
+    {
+        const auto position = _nodes.size();
+        _nodes.push_back(WhereNode{kind});
+
+        std::uint32_t                 count = 0;
+        std::vector<const WhereExpr*> stack{&expr};
+
+        while (!stack.empty())
+        {
+            const auto* operand = stack.back();
+            stack.pop_back();
+
+            if (const auto* list = asList(*operand, kind))
+            {
+                stack.push_back(list->right.get());
+                stack.push_back(list->left.get());
+                continue;
+            }
+
+            _emit(*operand);
+            ++count;
+        }
+
+        _nodes[position].operand = count;
+        _closeNode(position);
+    }
+
+    /**
+     * @brief Set the subtree size of a node once all its operands are emitted
+     *
+     * @param position
+     */
+    void FlatWhere::_closeNode(std::size_t position)
+    {
+        _nodes[position].size =
+            static_cast<std::uint32_t>(_nodes.size() - position);
+    }
+
+    /**
+     * @brief Append the SQL of a node and its operands
+     *
+     * @param sql
+     * @param index The index of the node
+     * @return std::size_t The index of the node following the subtree
+     */
+    std::size_t FlatWhere::_appendNode(std::string& sql, std::size_t index) const
+    {
+        const auto& node = _nodes[index];
+
+        switch (node.kind)
+        {
+            case WhereNodeKind::Leaf:
+                _leaves[node.operand]->appendDBOperations(sql);
+                break;
+
+            case WhereNodeKind::Not:
+                sql += "NOT (";
+                _appendNode(sql, index + 1);
+                sql += ')';
+                break;
+
+            case WhereNodeKind::And:
+            case WhereNodeKind::Or:
+            {
+                const auto* separator =
+                    node.kind == WhereNodeKind::And ? ") AND (" : ") OR (";
+
+                auto child = index + 1;
+                sql       += '(';
+                for (std::uint32_t i = 0; i < node.operand; ++i)
+                {
+                    if (i > 0)
+                        sql += separator;
+                    child = _appendNode(sql, child);
+                }
+                sql += ')';
+                break;
+            }
+        }
+
+        return index + node.size;
+    }
+
+    /**
+     * @brief Estimate the SQL length of the expression, used to reserve the
+     * buffer up front
+     *
+     * @return std::size_t
+     */
+    std::size_t FlatWhere::_estimateSize() const
+    {
+        return (_leaves.size() * LEAF_SIZE_ESTIMATE) +
+               (_nodes.size() * NODE_SIZE_ESTIMATE);
+    }
+}   // namespace orm
@@ -2,6 +2,7 @@
 
 #include <mstd/string.hpp>
 
+#include "orm/flat_where.hpp"
 #include "orm/where_expr.hpp"
 
 namespace orm
@@ -26,7 +27,7 @@ namespace orm
      */
     Query& Query::where(const WhereExpr& whereExpr)
     {
-        _whereExpr &= whereExpr;
+        _addWhere(whereExpr);
         return *this;
     }
 
@@ -37,12 +38,12 @@ namespace orm
      */
     std::string Query::getWhereDBOperations() const
     {
-        const auto operations = orm::getDBOperations(_whereExpr);
-
-        if (!operations.empty())
-            return "WHERE " + operations;
+        if (_flatWhere.empty())
+            return "";
 
-        return "";
+        std::string sql{"WHERE "};
+        _flatWhere.appendDBOperations(sql);
+        return sql;
     }
 
     /**
@@ -79,7 +80,32 @@ namespace orm
      */
     void Query::bind(db::Statement& statement) const
     {
-        orm::bind(_whereExpr, statement);
+        auto index = bindIndex(0);
+        _flatWhere.bind(statement, index);
+    }
+
+    /**
+     * @brief Bind the values for the where expression to the statement,
+     * starting at the given bind index
+     *
+     * @param statement
+     * @param index The bind index, advanced past the bound values
+     */
+    void Query::bind(db::Statement& statement, BindIndex& index) const
+    {
+        _flatWhere.bind(statement, index);
+    }
+
+    /**
+     * @brief AND the expression to the where expression and compile the
+     * result, so the SQL and the binding share one FlatWhere
+     *
+     * @param whereExpr
+     */
+    void Query::_addWhere(const WhereExpr& whereExpr)
+    {
+        _whereExpr &= whereExpr;
+        _flatWhere  = FlatWhere::compile(_whereExpr);
     }
 
 }   // namespace orm
@@ -2,6 +2,18 @@
 
 namespace orm
 {
+    /**
+     * @brief Get the SQL operations for this where clause, e.g. "field = ?"
+     *
+     * @return std::string
+     */
+    std::string IWhereClause::getDBOperations() const
+    {
+        std::string sql;
+        appendDBOperations(sql);
+        return sql;
+    }
+
     std::string whereOperatorStr(filter::Operator operator_)
     {
         switch (operator_)
@@ -1,6 +1,7 @@
 #ifndef __REPO__INCLUDE__REPO__I_INSTRUMENT_REPO_HPP__
 #define __REPO__INCLUDE__REPO__I_INSTRUMENT_REPO_HPP__
 
+#include <cstddef>
 #include <string>
 #include <vector>
 
@@ -122,6 +123,21 @@ namespace repo
             const finance::Option& option
         ) = 0;
 
+        /**
+         * @brief Full-text search over the stock tickers and names
+         *
+         * @param text The words to search for, each one is matched as a
+         * prefix and all of them have to match
+         * @param limit The maximum number of results
+         * @return std::vector<StockId> The IDs of the matching stocks, best
+         * match first
+         */
+        [[nodiscard]]
+        virtual std::vector<StockId> searchStocks(
+            const std::string& text,
+            std::size_t        limit
+        ) = 0;
+
         /**
          * @brief Check if a stock with the given ticker already exists in
          * the database, this is used to prevent duplicate entries and
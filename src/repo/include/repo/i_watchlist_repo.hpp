@@ -73,6 +73,30 @@ namespace repo
             WatchlistId        id,
             const std::string& symbol
         ) = 0;
+
+        /**
+         * @brief Add several symbols to a watchlist at once, either all
+         * symbols are added or none
+         *
+         * @param id
+         * @param symbols
+         */
+        virtual void addSymbols(
+            WatchlistId                     id,
+            const std::vector<std::string>& symbols
+        ) = 0;
+
+        /**
+         * @brief Remove several symbols from a watchlist at once, symbols
+         * that aren't in the watchlist are ignored
+         *
+         * @param id
+         * @param symbols
+         */
+        virtual void removeSymbols(
+            WatchlistId                     id,
+            const std::vector<std::string>& symbols
+        ) = 0;
     };
 
 }   // namespace repo
@@ -0,0 +1,55 @@
+#ifndef __REPO__INCLUDE__REPO__READ_SESSION_HPP__
+#define __REPO__INCLUDE__REPO__READ_SESSION_HPP__
+
+#include <filesystem>
+#include <memory>
+
+namespace db
+{
+    class Database;   // Forward declaration
+}   // namespace db
+
+namespace repo
+{
+
+    class IInstrumentRepo;   // Forward declaration
+    class IPositionRepo;     // Forward declaration
+    class IWatchlistRepo;    // Forward declaration
+
+    /**
+     * @brief A set of read repositories on their own read-only connection
+     *
+     * A read session is meant to be owned by exactly one worker thread, it
+     * allows reading data concurrently to the main connection of the
+     * RepoContainer without sharing a connection between threads.
+     */
+    class ReadSession
+    {
+       private:
+        /// The read-only database connection of this session
+        std::unique_ptr<db::Database> _database;
+
+        /// The Instrument repository
+        std::shared_ptr<IInstrumentRepo> _instrumentRepo;
+        /// The Position repository
+        std::shared_ptr<IPositionRepo> _positionRepo;
+        /// The Watchlist repository
+        std::shared_ptr<IWatchlistRepo> _watchlistRepo;
+
+       public:
+        explicit ReadSession(const std::filesystem::path& dbPath);
+        ~ReadSession();
+
+        ReadSession(const ReadSession&)            = delete;
+        ReadSession& operator=(const ReadSession&) = delete;
+        ReadSession(ReadSession&&)                 = delete;
+        ReadSession& operator=(ReadSession&&)      = delete;
+
+        [[nodiscard]] std::shared_ptr<IInstrumentRepo> getInstrumentRepo();
+        [[nodiscard]] std::shared_ptr<IPositionRepo>   getPositionRepo();
+        [[nodiscard]] std::shared_ptr<IWatchlistRepo>  getWatchlistRepo();
+    };
+
+}   // namespace repo
+
+#endif   // __REPO__INCLUDE__REPO__READ_SESSION_HPP__
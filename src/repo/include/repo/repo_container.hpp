@@ -5,7 +5,8 @@
 
 namespace db
 {
-    class Database;   // Forward declaration
+    class Database;       // Forward declaration
+    class BackupWorker;   // Forward declaration
 }   // namespace db
 
 namespace settings
@@ -34,6 +35,10 @@ namespace repo
         /// The database instance for the application
         std::unique_ptr<db::Database> _database;
 
+        /// The background worker creating the startup backup, declared after
+        /// the database so that it is cancelled before the database closes
+        std::unique_ptr<db::BackupWorker> _backupWorker;
+
         /// The migration runner for the application
         std::unique_ptr<MigrationRunner> _migrationRunner;
 
@@ -80,6 +85,10 @@ namespace repo
 
         void closeDb();
         void reopenDb();
+
+       private:
+        void _startBackup(const settings::BackupSettings& backupSettings);
+        void _cancelBackup();
     };
 
 }   // namespace repo
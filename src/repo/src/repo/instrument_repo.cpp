@@ -292,6 +292,31 @@ namespace repo
         };
     }
 
+    /**
+     * @brief Full-text search over the stock tickers and names, answered from
+     * the FTS5 index without loading any stock rows
+     *
+     * @param text The words to search for, each one is matched as a prefix
+     * @param limit The maximum number of results
+     * @return std::vector<StockId> The IDs of the matching stocks, best match
+     * first
+     */
+    std::vector<StockId> InstrumentRepo::searchStocks(
+        const std::string& text,
+        std::size_t        limit
+    )
+    {
+        const auto rowIds = _getCrud().search<StockRow>(_getDb(), text, limit);
+
+        std::vector<StockId> ids;
+        ids.reserve(rowIds.size());
+
+        for (const auto rowId : rowIds)
+            ids.emplace_back(rowId);
+
+        return ids;
+    }
+
     /**
      * @brief Check if a stock with the given ticker already exists in the
      * database, this is used to prevent duplicate entries and ensure data
@@ -304,9 +329,7 @@ namespace repo
     {
         const auto query = orm::Query{}.where(StockRow::hasTicker(ticker));
 
-        auto result = _getCrud().get<StockRow>(_getDb(), query);
-
-        return !result.empty();
+        return _getCrud().exists<StockRow>(_getDb(), query);
     }
 
     /**
@@ -329,9 +352,7 @@ namespace repo
             )
         );
 
-        auto result = _getCrud().get<OptionRow>(_getDb(), query);
-
-        return !result.empty();
+        return _getCrud().exists<OptionRow>(_getDb(), query);
     }
 
 }   // namespace repo
\ No newline at end of file
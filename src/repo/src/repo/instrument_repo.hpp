@@ -52,6 +52,12 @@ namespace repo
             const finance::Option& option
         ) override;
 
+        [[nodiscard]]
+        std::vector<StockId> searchStocks(
+            const std::string& text,
+            std::size_t        limit
+        ) override;
+
         [[nodiscard]]
         bool stockExists(const std::string& ticker) override;
 
@@ -4,6 +4,8 @@
 #include <format>
 #include <memory>
 #include <string>
+#include <string_view>
+#include <vector>
 
 #include "common/finance.hpp"
 #include "common/version.hpp"
@@ -27,6 +29,94 @@
 
 namespace repo
 {
+    namespace
+    {
+        /**
+         * @brief Join the columns with the given prefix, e.g. "new."
+         *
+         * @param columns
+         * @param prefix
+         * @return std::string
+         */
+        std::string joinColumns(
+            const std::vector<std::string_view>& columns,
+            std::string_view                     prefix
+        )
+        {
+            std::string joined;
+            for (const auto column : columns)
+            {
+                if (!joined.empty())
+                    joined += ", ";
+
+                joined += prefix;
+                joined += column;
+            }
+            return joined;
+        }
+
+        /**
+         * @brief Build the SQL creating an FTS5 table over columns of a
+         * content table, the triggers keeping it in sync with the content
+         * table and the initial build of the index.
+         *
+         * The FTS5 table uses the content table as external content, so the
+         * indexed text is not stored twice and the rowid of a match is the
+         * primary key of the content row.
+         *
+         * @param table The content table, its primary key has to be "id"
+         * @param searchTable The name of the FTS5 table
+         * @param columns The indexed text columns
+         * @return std::string
+         */
+        std::string makeSearchTableSql(
+            std::string_view                     table,
+            std::string_view                     searchTable,
+            const std::vector<std::string_view>& columns
+        )
+        {
+            const auto plain = joinColumns(columns, "");
+            const auto added = joinColumns(columns, "new.");
+            const auto old   = joinColumns(columns, "old.");
+
+            return std::format(
+                R"(
+                    CREATE VIRTUAL TABLE {1} USING fts5(
+                        {2},
+                        content='{0}',
+                        content_rowid='id',
+                        tokenize='unicode61 remove_diacritics 2',
+                        prefix='2 3'
+                    );
+
+                    CREATE TRIGGER {1}_after_insert AFTER INSERT ON {0}
+                    BEGIN
+                        INSERT INTO {1}(rowid, {2}) VALUES (new.id, {3});
+                    END;
+
+                    CREATE TRIGGER {1}_after_delete AFTER DELETE ON {0}
+                    BEGIN
+                        INSERT INTO {1}({1}, rowid, {2})
+                        VALUES ('delete', old.id, {4});
+                    END;
+
+                    CREATE TRIGGER {1}_after_update AFTER UPDATE ON {0}
+                    BEGIN
+                        INSERT INTO {1}({1}, rowid, {2})
+                        VALUES ('delete', old.id, {4});
+                        INSERT INTO {1}(rowid, {2}) VALUES (new.id, {3});
+                    END;
+
+                    INSERT INTO {1}({1}) VALUES ('rebuild');
+                )",
+                table,
+                searchTable,
+                plain,
+                added,
+                old
+            );
+        }
+    }   // namespace
 
     /**
      * @brief Construct a new Migration object
@@ -88,6 +178,7 @@ namespace repo
         _migrate_0_0_3();
         _migrate_0_1_0();
         _migrate_0_2_3();
+        _migrate_0_3_0();
 
         assert(_migrations.size() == toVersion);
     }
@@ -555,4 +646,55 @@ namespace repo
 
         _migrations.push_back(std::move(migration));
     }
-}   // namespace repo
\ No newline at end of file
+
+    /**
+     * @brief Migrate from version 0.3.0
+     */
+    void Migrations::_migrate_0_3_0()
+    {
+        _lastReleaseVersion = common::SemVer(0, 3, 0);
+
+        _migrateV16();
+    }
+
+    /**
+     * @brief Migrate to version 16
+     *
+     * @details This handles the migration from v15 to v16. It creates FTS5
+     * tables over the transaction comments and the stock ticker and names,
+     * kept in sync by triggers, so that text searches are answered from the
+     * full-text index without loading any rows. The existing rows are indexed
+     * as part of the migration.
+     */
+    void Migrations::_migrateV16()
+    {
+        constexpr std::size_t currentVersion = 15;
+        Migration             migration(currentVersion, _lastReleaseVersion);
+
+        migration.addMigration(
+            std::make_unique<CustomMigration>(
+                makeSearchTableSql(
+                    std::string_view(TransactionRow::tableName),
+                    std::string_view(TransactionRow::searchTableName),
+                    {std::string_view(TransactionRow::commentField::name)}
+                ),
+                MigrationType::AddTable
+            )
+        );
+
+        migration.addMigration(
+            std::make_unique<CustomMigration>(
+                makeSearchTableSql(
+                    std::string_view(StockRow::tableName),
+                    std::string_view(StockRow::searchTableName),
+                    {std::string_view(StockRow::tickerField::name),
+                     std::string_view(StockRow::shortNameField::name),
+                     std::string_view(StockRow::longNameField::name)}
+                ),
+                MigrationType::AddTable
+            )
+        );
+
+        _migrations.push_back(std::move(migration));
+    }
+}   // namespace repo
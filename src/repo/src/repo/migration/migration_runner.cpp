@@ -28,6 +28,21 @@ namespace repo
         }
     }
 
+    /**
+     * @brief Check whether the database is behind the current schema version
+     * and therefore will be modified by the migration runner.
+     *
+     * @param db The database to check
+     * @return true if migrations need to be applied
+     */
+    bool MigrationRunner::isMigrationPending(db::Database& db)
+    {
+        const auto dbVersion =
+            static_cast<size_t>(db.queryInt("PRAGMA user_version"));
+
+        return dbVersion != DB_VERSION;
+    }
+
     /**
      * @brief determine last db version and apply all migrations needed
      *
@@ -17,7 +17,7 @@ namespace repo
     {
        private:
         /// current db version
-        constexpr static std::size_t DB_VERSION = 15;
+        constexpr static std::size_t DB_VERSION = 16;
 
         /// The migration states for the application
         Migrations _migrations;
@@ -25,6 +25,8 @@ namespace repo
        public:
         explicit MigrationRunner(db::Database& db);
 
+        [[nodiscard]] static bool isMigrationPending(db::Database& db);
+
        private:
         void migrate(db::Database& db);
     };
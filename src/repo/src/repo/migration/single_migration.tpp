@@ -42,7 +42,7 @@ namespace repo
         orm::Crud crud;
         crud.createTable<Model>(db, _tableName);
 
-        setSQLStatements(crud.getExecutedSQL());
+        setSQLStatements(crud.getExecutedSQL().toVector());
     }
 
     /**
@@ -70,7 +70,7 @@ namespace repo
 
         crud.addColumn(db, _defaultValue);
 
-        setSQLStatements(crud.getExecutedSQL());
+        setSQLStatements(crud.getExecutedSQL().toVector());
     }
 
     /**
@@ -99,7 +99,7 @@ namespace repo
 
         crud.dropColumn<Model>(db, _columnName);
 
-        setSQLStatements(crud.getExecutedSQL());
+        setSQLStatements(crud.getExecutedSQL().toVector());
     }
 
 }   // namespace repo
@@ -0,0 +1,69 @@
+#include "repo/read_session.hpp"
+
+#include "db/database.hpp"
+#include "instrument_repo.hpp"
+#include "logging/log_macros.hpp"
+#include "position_repo.hpp"
+#include "watchlist_repo.hpp"
+
+REGISTER_LOG_CATEGORY("Repo.ReadSession");
+
+namespace repo
+{
+
+    /**
+     * @brief Construct a new Read Session object, opening a new read-only
+     * connection to the database at the given path
+     *
+     * @param dbPath The path to the (already migrated) database file
+     */
+    ReadSession::ReadSession(const std::filesystem::path& dbPath)
+        : _database{std::make_unique<db::Database>(
+              dbPath,
+              db::OpenMode::ReadOnly
+          )},
+          _instrumentRepo{std::make_shared<InstrumentRepo>(*_database)},
+          _positionRepo{std::make_shared<PositionRepo>(*_database)},
+          _watchlistRepo{std::make_shared<WatchlistRepo>(*_database)}
+    {
+        LOG_DEBUG("Opened read session on " + dbPath.string());
+    }
+
+    /**
+     * @brief Destroy the Read Session object, the repositories are declared
+     * after the connection and are therefore released before it is closed
+     *
+     */
+    ReadSession::~ReadSession() = default;
+
+    /**
+     * @brief Get the Instrument Repo
+     *
+     * @return std::shared_ptr<IInstrumentRepo>
+     */
+    std::shared_ptr<IInstrumentRepo> ReadSession::getInstrumentRepo()
+    {
+        return _instrumentRepo;
+    }
+
+    /**
+     * @brief Get the Position Repo
+     *
+     * @return std::shared_ptr<IPositionRepo>
+     */
+    std::shared_ptr<IPositionRepo> ReadSession::getPositionRepo()
+    {
+        return _positionRepo;
+    }
+
+    /**
+     * @brief Get the Watchlist Repo
+     *
+     * @return std::shared_ptr<IWatchlistRepo>
+     */
+    std::shared_ptr<IWatchlistRepo> ReadSession::getWatchlistRepo()
+    {
+        return _watchlistRepo;
+    }
+
+}   // namespace repo
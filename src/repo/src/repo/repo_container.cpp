@@ -3,6 +3,8 @@
 #include "account_repo.hpp"
 #include "config/constants/constants.hpp"
 #include "db/backup_manager.hpp"
+#include "db/backup_worker.hpp"
+#include "db/database.hpp"
 #include "instrument_repo.hpp"
 #include "logging/log_macros.hpp"
 #include "position_repo.hpp"
@@ -29,16 +31,7 @@ namespace repo
               Constants::getInstance().getDatabasePath()
           )}
     {
-        try
-        {
-            db::BackupManager::createBackup(*_database, backupSettings);
-        }
-        catch (const std::exception& e)
-        {
-            LOG_WARNING(
-                std::string{"Startup backup failed (continuing): "} + e.what()
-            );
-        }
+        _startBackup(backupSettings);
 
         _migrationRunner = std::make_unique<MigrationRunner>(*_database);
         _profileRepo     = std::make_shared<ProfileRepo>(*_database);
@@ -60,8 +53,15 @@ namespace repo
 
     /**
      * @brief Close the underlying database connection.
+     *
+     * A still running startup backup is cancelled first, as the database file
+     * is about to be replaced.
      */
-    void RepoContainer::closeDb() { _database->close(); }
+    void RepoContainer::closeDb()
+    {
+        _cancelBackup();
+        _database->close();
+    }
 
     /**
      * @brief Reopen the database connection at the original path.
@@ -71,7 +71,75 @@ namespace repo
         _database->open(Constants::getInstance().getDatabasePath().string());
     }
 
-    RepoContainer::~RepoContainer() = default;
+    /**
+     * @brief Destroy the Repo Container object, cancelling a still running
+     * startup backup before the database is closed.
+     */
+    RepoContainer::~RepoContainer() { _cancelBackup(); }
+
+    /**
+     * @brief Create the startup backup.
+     *
+     * If the schema is up to date the backup runs on a background worker so
+     * that the UI does not wait for it. If migrations are pending the backup
+     * has to capture the pre-migration state and is therefore created
+     * synchronously before the migration runner touches the database.
+     *
+     * @param backupSettings The backup settings to use
+     */
+    void RepoContainer::_startBackup(
+        const settings::BackupSettings& backupSettings
+    )
+    {
+        if (!backupSettings.isBackupEnabled())
+        {
+            LOG_INFO("Backups are disabled, skipping startup backup");
+            return;
+        }
+
+        try
+        {
+            if (MigrationRunner::isMigrationPending(*_database))
+            {
+                LOG_INFO("Migrations pending, creating blocking backup");
+                db::BackupManager::createBackup(*_database, backupSettings);
+                return;
+            }
+
+            _backupWorker = std::make_unique<db::BackupWorker>(
+                Constants::getInstance().getDatabasePath(),
+                db::BackupManager::BackupOptions::fromSettings(backupSettings),
+                [](const db::BackupProgress& progress)
+                {
+                    LOG_TRACE(
+                        std::format(
+                            "Backup progress: {}/{} pages remaining",
+                            progress.remainingPages,
+                            progress.totalPages
+                        )
+                    );
+                }
+            );
+        }
+        catch (const std::exception& e)
+        {
+            LOG_WARNING(
+                std::string{"Startup backup failed (continuing): "} + e.what()
+            );
+        }
+    }
+
+    /**
+     * @brief Cancel and join a still running startup backup.
+     */
+    void RepoContainer::_cancelBackup()
+    {
+        if (_backupWorker)
+        {
+            _backupWorker->cancel();
+            _backupWorker.reset();
+        }
+    }
 
     /**
      * @brief Get the Profile Repo
@@ -121,105 +121,161 @@ namespace repo
 
             std::unreachable();
         }
-    }   // namespace
-    /**
-     * @brief add a transaction to the database
-     *
-     * @param transaction
-     * @return TransactionId
-     */
-    TransactionId TransactionRepo::addTransaction(
-        const finance::DomainTransaction& transaction
-    )
-    {
-        db::Transaction dbTx{_getDb()};
-        auto            txRow = TransactionFactory::toRow(transaction);
 
-        const auto transactionResult = _getCrud().insert(_getDb(), txRow);
-
-        if (!transactionResult.has_value())
-        {
-            const auto msg =
-                getInsertError(transactionResult.error(), "transaction");
-
-            LOG_ERROR(msg);
-            throw orm::CrudException(msg);
-        }
-
-        const auto txId = TransactionId(transactionResult.value());
-
-        for (const auto& entry : transaction.getEntries())
+        /**
+         * @brief insert a transaction with its entries, legs and option data
+         * inside an already running database transaction
+         *
+         * @param transaction
+         * @param dbTx
+         * @param crud
+         * @param db
+         * @return TransactionId
+         */
+        TransactionId insertTransaction(
+            const finance::DomainTransaction& transaction,
+            const db::Transaction&            dbTx,
+            orm::Crud&                        crud,
+            db::Database&                     db
+        )
         {
-            // 1. check if instrument exists -> if not create it
-            const auto entryRow = TransactionFactory::toEntryRow(entry, txId);
+            auto txRow = TransactionFactory::toRow(transaction);
 
-            const auto entryResult =
-                _getCrud().insert(_getDb(), dbTx, entryRow);
+            const auto transactionResult = crud.insert(db, dbTx, txRow);
 
-            if (!entryResult.has_value())
+            if (!transactionResult.has_value())
             {
                 const auto msg =
-                    getInsertError(entryResult.error(), "transaction entry");
+                    getInsertError(transactionResult.error(), "transaction");
 
                 LOG_ERROR(msg);
                 throw orm::CrudException(msg);
             }
-        }
 
-        switch (txRow.type.value())
-        {
-            case TransactionDataType::Stock:
-            {
-                const auto data =
-                    std::get<finance::StockData>(transaction.getData());
-
-                addLegs(
-                    data.getLegs(),
-                    TransactionId(transactionResult.value()),
-                    dbTx,
-                    _getCrud(),
-                    _getDb()
-                );
-                break;
-            }
-            case TransactionDataType::Option:
+            const auto txId = TransactionId(transactionResult.value());
+
+            for (const auto& entry : transaction.getEntries())
             {
-                const auto data =
-                    std::get<finance::OptionData>(transaction.getData());
-
-                addLegs(
-                    data.getLegs(),
-                    TransactionId(transactionResult.value()),
-                    dbTx,
-                    _getCrud(),
-                    _getDb()
-                );
+                // 1. check if instrument exists -> if not create it
+                const auto entryRow =
+                    TransactionFactory::toEntryRow(entry, txId);
 
-                const auto optionResult = _getCrud().insert(
-                    _getDb(),
-                    dbTx,
-                    TransactionFactory::toOptionRow(data, txId)
-                );
+                const auto entryResult = crud.insert(db, dbTx, entryRow);
 
-                if (!optionResult.has_value())
+                if (!entryResult.has_value())
                 {
                     const auto msg = getInsertError(
-                        optionResult.error(),
-                        "transaction option"
+                        entryResult.error(),
+                        "transaction entry"
                     );
 
                     LOG_ERROR(msg);
                     throw orm::CrudException(msg);
                 }
-                break;
             }
-            case TransactionDataType::Cash:
-                break;
+
+            switch (txRow.type.value())
+            {
+                case TransactionDataType::Stock:
+                {
+                    const auto data =
+                        std::get<finance::StockData>(transaction.getData());
+
+                    addLegs(
+                        data.getLegs(),
+                        TransactionId(transactionResult.value()),
+                        dbTx,
+                        crud,
+                        db
+                    );
+                    break;
+                }
+                case TransactionDataType::Option:
+                {
+                    const auto data =
+                        std::get<finance::OptionData>(transaction.getData());
+
+                    addLegs(
+                        data.getLegs(),
+                        TransactionId(transactionResult.value()),
+                        dbTx,
+                        crud,
+                        db
+                    );
+
+                    const auto optionResult = crud.insert(
+                        db,
+                        dbTx,
+                        TransactionFactory::toOptionRow(data, txId)
+                    );
+
+                    if (!optionResult.has_value())
+                    {
+                        const auto msg = getInsertError(
+                            optionResult.error(),
+                            "transaction option"
+                        );
+
+                        LOG_ERROR(msg);
+                        throw orm::CrudException(msg);
+                    }
+                    break;
+                }
+                case TransactionDataType::Cash:
+                    break;
+            }
+
+            return txId;
         }
+    }   // namespace
+
+    /**
+     * @brief add a transaction to the database
+     *
+     * @param transaction
+     * @return TransactionId
+     */
+    TransactionId TransactionRepo::addTransaction(
+        const finance::DomainTransaction& transaction
+    )
+    {
+        db::Transaction dbTx{_getDb()};
+
+        const auto txId =
+            insertTransaction(transaction, dbTx, _getCrud(), _getDb());
 
         dbTx.commit();
 
-        return TransactionId(transactionResult.value());
+        return txId;
+    }
+
+    /**
+     * @brief add a batch of transactions to the database in a single database
+     * transaction, either all of them are persisted or none
+     *
+     * @param transactions
+     * @return std::vector<TransactionId> The ids in the order of the given
+     * transactions
+     */
+    std::vector<TransactionId> TransactionRepo::addTransactions(
+        const std::vector<finance::DomainTransaction>& transactions
+    )
+    {
+        std::vector<TransactionId> ids;
+        ids.reserve(transactions.size());
+
+        db::Transaction dbTx{_getDb()};
+
+        for (const auto& transaction : transactions)
+        {
+            ids.push_back(
+                insertTransaction(transaction, dbTx, _getCrud(), _getDb())
+            );
+        }
+
+        dbTx.commit();
+
+        return ids;
     }
 
     /**
@@ -300,4 +356,30 @@ namespace repo
         return results;
     }
 
+    /**
+     * @brief Full-text search over the transaction comments, answered from
+     * the FTS5 index without loading any transaction rows
+     *
+     * @param text The words to search for, each one is matched as a prefix
+     * @param limit The maximum number of results
+     * @return std::vector<TransactionId> The IDs of the matching transactions,
+     * best match first
+     */
+    std::vector<TransactionId> TransactionRepo::searchTransactions(
+        const std::string& text,
+        std::size_t        limit
+    )
+    {
+        const auto rowIds =
+            _getCrud().search<TransactionRow>(_getDb(), text, limit);
+
+        std::vector<TransactionId> ids;
+        ids.reserve(rowIds.size());
+
+        for (const auto rowId : rowIds)
+            ids.emplace_back(rowId);
+
+        return ids;
+    }
+
 }   // namespace repo
\ No newline at end of file
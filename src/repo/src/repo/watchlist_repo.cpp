@@ -1,5 +1,9 @@
 #include "watchlist_repo.hpp"
 
+#include <algorithm>
+#include <span>
+
+#include "common/container/id_map.hpp"
 #include "common/timestamp.hpp"
 #include "factories/watchlist_factory.hpp"
 #include "finance/watchlist.hpp"
@@ -52,20 +56,36 @@ namespace repo
     /**
      * @brief Get all watchlists, including their symbols
      *
+     * The watchlists and all of their symbols are loaded with two queries,
+     * the symbols are grouped by watchlist in a single pass, so the number of
+     * queries doesn't grow with the number of watchlists.
+     *
      * @return std::vector<finance::Watchlist>
      */
     std::vector<finance::Watchlist> WatchlistRepo::getAllWatchlists()
     {
         const auto watchlistRows = _getCrud().get<WatchlistRow>(_getDb());
 
+        if (watchlistRows.empty())
+            return {};
+
+        const auto instrumentRows =
+            _getCrud().get<WatchlistInstrumentRow>(_getDb());
+
+        IdMap<WatchlistId, std::vector<std::string>> symbolsById;
+        for (const auto& row : instrumentRows)
+            symbolsById[row.watchlistId.value()].push_back(row.symbol.value());
+
         std::vector<finance::Watchlist> watchlists;
         watchlists.reserve(watchlistRows.size());
 
         for (const auto& row : watchlistRows)
         {
-            const auto symbols = _getSymbols(row.id.value());
             watchlists.push_back(
-                WatchlistFactory::toWatchlistDomain(row, symbols)
+                WatchlistFactory::toWatchlistDomain(
+                    row,
+                    symbolsById[row.id.value()]
+                )
             );
         }
 
@@ -162,34 +182,91 @@ namespace repo
             WatchlistInstrumentRow::hasWatchlistIdAndSymbol(id, symbol)
         );
 
-        const auto rows =
-            _getCrud().get<WatchlistInstrumentRow>(_getDb(), query);
+        _getCrud().deleteWhere<WatchlistInstrumentRow>(_getDb(), query);
+    }
+
+    /**
+     * @brief Add several symbols to a watchlist with multi-row inserts, either
+     * all symbols are added or none
+     *
+     * @param id
+     * @param symbols
+     */
+    void WatchlistRepo::addSymbols(
+        WatchlistId                     id,
+        const std::vector<std::string>& symbols
+    )
+    {
+        if (symbols.empty())
+            return;
+
+        std::vector<WatchlistInstrumentRow> rows;
+        rows.reserve(symbols.size());
+
+        for (const auto& symbol : symbols)
+        {
+            WatchlistInstrumentRow row;
+            row.watchlistId = id;
+            row.symbol      = symbol;
+            rows.push_back(std::move(row));
+        }
+
+        const auto result =
+            _getCrud().upsert<WatchlistInstrumentRow>(_getDb(), rows);
 
-        for (const auto& row : rows)
-            _getCrud().deleteByPk(_getDb(), row);
+        if (!result.has_value())
+        {
+            const auto msg = getInsertError(
+                result.error(),
+                std::to_string(symbols.size()) +
+                    " watchlist instruments for watchlist '" + id.toString() +
+                    "'"
+            );
+
+            LOG_ERROR(msg);
+            throw orm::CrudException(msg);
+        }
     }
 
     /**
-     * @brief Get the symbols belonging to a watchlist
+     * @brief Remove several symbols from a watchlist, each statement removes
+     * as many symbols as fit into the variable limit of the connection
      *
      * @param id
-     * @return std::vector<std::string>
+     * @param symbols
      */
-    std::vector<std::string> WatchlistRepo::_getSymbols(WatchlistId id)
+    void WatchlistRepo::removeSymbols(
+        WatchlistId                     id,
+        const std::vector<std::string>& symbols
+    )
     {
-        auto query =
-            orm::Query{}.where(WatchlistInstrumentRow::hasWatchlistId(id));
+        if (symbols.empty())
+            return;
+
+        db::Transaction transaction{_getDb()};
+
+        // one variable is taken by the watchlist id
+        const auto chunkSize =
+            std::max<std::size_t>(_getDb().getVariableLimit(), 2) - 1;
 
-        const auto rows =
-            _getCrud().get<WatchlistInstrumentRow>(_getDb(), query);
+        const std::span<const std::string> remaining{symbols};
+        for (std::size_t offset = 0; offset < remaining.size();
+             offset += chunkSize)
+        {
+            const auto chunk = remaining.subspan(
+                offset,
+                std::min(chunkSize, remaining.size() - offset)
+            );
 
-        std::vector<std::string> symbols;
-        symbols.reserve(rows.size());
+            auto query =
+                orm::Query{}
+                    .where(WatchlistInstrumentRow::hasWatchlistId(id))
+                    .in<WatchlistInstrumentRow::symbolField>(chunk);
 
-        for (const auto& row : rows)
-            symbols.push_back(row.symbol.value());
+            _getCrud().deleteWhere<WatchlistInstrumentRow>(_getDb(), query);
+        }
 
-        return symbols;
+        transaction.commit();
     }
 
 }   // namespace repo
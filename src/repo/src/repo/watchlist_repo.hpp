@@ -31,8 +31,15 @@ namespace repo
 
         void removeSymbol(WatchlistId id, const std::string& symbol) override;
 
-       private:
-        [[nodiscard]] std::vector<std::string> _getSymbols(WatchlistId id);
+        void addSymbols(
+            WatchlistId                     id,
+            const std::vector<std::string>& symbols
+        ) override;
+
+        void removeSymbols(
+            WatchlistId                     id,
+            const std::vector<std::string>& symbols
+        ) override;
     };
 
 }   // namespace repo
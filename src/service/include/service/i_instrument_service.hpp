@@ -1,6 +1,7 @@
 #ifndef __SERVICE__INCLUDE__SERVICE__I_INSTRUMENT_SERVICE_HPP__
 #define __SERVICE__INCLUDE__SERVICE__I_INSTRUMENT_SERVICE_HPP__
 
+#include <cstddef>
 #include <optional>
 #include <string>
 #include <vector>
@@ -116,6 +117,21 @@ namespace service
             const finance::Option& option
         ) = 0;
 
+        /**
+         * @brief Full-text search over the stock tickers and names
+         *
+         * @param text The words to search for, each one is matched as a
+         * prefix and all of them have to match
+         * @param limit The maximum number of results
+         * @return std::vector<StockId> The IDs of the matching stocks, best
+         * match first
+         */
+        [[nodiscard]]
+        virtual std::vector<StockId> searchStocks(
+            const std::string& text,
+            std::size_t        limit
+        ) = 0;
+
         /**
          * @brief Check if a stock with the given ticker already exists in the
          * database, this is used to prevent duplicate entries and ensure data
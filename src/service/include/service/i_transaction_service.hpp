@@ -1,6 +1,8 @@
 #ifndef __SERVICE__INCLUDE__SERVICE__I_TRANSACTION_SERVICE_HPP__
 #define __SERVICE__INCLUDE__SERVICE__I_TRANSACTION_SERVICE_HPP__
 
+#include <cstddef>
+#include <string>
 #include <vector>
 
 #include "config/id_types.hpp"
@@ -34,6 +36,20 @@ namespace service
             const finance::DomainTransaction& transaction
         ) = 0;
 
+        /**
+         * @brief Adds a batch of transactions to the service in a single
+         * database transaction, either all of them are added or none.
+         *
+         * @param transactions The transactions to add.
+         *
+         * @return The IDs of the added transactions, in the order of the
+         * given transactions.
+         */
+        [[nodiscard]]
+        virtual std::vector<TransactionId> addTransactions(
+            const std::vector<finance::DomainTransaction>& transactions
+        ) = 0;
+
         /**
          * @brief Retrieves all transactions from the service.
          *
@@ -48,6 +64,21 @@ namespace service
         virtual std::vector<finance::DomainTransaction> getTransactions(
             const finance::TransactionFilter& filter
         ) = 0;
+
+        /**
+         * @brief Full-text search over the transaction comments
+         *
+         * @param text The words to search for, each one is matched as a
+         * prefix and all of them have to match
+         * @param limit The maximum number of results
+         *
+         * @return The IDs of the matching transactions, best match first.
+         */
+        [[nodiscard]]
+        virtual std::vector<TransactionId> searchTransactions(
+            const std::string& text,
+            std::size_t        limit
+        ) = 0;
     };
 }   // namespace service
 
@@ -76,6 +76,28 @@ namespace service
             WatchlistId        id,
             const std::string& symbol
         ) = 0;
+
+        /**
+         * @brief Add several symbols to a watchlist at once
+         *
+         * @param id
+         * @param symbols
+         */
+        virtual void addSymbols(
+            WatchlistId                     id,
+            const std::vector<std::string>& symbols
+        ) = 0;
+
+        /**
+         * @brief Remove several symbols from a watchlist at once
+         *
+         * @param id
+         * @param symbols
+         */
+        virtual void removeSymbols(
+            WatchlistId                     id,
+            const std::vector<std::string>& symbols
+        ) = 0;
     };
 
 }   // namespace service
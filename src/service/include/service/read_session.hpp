@@ -0,0 +1,56 @@
+#ifndef __SERVICE__INCLUDE__SERVICE__READ_SESSION_HPP__
+#define __SERVICE__INCLUDE__SERVICE__READ_SESSION_HPP__
+
+#include <filesystem>
+#include <memory>
+
+namespace repo
+{
+    class ReadSession;   // Forward declaration
+}   // namespace repo
+
+namespace service
+{
+
+    class IInstrumentService;   // Forward declaration
+    class IPositionService;     // Forward declaration
+    class IWatchlistService;    // Forward declaration
+
+    /**
+     * @brief Read services bound to their own read-only connection
+     *
+     * This is used to hydrate stores from worker threads, each worker opens
+     * its own session so that no connection is ever shared between threads.
+     * The returned services must not outlive the session.
+     */
+    class ReadSession
+    {
+       private:
+        /// The repository read session owning the connection
+        std::unique_ptr<repo::ReadSession> _repoSession;
+
+        /// The Instrument service
+        std::shared_ptr<IInstrumentService> _instrumentService;
+        /// The Position service
+        std::shared_ptr<IPositionService> _positionService;
+        /// The Watchlist service
+        std::shared_ptr<IWatchlistService> _watchlistService;
+
+       public:
+        explicit ReadSession(const std::filesystem::path& dbPath);
+        ~ReadSession();
+
+        ReadSession(const ReadSession&)            = delete;
+        ReadSession& operator=(const ReadSession&) = delete;
+        ReadSession(ReadSession&&)                 = delete;
+        ReadSession& operator=(ReadSession&&)      = delete;
+
+        [[nodiscard]] std::shared_ptr<IInstrumentService> getInstrumentService(
+        );
+        [[nodiscard]] std::shared_ptr<IPositionService> getPositionService();
+        [[nodiscard]] std::shared_ptr<IWatchlistService> getWatchlistService();
+    };
+
+}   // namespace service
+
+#endif   // __SERVICE__INCLUDE__SERVICE__READ_SESSION_HPP__
@@ -87,6 +87,22 @@ namespace service
         return _instrumentRepo->addOption(option);
     }
 
+    /**
+     * @brief Full-text search over the stock tickers and names
+     *
+     * @param text The words to search for
+     * @param limit The maximum number of results
+     * @return std::vector<StockId> The IDs of the matching stocks, best match
+     * first
+     */
+    std::vector<StockId> InstrumentService::searchStocks(
+        const std::string& text,
+        std::size_t        limit
+    )
+    {
+        return _instrumentRepo->searchStocks(text, limit);
+    }
+
     /**
      * @brief Check if a stock with the given ticker already exists in the
      * database, this is used to prevent duplicate entries and ensure data
@@ -56,6 +56,12 @@ namespace service
             const finance::Option& option
         ) override;
 
+        [[nodiscard]]
+        std::vector<StockId> searchStocks(
+            const std::string& text,
+            std::size_t        limit
+        ) override;
+
         [[nodiscard]] bool stockExists(const std::string& ticker) override;
 
         [[nodiscard]] bool optionExists(const finance::Option& option) override;
@@ -0,0 +1,62 @@
+#include "service/read_session.hpp"
+
+#include "instrument_service.hpp"
+#include "position_service.hpp"
+#include "repo/read_session.hpp"
+#include "watchlist_service.hpp"
+
+namespace service
+{
+
+    /**
+     * @brief Construct a new Read Session object
+     *
+     * @param dbPath The path to the (already migrated) database file
+     */
+    ReadSession::ReadSession(const std::filesystem::path& dbPath)
+        : _repoSession{std::make_unique<repo::ReadSession>(dbPath)},
+          _instrumentService{std::make_shared<InstrumentService>(
+              _repoSession->getInstrumentRepo()
+          )},
+          _positionService{
+              std::make_shared<PositionService>(_repoSession->getPositionRepo()
+              )},
+          _watchlistService{std::make_shared<WatchlistService>(
+              _repoSession->getWatchlistRepo()
+          )}
+    {
+    }
+
+    ReadSession::~ReadSession() = default;
+
+    /**
+     * @brief Get the Instrument Service
+     *
+     * @return std::shared_ptr<IInstrumentService>
+     */
+    std::shared_ptr<IInstrumentService> ReadSession::getInstrumentService()
+    {
+        return _instrumentService;
+    }
+
+    /**
+     * @brief Get the Position Service
+     *
+     * @return std::shared_ptr<IPositionService>
+     */
+    std::shared_ptr<IPositionService> ReadSession::getPositionService()
+    {
+        return _positionService;
+    }
+
+    /**
+     * @brief Get the Watchlist Service
+     *
+     * @return std::shared_ptr<IWatchlistService>
+     */
+    std::shared_ptr<IWatchlistService> ReadSession::getWatchlistService()
+    {
+        return _watchlistService;
+    }
+
+}   // namespace service
@@ -31,6 +31,20 @@ namespace service
         return _transactionRepo->addTransaction(transaction);
     }
 
+    /**
+     * @brief Adds a batch of transactions to the repository in a single
+     * database transaction.
+     *
+     * @param transactions The transactions to add.
+     * @return std::vector<TransactionId> The IDs of the added transactions.
+     */
+    std::vector<TransactionId> TransactionService::addTransactions(
+        const std::vector<finance::DomainTransaction>& transactions
+    )
+    {
+        return _transactionRepo->addTransactions(transactions);
+    }
+
     /**
      * @brief Retrieves all transactions from the repository.
      *
@@ -49,4 +63,20 @@ namespace service
         return _transactionRepo->getTransactions(filter);
     }
 
+    /**
+     * @brief Full-text search over the transaction comments
+     *
+     * @param text The words to search for
+     * @param limit The maximum number of results
+     * @return std::vector<TransactionId> The IDs of the matching transactions,
+     * best match first
+     */
+    std::vector<TransactionId> TransactionService::searchTransactions(
+        const std::string& text,
+        std::size_t        limit
+    )
+    {
+        return _transactionRepo->searchTransactions(text, limit);
+    }
+
 }   // namespace service
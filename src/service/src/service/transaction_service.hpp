@@ -33,10 +33,21 @@ namespace service
             const finance::DomainTransaction& transaction
         ) override;
 
+        [[nodiscard]]
+        std::vector<TransactionId> addTransactions(
+            const std::vector<finance::DomainTransaction>& transactions
+        ) override;
+
         [[nodiscard]]
         std::vector<finance::DomainTransaction> getTransactions(
             const finance::TransactionFilter& filter
         ) override;
+
+        [[nodiscard]]
+        std::vector<TransactionId> searchTransactions(
+            const std::string& text,
+            std::size_t        limit
+        ) override;
     };
 }   // namespace service
 
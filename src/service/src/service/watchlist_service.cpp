@@ -88,4 +88,32 @@ namespace service
         _watchlistRepo->removeSymbol(id, symbol);
     }
 
+    /**
+     * @brief Add several symbols to a watchlist at once
+     *
+     * @param id
+     * @param symbols
+     */
+    void WatchlistService::addSymbols(
+        WatchlistId                     id,
+        const std::vector<std::string>& symbols
+    )
+    {
+        _watchlistRepo->addSymbols(id, symbols);
+    }
+
+    /**
+     * @brief Remove several symbols from a watchlist at once
+     *
+     * @param id
+     * @param symbols
+     */
+    void WatchlistService::removeSymbols(
+        WatchlistId                     id,
+        const std::vector<std::string>& symbols
+    )
+    {
+        _watchlistRepo->removeSymbols(id, symbols);
+    }
+
 }   // namespace service
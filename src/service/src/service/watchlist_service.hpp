@@ -41,6 +41,16 @@ namespace service
         void addSymbol(WatchlistId id, const std::string& symbol) override;
 
         void removeSymbol(WatchlistId id, const std::string& symbol) override;
+
+        void addSymbols(
+            WatchlistId                     id,
+            const std::vector<std::string>& symbols
+        ) override;
+
+        void removeSymbols(
+            WatchlistId                     id,
+            const std::vector<std::string>& symbols
+        ) override;
     };
 
 }   // namespace service
@@ -40,6 +40,19 @@ namespace settings
             "When enabled, a backup of the database is created on every "
             "application startup.";
 
+        /*********************
+         * Compact Backup    *
+         *********************/
+
+        /// compact backup key
+        static constexpr const char* COMPACT_BACKUP_KEY = "compactBackup";
+        /// compact backup title
+        static constexpr const char* COMPACT_BACKUP_TITLE = "Compact Backups";
+        /// compact backup description
+        static constexpr const char* COMPACT_BACKUP_DESC =
+            "When enabled, backups are written via VACUUM INTO, which drops "
+            "free pages and produces smaller files.";
+
         /*********************
          * Backup Directory  *
          *********************/
@@ -113,6 +126,13 @@ namespace settings
             Schema::ENABLE_BACKUP_DESC
         };
 
+        /// Whether backups are compacted via VACUUM INTO
+        BoolParam _compactBackup{
+            Schema::COMPACT_BACKUP_KEY,
+            Schema::COMPACT_BACKUP_TITLE,
+            Schema::COMPACT_BACKUP_DESC
+        };
+
         /// Relative backup directory path
         StringParam _backupDir{
             Schema::BACKUP_DIR_KEY,
@@ -138,6 +158,7 @@ namespace settings
         BackupSettings();
 
         [[nodiscard]] bool                  isBackupEnabled() const;
+        [[nodiscard]] bool                  isCompactBackup() const;
         [[nodiscard]] std::string           getBackupDir() const;
         [[nodiscard]] std::filesystem::path getBackupPath() const;
         [[nodiscard]] std::size_t           getRecentCount() const;
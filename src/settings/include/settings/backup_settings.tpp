@@ -15,6 +15,7 @@ namespace settings
     void BackupSettings::forEachParam(Func&& func) const
     {
         std::forward<Func>(func)(_enableBackup);
+        std::forward<Func>(func)(_compactBackup);
         std::forward<Func>(func)(_backupDir);
         std::forward<Func>(func)(_recentCount);
         std::forward<Func>(func)(_weeklyCount);
@@ -30,6 +31,7 @@ namespace settings
     void BackupSettings::forEachParam(Func&& func)
     {
         std::forward<Func>(func)(_enableBackup);
+        std::forward<Func>(func)(_compactBackup);
         std::forward<Func>(func)(_backupDir);
         std::forward<Func>(func)(_recentCount);
         std::forward<Func>(func)(_weeklyCount);
@@ -2,6 +2,7 @@
 #define __SETTINGS__INCLUDE__SETTINGS__SETTINGS_HPP__
 
 #include <filesystem>
+#include <memory>
 
 #include "config/signal_tags.hpp"
 #include "settings/backup_settings.hpp"
@@ -9,6 +10,7 @@
 #include "settings/logging_settings.hpp"
 #include "settings/params/param_container.hpp"
 #include "settings/params/param_container_mixin.hpp"
+#include "settings/settings_writer.hpp"
 #include "settings/shortcut_settings.hpp"
 #include "settings/ui_settings.hpp"
 
@@ -33,7 +35,11 @@ namespace settings
     };
 
     /**
-     * @brief Application settings management
+     * @brief Application settings management.
+     *
+     * save() commits the parameters and hands a snapshot to a SettingsWriter,
+     * which writes the settings file on a background thread. Copies of the
+     * settings share the writer of the file.
      */
     class Settings : public ParamContainerMixin<Settings>
     {
@@ -53,6 +59,8 @@ namespace settings
 
         /// The path to the settings file
         std::filesystem::path _settingsPath;
+        /// Writes the settings file in the background, shared by copies
+        std::shared_ptr<SettingsWriter> _writer;
 
         /// The general settings parameters
         GeneralSettings _generalSettings;
@@ -70,6 +78,7 @@ namespace settings
         explicit Settings(const std::filesystem::path& configDir);
 
         void save();
+        void flush();
 
        public:   // getters and setters
         [[nodiscard]] GeneralSettings&       getGeneralSettings();
@@ -0,0 +1,87 @@
+#ifndef __SETTINGS__INCLUDE__SETTINGS__SETTINGS_WRITER_HPP__
+#define __SETTINGS__INCLUDE__SETTINGS__SETTINGS_WRITER_HPP__
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <filesystem>
+#include <mutex>
+#include <nlohmann/json.hpp>
+#include <optional>
+#include <stop_token>
+#include <string_view>
+#include <thread>
+
+namespace settings
+{
+    /**
+     * @brief Persists settings snapshots on a background thread.
+     *
+     * Snapshots scheduled within the debounce window are coalesced, only the
+     * latest one is written once the window has passed without a new
+     * snapshot. The worker serializes the snapshot and skips the write if
+     * the content hash matches the last written file. Otherwise the content
+     * is written with common::writeFileAtomically(), so the settings file is
+     * never left half written.
+     *
+     * A failed write keeps the previous file, the next snapshot retries it.
+     * Pending snapshots are written when the writer is destroyed.
+     */
+    class SettingsWriter
+    {
+       public:
+        /// The default time a snapshot waits for newer snapshots
+        static constexpr std::chrono::milliseconds DEFAULT_DEBOUNCE{250};
+
+       private:
+        /// The settings file
+        std::filesystem::path _path;
+        /// The time a snapshot waits for newer snapshots
+        std::chrono::milliseconds _debounce;
+
+        /// Guards the state below
+        mutable std::mutex _mutex;
+        /// Signals new snapshots, flush requests and finished writes
+        std::condition_variable_any _condition;
+        /// The latest snapshot that is not written yet
+        std::optional<nlohmann::json> _pending;
+        /// The time the pending snapshot is written at
+        std::chrono::steady_clock::time_point _deadline;
+        /// The number of threads waiting in flush()
+        std::size_t _flushRequests = 0;
+        /// Whether the worker is currently writing a snapshot
+        bool _writing = false;
+        /// The hash of the content of the settings file
+        std::optional<std::size_t> _writtenHash;
+        /// The number of writes that reached the disk
+        std::size_t _writeCount = 0;
+
+        /// The worker thread, must be the last member so that it is joined
+        /// before the state above is destroyed
+        std::jthread _thread;
+
+       public:
+        explicit SettingsWriter(
+            std::filesystem::path     path,
+            std::chrono::milliseconds debounce = DEFAULT_DEBOUNCE
+        );
+        ~SettingsWriter();
+
+        SettingsWriter(const SettingsWriter&)            = delete;
+        SettingsWriter& operator=(const SettingsWriter&) = delete;
+        SettingsWriter(SettingsWriter&&)                 = delete;
+        SettingsWriter& operator=(SettingsWriter&&)      = delete;
+
+        void seed(std::string_view content);
+        void schedule(nlohmann::json snapshot);
+        void flush();
+
+        [[nodiscard]] std::size_t getWriteCount() const;
+
+       private:
+        void _run(const std::stop_token& stopToken);
+    };
+
+}   // namespace settings
+
+#endif   // __SETTINGS__INCLUDE__SETTINGS__SETTINGS_WRITER_HPP__
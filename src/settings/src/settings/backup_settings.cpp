@@ -17,6 +17,8 @@ namespace settings
     {
         _enableBackup.setDefault(true);
         _enableBackup.setRebootRequired(true);
+        _compactBackup.setDefault(false);
+        _compactBackup.setRebootRequired(true);
         _backupDir.setDefault(Schema::BACKUP_DIR_DEFAULT);
         _backupDir.setRebootRequired(true);
         _recentCount.setDefault(Schema::RECENT_COUNT_DEFAULT);
@@ -34,6 +36,16 @@ namespace settings
      */
     bool BackupSettings::isBackupEnabled() const { return _enableBackup.get(); }
 
+    /**
+     * @brief Return whether backups are compacted via VACUUM INTO.
+     *
+     * @return bool
+     */
+    bool BackupSettings::isCompactBackup() const
+    {
+        return _compactBackup.get();
+    }
+
     /**
      * @brief Return the configured backup directory (relative path).
      *
@@ -2,6 +2,8 @@
 
 #include <filesystem>
 #include <fstream>
+#include <iterator>
+#include <memory>
 #include <nlohmann/json.hpp>
 #include <string>
 #include <utility>
@@ -13,6 +15,7 @@
 #include "connections/connection.hpp"
 #include "settings/params/param_container.hpp"
 #include "settings/params/params.hpp"
+#include "settings/settings_writer.hpp"
 
 namespace settings
 {
@@ -32,13 +35,15 @@ namespace settings
      */
     Settings::Settings(const std::filesystem::path& configDir)
         : _core{SettingsSchema::SETTINGS_KEY, SettingsSchema::SETTINGS_TITLE, SettingsSchema::SETTINGS_DESC},
-          _settingsPath{absolute(configDir / Constants::getSettingsFileName())}
+          _settingsPath{absolute(configDir / Constants::getSettingsFileName())},
+          _writer{std::make_shared<SettingsWriter>(_settingsPath)}
     {
         _fromJson();
     }
 
     /**
-     * @brief Save settings to the JSON file
+     * @brief Save settings to the JSON file, the file is written in the
+     * background once no further save follows within the debounce window
      *
      */
     void Settings::save()
@@ -48,6 +53,16 @@ namespace settings
         notifySaved();
     }
 
+    /**
+     * @brief Block until the last saved settings are written to the file
+     *
+     */
+    void Settings::flush()
+    {
+        if (_writer)
+            _writer->flush();
+    }
+
     /**
      * @brief Get the GeneralSettings object
      *
@@ -134,19 +149,13 @@ namespace settings
     }
 
     /**
-     * @brief Serialize settings to JSON and save to file
+     * @brief Snapshot the settings as JSON and schedule writing it to file
      *
      */
     void Settings::_toJson() const
     {
-        std::ofstream file{_settingsPath.string()};
-        if (file.is_open())
-        {
-            nlohmann::json jsonData = toJson();
-
-            file << jsonData.dump(4);
-            file.close();
-        }
+        if (_writer)
+            _writer->schedule(toJson());
     }
 
     /**
@@ -158,10 +167,15 @@ namespace settings
         std::ifstream file{_settingsPath.string()};
         if (file.is_open())
         {
-            nlohmann::json jsonData;
-            file >> jsonData;
+            const std::string content{
+                std::istreambuf_iterator<char>{file},
+                std::istreambuf_iterator<char>{}
+            };
+
+            fromJson(nlohmann::json::parse(content), *this);
 
-            fromJson(jsonData, *this);
+            // an unchanged save does not rewrite the file
+            _writer->seed(content);
 
             file.close();
         }
@@ -0,0 +1,177 @@
+#include "settings/settings_writer.hpp"
+
+#include <functional>
+#include <string>
+#include <utility>
+
+#include "common/atomic_file.hpp"
+
+namespace settings
+{
+    namespace
+    {
+        /**
+         * @brief Hashes the serialized settings
+         *
+         * @param content
+         * @return std::size_t
+         */
+        std::size_t hashContent(std::string_view content)
+        {
+            return std::hash<std::string_view>{}(content);
+        }
+    }   // namespace
+
+    /**
+     * @brief Construct a new SettingsWriter and start its worker thread
+     *
+     * @param path The settings file
+     * @param debounce The time a snapshot waits for newer snapshots
+     */
+    SettingsWriter::SettingsWriter(
+        std::filesystem::path     path,
+        std::chrono::milliseconds debounce
+    )
+        : _path{std::move(path)},
+          _debounce{debounce},
+          _thread{[this](std::stop_token stopToken) { _run(stopToken); }}
+    {
+    }
+
+    /**
+     * @brief Destroy the SettingsWriter, a pending snapshot is written before
+     * the worker thread stops
+     *
+     */
+    SettingsWriter::~SettingsWriter()
+    {
+        _thread.request_stop();
+        _thread.join();
+    }
+
+    /**
+     * @brief Set the content of the settings file as read at startup, a
+     * snapshot serializing to the same content is not written again
+     *
+     * @param content
+     */
+    void SettingsWriter::seed(std::string_view content)
+    {
+        const std::scoped_lock lock{_mutex};
+        _writtenHash = hashContent(content);
+    }
+
+    /**
+     * @brief Schedule a snapshot to be written, replacing a pending snapshot
+     * and restarting the debounce window
+     *
+     * @param snapshot
+     */
+    void SettingsWriter::schedule(nlohmann::json snapshot)
+    {
+        {
+            const std::scoped_lock lock{_mutex};
+            _pending  = std::move(snapshot);
+            _deadline = std::chrono::steady_clock::now() + _debounce;
+        }
+
+        _condition.notify_all();
+    }
+
+    /**
+     * @brief Write a pending snapshot without waiting for the debounce window
+     * and block until it is on disk
+     *
+     */
+    void SettingsWriter::flush()
+    {
+        std::unique_lock lock{_mutex};
+
+        ++_flushRequests;
+        _condition.notify_all();
+        _condition.wait(lock, [this] { return !_pending && !_writing; });
+        --_flushRequests;
+    }
+
+    /**
+     * @brief Get the number of writes that reached the disk, snapshots that
+     * were coalesced or skipped as unchanged are not counted
+     *
+     * @return std::size_t
+     */
+    std::size_t SettingsWriter::getWriteCount() const
+    {
+        const std::scoped_lock lock{_mutex};
+        return _writeCount;
+    }
+
+    /**
+     * @brief Thread entry point, waits for snapshots and writes the latest one
+     * once its debounce window has passed
+     *
+     * @param stopToken
+     */
+    void SettingsWriter::_run(const std::stop_token& stopToken)
+    {
+        std::unique_lock lock{_mutex};
+
+        while (true)
+        {
+            _condition.wait(
+                lock,
+                stopToken,
+                [this] { return _pending.has_value(); }
+            );
+
+            // stop requested and nothing left to write
+            if (!_pending)
+                return;
+
+            // newer snapshots move the deadline, a flush or a stop ends the
+            // window early
+            while (_flushRequests == 0 && !stopToken.stop_requested() &&
+                   std::chrono::steady_clock::now() < _deadline)
+            {
+                // the deadline is read while the lock is released, wait on a
+                // copy
+                const auto deadline = _deadline;
+
+                _condition.wait_until(
+                    lock,
+                    stopToken,
+                    deadline,
+                    [this]
+                    {
+                        return _flushRequests > 0 ||
+                               std::chrono::steady_clock::now() >= _deadline;
+                    }
+                );
+            }
+
+            const auto snapshot    = std::move(_pending.value());
+            const auto writtenHash = _writtenHash;
+
+            _pending.reset();
+            _writing = true;
+            lock.unlock();
+
+            const auto content = snapshot.dump(4);
+            const auto hash    = hashContent(content);
+            const bool written =
+                hash != writtenHash &&
+                common::writeFileAtomically(_path, content);
+
+            lock.lock();
+            _writing = false;
+
+            if (written)
+            {
+                _writtenHash = hash;
+                ++_writeCount;
+            }
+
+            _condition.notify_all();
+        }
+    }
+
+}   // namespace settings
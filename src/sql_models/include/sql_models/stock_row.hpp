@@ -5,6 +5,7 @@
 #include "config/id_types.hpp"
 #include "orm/constraints.hpp"
 #include "orm/field.hpp"
+#include "orm/fixed_string.hpp"
 #include "orm/orm_model.hpp"
 #include "orm/where_expr.hpp"
 #include "sql_models/instrument_row.hpp"
@@ -24,6 +25,10 @@ struct StockRow : public orm::ORMModel<"stock">
     [[nodiscard]]
     static orm::WhereExpr hasTicker(const std::string& ticker);
 
+    /// The FTS5 table indexing the ticker, short name and long name fields,
+    /// kept in sync by triggers (see migration V16)
+    static constexpr orm::fixed_string searchTableName = "stock_fts";
+
     /// The ID of the stock instrument, this is the primary key for the stock
     /// table.
     ORM_FIELD(id, IdField<StockId>)
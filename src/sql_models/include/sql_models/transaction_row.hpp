@@ -24,6 +24,10 @@ struct TransactionRow : public orm::ORMModel<"transaction_">
     [[nodiscard]]
     static orm::WhereExpr hasTransactionId(TransactionId transactionId);
 
+    /// The FTS5 table indexing the comment field, kept in sync by triggers
+    /// (see migration V16)
+    static constexpr orm::fixed_string searchTableName = "transaction_fts";
+
     /// The id field, this is the primary key of the table and is
     /// auto-incremented
     ORM_FIELD(id, IdField<TransactionId>)
@@ -37,6 +37,13 @@ namespace store
        public:
         virtual ~IOptionStore() = default;
 
+        /**
+         * @brief Get the version of the store content, see IStore::getVersion
+         *
+         * @return std::uint64_t The current version
+         */
+        [[nodiscard]] virtual std::uint64_t getVersion() const = 0;
+
         /**
          * @brief Add a new option to the store, this will insert the option
          * into the store and return the generated instrument ID for the option
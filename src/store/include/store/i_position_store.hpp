@@ -1,6 +1,8 @@
 #ifndef __STORE__INCLUDE__STORE__I_POSITION_STORE_HPP__
 #define __STORE__INCLUDE__STORE__I_POSITION_STORE_HPP__
 
+#include <cstdint>
+
 #include "common/container/id_id_map.hpp"
 #include "config/id_types.hpp"
 #include "finance/positions.hpp"   // to avoid incomplete return type outside
@@ -34,6 +36,13 @@ namespace store
        public:
         virtual ~IPositionStore() = default;
 
+        /**
+         * @brief Get the version of the store content, see IStore::getVersion
+         *
+         * @return std::uint64_t The current version
+         */
+        [[nodiscard]] virtual std::uint64_t getVersion() const = 0;
+
         /**
          * @brief Create a Position
          *
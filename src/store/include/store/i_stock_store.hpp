@@ -1,6 +1,7 @@
 #ifndef __STORE__INCLUDE__STORE__I_STOCK_STORE_HPP__
 #define __STORE__INCLUDE__STORE__I_STOCK_STORE_HPP__
 
+#include <cstdint>
 #include <optional>
 #include <string>
 
@@ -40,6 +41,13 @@ namespace store
        public:
         virtual ~IStockStore() = default;
 
+        /**
+         * @brief Get the version of the store content, see IStore::getVersion
+         *
+         * @return std::uint64_t The current version
+         */
+        [[nodiscard]] virtual std::uint64_t getVersion() const = 0;
+
         /**
          * @brief Add a stock to the store, this will check if a stock with the
          * same ticker already exists in the store or in the database, and if
@@ -1,6 +1,8 @@
 #ifndef __STORE__INCLUDE__STORE__I_STORE_HPP__
 #define __STORE__INCLUDE__STORE__I_STORE_HPP__
 
+#include <cstdint>
+
 #include "config/signal_tags.hpp"
 
 class Connection;   // Forward declaration
@@ -24,6 +26,15 @@ namespace store
          */
         [[nodiscard]] virtual bool isDirty() const = 0;
 
+        /**
+         * @brief Get the version of the store content, it is increased by
+         * every mutation of the store. An unchanged version guarantees
+         * unchanged content, so derived results can be cached on it.
+         *
+         * @return std::uint64_t The current version
+         */
+        [[nodiscard]] virtual std::uint64_t getVersion() const = 0;
+
         /**
          * @brief Subscribe to changes in the dirty state of the store, the
          * provided callback function will be called whenever the dirty state
@@ -60,6 +71,13 @@ namespace store
          */
         virtual void reload() = 0;
 
+        /**
+         * @brief Wait for a pending background load of the store and drop its
+         * result. Called before the database file is replaced, the store is
+         * expected to be reloaded afterwards.
+         */
+        virtual void discardHydration() = 0;
+
         /**
          * @brief Clear the ID remapping map for the store. This is used to
          * reset the ID remapping state, typically after a commit or when the
@@ -4,12 +4,14 @@
 #include <cstdint>
 #include <functional>
 #include <mstd/enum.hpp>
+#include <vector>
 
 #include "finance/transaction/transactions.hpp"   // needed for public return types
 
 namespace finance
 {
     class Account;              // Forward declaration
+    class DomainTransaction;    // Forward declaration
     struct TransactionFilter;   // Forward declaration
     class CashTransaction;      // Forward declaration
     class StockTransaction;     // Forward declaration
@@ -47,6 +49,13 @@ namespace store
        public:
         virtual ~ITransactionStore() = default;
 
+        /**
+         * @brief Get the version of the store content, see IStore::getVersion
+         *
+         * @return std::uint64_t The current version
+         */
+        [[nodiscard]] virtual std::uint64_t getVersion() const = 0;
+
         /**
          * @brief Add a cash transaction to the store
          *
@@ -80,6 +89,19 @@ namespace store
             finance::OptionTransaction transaction
         ) = 0;
 
+        /**
+         * @brief Add a batch of transactions to the store, subscribers are
+         * notified once for the whole batch
+         *
+         * @param transactions The transactions to add, already converted
+         * (and thereby validated) by finance::TransactionConverter
+         * @return TransactionStoreResult The result of the operation
+         */
+        [[nodiscard]]
+        virtual TransactionStoreResult addTransactions(
+            std::vector<finance::DomainTransaction> transactions
+        ) = 0;
+
         /**
          * @brief Get all transactions in the store
          *
@@ -1,17 +1,21 @@
 #ifndef __STORE__SRC__STORE__BASE__BASE_STORE_HPP__
 #define __STORE__SRC__STORE__BASE__BASE_STORE_HPP__
 
+#include <cstddef>
 #include <cstdint>
+#include <future>
 #include <mstd/enum.hpp>
 #include <optional>
 #include <vector>
 
 #include "common/container/id_id_map.hpp"
+#include "common/container/id_map.hpp"
 #include "common/container/set.hpp"
 #include "config/logging_base.hpp"
 #include "config/signal_tags.hpp"
 #include "config/strong_id.hpp"
 #include "connections/observable.hpp"
+#include "filter/compiled_predicate.hpp"
 #include "filter/predicate.hpp"
 #include "store/i_store.hpp"
 #include "store_state.hpp"
@@ -34,6 +38,39 @@ namespace store
 
     MSTD_ENUM(StoreResult, std::int8_t, STORE_RESULT_LIST);
 
+    /**
+     * @brief Filter options compiled once per query, see
+     * FilterOptions::compile.
+     *
+     * @tparam T
+     */
+    template <typename T>
+    struct CompiledFilterOptions
+    {
+        /// The compiled filter predicate
+        filter::CompiledPredicate<T> filter;
+
+        /// A policy for including or excluding deleted entries in the results
+        DeletionPolicy deletion = DeletionPolicy::IncludeDelete;
+
+        /**
+         * @brief evaluates whether an entry matches the compiled options, the
+         * cheap deletion policy is checked before the predicate
+         *
+         * @tparam U
+         * @param entry
+         * @return true
+         * @return false
+         */
+        template <typename U>
+        bool eval(const U& entry) const
+        {
+            return (deletion == DeletionPolicy::IncludeDelete ||
+                    entry.state != StoreState::Deleted) &&
+                   filter(entry.value);
+        }
+    };
+
     /**
      * @brief Struct representing filter options for querying entries in the
      * store. This can be extended in the future to include additional options
@@ -72,6 +109,21 @@ namespace store
                    (deletion == DeletionPolicy::IncludeDelete ||
                     entry.state != StoreState::Deleted);
         }
+
+        /**
+         * @brief compiles the filter predicate into a flat program, queries
+         * compile their options once instead of walking the predicate tree
+         * for every entry
+         *
+         * @return CompiledFilterOptions<T>
+         */
+        [[nodiscard]] CompiledFilterOptions<T> compile() const
+        {
+            return CompiledFilterOptions<T>{
+                .filter   = filter::CompiledPredicate<T>::compile(filter),
+                .deletion = deletion
+            };
+        }
     };
 
     /**
@@ -122,9 +174,22 @@ namespace store
         /// its state.
         struct Entry;
 
+        /// Clean entries that are loaded in the background while the store is
+        /// only partially loaded.
+        using Hydration = std::future<std::vector<T>>;
+
        private:
-        /// The collection of entries in the store.
-        std::vector<Entry> _entries;
+        /// The collection of entries in the store, mutable because a partially
+        /// loaded store is hydrated on first (possibly const) access.
+        mutable std::vector<Entry> _entries;
+
+        /// Position of each entry in _entries by its ID, kept in sync with
+        /// _entries so that entries are found in constant time.
+        mutable IdMap<IdType, std::size_t> _entryIndex;
+
+        /// The pending background load, valid as long as the store is only
+        /// partially loaded.
+        mutable Hydration _pendingHydration;
 
         /// Flag indicating whether the store is potentially dirty (i.e., has
         /// unsaved changes).
@@ -148,12 +213,16 @@ namespace store
         /// Flag indicating whether the store is fully cached
         bool _fullCache = false;
 
+        /// Version of the store content, increased by every mutation
+        std::uint64_t _version = 0;
+
        public:
         BaseStore() = default;
         explicit BaseStore(bool fullCache);
 
-        [[nodiscard]] bool isDirty() const override;
-        [[nodiscard]] bool allDirty() const;
+        [[nodiscard]] bool          isDirty() const override;
+        [[nodiscard]] bool          allDirty() const;
+        [[nodiscard]] std::uint64_t getVersion() const override;
 
         void clearPotentiallyDirty() override;
 
@@ -195,10 +264,15 @@ namespace store
         [[nodiscard]]
         bool isFullCache() const;
 
+        [[nodiscard]]
+        bool isHydrated() const;
+        void discardHydration() override;
+
         void clearIdRemap() override;
 
        protected:
         [[nodiscard]] bool _isDeleted(IdType id) const;
+        [[nodiscard]] bool _isNew(IdType id) const;
         [[nodiscard]] bool _hasNonDeletedEntries() const;
 
         [[nodiscard]]
@@ -219,8 +293,16 @@ namespace store
         StoreResult _removeEntry(IdType id);
         StoreResult _deleteEntry(IdType id);
 
+        std::vector<IdType> _addEntries(std::vector<T> values);
+
+        template <typename Modify>
+        StoreResult _modifyEntry(IdType id, Modify&& modify);
+
         void _clearEntries();
 
+        void _hydrateLater(Hydration hydration);
+        void _ensureHydrated() const;
+
         void _notifyOnCommit();
 
         void _logCache(const std::string& category, LogLevel level);
@@ -234,7 +316,9 @@ namespace store
         );
 
         [[nodiscard]]
-        Entry* _findEntry(IdType id);
+        Entry* _findEntry(IdType id) const;
+
+        void _reindexEntries() const;
 
         void                 _markPotentiallyDirty();
         [[nodiscard]] IdType _generateNewId();
@@ -2,7 +2,12 @@
 #define __STORE__SRC__STORE__BASE__BASE_STORE_TPP__
 
 #include <algorithm>
+#include <exception>
+#include <functional>
+#include <iterator>
 #include <ranges>
+#include <string>
+#include <utility>
 
 #include "base_store.hpp"
 #include "config/id_types.hpp"
@@ -44,6 +49,23 @@ namespace store
         return entry != nullptr && entry->state == StoreState::Deleted;
     }
 
+    /**
+     * @brief Checks if an entry with the given ID is new, i.e. not yet
+     * committed to the database.
+     *
+     * @tparam T
+     * @tparam IdType
+     * @param id
+     * @return true
+     * @return false
+     */
+    template <typename T, typename IdType>
+    bool BaseStore<T, IdType>::_isNew(IdType id) const
+    {
+        const auto* entry = _findEntry(id);
+        return entry != nullptr && entry->state == StoreState::New;
+    }
+
     /**
      * @brief Checks if the store has any entries that are not marked as
      * deleted.
@@ -56,6 +78,8 @@ namespace store
     template <typename T, typename IdType>
     bool BaseStore<T, IdType>::_hasNonDeletedEntries() const
     {
+        _ensureHydrated();
+
         return std::ranges::any_of(
             _entries,
             [](const auto& entry) { return entry.state != StoreState::Deleted; }
@@ -66,6 +90,9 @@ namespace store
      * @brief Checks if the store is dirty, meaning it has any entries that are
      * not in the Clean state (i.e., they are either New or Deleted).
      *
+     * A pending hydration only yields clean entries, therefore it does not
+     * have to be awaited here.
+     *
      * @tparam T
      * @tparam IdType
      * @return true
@@ -80,6 +107,19 @@ namespace store
         );
     }
 
+    /**
+     * @brief Gets the version of the store content, see IStore::getVersion
+     *
+     * @tparam T
+     * @tparam IdType
+     * @return std::uint64_t
+     */
+    template <typename T, typename IdType>
+    std::uint64_t BaseStore<T, IdType>::getVersion() const
+    {
+        return _version;
+    }
+
     /**
      * @brief Checks if all entries in the store are dirty, meaning none of
      * them are in the Clean state.
@@ -92,6 +132,8 @@ namespace store
     template <typename T, typename IdType>
     bool BaseStore<T, IdType>::allDirty() const
     {
+        _ensureHydrated();
+
         return std::ranges::all_of(
             _entries,
             [](const auto& entry) { return entry.state != StoreState::Clean; }
@@ -99,7 +141,7 @@ namespace store
     }
 
     /**
-     * @brief Finds an entry in the store that matches the given predicate and
+     * @brief Finds the entry with the given ID through the entry index and
      * returns a pointer to it, or nullptr if not found.
      *
      * @tparam T
@@ -108,14 +150,31 @@ namespace store
      * @return BaseStore<T, IdType>::Entry*
      */
     template <typename T, typename IdType>
-    auto BaseStore<T, IdType>::_findEntry(IdType id) -> Entry*
+    auto BaseStore<T, IdType>::_findEntry(IdType id) const -> Entry*
     {
-        auto it = std::ranges::find_if(
-            _entries,
-            [id](const auto& entry) { return getId(entry.value) == id; }
-        );
+        _ensureHydrated();
+
+        if (!_entryIndex.contains(id))
+            return nullptr;
+
+        return &_entries[_entryIndex.at(id)];
+    }
 
-        return it != _entries.end() ? &(*it) : nullptr;
+    /**
+     * @brief Rebuilds the entry index after entries changed their position,
+     * for duplicated IDs the first entry wins.
+     *
+     * @tparam T
+     * @tparam IdType
+     */
+    template <typename T, typename IdType>
+    void BaseStore<T, IdType>::_reindexEntries() const
+    {
+        _entryIndex.clear();
+        _entryIndex.reserve(_entries.size());
+
+        for (std::size_t index = 0; index < _entries.size(); ++index)
+            _entryIndex.addUnchecked(getId(_entries[index].value), index);
     }
 
     /**
@@ -131,9 +190,13 @@ namespace store
     template <typename T, typename IdType>
     std::optional<T> BaseStore<T, IdType>::_get(Options options) const
     {
+        _ensureHydrated();
+
+        const auto compiled = options.compile();
+
         auto it = std::ranges::find_if(
             _entries,
-            [&options](const auto& entry) { return options.eval(entry); }
+            [&compiled](const auto& entry) { return compiled.eval(entry); }
         );
 
         return it != _entries.end() ? std::optional<T>{it->value}
@@ -152,9 +215,13 @@ namespace store
     template <typename T, typename IdType>
     auto BaseStore<T, IdType>::_getEntry(Options options) const
     {
+        _ensureHydrated();
+
+        const auto compiled = options.compile();
+
         auto it = std::ranges::find_if(
             _entries,
-            [&options](const auto& entry) { return options.eval(entry); }
+            [&compiled](const auto& entry) { return compiled.eval(entry); }
         );
 
         return it != _entries.end() ? std::optional<Entry>{*it} : std::nullopt;
@@ -172,9 +239,13 @@ namespace store
     template <typename T, typename IdType>
     IdSet<IdType> BaseStore<T, IdType>::_getIds(Options options) const
     {
+        _ensureHydrated();
+
+        const auto compiled = options.compile();
+
         IdSet<IdType> ids;
         for (const auto& entry : _entries)
-            if (options.eval(entry))
+            if (compiled.eval(entry))
                 ids.insert(getId(entry.value));
 
         return ids;
@@ -192,11 +263,14 @@ namespace store
     template <typename T, typename IdType>
     auto BaseStore<T, IdType>::_getEntries(Options options) const
     {
+        _ensureHydrated();
+
         // pipe operator not working here due _Partial adaptor invocable
         // constraints -- NO IDEA WHY
         return std::ranges::filter_view(
-            _entries,
-            [options](const auto& entry) { return options.eval(entry); }
+            std::as_const(_entries),
+            [compiled = options.compile()](const auto& entry)
+            { return compiled.eval(entry); }
         );
     }
 
@@ -246,11 +320,14 @@ namespace store
     template <typename T, typename IdType>
     IdType BaseStore<T, IdType>::_addEntry(T value)
     {
+        _ensureHydrated();
         _markPotentiallyDirty();
 
         value.setId(_generateNewId());
 
+        _entryIndex.addUnchecked(value.getId(), _entries.size());
         _entries.push_back(Entry{value, StoreState::New});
+        ++_version;
 
         _added.push_back(value);
         _notifyAdded(false);
@@ -258,6 +335,50 @@ namespace store
         return value.getId();
     }
 
+    /**
+     * @brief Adds a batch of new entries to the store. Marks the store as
+     * potentially dirty, subscribers are notified once for the whole batch
+     * instead of once per entry.
+     *
+     * @tparam T
+     * @tparam IdType
+     * @param values
+     *
+     * @return std::vector<IdType> The IDs of the new entries, in the order of
+     * the given values.
+     */
+    template <typename T, typename IdType>
+    std::vector<IdType> BaseStore<T, IdType>::_addEntries(std::vector<T> values)
+    {
+        std::vector<IdType> ids;
+
+        if (values.empty())
+            return ids;
+
+        _ensureHydrated();
+        _markPotentiallyDirty();
+
+        ids.reserve(values.size());
+        _entries.reserve(_entries.size() + values.size());
+        _added.reserve(_added.size() + values.size());
+
+        for (auto& value : values)
+        {
+            value.setId(_generateNewId());
+            ids.push_back(value.getId());
+
+            _entryIndex.addUnchecked(value.getId(), _entries.size());
+            _entries.push_back(Entry{value, StoreState::New});
+            _added.push_back(std::move(value));
+        }
+
+        ++_version;
+
+        _notifyAdded(false);
+
+        return ids;
+    }
+
     /**
      * @brief Adds a collection of new entries to the store with the given
      * values. Marks the store as potentially dirty.
@@ -269,8 +390,15 @@ namespace store
     template <typename T, typename IdType>
     void BaseStore<T, IdType>::_addCleanEntries(const std::vector<T>& value)
     {
+        _ensureHydrated();
+
         for (const auto& item : value)
+        {
+            _entryIndex.addUnchecked(getId(item), _entries.size());
             _entries.push_back(Entry{item, StoreState::Clean});
+        }
+
+        ++_version;
 
         _notifyStoreChanged(false);
     }
@@ -300,6 +428,44 @@ namespace store
 
         entry->value = value;
         entry->state = state;
+        ++_version;
+
+        _updated.push_back(entry->value);
+        _notifyUpdated(false);
+        return StoreResult::Ok;
+    }
+
+    /**
+     * @brief Modifies the value of an existing entry in place, its state is
+     * kept. The modification must not change the ID of the value. If the
+     * entry is not found, returns NotFound.
+     *
+     * In contrast to _updateEntry the value is not copied, which keeps bulk
+     * modifications like ID remapping cheap.
+     *
+     * @tparam T
+     * @tparam IdType
+     * @tparam Modify callable taking T& and returning whether it modified
+     * the value
+     * @param id
+     * @param modify
+     * @return StoreResult
+     */
+    template <typename T, typename IdType>
+    template <typename Modify>
+    StoreResult BaseStore<T, IdType>::_modifyEntry(IdType id, Modify&& modify)
+    {
+        auto* entry = _findEntry(id);
+        if (entry == nullptr)
+            return StoreResult::NotFound;
+
+        if (!std::invoke(std::forward<Modify>(modify), entry->value))
+            return StoreResult::Ok;
+
+        if (entry->state != StoreState::Clean)
+            _markPotentiallyDirty();
+
+        ++_version;
 
         _updated.push_back(entry->value);
         _notifyUpdated(false);
@@ -311,6 +477,10 @@ namespace store
      * with the specified ID is found and removed, marks the store as
      * potentially dirty.
      *
+     * The last entry is moved into the freed slot, so only its index has to
+     * be updated. The order of the remaining entries is not kept and
+     * pointers to the last entry are invalidated.
+     *
      * @tparam T
      * @tparam IdType
      * @param id
@@ -321,16 +491,27 @@ namespace store
     {
         LOG_ENTRY;
 
-        const auto* entry = _findEntry(id);
-
-        if (entry == nullptr)
+        if (_findEntry(id) == nullptr)
             return StoreResult::NotFound;
 
-        auto [beg, end] = std::ranges::remove_if(
-            _entries,
-            [id](const auto& entry_) { return entry_.value.getId() == id; }
-        );
-        _entries.erase(beg, end);
+        const auto index     = _entryIndex.at(id);
+        const auto lastIndex = _entries.size() - 1;
+
+        _entryIndex.removeUnchecked(id);
+
+        if (index != lastIndex)
+        {
+            _entries[index] = std::move(_entries[lastIndex]);
+
+            // for duplicated IDs the moved entry may not be the indexed one
+            const auto movedId = getId(_entries[index].value);
+            if (_entryIndex.contains(movedId) &&
+                _entryIndex.at(movedId) == lastIndex)
+                _entryIndex.at(movedId) = index;
+        }
+
+        _entries.pop_back();
+        ++_version;
 
         return StoreResult::Ok;
     }
@@ -373,7 +554,7 @@ namespace store
 
     /**
      * @brief Clears all entries from the store. If any entries are cleared,
-     * marks the store as potentially dirty.
+     * marks the store as potentially dirty. A pending hydration is discarded.
      *
      * @tparam T
      * @tparam IdType
@@ -383,11 +564,94 @@ namespace store
     {
         LOG_ENTRY;
 
+        discardHydration();
+
+        // the backing database may have changed as well, e.g. on a restore
+        ++_version;
+
         if (!_entries.empty())
         {
             _markPotentiallyDirty();
             _entries.clear();
+            _entryIndex.clear();
+        }
+    }
+
+    /**
+     * @brief Marks the store as partially loaded, the clean entries of the
+     * given hydration are merged into the store on its first access.
+     *
+     * This allows the entries to be loaded on a worker thread while the
+     * application keeps starting up. The hydration is always consumed on the
+     * thread accessing the store.
+     *
+     * @tparam T
+     * @tparam IdType
+     * @param hydration The pending background load of the clean entries
+     */
+    template <typename T, typename IdType>
+    void BaseStore<T, IdType>::_hydrateLater(Hydration hydration)
+    {
+        discardHydration();
+        _pendingHydration = std::move(hydration);
+        ++_version;
+    }
+
+    /**
+     * @brief Waits for a pending hydration and merges its entries into the
+     * store. The loaded entries are placed in front of entries added in the
+     * meantime, so the order matches an eagerly loaded store. No store change
+     * is notified, as every accessor hydrates before reading.
+     *
+     * @tparam T
+     * @tparam IdType
+     * @throws any exception raised while loading the entries
+     */
+    template <typename T, typename IdType>
+    void BaseStore<T, IdType>::_ensureHydrated() const
+    {
+        if (!_pendingHydration.valid())
+            return;
+
+        std::vector<T> values;
+
+        try
+        {
+            values = _pendingHydration.get();
         }
+        catch (const std::exception& e)
+        {
+            LOG_ERROR(std::string{"Failed to hydrate store: "} + e.what());
+            throw;
+        }
+
+        std::vector<Entry> entries;
+        entries.reserve(values.size() + _entries.size());
+
+        for (auto& value : values)
+            entries.push_back(Entry{std::move(value), StoreState::Clean});
+
+        std::ranges::move(_entries, std::back_inserter(entries));
+        _entries = std::move(entries);
+
+        _reindexEntries();
+    }
+
+    /**
+     * @brief Waits for a pending hydration and drops its result, used before
+     * the store is reloaded from the database.
+     *
+     * @tparam T
+     * @tparam IdType
+     */
+    template <typename T, typename IdType>
+    void BaseStore<T, IdType>::discardHydration()
+    {
+        if (!_pendingHydration.valid())
+            return;
+
+        _pendingHydration.wait();
+        _pendingHydration = Hydration{};
     }
 
     /**
@@ -469,12 +733,24 @@ namespace store
 
         if (persistedValue.state == StoreState::New ||
             persistedValue.state == StoreState::Modified)
+        {
             entry->value = persistedValue.value;
 
+            const auto persistedId = getId(persistedValue.value);
+            if (tempId != persistedId)
+            {
+                const auto index = _entryIndex.at(tempId);
+                _entryIndex.removeUnchecked(tempId);
+                _entryIndex.addUnchecked(persistedId, index);
+            }
+        }
+
+        // the removal moves another entry into the slot of this one
         if (persistedValue.state == StoreState::Deleted)
-            _removeEntry(getId(persistedValue.value));
+            return _removeEntry(getId(persistedValue.value));
 
         entry->state = StoreState::Clean;
+        ++_version;
 
         // when committing we don't want single notifications
         return StoreResult::Ok;
@@ -493,6 +769,20 @@ namespace store
         return _fullCache;
     }
 
+    /**
+     * @brief Checks if the store is fully loaded, i.e. no background
+     * hydration is pending.
+     *
+     * @tparam T
+     * @tparam IdType
+     * @return true if the store is fully loaded, false otherwise.
+     */
+    template <typename T, typename IdType>
+    bool BaseStore<T, IdType>::isHydrated() const
+    {
+        return !_pendingHydration.valid();
+    }
+
     /**
      * @brief logs the contents of the store's cache for debugging purposes.
      * This method checks if logging is enabled for the specified category and
@@ -514,6 +804,8 @@ namespace store
     {
         if (logging::LogManager::getInstance().isEnabled(category, level))
         {
+            _ensureHydrated();
+
             EXPLICIT_LOG(
                 level,
                 category,
@@ -17,14 +17,23 @@ namespace store
      *
      * @param instrumentService
      * @param instrumentIdSeq
+     * @param hydration optional background load of all options, if given the
+     * store is only partially loaded until its first access
      */
     OptionStore::OptionStore(
         InstrumentServicePtr instrumentService,
-        InstrumentIdSeq&     instrumentIdSeq
+        InstrumentIdSeq&     instrumentIdSeq,
+        Hydration            hydration
     )
         : _instrumentService(std::move(instrumentService)),
           _instrumentIdSeq(instrumentIdSeq)
     {
+        if (hydration.valid())
+        {
+            _hydrateLater(std::move(hydration));
+            return;
+        }
+
         const auto options = _instrumentService->getOptions();
 
         _addCleanEntries(options.getValues());
@@ -316,4 +325,14 @@ namespace store
         _addCleanEntries(options.getValues());
     }
 
-}   // namespace store
\ No newline at end of file
+    /**
+     * @brief Get the version of the store content, see IStore::getVersion
+     *
+     * @return std::uint64_t
+     */
+    std::uint64_t OptionStore::getVersion() const
+    {
+        return BaseStore::getVersion();
+    }
+
+}   // namespace store
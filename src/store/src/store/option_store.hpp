@@ -1,6 +1,7 @@
 #ifndef __STORE__SRC__STORE__OPTION_STORE_HPP__
 #define __STORE__SRC__STORE__OPTION_STORE_HPP__
 
+#include <cstdint>
 #include <memory>
 
 #include "common/container/id_id_map.hpp"
@@ -40,7 +41,8 @@ namespace store
        public:
         explicit OptionStore(
             InstrumentServicePtr instrumentService,
-            InstrumentIdSeq&     instrumentIdSeq
+            InstrumentIdSeq&     instrumentIdSeq,
+            Hydration            hydration = {}
         );
 
         ~OptionStore() override                    = default;
@@ -71,6 +73,8 @@ namespace store
 
         void reload() override;
 
+        [[nodiscard]] std::uint64_t getVersion() const override;
+
         [[nodiscard]]
         bool optionExists(const finance::Option& option) const;
 
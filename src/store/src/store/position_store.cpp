@@ -46,14 +46,24 @@ namespace store
      *
      * @param positionService
      * @param accountSession
+     * @param hydration optional background load of the open positions of the
+     * session accounts, if given the store is only partially loaded until its
+     * first access
      */
     PositionStore::PositionStore(
         std::shared_ptr<service::IPositionService> positionService,
-        const finance::Accounts&                   accountSession
+        const finance::Accounts&                   accountSession,
+        Hydration                                  hydration
     )
         : _positionService(std::move(positionService)),
           _session(std::make_unique<Session>(accountSession))
     {
+        if (hydration.valid())
+        {
+            _hydrateLater(std::move(hydration));
+            return;
+        }
+
         const auto accountIds = _session->accountSession.getIds();
         if (!accountIds.empty())
         {
@@ -234,4 +244,14 @@ namespace store
         );
     }
 
+    /**
+     * @brief Get the version of the store content, see IStore::getVersion
+     *
+     * @return std::uint64_t
+     */
+    std::uint64_t PositionStore::getVersion() const
+    {
+        return BaseStore::getVersion();
+    }
+
 }   // namespace store
@@ -1,6 +1,8 @@
 #ifndef __STORE__SRC__STORE__POSITION_STORE_HPP__
 #define __STORE__SRC__STORE__POSITION_STORE_HPP__
 
+#include <cstdint>
+
 #include "base/base_store.hpp"
 #include "config/id_types.hpp"
 #include "finance/position.hpp"
@@ -47,7 +49,8 @@ namespace store
        public:
         explicit PositionStore(
             std::shared_ptr<service::IPositionService> positionService,
-            const finance::Accounts&                   accountSession
+            const finance::Accounts&                   accountSession,
+            Hydration                                  hydration = {}
         );
 
         ~PositionStore() override;
@@ -64,6 +67,8 @@ namespace store
         void commit();
         void reload() override;
 
+        [[nodiscard]] std::uint64_t getVersion() const override;
+
         [[nodiscard]]
         const IdIdMap<PositionId>& getIdRemap() const override;
 
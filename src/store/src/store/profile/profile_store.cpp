@@ -4,6 +4,7 @@
 #include <format>
 #include <ranges>
 #include <utility>
+#include <vector>
 
 #include "domain/profile.hpp"
 #include "logging/log_macros.hpp"
@@ -337,7 +338,11 @@ namespace store
      */
     void ProfileStore::commit()
     {
-        for (const auto& entry : _getEntries())
+        // committing a deleted profile removes its entry from the store
+        auto                     view = _getEntries();
+        const std::vector<Entry> entries(view.begin(), view.end());
+
+        for (const auto& entry : entries)
         {
             switch (entry.state)
             {
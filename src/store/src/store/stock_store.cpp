@@ -24,15 +24,24 @@ namespace store
      *
      * @param instrumentService
      * @param instrumentIdSeq
+     * @param hydration optional background load of all stocks, if given the
+     * store is only partially loaded until its first access
      */
     StockStore::StockStore(
         InstrumentServicePtr instrumentService,
-        InstrumentIdSeq&     instrumentIdSeq
+        InstrumentIdSeq&     instrumentIdSeq,
+        Hydration            hydration
     )
         : BaseStore<finance::Stock, StockId>(true),
           _instrumentService(std::move(instrumentService)),
           _instrumentIdSeq(instrumentIdSeq)
     {
+        if (hydration.valid())
+        {
+            _hydrateLater(std::move(hydration));
+            return;
+        }
+
         // empty id set returns all stocks
         const auto& stocks = _instrumentService->getStocks({});
 
@@ -366,4 +375,14 @@ namespace store
         _addCleanEntries(stocks);
     }
 
-}   // namespace store
\ No newline at end of file
+    /**
+     * @brief Get the version of the store content, see IStore::getVersion
+     *
+     * @return std::uint64_t
+     */
+    std::uint64_t StockStore::getVersion() const
+    {
+        return BaseStore::getVersion();
+    }
+
+}   // namespace store
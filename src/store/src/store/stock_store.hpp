@@ -1,6 +1,7 @@
 #ifndef __STORE__SRC__STORE__STOCK_STORE_HPP__
 #define __STORE__SRC__STORE__STOCK_STORE_HPP__
 
+#include <cstdint>
 #include <memory>
 #include <unordered_map>
 
@@ -38,7 +39,8 @@ namespace store
        public:
         explicit StockStore(
             InstrumentServicePtr instrumentService,
-            InstrumentIdSeq&     instrumentIdSeq
+            InstrumentIdSeq&     instrumentIdSeq,
+            Hydration            hydration = {}
         );
 
         ~StockStore() override                   = default;
@@ -82,6 +84,8 @@ namespace store
         void commit();
         void reload() override;
 
+        [[nodiscard]] std::uint64_t getVersion() const override;
+
         [[nodiscard]]
         const IdIdMap<InstrumentId>& getInstrumentIdMap() const override;
 
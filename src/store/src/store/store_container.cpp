@@ -2,11 +2,25 @@
 
 #include <algorithm>
 #include <filesystem>
+#include <future>
 #include <memory>
+#include <string>
+#include <utility>
+#include <vector>
 
 #include "config/constants/constants.hpp"
 #include "connections/connection.hpp"
+#include "finance/instrument/option.hpp"
+#include "finance/instrument/stock.hpp"
+#include "finance/position.hpp"
+#include "finance/watchlist.hpp"
 #include "logging/log_macros.hpp"
+#include "logging/startup_phases.hpp"
+#include "logging/tracer.hpp"
+#include "service/i_instrument_service.hpp"
+#include "service/i_position_service.hpp"
+#include "service/i_watchlist_service.hpp"
+#include "service/read_session.hpp"
 #include "service/service_container.hpp"
 #include "store/account/account_store.hpp"
 #include "store/i_profile_store.hpp"
@@ -58,9 +72,49 @@ namespace store
         );
     };
 
+    namespace
+    {
+        /**
+         * @brief Load the entries of a store on a worker thread
+         *
+         * Every load opens its own read-only connection, so the loads run
+         * concurrently to each other and to the main connection.
+         *
+         * @param phase The name of the startup phase to record
+         * @param dbPath The path to the database
+         * @param load Callable loading the entries from a read session
+         * @return std::future of the loaded entries
+         */
+        template <typename Load>
+        auto _hydrateAsync(
+            std::string           phase,
+            std::filesystem::path dbPath,
+            Load                  load
+        )
+        {
+            return std::async(
+                std::launch::async,
+                [phase  = std::move(phase),
+                 dbPath = std::move(dbPath),
+                 load   = std::move(load)]
+                {
+                    STARTUP_PHASE(phase);
+
+                    service::ReadSession session{dbPath};
+                    return load(session);
+                }
+            );
+        }
+    }   // namespace
+
     /**
      * @brief Construct a new Store Container:: Store Impl:: Store Impl object
      *
+     * The profile and account stores are loaded eagerly, as the active
+     * account session is needed by the other stores. Stocks, options, open
+     * positions and watchlists are loaded concurrently in the background and
+     * their stores stay partially loaded until their first access.
+     *
      * @param serviceContainer
      * @param instrumentIdSeq
      */
@@ -68,44 +122,91 @@ namespace store
         service::ServiceContainer& serviceContainer,
         InstrumentIdSeq&           instrumentIdSeq
     )
-        : profileStore(
-              std::make_shared<ProfileStore>(serviceContainer.getProfileService(
-              ))
-          ),
-          accountStore(
-              std::make_shared<AccountStore>(serviceContainer.getAccountService(
-              ))
-          ),
-          stockStore(
-              std::make_shared<StockStore>(
-                  serviceContainer.getInstrumentService(),
-                  instrumentIdSeq
-              )
-          ),
-          optionStore(
-              std::make_shared<OptionStore>(
-                  serviceContainer.getInstrumentService(),
-                  instrumentIdSeq
-              )
-          ),
-          positionStore(
-              std::make_shared<PositionStore>(
-                  serviceContainer.getPositionService(),
-                  accountStore->getAccountSession()
-              )
-          ),
-          transactionStore(
-              std::make_shared<TransactionStore>(
-                  serviceContainer.getTransactionService(),
-                  accountStore->getAccountSession()
-              )
-          ),
-          watchlistStore(
-              std::make_shared<WatchlistStore>(
-                  serviceContainer.getWatchlistService()
-              )
-          )
     {
+        {
+            STARTUP_PHASE("Stores.Profiles");
+            profileStore = std::make_shared<ProfileStore>(
+                serviceContainer.getProfileService()
+            );
+        }
+
+        {
+            STARTUP_PHASE("Stores.Accounts");
+            accountStore = std::make_shared<AccountStore>(
+                serviceContainer.getAccountService()
+            );
+        }
+
+        const auto  dbPath     = Constants::getInstance().getDatabasePath();
+        const auto& session    = accountStore->getAccountSession();
+        const auto  accountIds = session.getIds();
+
+        auto stocks = _hydrateAsync(
+            "Stores.Hydrate.Stocks",
+            dbPath,
+            [](service::ReadSession& readSession)
+            {
+                // empty id set returns all stocks
+                return readSession.getInstrumentService()->getStocks({});
+            }
+        );
+
+        auto options = _hydrateAsync(
+            "Stores.Hydrate.Options",
+            dbPath,
+            [](service::ReadSession& readSession)
+            {
+                return readSession.getInstrumentService()
+                    ->getOptions()
+                    .getValues();
+            }
+        );
+
+        auto positions = _hydrateAsync(
+            "Stores.Hydrate.Positions",
+            dbPath,
+            [accountIds](service::ReadSession& readSession)
+            {
+                if (accountIds.empty())
+                    return std::vector<finance::Position>{};
+
+                return readSession.getPositionService()->getAllOpenPositions(
+                    accountIds
+                );
+            }
+        );
+
+        auto watchlists = _hydrateAsync(
+            "Stores.Hydrate.Watchlists",
+            dbPath,
+            [](service::ReadSession& readSession)
+            { return readSession.getWatchlistService()->getAllWatchlists(); }
+        );
+
+        stockStore = std::make_shared<StockStore>(
+            serviceContainer.getInstrumentService(),
+            instrumentIdSeq,
+            std::move(stocks)
+        );
+        optionStore = std::make_shared<OptionStore>(
+            serviceContainer.getInstrumentService(),
+            instrumentIdSeq,
+            std::move(options)
+        );
+        positionStore = std::make_shared<PositionStore>(
+            serviceContainer.getPositionService(),
+            session,
+            std::move(positions)
+        );
+        transactionStore = std::make_shared<TransactionStore>(
+            serviceContainer.getTransactionService(),
+            session
+        );
+        watchlistStore = std::make_shared<WatchlistStore>(
+            serviceContainer.getWatchlistService(),
+            std::move(watchlists)
+        );
+
         allStores.push_back(profileStore.get());
         allStores.push_back(accountStore.get());
         allStores.push_back(stockStore.get());
@@ -124,9 +225,12 @@ namespace store
     StoreContainer::StoreContainer(
         const settings::BackupSettings& backupSettings
     )
-        : _serviceContainer{std::make_unique<service::ServiceContainer>(
-              backupSettings
-          )},
+        : _serviceContainer{[&backupSettings]()
+                            {
+                                STARTUP_PHASE("Stores.Database");
+                                return std::make_unique<
+                                    service::ServiceContainer>(backupSettings);
+                            }()},
           _stores{
               std::make_unique<StoreImpl>(*_serviceContainer, _instrumentIdSeq)
           },
@@ -151,6 +255,8 @@ namespace store
      */
     void StoreContainer::commit()
     {
+        TRACE_SCOPE("Store.Commit");
+
         LOG_INFO("Saving all temporary changes to database");
 
         _stores->profileStore->commit();
@@ -326,10 +432,11 @@ namespace store
      * @brief Replace the live database with a backup file and reload all
      * stores so they reflect the restored data.
      *
-     * 1. Close the SQLite connection via ServiceContainer.
-     * 2. Overwrite the database file with the selected backup.
-     * 3. Reopen the connection.
-     * 4. Call reload() on every store so they clear their caches and
+     * 1. Wait for pending background loads of partially loaded stores.
+     * 2. Close the SQLite connection via ServiceContainer.
+     * 3. Overwrite the database file with the selected backup.
+     * 4. Reopen the connection.
+     * 5. Call reload() on every store so they clear their caches and
      *    re-fetch from the restored database.
      *
      * @param backupFile Path to the backup file to restore from
@@ -340,6 +447,13 @@ namespace store
     {
         LOG_INFO("Restoring database from backup: " + backupFile.string());
 
+        // background loads still read from the file that is replaced
+        for (auto* store : _stores->allStores)
+        {
+            if (store != nullptr)
+                store->discardHydration();
+        }
+
         _serviceContainer->closeDb();
 
         std::filesystem::copy(
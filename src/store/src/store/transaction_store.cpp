@@ -1,7 +1,13 @@
 #include "store/transaction_store.hpp"
 
+#include <cstddef>
 #include <format>
+#include <stdexcept>
+#include <utility>
+#include <vector>
 
+#include "common/container/id_map.hpp"
+#include "common/container/set.hpp"
 #include "config/id_types.hpp"
 #include "config/strong_id.hpp"
 #include "finance/account/accounts.hpp"
@@ -18,6 +24,38 @@ REGISTER_LOG_CATEGORY("Store.TransactionStore");
 
 namespace store
 {
+    namespace
+    {
+        /// Reverse index from a referenced id to the transactions using it
+        template <typename Id>
+        using References = IdMap<Id, IdSet<TransactionId>>;
+
+        /**
+         * @brief Collect the transactions referencing any remapped id
+         *
+         * @tparam Id
+         * @param remap The mapping of old to new ids
+         * @param references The reverse index of the referenced ids
+         * @param transactionIds The set the referencing transactions are
+         * added to
+         */
+        template <typename Id>
+        void _collectReferences(
+            const IdIdMap<Id>&    remap,
+            const References<Id>& references,
+            IdSet<TransactionId>& transactionIds
+        )
+        {
+            for (const auto& [id, _] : remap)
+            {
+                if (!references.contains(id))
+                    continue;
+
+                for (const auto transactionId : references.at(id))
+                    transactionIds.insert(transactionId);
+            }
+        }
+    }   // namespace
 
     /**
      * @brief Internal session struct for TransactionStore, this struct holds a
@@ -30,6 +68,13 @@ namespace store
         /// A reference to the AccountSession
         const finance::Accounts& accountSession;
 
+        /// New transactions by the account IDs they reference
+        References<AccountId> accountReferences;
+        /// New transactions by the instrument IDs they reference
+        References<InstrumentId> instrumentReferences;
+        /// New transactions by the position IDs they reference
+        References<PositionId> positionReferences;
+
         /**
          * @brief Construct a new Session object
          *
@@ -42,6 +87,38 @@ namespace store
 
         ~Session() = default;
 
+        /**
+         * @brief Record the ids referenced by a new transaction, so that only
+         * the referencing transactions are visited when ids are remapped
+         *
+         * @param transaction
+         */
+        void addReferences(const finance::DomainTransaction& transaction)
+        {
+            const auto id = transaction.getId();
+
+            for (const auto& entry : transaction.getEntries())
+                accountReferences[entry.getAccountId()].insert(id);
+
+            for (const auto& leg : transaction.getLegs())
+            {
+                accountReferences[leg.getAccountId()].insert(id);
+                instrumentReferences[leg.getInstrumentId()].insert(id);
+                positionReferences[leg.getPositionId()].insert(id);
+            }
+        }
+
+        /**
+         * @brief Drop all recorded references, called once the new
+         * transactions are committed or discarded
+         */
+        void clearReferences()
+        {
+            accountReferences.clear();
+            instrumentReferences.clear();
+            positionReferences.clear();
+        }
+
         // delete copy and moving
         Session(const Session&)            = delete;
         Session(Session&&)                 = delete;
@@ -96,35 +173,25 @@ namespace store
             return;
         }
 
-        _onAccountIdRemap(accountIdRemap);
-        _onInstrumentIdRemap(instrumentIdRemap);
-        _onPositionIdRemap(positionIdRemap);
+        _remapIds(accountIdRemap, instrumentIdRemap, positionIdRemap);
+
+        // new transactions are persisted as one batch, so that a commit
+        // after a bulk import runs in a single database transaction
+        std::vector<finance::DomainTransaction> newTransactions;
 
         for (const auto& entry : _getEntries())
         {
             switch (entry.state)
             {
                 case StoreState::New:
-                {
                     LOG_DEBUG(
                         std::format(
                             "Adding new transaction to database: {}",
                             entry.value.toString()
                         )
                     );
-
-                    const auto oldId = entry.value.getId();
-                    const auto id =
-                        _transactionService->addTransaction(entry.value);
-
-                    auto persisted = entry.value;
-                    persisted.setId(id);
-                    _commitEntry(
-                        oldId,
-                        Entry{.value = persisted, .state = entry.state}
-                    );
+                    newTransactions.push_back(entry.value);
                     break;
-                }
                 case StoreState::Modified:
                 case StoreState::Deleted:
                     throw std::runtime_error("Not yet implemented");
@@ -133,6 +200,31 @@ namespace store
             }
         }
 
+        // no empty batch, the service would open a database transaction for
+        // nothing
+        if (!newTransactions.empty())
+        {
+            const auto ids =
+                _transactionService->addTransactions(newTransactions);
+
+            for (std::size_t i = 0; i < newTransactions.size(); ++i)
+            {
+                auto&      persisted = newTransactions[i];
+                const auto oldId     = persisted.getId();
+
+                persisted.setId(ids[i]);
+                _commitEntry(
+                    oldId,
+                    Entry{
+                        .value = std::move(persisted),
+                        .state = StoreState::New
+                    }
+                );
+            }
+        }
+
+        _session->clearReferences();
+
         _logCache(LOG_CATEGORY, LogLevel::Trace);
 
         _notifyOnCommit();
@@ -150,7 +242,7 @@ namespace store
     {
         LOG_ENTRY;
 
-        _addEntry(
+        _addTransaction(
             finance::TransactionConverter::toDomain(
                 transaction,
                 _session->accountSession
@@ -172,7 +264,7 @@ namespace store
     {
         LOG_ENTRY;
 
-        _addEntry(
+        _addTransaction(
             finance::TransactionConverter::toDomain(
                 transaction,
                 _session->accountSession
@@ -188,7 +280,7 @@ namespace store
     {
         LOG_ENTRY;
 
-        _addEntry(
+        _addTransaction(
             finance::TransactionConverter::toDomain(
                 transaction,
                 _session->accountSession
@@ -198,6 +290,31 @@ namespace store
         return TransactionStoreResult::Ok;
     }
 
+    /**
+     * @brief Add a batch of transactions to the store, e.g. the result of a
+     * statement import. All transactions are staged at once and subscribers
+     * are notified a single time.
+     *
+     * @param transactions The converted transactions to add
+     * @return TransactionStoreResult The result of the operation
+     */
+    TransactionStoreResult TransactionStore::addTransactions(
+        std::vector<finance::DomainTransaction> transactions
+    )
+    {
+        LOG_ENTRY;
+
+        const auto ids = _addEntries(transactions);
+
+        for (std::size_t i = 0; i < transactions.size(); ++i)
+        {
+            transactions[i].setId(ids[i]);
+            _session->addReferences(transactions[i]);
+        }
+
+        return TransactionStoreResult::Ok;
+    }
+
     /**
      * @brief Get all transactions from the store, this retrieves all
      * transactions that are currently in the store, including both new
@@ -320,212 +437,91 @@ namespace store
     }
 
     /**
-     * @brief Handle account ID remapping for transaction entries
+     * @brief Add a new transaction to the store and record the ids it
+     * references
      *
-     * @param remap The mapping of old account IDs to new account IDs
+     * @param transaction
      */
-    void TransactionStore::_onAccountIdRemap(const IdIdMap<AccountId>& remap)
+    void TransactionStore::_addTransaction(
+        finance::DomainTransaction transaction
+    )
     {
-        for (const auto& entry : _getEntries())
-        {
-            if (entry.state != StoreState::New)
-            {
-                // check if this committed transaction references the
-                // remapped ID
-                const auto references = std::ranges::any_of(
-                    entry.value.getEntries(),
-                    [&remap](const auto& entry_)
-                    { return remap.contains(entry_.getAccountId()); }
-                );
-
-                if (references)
-                {
-                    throw std::runtime_error(
-                        "Account ID found in already committed transaction "
-                        "entry!"
-                    );
-                }
-
-                continue;
-            }
-
-            bool modified = false;
-
-            auto txEntries = entry.value.getEntries();
-            for (auto& txEntry : txEntries)
-            {
-                const auto id = txEntry.getAccountId();
-                if (remap.contains(id))
-                {
-                    txEntry.setAccountId(remap.at(id));
-                    modified = true;
-                }
-            }
-
-            auto legs = entry.value.getLegs();
-            for (auto& leg : legs)
-            {
-                const auto id = leg.getAccountId();
-                if (remap.contains(id))
-                {
-                    leg.setAccountId(remap.at(id));
-                    modified = true;
-                }
-            }
-
-            if (modified)
-            {
-                auto txCopy = entry.value;
-                txCopy.setEntries(txEntries);
-                txCopy.setLegs(legs);
-                _updateEntry(txCopy, StoreState::New);
-            }
-        }
+        transaction.setId(_addEntry(transaction));
+        _session->addReferences(transaction);
     }
 
     /**
-     * @brief Handle instrument ID remapping for transaction entries
+     * @brief Replace the temporary account, instrument and position ids of
+     * new transactions by the ids assigned by the database in a single pass.
      *
-     * @param remap The mapping of old instrument IDs to new instrument IDs
+     * Only transactions referencing a remapped id are visited, they are
+     * found through the reverse index of the session and modified in place.
+     *
+     * @param accountIdRemap The mapping of old account IDs to new account IDs
+     * @param instrumentIdRemap The mapping of old instrument IDs to new
+     * instrument IDs
+     * @param positionIdRemap The mapping of old position IDs to new position
+     * IDs
+     *
+     * @throws std::runtime_error if a committed transaction references a
+     * remapped ID
      */
-    void TransactionStore::_onInstrumentIdRemap(
-        const IdIdMap<InstrumentId>& remap
+    void TransactionStore::_remapIds(
+        const IdIdMap<AccountId>&    accountIdRemap,
+        const IdIdMap<InstrumentId>& instrumentIdRemap,
+        const IdIdMap<PositionId>&   positionIdRemap
     )
     {
         LOG_ENTRY;
 
-        LOG_TRACE(
-            std::format(
-                "Remapping instrument IDs in transactions: {}",
-                remap.toString()
-            )
+        IdSet<TransactionId> transactionIds;
+        _collectReferences(
+            accountIdRemap,
+            _session->accountReferences,
+            transactionIds
+        );
+        _collectReferences(
+            instrumentIdRemap,
+            _session->instrumentReferences,
+            transactionIds
+        );
+        _collectReferences(
+            positionIdRemap,
+            _session->positionReferences,
+            transactionIds
         );
 
-        for (const auto& entry : _getEntries())
-        {
-            if (entry.state != StoreState::New)
-            {
-                // check if this committed transaction references the
-                // remapped ID
-                const auto hasId = std::ranges::any_of(
-                    remap,
-                    [&entry](const auto& pair)
-                    { return entry.value.hasInstrumentId(pair.first); }
-                );
-
-                if (hasId)
-                {
-                    throw std::runtime_error(
-                        "Instrument ID found in already committed "
-                        "transaction "
-                        "entry!"
-                    );
-                }
-
-                continue;
-            }
-
-            bool               modified = false;
-            finance::TradeLegs legs     = entry.value.getLegs();
-
-            for (auto& leg : legs)
-            {
-                const auto instrumentId = leg.getInstrumentId();
-                if (remap.contains(instrumentId))
-                {
-                    LOG_DEBUG(
-                        std::format(
-                            "Remapping instrument ID in transaction leg {}: {} "
-                            "-> {}",
-                            leg.toString(),
-                            instrumentId.toString(),
-                            remap.at(instrumentId).toString()
-                        )
-                    );
-                    leg.setInstrumentId(remap.at(instrumentId));
-                    modified = true;
-                }
-            }
-
-            if (modified)
-            {
-                auto txCopy = entry.value;
-                txCopy.setLegs(legs);
-                _updateEntry(txCopy, StoreState::New);
-            }
-        }
-    }
-
-    /**
-     * @brief Handle position ID remapping for transaction entries
-     *
-     * @param remap The mapping of old position IDs to new position IDs
-     */
-    void TransactionStore::_onPositionIdRemap(const IdIdMap<PositionId>& remap)
-    {
         LOG_TRACE(
             std::format(
-                "Remapping position IDs in transactions: {}",
-                remap.toString()
+                "Remapping ids in transactions {}: accounts {}, instruments "
+                "{}, positions {}",
+                transactionIds.toString(),
+                accountIdRemap.toString(),
+                instrumentIdRemap.toString(),
+                positionIdRemap.toString()
             )
         );
 
-        for (const auto& entry : _getEntries())
+        for (const auto id : transactionIds)
         {
-            if (entry.state != StoreState::New)
+            if (!_isNew(id))
             {
-                // check if this committed transaction references the
-                // remapped ID
-                const auto hasId = std::ranges::any_of(
-                    remap,
-                    [&entry](const auto& pair)
-                    { return entry.value.hasPositionId(pair.first); }
+                throw std::runtime_error(
+                    "Remapped ID found in already committed transaction "
+                    "entry!"
                 );
-
-                if (hasId)
-                {
-                    throw std::runtime_error(
-                        "Position ID found in already committed "
-                        "transaction "
-                        "entry!"
-                    );
-                }
-                continue;
             }
 
-            bool modified = false;
-
-            auto legs = entry.value.getLegs();
-            for (auto& leg : legs)
+            const auto remap = [&](finance::DomainTransaction& transaction)
             {
-                const auto positionId = leg.getPositionId();
-                if (remap.contains(positionId))
-                {
-                    const auto newPositionId = remap.at(positionId);
-
-                    LOG_DEBUG(
-                        std::format(
-                            "Remapping position ID in transaction "
-                            "leg "
-                            "{}: "
-                            "{} -> "
-                            "{}",
-                            leg.toString(),
-                            positionId.toString(),
-                            newPositionId.toString()
-                        )
-                    );
-                    leg.setPositionId(newPositionId);
-                    modified = true;
-                }
-            }
+                return transaction.remapIds(
+                    accountIdRemap,
+                    instrumentIdRemap,
+                    positionIdRemap
+                );
+            };
 
-            if (modified)
-            {
-                auto txCopy = entry.value;
-                txCopy.setLegs(legs);
-                _updateEntry(txCopy, StoreState::New);
-            }
+            _modifyEntry(id, remap);
         }
     }
 
@@ -559,6 +555,17 @@ namespace store
         LOG_ENTRY;
         _logCache(LOG_CATEGORY, LogLevel::Debug);
         _clearEntries();
+        _session->clearReferences();
+    }
+
+    /**
+     * @brief Get the version of the store content, see IStore::getVersion
+     *
+     * @return std::uint64_t
+     */
+    std::uint64_t TransactionStore::getVersion() const
+    {
+        return BaseStore::getVersion();
     }
 
 }   // namespace store
@@ -1,6 +1,7 @@
 #ifndef __STORE__SRC__STORE__TRANSACTION_STORE_HPP__
 #define __STORE__SRC__STORE__TRANSACTION_STORE_HPP__
 
+#include <cstdint>
 #include <memory>
 #include <mstd/enum.hpp>
 
@@ -61,6 +62,8 @@ namespace store
         );
         void reload() override;
 
+        [[nodiscard]] std::uint64_t getVersion() const override;
+
         [[nodiscard]]
         TransactionStoreResult addCashTransaction(
             finance::CashTransaction transaction
@@ -75,6 +78,11 @@ namespace store
             finance::OptionTransaction transaction
         ) override;
 
+        [[nodiscard]]
+        TransactionStoreResult addTransactions(
+            std::vector<finance::DomainTransaction> transactions
+        ) override;
+
         [[nodiscard]]
         FinanceResult<finance::Transactions> getTransactions(
             finance::TransactionFilter filter
@@ -89,9 +97,13 @@ namespace store
         ) override;
 
        private:
-        void _onAccountIdRemap(const IdIdMap<AccountId>& remap);
-        void _onInstrumentIdRemap(const IdIdMap<InstrumentId>& remap);
-        void _onPositionIdRemap(const IdIdMap<PositionId>& remap);
+        void _addTransaction(finance::DomainTransaction transaction);
+
+        void _remapIds(
+            const IdIdMap<AccountId>&    accountIdRemap,
+            const IdIdMap<InstrumentId>& instrumentIdRemap,
+            const IdIdMap<PositionId>&   positionIdRemap
+        );
     };
 
 }   // namespace store
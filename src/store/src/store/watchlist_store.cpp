@@ -1,6 +1,7 @@
 #include "store/watchlist_store.hpp"
 
 #include <format>
+#include <utility>
 
 #include "logging/log_macros.hpp"
 #include "service/i_watchlist_service.hpp"
@@ -17,12 +18,21 @@ namespace store
      *
      * @param watchlistService A shared pointer to the watchlist service that
      * the store will use to perform operations related to watchlists
+     * @param hydration optional background load of all watchlists, if given
+     * the store is only partially loaded until its first access
      */
     WatchlistStore::WatchlistStore(
-        const std::shared_ptr<service::IWatchlistService>& watchlistService
+        const std::shared_ptr<service::IWatchlistService>& watchlistService,
+        Hydration                                          hydration
     )
         : _watchlistService(watchlistService)
     {
+        if (hydration.valid())
+        {
+            _hydrateLater(std::move(hydration));
+            return;
+        }
+
         _refresh();
     }
 
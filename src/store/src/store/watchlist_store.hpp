@@ -28,7 +28,8 @@ namespace store
 
        public:
         explicit WatchlistStore(
-            const std::shared_ptr<service::IWatchlistService>& watchlistService
+            const std::shared_ptr<service::IWatchlistService>& watchlistService,
+            Hydration                                          hydration = {}
         );
 
         [[nodiscard]]
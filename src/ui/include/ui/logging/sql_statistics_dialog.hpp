@@ -0,0 +1,50 @@
+#ifndef __UI__INCLUDE__UI__LOGGING__SQL_STATISTICS_DIALOG_HPP__
+#define __UI__INCLUDE__UI__LOGGING__SQL_STATISTICS_DIALOG_HPP__
+
+#include <vector>
+
+#include "db/sql_statistics.hpp"
+#include "ui/base/dialog.hpp"
+
+class QPushButton;   // Forward declaration
+class QTableView;    // Forward declaration
+class QWidget;       // Forward declaration
+
+namespace ui
+{
+    class SqlStatisticsModel;   // Forward declaration
+
+    /**
+     * @brief Dialog listing the latency statistics of all executed SQL
+     * statements, the slowest (by total time) first.
+     *
+     */
+    class SqlStatisticsDialog final : public Dialog
+    {
+        Q_OBJECT
+
+       private:
+        /// The model holding the statistics rows
+        SqlStatisticsModel* _model;
+        /// The table view displaying the statistics
+        QTableView* _tableView;
+        /// Button for reloading the statistics
+        QPushButton* _refreshButton;
+        /// Button for discarding all recorded statistics
+        QPushButton* _resetButton;
+
+       public:
+        explicit SqlStatisticsDialog(QWidget* parent);
+
+        void setStatistics(std::vector<db::SqlStatementStats> statistics);
+
+       signals:
+        /// QT signal for when the statistics should be reloaded
+        void requestRefresh();
+        /// QT signal for when the statistics should be discarded
+        void requestReset();
+    };
+
+}   // namespace ui
+
+#endif   // __UI__INCLUDE__UI__LOGGING__SQL_STATISTICS_DIALOG_HPP__
@@ -0,0 +1,52 @@
+#ifndef __UI__INCLUDE__UI__LOGGING__SQL_STATISTICS_MODEL_HPP__
+#define __UI__INCLUDE__UI__LOGGING__SQL_STATISTICS_MODEL_HPP__
+
+#include <QAbstractTableModel>
+#include <vector>
+
+#include "db/sql_statistics.hpp"
+
+namespace ui
+{
+    /**
+     * @brief Model for displaying per-statement SQL latency statistics in a
+     * table view.
+     */
+    class SqlStatisticsModel final : public QAbstractTableModel
+    {
+        Q_OBJECT
+
+       private:
+        /// The rows of the model
+        std::vector<db::SqlStatementStats> _rows;
+
+       public:
+        explicit SqlStatisticsModel(QObject* parent = nullptr);
+
+        void setRows(std::vector<db::SqlStatementStats> rows);
+
+        [[nodiscard]]
+        int rowCount(const QModelIndex& parent) const override;
+
+        [[nodiscard]]
+        int columnCount(const QModelIndex& parent) const override;
+
+        [[nodiscard]]
+        QVariant data(const QModelIndex& index, int role) const override;
+
+        [[nodiscard]]
+        QVariant headerData(
+            int             section,
+            Qt::Orientation orientation,
+            int             role
+        ) const override;
+
+        [[nodiscard]]
+        static int getSqlColumn();
+
+        [[nodiscard]]
+        Qt::ItemFlags flags(const QModelIndex& index) const override;
+    };
+}   // namespace ui
+
+#endif   // __UI__INCLUDE__UI__LOGGING__SQL_STATISTICS_MODEL_HPP__
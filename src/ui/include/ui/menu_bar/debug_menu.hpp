@@ -26,6 +26,10 @@ namespace ui
         QAction* _debugSlotsAction = nullptr;
         /// Pointer to the action for opening the log viewer dialog
         QAction* _logViewerAction = nullptr;
+        /// Pointer to the action for opening the SQL statistics dialog
+        QAction* _sqlStatisticsAction = nullptr;
+        /// Pointer to the checkable action for starting/stopping a trace
+        QAction* _traceCaptureAction = nullptr;
 
        public:
         explicit DebugMenu(QMenuBar& menuBar);
@@ -35,6 +39,10 @@ namespace ui
         void requestDebugSlots();
         /// QT signal for when the log viewer action is triggered
         void requestLogViewer();
+        /// QT signal for when the SQL statistics action is triggered
+        void requestSqlStatistics();
+        /// QT signal for when the trace capture action is toggled
+        void requestTraceCapture(bool enabled);
     };
 
 }   // namespace ui
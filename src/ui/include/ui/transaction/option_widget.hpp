@@ -3,14 +3,15 @@
 
 #include <qwidget.h>
 
+#include <memory>
 #include <vector>
 
-#include "common/container/set.hpp"
 #include "ui/base/dialog.hpp"
 
 class QFormLayout;   // Forward declaration
 class QLabel;        // Forward declaration
 class QPushButton;   // Forward declaration
+class SearchIndex;   // Forward declaration
 
 namespace drafts
 {
@@ -55,10 +56,10 @@ namespace ui
 
        public:
         explicit OptionWidget(
-            const std::vector<drafts::AccountDraft>& accounts,
-            const std::vector<drafts::AccountDraft>& referenceAccounts,
-            const Set<std::string>&                  tickers,
-            QWidget*                                 parent = nullptr
+            const std::vector<drafts::AccountDraft>&  accounts,
+            const std::vector<drafts::AccountDraft>&  referenceAccounts,
+            const std::shared_ptr<const SearchIndex>& tickers,
+            QWidget*                                  parent = nullptr
         );
 
         ~OptionWidget() override;
@@ -67,7 +68,7 @@ namespace ui
         void updateReferenceAccounts(
             std::vector<drafts::AccountDraft> referenceAccounts
         );
-        void updateTickers(const Set<std::string>& tickers);
+        void refreshTickers();
         void refresh();
 
        signals:
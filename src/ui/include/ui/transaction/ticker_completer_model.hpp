@@ -0,0 +1,57 @@
+#ifndef __UI__INCLUDE__UI__TRANSACTION__TICKER_COMPLETER_MODEL_HPP__
+#define __UI__INCLUDE__UI__TRANSACTION__TICKER_COMPLETER_MODEL_HPP__
+
+#include <QAbstractListModel>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "common/container/search_index.hpp"
+
+namespace ui
+{
+
+    /**
+     * @brief List model holding the ticker suggestions for the current query.
+     *
+     * The model is meant to be used by a QCompleter in unfiltered popup mode:
+     * it never holds the full ticker list, only the results of the shared
+     * SearchIndex for the last query, bounded by the result limit.
+     */
+    class TickerCompleterModel : public QAbstractListModel
+    {
+        Q_OBJECT
+
+       private:
+        /// The shared index of all available tickers
+        std::shared_ptr<const SearchIndex> _index;
+
+        /// The maximum number of suggestions
+        std::size_t _limit;
+
+        /// The last query
+        QString _query;
+
+        /// The suggestions for the last query
+        std::vector<std::string> _rows;
+
+       public:
+        explicit TickerCompleterModel(
+            std::shared_ptr<const SearchIndex> index,
+            QObject*                           parent = nullptr,
+            std::size_t limit = SearchIndex::DefaultLimit
+        );
+
+        void setQuery(const QString& query);
+        void refresh();
+
+        [[nodiscard]]
+        int rowCount(const QModelIndex& parent) const override;
+
+        [[nodiscard]]
+        QVariant data(const QModelIndex& index, int role) const override;
+    };
+
+}   // namespace ui
+
+#endif   // __UI__INCLUDE__UI__TRANSACTION__TICKER_COMPLETER_MODEL_HPP__
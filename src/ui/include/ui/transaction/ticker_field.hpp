@@ -5,9 +5,10 @@
 #include <qstring.h>
 #include <qwidget.h>
 
+#include <memory>
 #include <optional>
 
-#include "common/container/set.hpp"
+class SearchIndex;   // Forward declaration
 
 class QLineEdit;     // Forward declaration
 class QPushButton;   // Forward declaration
@@ -16,11 +17,15 @@ class QCompleter;    // Forward declaration
 namespace ui
 {
 
+    class TickerCompleterModel;   // Forward declaration
+
     /**
      * @brief Ticker search field with autocomplete and creation support
      *
-     * Displays a line edit that filters available tickers as the user types,
-     * using a QCompleter for the dropdown. A "+" button signals upward when
+     * Displays a line edit that searches the available tickers as the user
+     * types. The suggestions come from a SearchIndex shared with the other
+     * ticker fields, only the bounded results of the current query are handed
+     * to the QCompleter dropdown. A "+" button signals upward when
      * the user wants to create a new ticker, keeping the widget free of any
      * dialog or domain logic.
      */
@@ -29,8 +34,8 @@ namespace ui
         Q_OBJECT
 
        private:
-        /// The list of available ticker symbols for autocomplete
-        Set<QString> _tickers;
+        /// The shared index of available ticker symbols for autocomplete
+        std::shared_ptr<const SearchIndex> _tickers;
 
         /// The line edit for entering the ticker symbol
         QLineEdit* _lineEdit;
@@ -38,19 +43,20 @@ namespace ui
         /// The button for creating a new ticker
         QPushButton* _addButton;
 
+        /// The model holding the suggestions for the current text
+        TickerCompleterModel* _model;
+
         /// The completer for providing autocomplete suggestions based on the
         /// list of tickers
         QCompleter* _completer;
 
        public:
         explicit TickerField(
-            const Set<std::string>& tickers,
-            QWidget*                parent = nullptr
+            std::shared_ptr<const SearchIndex> tickers,
+            QWidget*                           parent = nullptr
         );
 
-        void addTicker(const QString& ticker);
-
-        void updateTickers(const Set<QString>& tickers);
+        void refreshTickers();
         void selectTicker(const QString& ticker);
 
         [[nodiscard]] std::optional<std::string> getTicker() const;
@@ -74,7 +80,6 @@ namespace ui
        private:
         void _onTextEdited(const QString& text);
         void _onActivated(const QString& ticker);
-        void _rebuildCompleter();
         void _onCreateTickerRequest();
     };
 
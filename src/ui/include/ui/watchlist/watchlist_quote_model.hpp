@@ -0,0 +1,126 @@
+#ifndef __UI__INCLUDE__UI__WATCHLIST__WATCHLIST_QUOTE_MODEL_HPP__
+#define __UI__INCLUDE__UI__WATCHLIST__WATCHLIST_QUOTE_MODEL_HPP__
+
+#include <QAbstractTableModel>
+#include <chrono>
+#include <cstdint>
+#include <mstd/enum.hpp>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "common/cash.hpp"
+
+class QTimer;   // Forward declaration
+
+namespace ui
+{
+// NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
+#define WATCHLIST_QUOTE_COLUMN_LIST(X) \
+    X(Symbol)                          \
+    X(LastPrice)                       \
+    X(Change)                          \
+    X(ChangePct)
+
+    MSTD_ENUM(
+        WatchlistQuoteColumns,
+        std::uint8_t,
+        WATCHLIST_QUOTE_COLUMN_LIST
+    );
+
+    /**
+     * @brief The quote of a single watchlist symbol.
+     *
+     */
+    struct WatchlistQuote
+    {
+        /// The last traded price
+        Cash lastPrice;
+        /// The previous close, the change is relative to it
+        Cash previousClose;
+
+        /// Compares two quotes member-wise
+        friend bool operator==(
+            const WatchlistQuote&,
+            const WatchlistQuote&
+        ) = default;
+    };
+
+    /**
+     * @brief Model for the quote board of a watchlist, showing the last
+     * price, change and percent change of every symbol.
+     *
+     * Quote updates are coalesced: queued quotes are applied at most once per
+     * frame interval, and every flush emits a single dataChanged signal for
+     * the range of changed rows instead of one signal per cell. Quotes that
+     * did not change are not repainted at all.
+     */
+    class WatchlistQuoteModel : public QAbstractTableModel
+    {
+        Q_OBJECT
+
+       public:
+        /// Default minimum time between two flushes, about 60 per second
+        static constexpr std::chrono::milliseconds DefaultFrameInterval{16};
+
+       private:
+        /// A row of the model
+        struct Row
+        {
+            /// The symbol of the row
+            std::string symbol;
+            /// The quote of the symbol, if one was received yet
+            std::optional<WatchlistQuote> quote;
+        };
+
+        /// The rows in display order
+        std::vector<Row> _rows;
+        /// Row index by symbol
+        std::unordered_map<std::string, std::size_t> _rowBySymbol;
+        /// Quotes queued since the last flush, the latest quote per symbol
+        std::unordered_map<std::string, WatchlistQuote> _pending;
+        /// Single-shot timer limiting the flush rate
+        QTimer* _flushTimer;
+
+       public:
+        explicit WatchlistQuoteModel(
+            QObject*                  parent        = nullptr,
+            std::chrono::milliseconds frameInterval = DefaultFrameInterval
+        );
+
+        void setSymbols(const std::vector<std::string>& symbols);
+        void queueQuotes(
+            const std::unordered_map<std::string, WatchlistQuote>& quotes
+        );
+        void flush();
+
+        [[nodiscard]] bool hasPendingQuotes() const;
+
+        [[nodiscard]]
+        std::optional<WatchlistQuote> quoteAt(int row) const;
+
+        [[nodiscard]]
+        int rowCount(const QModelIndex& parent) const override;
+
+        [[nodiscard]]
+        int columnCount(const QModelIndex& parent) const override;
+
+        [[nodiscard]]
+        QVariant data(const QModelIndex& index, int role) const override;
+
+        [[nodiscard]]
+        QVariant headerData(
+            int             section,
+            Qt::Orientation orientation,
+            int             role
+        ) const override;
+
+       private:
+        [[nodiscard]]
+        static QString _columnLabel(int index);
+    };
+
+}   // namespace ui
+
+#endif   // __UI__INCLUDE__UI__WATCHLIST__WATCHLIST_QUOTE_MODEL_HPP__
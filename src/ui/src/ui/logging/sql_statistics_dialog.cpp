@@ -0,0 +1,81 @@
+#include "ui/logging/sql_statistics_dialog.hpp"
+
+#include <QHBoxLayout>
+#include <QHeaderView>
+#include <QPushButton>
+#include <QTableView>
+#include <QVBoxLayout>
+#include <utility>
+
+#include "common/qt_helpers.hpp"
+#include "ui/logging/sql_statistics_model.hpp"
+
+namespace ui
+{
+    /**
+     * @brief Construct a new Sql Statistics Dialog object
+     *
+     * @param parent Parent widget
+     */
+    SqlStatisticsDialog::SqlStatisticsDialog(QWidget* parent)
+        : Dialog(parent),
+          _model(new SqlStatisticsModel(this)),
+          _tableView(new QTableView(this)),
+          _refreshButton(new QPushButton(tr("Refresh"), this)),
+          _resetButton(new QPushButton(tr("Reset"), this))
+    {
+        constexpr int DIALOG_WIDTH  = 1000;
+        constexpr int DIALOG_HEIGHT = 600;
+
+        setWindowTitle(tr("SQL Statistics"));
+        resize(DIALOG_WIDTH, DIALOG_HEIGHT);
+
+        _tableView->setModel(_model);
+        _tableView->setSelectionBehavior(QAbstractItemView::SelectRows);
+        _tableView->setWordWrap(false);
+        _tableView->verticalHeader()->setVisible(false);
+        _tableView->horizontalHeader()->setSectionResizeMode(
+            QHeaderView::ResizeToContents
+        );
+        _tableView->horizontalHeader()->setSectionResizeMode(
+            SqlStatisticsModel::getSqlColumn(),
+            QHeaderView::Stretch
+        );
+
+        auto* buttonLayout = common::makeQChild<QHBoxLayout>();
+        buttonLayout->addWidget(_refreshButton);
+        buttonLayout->addStretch(1);
+        buttonLayout->addWidget(_resetButton);
+
+        auto* layout = common::makeQChild<QVBoxLayout>(this);
+        layout->addWidget(_tableView);
+        layout->addLayout(buttonLayout);
+
+        connect(
+            _refreshButton,
+            &QPushButton::clicked,
+            this,
+            &SqlStatisticsDialog::requestRefresh
+        );
+
+        connect(
+            _resetButton,
+            &QPushButton::clicked,
+            this,
+            &SqlStatisticsDialog::requestReset
+        );
+    }
+
+    /**
+     * @brief Replace the displayed statistics
+     *
+     * @param statistics The statistics to display
+     */
+    void SqlStatisticsDialog::setStatistics(
+        std::vector<db::SqlStatementStats> statistics
+    )
+    {
+        _model->setRows(std::move(statistics));
+    }
+
+}   // namespace ui
@@ -0,0 +1,218 @@
+#include "ui/logging/sql_statistics_model.hpp"
+
+#include <chrono>
+#include <cstdint>
+#include <mstd/enum.hpp>
+#include <utility>
+
+namespace ui
+{
+// NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
+#define SQL_STATISTICS_MODEL_COLUMNS(X) \
+    X(Count)                            \
+    X(Total)                            \
+    X(Avg)                              \
+    X(Min)                              \
+    X(Max)                              \
+    X(P95)                              \
+    X(Rows)                             \
+    X(Sql)
+
+    // cppcheck-suppress unknownMacro
+    MSTD_ENUM(SqlStatisticsColumn, std::uint8_t, SQL_STATISTICS_MODEL_COLUMNS)
+
+    namespace
+    {
+        /**
+         * @brief Format a duration in milliseconds with microsecond precision
+         */
+        QString _toMs(std::chrono::nanoseconds duration)
+        {
+            constexpr int PRECISION = 3;
+
+            const auto milliseconds =
+                std::chrono::duration<double, std::milli>(duration).count();
+
+            return QString::number(milliseconds, 'f', PRECISION);
+        }
+
+        /**
+         * @brief Average execution time of a statement
+         */
+        std::chrono::nanoseconds _average(const db::SqlStatementStats& row)
+        {
+            if (row.count == 0)
+                return std::chrono::nanoseconds{0};
+
+            return row.totalTime / static_cast<std::int64_t>(row.count);
+        }
+    }   // namespace
+
+    /**
+     * @brief Construct a new Sql Statistics Model object
+     *
+     * @param parent
+     */
+    SqlStatisticsModel::SqlStatisticsModel(QObject* parent)
+        : QAbstractTableModel(parent)
+    {
+    }
+
+    /**
+     * @brief Set the rows of the model
+     *
+     * @param rows The rows to set
+     */
+    void SqlStatisticsModel::setRows(std::vector<db::SqlStatementStats> rows)
+    {
+        beginResetModel();
+        _rows = std::move(rows);
+        endResetModel();
+    }
+
+    /**
+     * @brief Get the number of rows in the model
+     *
+     * @param parent The parent index
+     * @return int
+     */
+    int SqlStatisticsModel::rowCount(const QModelIndex& parent) const
+    {
+        if (parent.isValid())
+            return 0;
+        return static_cast<int>(_rows.size());
+    }
+
+    /**
+     * @brief Get the number of columns in the model
+     *
+     * @param parent The parent index
+     * @return int
+     */
+    int SqlStatisticsModel::columnCount(const QModelIndex& parent) const
+    {
+        if (parent.isValid())
+            return 0;
+
+        return static_cast<int>(SqlStatisticsColumnMeta::size);
+    }
+
+    /**
+     * @brief Get the data for a specific index, durations are displayed in
+     * milliseconds
+     *
+     * @param index The index to get data for
+     * @param role The role of the data
+     * @return QVariant
+     */
+    QVariant SqlStatisticsModel::data(const QModelIndex& index, int role) const
+    {
+        if (!index.isValid() || index.row() >= rowCount({}))
+            return {};
+
+        const auto& row = _rows[static_cast<size_t>(index.row())];
+        const auto  col = static_cast<SqlStatisticsColumn>(index.column());
+
+        if (role == Qt::DisplayRole)
+        {
+            switch (col)
+            {
+                case SqlStatisticsColumn::Count:
+                    return QString::number(row.count);
+                case SqlStatisticsColumn::Total:
+                    return _toMs(row.totalTime);
+                case SqlStatisticsColumn::Avg:
+                    return _toMs(_average(row));
+                case SqlStatisticsColumn::Min:
+                    return _toMs(row.minTime);
+                case SqlStatisticsColumn::Max:
+                    return _toMs(row.maxTime);
+                case SqlStatisticsColumn::P95:
+                    return _toMs(row.p95Time);
+                case SqlStatisticsColumn::Rows:
+                    return QString::number(row.rows);
+                case SqlStatisticsColumn::Sql:
+                    return QString::fromStdString(row.sql);
+            }
+
+            std::unreachable();
+        }
+
+        if (role == Qt::ToolTipRole && col == SqlStatisticsColumn::Sql)
+            return QString::fromStdString(row.sql);
+
+        if (role == Qt::TextAlignmentRole)
+        {
+            if (col == SqlStatisticsColumn::Sql)
+                return {Qt::AlignLeft | Qt::AlignVCenter};
+
+            return {Qt::AlignRight | Qt::AlignVCenter};
+        }
+
+        return {};
+    }
+
+    /**
+     * @brief Get the header data for a specific section
+     *
+     * @param section The section to get header data for
+     * @param orientation The orientation of the header
+     * @param role The role of the header data
+     * @return QVariant
+     */
+    QVariant SqlStatisticsModel::headerData(
+        int             section,
+        Qt::Orientation orientation,
+        int             role
+    ) const
+    {
+        if (orientation != Qt::Horizontal || role != Qt::DisplayRole)
+            return {};
+
+        const auto col = static_cast<SqlStatisticsColumn>(section);
+
+        switch (col)
+        {
+            case SqlStatisticsColumn::Total:
+            case SqlStatisticsColumn::Avg:
+            case SqlStatisticsColumn::Min:
+            case SqlStatisticsColumn::Max:
+            case SqlStatisticsColumn::P95:
+                return QString::fromStdString(
+                    SqlStatisticsColumnMeta::toString(col) + " [ms]"
+                );
+            case SqlStatisticsColumn::Count:
+            case SqlStatisticsColumn::Rows:
+            case SqlStatisticsColumn::Sql:
+                return QString::fromStdString(
+                    SqlStatisticsColumnMeta::toString(col)
+                );
+        }
+
+        std::unreachable();
+    }
+
+    /**
+     * @brief Get the column index for the SQL text
+     *
+     * @return int
+     */
+    int SqlStatisticsModel::getSqlColumn()
+    {
+        return static_cast<int>(SqlStatisticsColumn::Sql);
+    }
+
+    /**
+     * @brief flag handling for the model
+     *
+     * @param index
+     * @return Qt::ItemFlags
+     */
+    Qt::ItemFlags SqlStatisticsModel::flags(const QModelIndex& index) const
+    {
+        if (!index.isValid())
+            return Qt::NoItemFlags;
+        return Qt::ItemIsEnabled | Qt::ItemIsSelectable;
+    }
+
+}   // namespace ui
@@ -31,6 +31,26 @@ namespace ui
             this,
             &DebugMenu::requestLogViewer
         );
+
+        _debugMenu->addSeparator();
+
+        _sqlStatisticsAction = _debugMenu->addAction("SQL Statistics");
+        connect(
+            _sqlStatisticsAction,
+            &QAction::triggered,
+            this,
+            &DebugMenu::requestSqlStatistics
+        );
+
+        _traceCaptureAction =
+            _debugMenu->addAction("Capture Performance Trace");
+        _traceCaptureAction->setCheckable(true);
+        connect(
+            _traceCaptureAction,
+            &QAction::toggled,
+            this,
+            &DebugMenu::requestTraceCapture
+        );
     }
 
 }   // namespace ui
\ No newline at end of file
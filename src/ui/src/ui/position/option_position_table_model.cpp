@@ -4,6 +4,7 @@
 #include <QDateTime>
 
 #include "drafts/position/position_option_draft.hpp"
+#include "logging/tracer.hpp"
 #include "ui/position/position_columns.hpp"
 #include "ui/utils/format.hpp"
 
@@ -228,6 +229,8 @@ namespace ui
         const std::vector<drafts::PositionOptionDetailDraft>& positions
     )
     {
+        TRACE_SCOPE("UI.Model.OptionPositions.Reset");
+
         beginResetModel();
         _positions = positions;
         endResetModel();
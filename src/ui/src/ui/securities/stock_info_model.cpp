@@ -4,6 +4,7 @@
 
 #include "common/finance.hpp"
 #include "drafts/stock_draft.hpp"
+#include "logging/tracer.hpp"
 
 namespace ui
 {
@@ -38,6 +39,8 @@ namespace ui
      */
     void StockInfoTableModel::setRows(std::vector<drafts::StockInfoDraft> rows)
     {
+        TRACE_SCOPE("UI.Model.StockInfo.Reset");
+
         beginResetModel();
         _rows = std::move(rows);
         endResetModel();
@@ -12,6 +12,7 @@
 #include <mstd/enum.hpp>
 
 #include "drafts/transaction/transaction_overview_draft.hpp"
+#include "logging/tracer.hpp"
 
 namespace ui
 {
@@ -82,6 +83,8 @@ namespace ui
         IdMap<AccountId, std::string>                accountIdToName
     )
     {
+        TRACE_SCOPE("UI.Model.CashTransactions.Reset");
+
         beginResetModel();
         _transactions    = std::move(transactions);
         _accountIdToName = std::move(accountIdToName);
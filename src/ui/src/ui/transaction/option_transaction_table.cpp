@@ -14,6 +14,7 @@
 #include "common/finance.hpp"
 #include "common/quantity.hpp"
 #include "drafts/transaction/transaction_overview_draft.hpp"
+#include "logging/tracer.hpp"
 
 namespace ui
 {
@@ -90,6 +91,8 @@ namespace ui
         IdMap<AccountId, std::string>                  accountIdToName
     )
     {
+        TRACE_SCOPE("UI.Model.OptionTransactions.Reset");
+
         beginResetModel();
         _transactions    = std::move(transactions);
         _accountIdToName = std::move(accountIdToName);
@@ -69,10 +69,10 @@ namespace ui
         QPointer<QLabel> currencyFeesLabel = nullptr;
 
         Fields(
-            const std::vector<drafts::AccountDraft>& accounts,
-            const std::vector<drafts::AccountDraft>& referenceAccounts,
-            const Set<std::string>&                  tickers,
-            QWidget*                                 parent
+            const std::vector<drafts::AccountDraft>&  accounts,
+            const std::vector<drafts::AccountDraft>&  referenceAccounts,
+            const std::shared_ptr<const SearchIndex>& tickers,
+            QWidget*                                  parent
         );
 
         void addFieldsToLayout(QFormLayout* layout) const;
@@ -95,10 +95,10 @@ namespace ui
      * @param parent
      */
     OptionWidget::Fields::Fields(
-        const std::vector<drafts::AccountDraft>& accounts,
-        const std::vector<drafts::AccountDraft>& referenceAccounts,
-        const Set<std::string>&                  tickers,
-        QWidget*                                 parent
+        const std::vector<drafts::AccountDraft>&  accounts,
+        const std::vector<drafts::AccountDraft>&  referenceAccounts,
+        const std::shared_ptr<const SearchIndex>& tickers,
+        QWidget*                                  parent
     )
         : accountCombo(new AccountCombo(accounts, parent)),
           referenceAccountCombo(new AccountCombo(referenceAccounts, parent)),
@@ -293,14 +293,14 @@ namespace ui
      * reference account combo box, this will be filtered based on the
      * selected primary account to only include accounts with the same
      * currency
-     * @param tickers A list of ticker symbols to populate the ticker field
+     * @param tickers The shared index of ticker symbols for the ticker field
      * @param parent The parent widget for this widget
      */
     OptionWidget::OptionWidget(
-        const std::vector<drafts::AccountDraft>& accounts,
-        const std::vector<drafts::AccountDraft>& referenceAccounts,
-        const Set<std::string>&                  tickers,
-        QWidget*                                 parent
+        const std::vector<drafts::AccountDraft>&  accounts,
+        const std::vector<drafts::AccountDraft>&  referenceAccounts,
+        const std::shared_ptr<const SearchIndex>& tickers,
+        QWidget*                                  parent
     )
         : Dialog(parent),
           _layout(new QFormLayout(this)),
@@ -483,14 +483,12 @@ namespace ui
     }
 
     /**
-     * @brief Update the list of tickers in the ticker field
-     *
-     * @param tickers The new list of ticker symbols to populate the ticker
-     * field
+     * @brief Refresh the ticker suggestions after the shared ticker index has
+     * changed
      */
-    void OptionWidget::updateTickers(const Set<std::string>& tickers)
+    void OptionWidget::refreshTickers()
     {
-        _fields->tickerField->updateTickers(common::toQStringSet(tickers));
+        _fields->tickerField->refreshTickers();
     }
 
     /**
@@ -13,6 +13,7 @@
 
 #include "common/quantity.hpp"
 #include "drafts/transaction/transaction_overview_draft.hpp"
+#include "logging/tracer.hpp"
 
 namespace ui
 {
@@ -85,6 +86,8 @@ namespace ui
         IdMap<AccountId, std::string>                 accountIdToName
     )
     {
+        TRACE_SCOPE("UI.Model.StockTransactions.Reset");
+
         beginResetModel();
         _transactions    = std::move(transactions);
         _accountIdToName = std::move(accountIdToName);
@@ -10,7 +10,6 @@
 #include <QPointer>
 
 #include "common/cash.hpp"
-#include "common/container/set.hpp"
 #include "common/currency.hpp"
 #include "common/qt_helpers.hpp"
 #include "drafts/account_draft.hpp"
@@ -66,10 +65,10 @@ namespace ui
         QPointer<QLabel> currencyFeesLabel = nullptr;
 
         Fields(
-            const std::vector<drafts::AccountDraft>& accounts,
-            const std::vector<drafts::AccountDraft>& referenceAccounts,
-            const Set<std::string>&                  tickers,
-            QWidget*                                 parent
+            const std::vector<drafts::AccountDraft>&  accounts,
+            const std::vector<drafts::AccountDraft>&  referenceAccounts,
+            const std::shared_ptr<const SearchIndex>& tickers,
+            QWidget*                                  parent
         );
 
         void addFieldsToLayout(QFormLayout* layout) const;
@@ -92,10 +91,10 @@ namespace ui
      * @param parent
      */
     StockWidget::Fields::Fields(
-        const std::vector<drafts::AccountDraft>& accounts,
-        const std::vector<drafts::AccountDraft>& referenceAccounts,
-        const Set<std::string>&                  tickers,
-        QWidget*                                 parent
+        const std::vector<drafts::AccountDraft>&  accounts,
+        const std::vector<drafts::AccountDraft>&  referenceAccounts,
+        const std::shared_ptr<const SearchIndex>& tickers,
+        QWidget*                                  parent
     )
         : accountCombo(new AccountCombo(accounts, parent)),
           referenceAccountCombo(new AccountCombo(referenceAccounts, parent)),
@@ -241,14 +240,14 @@ namespace ui
      * reference account combo box, this will be filtered based on the
      * selected primary account to only include accounts with the same
      * currency
-     * @param tickers A list of ticker symbols to populate the ticker field
+     * @param tickers The shared index of ticker symbols for the ticker field
      * @param parent The parent widget for this widget
      */
     StockWidget::StockWidget(
-        const std::vector<drafts::AccountDraft>& accounts,
-        const std::vector<drafts::AccountDraft>& referenceAccounts,
-        const Set<std::string>&                  tickers,
-        QWidget*                                 parent
+        const std::vector<drafts::AccountDraft>&  accounts,
+        const std::vector<drafts::AccountDraft>&  referenceAccounts,
+        const std::shared_ptr<const SearchIndex>& tickers,
+        QWidget*                                  parent
     )
         : Dialog(parent),
           _layout(new QFormLayout(this)),
@@ -422,18 +421,12 @@ namespace ui
     }
 
     /**
-     * @brief Update the list of tickers in the ticker field
-     *
-     * @param tickers The new list of ticker symbols to populate the ticker
-     * field
+     * @brief Refresh the ticker suggestions after the shared ticker index has
+     * changed
      */
-    void StockWidget::updateTickers(const Set<std::string>& tickers)
+    void StockWidget::refreshTickers()
     {
-        Set<QString> qTickers;
-        for (const auto& ticker : tickers)
-            qTickers.insert(QString::fromStdString(ticker));
-
-        _fields->tickerField->updateTickers(qTickers);
+        _fields->tickerField->refreshTickers();
     }
 
     /**
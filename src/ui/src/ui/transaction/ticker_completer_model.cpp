@@ -0,0 +1,84 @@
+#include "ui/transaction/ticker_completer_model.hpp"
+
+#include <utility>
+
+#include "logging/tracer.hpp"
+
+namespace ui
+{
+
+    /**
+     * @brief Construct a new Ticker Completer Model object
+     *
+     * @param index The shared index of all available tickers
+     * @param parent
+     * @param limit The maximum number of suggestions
+     */
+    TickerCompleterModel::TickerCompleterModel(
+        std::shared_ptr<const SearchIndex> index,
+        QObject*                           parent,
+        std::size_t                        limit
+    )
+        : QAbstractListModel(parent), _index(std::move(index)), _limit(limit)
+    {
+    }
+
+    /**
+     * @brief Set the query and replace the suggestions with its results
+     *
+     * @param query The text entered by the user
+     */
+    void TickerCompleterModel::setQuery(const QString& query)
+    {
+        _query = query.trimmed();
+        refresh();
+    }
+
+    /**
+     * @brief Re-run the last query, used after the shared index has changed
+     *
+     */
+    void TickerCompleterModel::refresh()
+    {
+        TRACE_SCOPE("UI.Model.TickerCompleter.Reset");
+
+        beginResetModel();
+        _rows = _index ? _index->search(_query.toStdString(), _limit)
+                       : std::vector<std::string>{};
+        endResetModel();
+    }
+
+    /**
+     * @brief Get the number of suggestions
+     *
+     * @param parent The parent index
+     * @return int
+     */
+    int TickerCompleterModel::rowCount(const QModelIndex& parent) const
+    {
+        if (parent.isValid())
+            return 0;
+        return static_cast<int>(_rows.size());
+    }
+
+    /**
+     * @brief Get the ticker of a suggestion
+     *
+     * @param index The index of the suggestion
+     * @param role The requested role
+     * @return QVariant The ticker for the display and edit roles
+     */
+    QVariant TickerCompleterModel::data(const QModelIndex& index, int role)
+        const
+    {
+        if (!index.isValid() || index.row() >= rowCount({}))
+            return {};
+
+        if (role != Qt::DisplayRole && role != Qt::EditRole)
+            return {};
+
+        const auto row = static_cast<std::size_t>(index.row());
+        return QString::fromStdString(_rows[row]);
+    }
+
+}   // namespace ui
@@ -5,11 +5,12 @@
 #include <qcompleter.h>
 #include <qlineedit.h>
 #include <qpushbutton.h>
-#include <qstringlistmodel.h>
 
-#include <algorithm>
+#include <utility>
 
+#include "common/container/search_index.hpp"
 #include "common/qt_helpers.hpp"
+#include "ui/transaction/ticker_completer_model.hpp"
 
 using common::makeQChild;
 
@@ -19,14 +20,18 @@ namespace ui
     /**
      * @brief Construct a new Ticker Field:: Ticker Field object
      *
-     * @param tickers A list of ticker symbols to initialize the field with
+     * @param tickers The shared index of available ticker symbols
      * @param parent The parent widget for this field
      */
-    TickerField::TickerField(const Set<std::string>& tickers, QWidget* parent)
+    TickerField::TickerField(
+        std::shared_ptr<const SearchIndex> tickers,
+        QWidget*                           parent
+    )
         : QWidget(parent),
-          _tickers(common::toQStringSet(tickers)),
+          _tickers(std::move(tickers)),
           _lineEdit(makeQChild<QLineEdit>(this)),
           _addButton(makeQChild<QPushButton>("+", this)),
+          _model(makeQChild<TickerCompleterModel>(_tickers, this)),
           _completer(new QCompleter(this))
     {
         auto* layout = makeQChild<QHBoxLayout>();
@@ -40,13 +45,13 @@ namespace ui
         constexpr int buttonSize = 28;
         _addButton->setFixedWidth(buttonSize);
 
+        // the model already holds the matches of the current text, the
+        // completer must not filter them again
+        _completer->setModel(_model);
         _completer->setCaseSensitivity(Qt::CaseInsensitive);
-        _completer->setFilterMode(Qt::MatchContains);
-        _completer->setCompletionMode(QCompleter::PopupCompletion);
+        _completer->setCompletionMode(QCompleter::UnfilteredPopupCompletion);
         _lineEdit->setCompleter(_completer);
 
-        _rebuildCompleter();
-
         connect(
             _lineEdit,
             &QLineEdit::textEdited,
@@ -79,28 +84,19 @@ namespace ui
      */
     std::optional<std::string> TickerField::getTicker() const
     {
-        const auto text = _lineEdit->text().trimmed();
+        auto text = _lineEdit->text().trimmed().toStdString();
 
-        const auto it = std::ranges::find(_tickers, text);
+        if (_tickers == nullptr || !_tickers->contains(text))
+            return std::nullopt;
 
-        return it != _tickers.end() ? std::optional{it->toStdString()}
-                                    : std::nullopt;
+        return text;
     }
 
     /**
-     * @brief Add a new ticker to the field, this will add the given ticker
-     * symbol to the list of available tickers and update the completer,
-     * allowing the user to select this new ticker from the dropdown when they
-     * type in the line edit.
-     *
-     * @param ticker The ticker symbol to add to the field, this should be a
-     * valid ticker symbol that can be used for creating stock transactions.
+     * @brief Refresh the suggestions after the shared ticker index has
+     * changed, the current text is searched again.
      */
-    void TickerField::addTicker(const QString& ticker)
-    {
-        _tickers.insert(ticker);
-        _rebuildCompleter();
-    }
+    void TickerField::refreshTickers() { _model->refresh(); }
 
     /**
      * @brief Handle the text edited event for the line edit, this will check if
@@ -114,6 +110,9 @@ namespace ui
      */
     void TickerField::_onTextEdited(const QString& text)
     {
+        _model->setQuery(text);
+        _completer->complete();
+
         if (text.trimmed().isEmpty())
             return;
 
@@ -140,37 +139,6 @@ namespace ui
         emit tickerSelected(ticker.toStdString());
     }
 
-    /**
-     * @brief Rebuild the completer model based on the current list of tickers,
-     * this will update the dropdown options in the completer to reflect any
-     * changes to the list of available tickers, ensuring that the user always
-     * sees an up-to-date list of tickers when they interact with the line edit.
-     */
-    void TickerField::_rebuildCompleter()
-    {
-        QStringList list;
-        list.reserve(static_cast<qsizetype>(_tickers.size()));
-
-        for (const auto& ticker : _tickers)
-            list.append(ticker);
-
-        _completer->setModel(
-            common::makeQChild<QStringListModel>(list, _completer)
-        );
-    }
-
-    /**
-     * @brief Update the list of tickers in the ticker field
-     *
-     * @param tickers The new list of ticker symbols to populate the ticker
-     * field
-     */
-    void TickerField::updateTickers(const Set<QString>& tickers)
-    {
-        _tickers = tickers;
-        _rebuildCompleter();
-    }
-
     /**
      * @brief Handle the request to create a new ticker
      *
@@ -189,7 +157,7 @@ namespace ui
     void TickerField::selectTicker(const QString& ticker)
     {
         _lineEdit->setText(ticker);
-        _rebuildCompleter();
+        _model->setQuery(ticker);
     }
 
     /**
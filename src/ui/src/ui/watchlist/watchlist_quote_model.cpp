@@ -0,0 +1,312 @@
+#include "ui/watchlist/watchlist_quote_model.hpp"
+
+#include <QTimer>
+#include <algorithm>
+#include <limits>
+#include <utility>
+
+#include "common/percentage.hpp"
+#include "logging/tracer.hpp"
+
+namespace ui
+{
+    namespace
+    {
+        /**
+         * @brief Display a price as a string, formatted with two decimal
+         * places.
+         *
+         * @param price The price to display.
+         * @return QString The formatted price string.
+         */
+        QString displayPrice(const Cash& price)
+        {
+            return QString::fromStdString(price.toString(2));
+        }
+
+        /**
+         * @brief Get the relative change of a quote against its previous
+         * close.
+         *
+         * @param quote
+         * @return Percentage The change, NaN if there is no previous close.
+         */
+        Percentage relativeChange(const WatchlistQuote& quote)
+        {
+            if (quote.previousClose.isZero())
+                return Percentage{std::numeric_limits<double>::quiet_NaN()};
+
+            return Percentage{
+                (quote.lastPrice - quote.previousClose) / quote.previousClose
+            };
+        }
+    }   // namespace
+
+    /**
+     * @brief Construct a new Watchlist Quote Model object
+     *
+     * @param parent The parent QObject (optional).
+     * @param frameInterval The minimum time between two flushes of queued
+     * quotes.
+     */
+    WatchlistQuoteModel::WatchlistQuoteModel(
+        QObject*                  parent,
+        std::chrono::milliseconds frameInterval
+    )
+        : QAbstractTableModel{parent}, _flushTimer(new QTimer(this))
+    {
+        _flushTimer->setSingleShot(true);
+        _flushTimer->setInterval(frameInterval);
+
+        connect(
+            _flushTimer,
+            &QTimer::timeout,
+            this,
+            &WatchlistQuoteModel::flush
+        );
+    }
+
+    /**
+     * @brief Set the symbols of the board, this resets the model, the quotes
+     * of the previous symbols are dropped, including the queued ones.
+     *
+     * @param symbols The symbols in display order.
+     */
+    void WatchlistQuoteModel::setSymbols(const std::vector<std::string>& symbols)
+    {
+        TRACE_SCOPE("UI.Model.WatchlistQuotes.Reset");
+
+        beginResetModel();
+
+        _rows.clear();
+        _rowBySymbol.clear();
+        _pending.clear();
+        _rows.reserve(symbols.size());
+
+        for (const auto& symbol : symbols)
+        {
+            if (_rowBySymbol.emplace(symbol, _rows.size()).second)
+                _rows.push_back(Row{symbol, std::nullopt});
+        }
+
+        endResetModel();
+    }
+
+    /**
+     * @brief Queue quotes for the next flush, a later quote of a symbol
+     * replaces an earlier one that was not flushed yet. The flush happens at
+     * most once per frame interval.
+     *
+     * @param quotes The quotes by symbol, symbols not on the board are
+     * ignored.
+     */
+    void WatchlistQuoteModel::queueQuotes(
+        const std::unordered_map<std::string, WatchlistQuote>& quotes
+    )
+    {
+        for (const auto& [symbol, quote] : quotes)
+        {
+            if (_rowBySymbol.contains(symbol))
+                _pending.insert_or_assign(symbol, quote);
+        }
+
+        if (!_pending.empty() && !_flushTimer->isActive())
+            _flushTimer->start();
+    }
+
+    /**
+     * @brief Apply all queued quotes, a single dataChanged signal is emitted
+     * for the range of rows whose quote changed.
+     *
+     */
+    void WatchlistQuoteModel::flush()
+    {
+        TRACE_SCOPE("UI.Model.WatchlistQuotes.Flush");
+
+        _flushTimer->stop();
+
+        auto firstRow = std::numeric_limits<std::size_t>::max();
+        auto lastRow  = std::size_t{0};
+
+        for (auto& [symbol, quote] : _pending)
+        {
+            const auto found = _rowBySymbol.find(symbol);
+            if (found == _rowBySymbol.end())
+                continue;
+
+            auto& row = _rows[found->second];
+            if (row.quote == quote)
+                continue;
+
+            row.quote = std::move(quote);
+            firstRow  = std::min(firstRow, found->second);
+            lastRow   = std::max(lastRow, found->second);
+        }
+
+        _pending.clear();
+
+        if (firstRow > lastRow)
+            return;
+
+        const int first = static_cast<int>(WatchlistQuoteColumns::LastPrice);
+        const int last  = static_cast<int>(WatchlistQuoteColumns::ChangePct);
+
+        emit dataChanged(
+            index(static_cast<int>(firstRow), first),
+            index(static_cast<int>(lastRow), last),
+            {Qt::DisplayRole}
+        );
+    }
+
+    /**
+     * @brief Checks whether quotes are queued for the next flush
+     *
+     * @return true
+     * @return false
+     */
+    bool WatchlistQuoteModel::hasPendingQuotes() const
+    {
+        return !_pending.empty();
+    }
+
+    /**
+     * @brief Get the applied quote of a row
+     *
+     * @param row
+     * @return std::optional<WatchlistQuote> std::nullopt if the row is out of
+     * range or has no quote yet
+     */
+    std::optional<WatchlistQuote> WatchlistQuoteModel::quoteAt(int row) const
+    {
+        if (row < 0 || row >= rowCount({}))
+            return std::nullopt;
+
+        return _rows[static_cast<std::size_t>(row)].quote;
+    }
+
+    /**
+     * @brief Get the number of rows in the model.
+     *
+     * @param parent The parent index (unused).
+     * @return int The number of rows.
+     */
+    int WatchlistQuoteModel::rowCount(const QModelIndex& parent) const
+    {
+        if (parent.isValid())
+            return 0;
+        return static_cast<int>(_rows.size());
+    }
+
+    /**
+     * @brief Get the number of columns in the model.
+     *
+     * @param parent The parent index (unused).
+     * @return int The number of columns.
+     */
+    int WatchlistQuoteModel::columnCount(const QModelIndex& parent) const
+    {
+        if (parent.isValid())
+            return 0;
+        return static_cast<int>(WatchlistQuoteColumnsMeta::size);
+    }
+
+    /**
+     * @brief Get the data for a specific index and role.
+     *
+     * @param index The model index.
+     * @param role The role for which to retrieve data.
+     * @return QVariant The data for the specified index and role.
+     */
+    QVariant WatchlistQuoteModel::data(const QModelIndex& index, int role) const
+    {
+        if (!index.isValid() || index.row() >= rowCount({}))
+            return {};
+
+        const auto& row = _rows[static_cast<std::size_t>(index.row())];
+        const auto  col = static_cast<WatchlistQuoteColumns>(index.column());
+
+        switch (role)
+        {
+            case Qt::DisplayRole:
+            {
+                if (col == WatchlistQuoteColumns::Symbol)
+                    return QString::fromStdString(row.symbol);
+
+                if (!row.quote)
+                    return QString{"-"};
+
+                const auto& quote = row.quote.value();
+
+                switch (col)
+                {
+                    case WatchlistQuoteColumns::Symbol:
+                        return QString::fromStdString(row.symbol);
+                    case WatchlistQuoteColumns::LastPrice:
+                        return displayPrice(quote.lastPrice);
+                    case WatchlistQuoteColumns::Change:
+                        return displayPrice(
+                            quote.lastPrice - quote.previousClose
+                        );
+                    case WatchlistQuoteColumns::ChangePct:
+                        return QString::fromStdString(
+                            relativeChange(quote).toString()
+                        );
+                }
+                std::unreachable();
+            }
+
+            case Qt::TextAlignmentRole:
+            {
+                if (col == WatchlistQuoteColumns::Symbol)
+                    return static_cast<int>(Qt::AlignLeft | Qt::AlignVCenter);
+
+                return static_cast<int>(Qt::AlignRight | Qt::AlignVCenter);
+            }
+
+            default:
+                return {};
+        }
+    }
+
+    /**
+     * @brief Get the header data for a specific section, orientation, and role.
+     *
+     * @param section The section index.
+     * @param orientation The orientation (horizontal or vertical).
+     * @param role The role for which to retrieve header data.
+     * @return QVariant The header data.
+     */
+    QVariant WatchlistQuoteModel::headerData(
+        int             section,
+        Qt::Orientation orientation,
+        int             role
+    ) const
+    {
+        if (orientation != Qt::Horizontal || role != Qt::DisplayRole)
+            return {};
+        return _columnLabel(section);
+    }
+
+    /**
+     * @brief Get the label for a specific column index
+     *
+     * @param index The column index.
+     * @return QString The label for the specified column index.
+     */
+    QString WatchlistQuoteModel::_columnLabel(int index)
+    {
+        switch (static_cast<WatchlistQuoteColumns>(index))
+        {
+            case WatchlistQuoteColumns::Symbol:
+                return "Symbol";
+            case WatchlistQuoteColumns::LastPrice:
+                return "Last";
+            case WatchlistQuoteColumns::Change:
+                return "Change";
+            case WatchlistQuoteColumns::ChangePct:
+                return "Change %";
+        }
+        return {};
+    }
+
+}   // namespace ui
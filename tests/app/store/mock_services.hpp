@@ -204,6 +204,14 @@ namespace tests
             };
         }
 
+        [[nodiscard]] std::vector<StockId> searchStocks(
+            const std::string& /*text*/,
+            std::size_t /*limit*/
+        ) override
+        {
+            return {};
+        }
+
         [[nodiscard]] bool stockExists(const std::string& ticker) override
         {
             return stocksInDb.contains(ticker);
@@ -253,7 +261,9 @@ namespace tests
     {
        public:
         // NOLINTBEGIN(misc-non-private-member-variables-in-classes)
-        int addCallCount = 0;
+        int                                     addCallCount      = 0;
+        int                                     addBatchCallCount = 0;
+        std::vector<finance::DomainTransaction> addedTransactions;
         // NOLINTEND(misc-non-private-member-variables-in-classes)
 
        private:
@@ -261,19 +271,43 @@ namespace tests
 
        public:
         [[nodiscard]] TransactionId addTransaction(
-            const finance::DomainTransaction& /*transaction*/
+            const finance::DomainTransaction& transaction
         ) override
         {
             addCallCount++;
+            addedTransactions.push_back(transaction);
             return TransactionId{_nextId++};
         }
 
+        [[nodiscard]] std::vector<TransactionId> addTransactions(
+            const std::vector<finance::DomainTransaction>& transactions
+        ) override
+        {
+            addBatchCallCount++;
+
+            std::vector<TransactionId> ids;
+            ids.reserve(transactions.size());
+
+            for (const auto& transaction : transactions)
+                ids.push_back(addTransaction(transaction));
+
+            return ids;
+        }
+
         [[nodiscard]] std::vector<finance::DomainTransaction> getTransactions(
             const finance::TransactionFilter& /*filter*/
         ) override
         {
             return {};
         }
+
+        [[nodiscard]] std::vector<TransactionId> searchTransactions(
+            const std::string& /*text*/,
+            std::size_t /*limit*/
+        ) override
+        {
+            return {};
+        }
     };
 
     class MockWatchlistService : public service::IWatchlistService
@@ -333,6 +367,24 @@ namespace tests
             }
         }
 
+        void addSymbols(
+            WatchlistId                     id,
+            const std::vector<std::string>& symbols
+        ) override
+        {
+            for (const auto& symbol : symbols)
+                addSymbol(id, symbol);
+        }
+
+        void removeSymbols(
+            WatchlistId                     id,
+            const std::vector<std::string>& symbols
+        ) override
+        {
+            for (const auto& symbol : symbols)
+                removeSymbol(id, symbol);
+        }
+
         void removeSymbol(WatchlistId id, const std::string& symbol) override
         {
             for (auto& watchlist : preloadedWatchlists)
@@ -173,6 +173,36 @@ TEST_F(AccountStoreTest, CreateCashAccountAlsoCreatesExternalAccount)
     );
 }
 
+TEST_F(AccountStoreTest, CashAccountResolvesExternalAccountOfItsCurrency)
+{
+    setActiveProfile();
+    static_cast<void>(_store->createAccount(
+        makeAccount("EurCash", AccountKind::Cash, Currency::EUR)
+    ));
+    static_cast<void>(_store->createAccount(
+        makeAccount("UsdCash", AccountKind::Cash, Currency::USD)
+    ));
+
+    const auto& session = _store->getAccountSession();
+
+    for (const auto& cashAccount : _store->getCashAccounts())
+    {
+        const auto externalId = session.getCorrespondingExternalAccountId(
+            cashAccount.getId()
+        );
+
+        EXPECT_EQ(
+            externalId,
+            _store->getExternalAccount(cashAccount.getCurrency())
+        );
+    }
+
+    const auto nonCashId = session.getCorrespondingExternalAccountId(
+        _store->getExternalAccount(Currency::EUR).value()
+    );
+    EXPECT_FALSE(nonCashId.isValid());
+}
+
 TEST_F(AccountStoreTest, IsDirtyFalseInitially)
 {
     EXPECT_FALSE(_store->isDirty());
@@ -93,3 +93,36 @@ TEST_F(PositionStoreTest, CreateMultiplePositionsIdsAreDistinct)
 
     EXPECT_NE(id1, id2);
 }
+
+TEST_F(PositionStoreTest, VersionChangesOnMutationOnly)
+{
+    const auto initial = _store->getVersion();
+
+    static_cast<void>(_store->getAllPositions());
+    EXPECT_EQ(_store->getVersion(), initial);
+
+    static_cast<void>(
+        _store->createPosition(finance::Position{Timestamp::fromInt64(TEST_TS)})
+    );
+    const auto afterCreate = _store->getVersion();
+    EXPECT_GT(afterCreate, initial);
+
+    _store->commit();
+    EXPECT_GT(_store->getVersion(), afterCreate);
+}
+
+TEST_F(PositionStoreTest, CommitAfterIdRemapOnlyPersistsNewPositions)
+{
+    static_cast<void>(
+        _store->createPosition(finance::Position{Timestamp::fromInt64(TEST_TS)})
+    );
+    _store->commit();
+
+    static_cast<void>(_store->createPosition(
+        finance::Position{Timestamp::fromInt64(TEST_TS + 1)}
+    ));
+    _store->commit();
+
+    EXPECT_FALSE(_store->isDirty());
+    EXPECT_EQ(_mockService->createCallCount, 2);
+}
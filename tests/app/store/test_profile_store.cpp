@@ -144,6 +144,51 @@ TEST_F(ProfileStoreTest, CommitDeletedProfileCallsServiceRemove)
     EXPECT_EQ(_mockService->removeCallCount, 1);
 }
 
+TEST_F(ProfileStoreTest, RemoveProfileKeepsRemainingProfilesReachable)
+{
+    for (const auto* name : {"Alice", "Bob", "Carol"})
+    {
+        static_cast<void>(_store->addProfile(
+            domain::Profile{ProfileId::invalid(), name, std::nullopt}
+        ));
+    }
+
+    ASSERT_EQ(
+        _store->removeProfile(
+            domain::Profile{ProfileId::invalid(), "Alice", std::nullopt}
+        ),
+        store::ProfileStoreResult::Ok
+    );
+    EXPECT_EQ(
+        _store->removeProfile(
+            domain::Profile{ProfileId::invalid(), "Carol", std::nullopt}
+        ),
+        store::ProfileStoreResult::Ok
+    );
+
+    const auto names = _store->getAllProfileNames();
+
+    ASSERT_EQ(names.size(), 1U);
+    EXPECT_EQ(names.front(), "Bob");
+}
+
+TEST_F(ProfileStoreTest, CommitDeletedProfileKeepsFollowingNewProfile)
+{
+    _mockService->addTestProfile("Alice");
+    rebuildStore();
+    static_cast<void>(_store->removeProfile(
+        domain::Profile{ProfileId::invalid(), "Alice", std::nullopt}
+    ));
+    static_cast<void>(_store->addProfile(
+        domain::Profile{ProfileId::invalid(), "Bob", std::nullopt}
+    ));
+
+    _store->commit();
+
+    EXPECT_EQ(_mockService->removeCallCount, 1);
+    EXPECT_EQ(_mockService->createCallCount, 1);
+}
+
 TEST_F(ProfileStoreTest, LoadsProfilesFromServiceOnConstruction)
 {
     _mockService->addTestProfile("Alice");
@@ -1,8 +1,10 @@
 #include <gtest/gtest.h>
 
+#include <future>
 #include <memory>
 #include <optional>
 #include <string>
+#include <vector>
 
 #include "common/finance.hpp"
 #include "config/id_types.hpp"
@@ -133,3 +135,66 @@ TEST_F(StockStoreTest, IsDirtyTrueAfterAddStock)
 
     EXPECT_TRUE(_store->isDirty());
 }
+
+TEST_F(StockStoreTest, PartiallyLoadedStoreHydratesOnFirstAccess)
+{
+    std::promise<std::vector<finance::Stock>> hydration;
+
+    const auto store = std::make_unique<store::StockStore>(
+        _mockService,
+        _idSeq,
+        hydration.get_future()
+    );
+
+    EXPECT_FALSE(store->isHydrated());
+
+    auto stock = makeStock("AAPL");
+    stock.setId(StockId{1});
+    stock.setInstrumentId(InstrumentId{1});
+    hydration.set_value({stock});
+
+    const auto tickers = store->getAllTickers();
+
+    ASSERT_EQ(tickers.size(), 1U);
+    EXPECT_EQ(tickers.front(), "AAPL");
+    EXPECT_TRUE(store->isHydrated());
+    EXPECT_FALSE(store->isDirty());
+}
+
+TEST_F(StockStoreTest, AddStockWhilePartiallyLoadedDetectsHydratedDuplicate)
+{
+    std::promise<std::vector<finance::Stock>> hydration;
+
+    const auto store = std::make_unique<store::StockStore>(
+        _mockService,
+        _idSeq,
+        hydration.get_future()
+    );
+
+    auto stock = makeStock("AAPL");
+    stock.setId(StockId{1});
+    stock.setInstrumentId(InstrumentId{1});
+    hydration.set_value({stock});
+
+    const auto result = store->addStock(makeStock("AAPL"));
+
+    EXPECT_EQ(result, store::StockStoreResult::StockAlreadyExists);
+    EXPECT_FALSE(store->isDirty());
+}
+
+TEST_F(StockStoreTest, DiscardHydrationDropsPendingEntries)
+{
+    std::promise<std::vector<finance::Stock>> hydration;
+
+    const auto store = std::make_unique<store::StockStore>(
+        _mockService,
+        _idSeq,
+        hydration.get_future()
+    );
+
+    hydration.set_value({makeStock("AAPL")});
+    store->discardHydration();
+
+    EXPECT_TRUE(store->isHydrated());
+    EXPECT_TRUE(store->getAllTickers().empty());
+}
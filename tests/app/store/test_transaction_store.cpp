@@ -1,14 +1,19 @@
 #include <gtest/gtest.h>
 
+#include <cstddef>
 #include <cstdint>
 #include <memory>
+#include <vector>
 
 #include "common/cash.hpp"
+#include "common/container/id_id_map.hpp"
 #include "common/finance.hpp"
 #include "common/quantity.hpp"
 #include "common/timestamp.hpp"
 #include "config/id_types.hpp"
 #include "finance/transaction/domain_transaction.hpp"
+#include "finance/transaction/stock_data.hpp"
+#include "finance/transaction/trade_leg.hpp"
 #include "finance/transaction/transaction_entry.hpp"
 #include "finance/transaction/transaction_filter.hpp"
 #include "finance/transaction/transactions.hpp"
@@ -145,3 +150,126 @@ namespace
 
 //     EXPECT_EQ(_mockTransactionService->addCallCount, 2);
 // }
+
+TEST_F(TransactionStoreTest, CommitRemapsIdsOfNewTransactions)
+{
+    const AccountId    tempAccount{-1};
+    const InstrumentId tempInstrument{-2};
+    const PositionId   tempPosition{-3};
+    const AccountId    cashAccount{5};
+    const auto         amount = Cash{Currency::USD, micro_units{1'000'000}};
+
+    finance::TradeLegs legs;
+    legs.add(
+        finance::TradeLeg{
+            tempAccount,
+            tempInstrument,
+            Quantity{Quantity::factor},
+            amount,
+            tempPosition
+        }
+    );
+
+    const finance::DomainTransaction remapped{
+        TransactionId::invalid(),
+        Timestamp::fromInt64(TEST_TS),
+        TransactionStatus::Completed,
+        finance::StockData{legs},
+        finance::TransactionEntries{
+            {finance::TransactionEntry{
+                 TransactionEntryId::invalid(),
+                 tempAccount,
+                 amount,
+                 TransactionEntryType::General
+             },
+             finance::TransactionEntry{
+                 TransactionEntryId::invalid(),
+                 cashAccount,
+                 -amount,
+                 TransactionEntryType::General
+             }}
+        },
+        std::nullopt
+    };
+
+    ASSERT_EQ(
+        _store->addTransactions({remapped, makeNonZeroSumTx()}),
+        store::TransactionStoreResult::Ok
+    );
+
+    IdIdMap<AccountId>    accountIdRemap;
+    IdIdMap<InstrumentId> instrumentIdRemap;
+    IdIdMap<PositionId>   positionIdRemap;
+    accountIdRemap[tempAccount]       = AccountId{10};
+    instrumentIdRemap[tempInstrument] = InstrumentId{20};
+    positionIdRemap[tempPosition]     = PositionId{30};
+
+    _store->commit(accountIdRemap, instrumentIdRemap, positionIdRemap);
+
+    const auto& added = _mockTransactionService->addedTransactions;
+    ASSERT_EQ(added.size(), 2U);
+
+    const auto& stock = added[0];
+    ASSERT_EQ(stock.getLegs().size(), 1U);
+
+    const auto& leg = stock.getLegs()[0];
+    EXPECT_EQ(leg.getAccountId(), AccountId{10});
+    EXPECT_EQ(leg.getInstrumentId(), InstrumentId{20});
+    EXPECT_EQ(leg.getPositionId(), PositionId{30});
+    EXPECT_EQ(stock.getPositionId(), PositionId{30});
+
+    const auto& entries = stock.getEntries();
+    ASSERT_EQ(entries.size(), 2U);
+    EXPECT_EQ(entries[0].getAccountId(), AccountId{10});
+    EXPECT_EQ(entries[1].getAccountId(), cashAccount);
+
+    // transactions without a remapped id are persisted unchanged
+    EXPECT_EQ(added[1].getEntries()[0].getAccountId(), AccountId{1});
+}
+
+TEST_F(TransactionStoreTest, AddTransactionsNotifiesOnceForBatch)
+{
+    int         notifications = 0;
+    std::size_t notified      = 0;
+
+    const auto connection = _store->subscribeToEntryAdded(
+        [&](const std::vector<finance::DomainTransaction>& transactions)
+        {
+            ++notifications;
+            notified = transactions.size();
+        },
+        this
+    );
+
+    ASSERT_EQ(
+        _store->addTransactions(
+            {makeNonZeroSumTx(), makeNonZeroSumTx(), makeNonZeroSumTx()}
+        ),
+        store::TransactionStoreResult::Ok
+    );
+
+    EXPECT_EQ(notifications, 1);
+    EXPECT_EQ(notified, 3U);
+
+    // an empty batch neither notifies nor dirties the store
+    ASSERT_EQ(_store->addTransactions({}), store::TransactionStoreResult::Ok);
+    EXPECT_EQ(notifications, 1);
+}
+
+TEST_F(TransactionStoreTest, CommitPersistsNewTransactionsAsOneBatch)
+{
+    ASSERT_EQ(
+        _store->addTransactions({makeNonZeroSumTx(), makeNonZeroSumTx()}),
+        store::TransactionStoreResult::Ok
+    );
+
+    _store->commit({}, {}, {});
+
+    EXPECT_EQ(_mockTransactionService->addBatchCallCount, 1);
+    EXPECT_EQ(_mockTransactionService->addedTransactions.size(), 2U);
+
+    // nothing new, the service is not called again
+    _store->commit({}, {}, {});
+
+    EXPECT_EQ(_mockTransactionService->addBatchCallCount, 1);
+}
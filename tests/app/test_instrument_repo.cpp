@@ -316,3 +316,34 @@ TEST_F(InstrumentRepoTest, GetStocksBySymbolsUnknownSymbolIsIgnored)
     ASSERT_EQ(stocks.size(), 1U);
     EXPECT_EQ(stocks[0].getTicker(), "AAPL");
 }
+
+// ---------------------------------------------------------------------------
+// searchStocks — FTS5 index over ticker and names
+// ---------------------------------------------------------------------------
+
+TEST_F(InstrumentRepoTest, SearchStocksMatchesTickerAndNames)
+{
+    const auto apple = _repo.addStock(makeStock("AAPL")).stockId;
+    const auto msft  = _repo.addStock(
+        finance::Stock{
+            "MSFT",
+            Currency::USD,
+            "Microsoft",
+            "Microsoft Corporation",
+            "NASDAQ",
+            "Software",
+            "Technology",
+            AssetClass::Stock
+        }
+    ).stockId;
+
+    EXPECT_EQ(_repo.searchStocks("aap", 10), std::vector{apple});
+    EXPECT_EQ(_repo.searchStocks("micro corp", 10), std::vector{msft});
+    EXPECT_EQ(_repo.searchStocks("appl", 10), std::vector{apple});
+    EXPECT_TRUE(_repo.searchStocks("google", 10).empty());
+
+    // makeStock names every stock "Apple"
+    static_cast<void>(_repo.addStock(makeStock("GOOG")));
+    EXPECT_EQ(_repo.searchStocks("apple", 10).size(), 2U);
+    EXPECT_EQ(_repo.searchStocks("apple", 1).size(), 1U);
+}
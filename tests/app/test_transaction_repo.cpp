@@ -11,6 +11,8 @@
 //  - addTransaction() preserves a NULL comment
 //  - addTransaction() round-trips a Trade transaction with legs
 //  - addTransaction() persists multiple independent transactions
+//  - addTransactions() persists a batch and returns the IDs in order
+//  - searchTransactions() matches comment prefixes, ignores FTS5 syntax
 //
 // Each test uses its own temp SQLite database for full isolation.
 // Prerequisite rows (profile, account, instrument) are inserted via raw SQL
@@ -350,6 +352,33 @@ TEST_F(
     EXPECT_EQ(txs.size(), 3U);
 }
 
+// ---------------------------------------------------------------------------
+// addTransactions — batch insert
+// ---------------------------------------------------------------------------
+
+TEST_F(TransactionRepoFixture, AddTransactionsBatchAllAreRetrievedInOrder)
+{
+    const auto ids = _repo.addTransactions(
+        {makeCashTx("first"), makeTradeTx(), makeCashTx("third")}
+    );
+
+    ASSERT_EQ(ids.size(), 3U);
+    EXPECT_LT(ids[0].value(), ids[1].value());
+    EXPECT_LT(ids[1].value(), ids[2].value());
+
+    finance::TransactionFilter filter;
+    filter.accountIds.insert(_accountId);
+
+    const auto txs = _repo.getTransactions(filter);
+
+    EXPECT_EQ(txs.size(), 3U);
+}
+
+TEST_F(TransactionRepoFixture, AddTransactionsEmptyBatchReturnsNoIds)
+{
+    EXPECT_TRUE(_repo.addTransactions({}).empty());
+}
+
 // ---------------------------------------------------------------------------
 // addTransaction — Trade round-trip
 // ---------------------------------------------------------------------------
@@ -406,3 +435,28 @@ TEST_F(
     const auto& data = std::get<finance::StockData>(txs[0].getData());
     EXPECT_EQ(data.getLegs().size(), 1U);
 }
+
+// ---------------------------------------------------------------------------
+// searchTransactions — FTS5 index over the comments
+// ---------------------------------------------------------------------------
+
+TEST_F(TransactionRepoFixture, SearchTransactionsMatchesCommentWordPrefixes)
+{
+    const auto rent   = _repo.addTransaction(makeCashTx("Monthly rent"));
+    const auto salary = _repo.addTransaction(makeCashTx("salary March"));
+    const auto none   = _repo.addTransaction(makeCashTx(std::nullopt));
+
+    EXPECT_EQ(_repo.searchTransactions("ren", 10), std::vector{rent});
+    EXPECT_EQ(_repo.searchTransactions("SAL mar", 10), std::vector{salary});
+    EXPECT_TRUE(_repo.searchTransactions("rent salary", 10).empty());
+    EXPECT_TRUE(_repo.searchTransactions("   ", 10).empty());
+    static_cast<void>(none);
+}
+
+TEST_F(TransactionRepoFixture, SearchTransactionsTreatsOperatorsAsText)
+{
+    const auto quoted = _repo.addTransaction(makeCashTx(R"(say "hi" OR)"));
+
+    EXPECT_EQ(_repo.searchTransactions(R"("hi" OR)", 10), std::vector{quoted});
+    EXPECT_TRUE(_repo.searchTransactions("comment:hi", 10).empty());
+}
@@ -1,4 +1,5 @@
 #include <gtest/gtest.h>
+#include <sqlite3.h>
 
 #include <string>
 #include <vector>
@@ -189,3 +190,108 @@ TEST_F(WatchlistRepoTest, DeleteWatchlistCascadesToInstruments)
 
     EXPECT_TRUE(remainingRows.empty());
 }
+
+TEST_F(WatchlistRepoTest, GetAllWatchlistsGroupsSymbolsByWatchlist)
+{
+    const auto id1 = _repo.createWatchlist("Tech Stocks");
+    const auto id2 = _repo.createWatchlist("Dividend Plays");
+    const auto id3 = _repo.createWatchlist("Empty");
+
+    _repo.addSymbol(id1, "AAPL");
+    _repo.addSymbol(id2, "KO");
+    _repo.addSymbol(id1, "MSFT");
+
+    const auto watchlists = _repo.getAllWatchlists();
+    ASSERT_EQ(watchlists.size(), 3U);
+
+    for (const auto& watchlist : watchlists)
+    {
+        if (watchlist.getId() == id1)
+        {
+            EXPECT_EQ(
+                watchlist.getSymbols(),
+                (std::vector<std::string>{"AAPL", "MSFT"})
+            );
+        }
+        else if (watchlist.getId() == id2)
+        {
+            EXPECT_EQ(watchlist.getSymbols(), std::vector<std::string>{"KO"});
+        }
+        else
+        {
+            EXPECT_EQ(watchlist.getId(), id3);
+            EXPECT_TRUE(watchlist.getSymbols().empty());
+        }
+    }
+}
+
+TEST_F(WatchlistRepoTest, AddSymbolsPersistsAllInOrder)
+{
+    const auto id = _repo.createWatchlist("Tech Stocks");
+
+    const std::vector<std::string> symbols{"AAPL", "MSFT", "NVDA"};
+    _repo.addSymbols(id, symbols);
+
+    const auto watchlists = _repo.getAllWatchlists();
+    ASSERT_EQ(watchlists.size(), 1U);
+    EXPECT_EQ(watchlists[0].getSymbols(), symbols);
+}
+
+TEST_F(WatchlistRepoTest, AddSymbolsWithDuplicateAddsNone)
+{
+    const auto id = _repo.createWatchlist("Tech Stocks");
+    _repo.addSymbol(id, "MSFT");
+
+    EXPECT_THROW(
+        _repo.addSymbols(id, {"AAPL", "MSFT", "NVDA"}),
+        orm::CrudException
+    );
+
+    const auto watchlists = _repo.getAllWatchlists();
+    ASSERT_EQ(watchlists.size(), 1U);
+    EXPECT_EQ(watchlists[0].getSymbols(), std::vector<std::string>{"MSFT"});
+}
+
+TEST_F(WatchlistRepoTest, RemoveSymbolsDeletesOnlyGivenSymbols)
+{
+    const auto id1 = _repo.createWatchlist("Tech Stocks");
+    const auto id2 = _repo.createWatchlist("Dividend Plays");
+    _repo.addSymbols(id1, {"AAPL", "MSFT", "NVDA"});
+    _repo.addSymbols(id2, {"AAPL", "KO"});
+
+    _repo.removeSymbols(id1, {"AAPL", "NVDA", "GOOG"});
+
+    for (const auto& watchlist : _repo.getAllWatchlists())
+    {
+        if (watchlist.getId() == id1)
+        {
+            EXPECT_EQ(
+                watchlist.getSymbols(),
+                std::vector<std::string>{"MSFT"}
+            );
+        }
+        else
+        {
+            EXPECT_EQ(
+                watchlist.getSymbols(),
+                (std::vector<std::string>{"AAPL", "KO"})
+            );
+        }
+    }
+}
+
+TEST_F(WatchlistRepoTest, RemoveSymbolsSplitsBatchesAtVariableLimit)
+{
+    // the watchlist id and three symbols per statement
+    sqlite3_limit(_db.nativeHandle(), SQLITE_LIMIT_VARIABLE_NUMBER, 4);
+
+    const auto id = _repo.createWatchlist("Tech Stocks");
+    for (const auto* symbol : {"A", "B", "C", "D", "E", "F", "G", "H"})
+        _repo.addSymbol(id, symbol);
+
+    _repo.removeSymbols(id, {"A", "B", "C", "D", "E", "F", "G"});
+
+    const auto watchlists = _repo.getAllWatchlists();
+    ASSERT_EQ(watchlists.size(), 1U);
+    EXPECT_EQ(watchlists[0].getSymbols(), std::vector<std::string>{"H"});
+}
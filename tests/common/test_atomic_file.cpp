@@ -0,0 +1,53 @@
+// tests/common/test_atomic_file.cpp
+//
+// GoogleTest-based tests for common::writeFileAtomically.
+//
+// Coverage:
+//  - a new file is created with the given content
+//  - an existing file is replaced and no temporary file is left behind
+//  - writing fails for a missing directory and creates no file
+
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <string>
+
+#include "common/atomic_file.hpp"
+#include "test_fixtures.hpp"
+
+namespace
+{
+    using tests::TempDir;
+    using tests::readFile;
+}   // namespace
+
+TEST(AtomicFile, CreatesFile)
+{
+    const TempDir tmp;
+    const auto    file = tmp.path() / "cache.json";
+
+    ASSERT_TRUE(common::writeFileAtomically(file, "[]"));
+
+    EXPECT_EQ(readFile(file), "[]");
+}
+
+TEST(AtomicFile, ReplacesFile)
+{
+    const TempDir tmp;
+    const auto    file = tmp.path() / "settings.json";
+
+    ASSERT_TRUE(common::writeFileAtomically(file, "old"));
+    ASSERT_TRUE(common::writeFileAtomically(file, "new"));
+
+    EXPECT_EQ(readFile(file), "new");
+    EXPECT_FALSE(std::filesystem::exists(tmp.path() / "settings.json.tmp"));
+}
+
+TEST(AtomicFile, FailsForMissingDirectory)
+{
+    const TempDir tmp;
+    const auto    file = tmp.path() / "missing" / "settings.json";
+
+    EXPECT_FALSE(common::writeFileAtomically(file, "content"));
+    EXPECT_FALSE(std::filesystem::exists(file));
+}
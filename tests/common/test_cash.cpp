@@ -0,0 +1,81 @@
+// tests/common/test_cash.cpp
+//
+// GoogleTest-based tests for Cash and Quantity arithmetic.
+//
+// Coverage:
+//  - Quantity and Cash arithmetic is usable in constant expressions
+//  - mulDiv keeps 128 bit precision for the intermediate product
+//  - an amount without currency adopts the currency of the other operand
+//  - operations on different currencies throw
+//  - division by a zero quantity throws
+
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+#include <tuple>
+
+#include "common/cash.hpp"
+#include "common/quantity.hpp"
+
+namespace
+{
+    constexpr Quantity shares(micro_units count)
+    {
+        return Quantity{count * Quantity::factor};
+    }
+
+    constexpr Cash usd(micro_units amount)
+    {
+        return Cash{Currency::USD, amount};
+    }
+}   // namespace
+
+TEST(CommonCash, ArithmeticIsConstexpr)
+{
+    static_assert((shares(2) + shares(3)) == shares(5));
+    static_assert((shares(2) - shares(3)).abs() == shares(1));
+    static_assert((usd(1'500'000) * shares(2)).getAmount() == 3'000'000);
+    static_assert((usd(3'000'000) / shares(2)).getAmount() == 1'500'000);
+    static_assert((usd(1) + usd(2) - usd(4)).isNegative());
+    static_assert(Cash::max(usd(1), usd(2)) == usd(2));
+    static_assert((Cash{} + usd(5)).getCurrency() == Currency::USD);
+
+    SUCCEED();
+}
+
+TEST(CommonCash, MulDivKeepsIntermediatePrecision)
+{
+    constexpr micro_units large = 4'000'000'000'000;
+
+    EXPECT_EQ(mulDiv(large, large, large), large);
+    EXPECT_EQ(mulDiv(large, shares(3)), 3 * large);
+}
+
+TEST(CommonCash, UnknownCurrencyAdoptsOtherCurrency)
+{
+    Cash total;
+    total += usd(10);
+
+    EXPECT_EQ(total.getCurrency(), Currency::USD);
+    EXPECT_EQ(total.getAmount(), 10);
+
+    total -= Cash{Currency::Unknown, 4};
+    EXPECT_EQ(total.getCurrency(), Currency::USD);
+    EXPECT_EQ(total.getAmount(), 6);
+}
+
+#ifndef MOLARTRACKER_UNCHECKED_CASH
+TEST(CommonCash, DifferentCurrenciesThrow)
+{
+    const Cash eur{Currency::EUR, 1};
+
+    EXPECT_ANY_THROW(std::ignore = usd(1) + eur);
+    EXPECT_ANY_THROW(std::ignore = usd(1) < eur);
+    EXPECT_ANY_THROW(std::ignore = Cash::min(usd(1), eur));
+}
+#endif
+
+TEST(CommonCash, DivisionByZeroQuantityThrows)
+{
+    EXPECT_THROW(std::ignore = usd(1) / Quantity{}, std::domain_error);
+}
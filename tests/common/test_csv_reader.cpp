@@ -0,0 +1,119 @@
+// tests/common/test_csv_reader.cpp
+//
+// GoogleTest-based tests for CsvReader and MappedFile.
+//
+// Coverage:
+//  - plain rows are split at the delimiter, empty fields are kept
+//  - quoted fields may contain delimiters, line breaks and escaped quotes
+//  - CRLF line endings, empty lines and a byte order mark are handled
+//  - line numbers and consumed bytes are reported
+//  - a mapped file exposes the file contents, an empty file maps to nothing
+
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <vector>
+
+#include "common/csv_reader.hpp"
+#include "common/mapped_file.hpp"
+
+namespace
+{
+    using Fields = std::vector<std::string_view>;
+
+    Fields readRow(CsvReader& reader)
+    {
+        Fields fields;
+        EXPECT_TRUE(reader.next(fields));
+        return fields;
+    }
+}   // namespace
+
+TEST(CsvReader, SplitsRowsAtDelimiter)
+{
+    CsvReader reader{"a,b,c\n1,,3\n"};
+
+    EXPECT_EQ(readRow(reader), (Fields{"a", "b", "c"}));
+    EXPECT_EQ(readRow(reader), (Fields{"1", "", "3"}));
+
+    Fields fields;
+    EXPECT_FALSE(reader.next(fields));
+    EXPECT_TRUE(fields.empty());
+}
+
+TEST(CsvReader, KeepsTrailingEmptyField)
+{
+    CsvReader reader{"a;b;", ';'};
+
+    EXPECT_EQ(reader.getSize(), 4);
+    EXPECT_EQ(readRow(reader), (Fields{"a", "b", ""}));
+    EXPECT_EQ(reader.getOffset(), 4);
+}
+
+TEST(CsvReader, QuotedFields)
+{
+    CsvReader reader{"\"a,b\",\"say \"\"hi\"\"\",\"x\ny\"\nnext\n"};
+
+    EXPECT_EQ(readRow(reader), (Fields{"a,b", "say \"hi\"", "x\ny"}));
+    EXPECT_EQ(reader.getLine(), 1);
+
+    EXPECT_EQ(readRow(reader), (Fields{"next"}));
+    EXPECT_EQ(reader.getLine(), 3);
+}
+
+TEST(CsvReader, CrlfEmptyLinesAndByteOrderMark)
+{
+    CsvReader reader{"\xEF\xBB\xBFh1,h2\r\n\r\n\r\nv1,v2\r\n"};
+
+    EXPECT_EQ(readRow(reader), (Fields{"h1", "h2"}));
+    EXPECT_EQ(readRow(reader), (Fields{"v1", "v2"}));
+    EXPECT_EQ(reader.getLine(), 4);
+
+    Fields fields;
+    EXPECT_FALSE(reader.next(fields));
+}
+
+TEST(CsvReader, Trim)
+{
+    EXPECT_EQ(CsvReader::trim("  a b\t"), "a b");
+    EXPECT_EQ(CsvReader::trim(" \t "), "");
+    EXPECT_EQ(CsvReader::trim(""), "");
+}
+
+TEST(MappedFile, ViewsFileContents)
+{
+    const auto path =
+        std::filesystem::temp_directory_path() / "test_mapped_file.csv";
+
+    {
+        std::ofstream file{path, std::ios::binary};
+        file << "a,b\n1,2\n";
+    }
+
+    MappedFile mapped{path};
+    EXPECT_EQ(mapped.view(), "a,b\n1,2\n");
+    EXPECT_EQ(mapped.size(), 8);
+
+    const MappedFile moved{std::move(mapped)};
+    EXPECT_EQ(moved.view(), "a,b\n1,2\n");
+    EXPECT_TRUE(mapped.view().empty());   // NOLINT(bugprone-use-after-move)
+
+    std::ofstream{path, std::ios::trunc};
+    const MappedFile empty{path};
+    EXPECT_TRUE(empty.empty());
+    EXPECT_TRUE(empty.view().empty());
+
+    std::filesystem::remove(path);
+}
+
+TEST(MappedFile, ThrowsForMissingFile)
+{
+    EXPECT_THROW(
+        MappedFile{std::filesystem::path{"/nonexistent/file.csv"}},
+        std::system_error
+    );
+}
@@ -0,0 +1,57 @@
+// tests/common/test_index_view.cpp
+//
+// GoogleTest-based tests for IndexView.
+//
+// Coverage:
+//  - items are selected and iterated in the order of the index list
+//  - the view refers to the storage instead of copying it
+//  - an empty index list yields an empty view
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "common/container/index_view.hpp"
+
+TEST(IndexView, IteratesInIndexOrder)
+{
+    const std::vector<std::string> items{"a", "b", "c", "d"};
+    const std::vector<std::size_t> indices{3, 0, 2};
+
+    const IndexView<std::string> view{items, indices};
+
+    EXPECT_EQ(view.size(), 3U);
+    EXPECT_EQ(view.front(), "d");
+    EXPECT_EQ(view[1], "a");
+
+    std::vector<std::string> visited;
+    for (const auto& item : view)
+        visited.push_back(item);
+
+    EXPECT_EQ(visited, (std::vector<std::string>{"d", "a", "c"}));
+}
+
+TEST(IndexView, RefersToTheStorage)
+{
+    std::vector<int>               items{1, 2, 3};
+    const std::vector<std::size_t> indices{1};
+
+    const IndexView<int> view{items, indices};
+    items[1] = 42;
+
+    EXPECT_EQ(&view.front(), &items[1]);
+    EXPECT_EQ(view.front(), 42);
+}
+
+TEST(IndexView, EmptyIndexListIsEmpty)
+{
+    const std::vector<int>         items{1, 2, 3};
+    const std::vector<std::size_t> indices;
+
+    const IndexView<int> view{items, indices};
+
+    EXPECT_TRUE(view.empty());
+    EXPECT_EQ(view.begin(), view.end());
+}
@@ -0,0 +1,86 @@
+// tests/common/test_ring_buffer.cpp
+//
+// GoogleTest-based tests for RingBuffer.
+//
+// Coverage:
+//  - a zero capacity is rejected
+//  - items are kept in insertion order until the buffer is full
+//  - once full the oldest item is overwritten
+//  - iteration and toVector run from the oldest to the newest item
+//  - clear empties the buffer but keeps its capacity
+
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "common/container/ring_buffer.hpp"
+
+TEST(RingBuffer, ZeroCapacityThrows)
+{
+    EXPECT_THROW(RingBuffer<int>{0}, std::invalid_argument);
+}
+
+TEST(RingBuffer, KeepsInsertionOrderUntilFull)
+{
+    RingBuffer<int> buffer{3};
+    EXPECT_TRUE(buffer.empty());
+
+    buffer.push(1);
+    buffer.push(2);
+
+    EXPECT_EQ(buffer.size(), 2U);
+    EXPECT_FALSE(buffer.full());
+    EXPECT_EQ(buffer.front(), 1);
+    EXPECT_EQ(buffer.back(), 2);
+}
+
+TEST(RingBuffer, OverwritesOldestItemWhenFull)
+{
+    RingBuffer<int> buffer{3};
+    for (int i = 1; i <= 5; ++i)
+        buffer.push(i);
+
+    EXPECT_TRUE(buffer.full());
+    EXPECT_EQ(buffer.size(), 3U);
+    EXPECT_EQ(buffer.capacity(), 3U);
+    EXPECT_EQ(buffer[0], 3);
+    EXPECT_EQ(buffer[2], 5);
+    EXPECT_EQ(buffer.front(), 3);
+    EXPECT_EQ(buffer.back(), 5);
+}
+
+TEST(RingBuffer, IteratesFromOldestToNewest)
+{
+    RingBuffer<std::string> buffer{2};
+    buffer.push("a");
+    buffer.push("b");
+    buffer.push("c");
+
+    std::vector<std::string> iterated;
+    for (const auto& item : buffer)
+        iterated.push_back(item);
+
+    const std::vector<std::string> expected{"b", "c"};
+    EXPECT_EQ(iterated, expected);
+    EXPECT_EQ(buffer.toVector(), expected);
+    EXPECT_EQ(buffer.end() - buffer.begin(), 2);
+}
+
+TEST(RingBuffer, ClearKeepsCapacity)
+{
+    RingBuffer<int> buffer{2};
+    buffer.push(1);
+    buffer.push(2);
+    buffer.push(3);
+
+    buffer.clear();
+
+    EXPECT_TRUE(buffer.empty());
+    EXPECT_EQ(buffer.capacity(), 2U);
+
+    buffer.push(4);
+    EXPECT_EQ(buffer.front(), 4);
+    EXPECT_EQ(buffer.toVector(), std::vector<int>{4});
+}
@@ -0,0 +1,173 @@
+// tests/common/test_ring_file.cpp
+//
+// GoogleTest-based tests for the Fd backend of RingFile.
+//
+// Coverage:
+//  - lines are buffered until an explicit flush
+//  - a write exceeding the buffer writes buffer and text out together
+//  - the flusher thread writes buffered lines out after the flush interval
+//  - buffered lines are written out on destruction
+//  - rotation shifts the current file into the numbered files
+//  - with a single file, rotation truncates the current file in place
+//  - rotated files of a previous run are shifted on the first rotation
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <thread>
+
+#include "common/ring_file.hpp"
+#include "common/ring_file_config.hpp"
+#include "test_fixtures.hpp"
+
+namespace
+{
+    using tests::TempDir;
+    using tests::readFile;
+
+    using namespace std::chrono_literals;
+
+    RingFileConfig makeConfig(const std::filesystem::path& directory)
+    {
+        RingFileConfig config;
+        config.directory = directory;
+        config.backend   = RingFileBackend::Fd;
+        config.maxFiles  = 3;
+        config.maxSizeMB = 1;
+        return config;
+    }
+
+    /// Writes lines of 1 KiB until more than one megabyte was written
+    void writeMegabyte(RingFile& ringFile, char fill)
+    {
+        const std::string line(1023, fill);
+        const std::size_t lines = RingFileConfig::MBtoBytes / 1024 + 1;
+
+        for (std::size_t i = 0; i < lines; ++i)
+            ringFile.writeLine(line);
+    }
+}   // namespace
+
+TEST(RingFileFd, BuffersLinesUntilFlush)
+{
+    const TempDir tmp;
+    RingFile      ringFile{makeConfig(tmp.path())};
+
+    ringFile.writeLine("first");
+    ringFile.write("second");
+
+    EXPECT_EQ(readFile(tmp.path() / "log.txt"), "");
+
+    ringFile.flush();
+
+    EXPECT_EQ(readFile(tmp.path() / "log.txt"), "first\nsecond");
+}
+
+TEST(RingFileFd, WritesFullBufferTogetherWithText)
+{
+    const TempDir tmp;
+    auto          config = makeConfig(tmp.path());
+    config.bufferSize    = 8;
+
+    RingFile ringFile{config};
+
+    ringFile.writeLine("abc");
+    EXPECT_EQ(readFile(tmp.path() / "log.txt"), "");
+
+    // does not fit into the buffer, both lines are written at once
+    ringFile.writeLine("defgh");
+    EXPECT_EQ(readFile(tmp.path() / "log.txt"), "abc\ndefgh\n");
+}
+
+TEST(RingFileFd, FlusherWritesOutAfterInterval)
+{
+    const TempDir tmp;
+    auto          config = makeConfig(tmp.path());
+    config.flushInterval = 10ms;
+
+    RingFile ringFile{config};
+    ringFile.writeLine("idle");
+
+    const auto timeout = std::chrono::steady_clock::now() + 5s;
+    while (readFile(tmp.path() / "log.txt").empty() &&
+           std::chrono::steady_clock::now() < timeout)
+        std::this_thread::sleep_for(5ms);
+
+    EXPECT_EQ(readFile(tmp.path() / "log.txt"), "idle\n");
+}
+
+TEST(RingFileFd, DestructionWritesOutBuffer)
+{
+    const TempDir tmp;
+    auto          config = makeConfig(tmp.path());
+    config.flushInterval = 1h;
+
+    {
+        RingFile ringFile{config};
+        ringFile.writeLine("pending");
+    }
+
+    EXPECT_EQ(readFile(tmp.path() / "log.txt"), "pending\n");
+}
+
+TEST(RingFileFd, RotationShiftsCurrentFile)
+{
+    const TempDir tmp;
+
+    {
+        RingFile ringFile{makeConfig(tmp.path())};
+        writeMegabyte(ringFile, 'a');
+        ringFile.writeLine("after rotation");
+    }
+
+    const auto rotated = readFile(tmp.path() / "log_1.txt");
+    ASSERT_FALSE(rotated.empty());
+    EXPECT_EQ(rotated.front(), 'a');
+    EXPECT_LE(rotated.size(), std::size_t{RingFileConfig::MBtoBytes});
+
+    const auto current = readFile(tmp.path() / "log.txt");
+    EXPECT_EQ(current.back(), '\n');
+    EXPECT_NE(current.find("after rotation\n"), std::string::npos);
+    EXPECT_FALSE(std::filesystem::exists(tmp.path() / "log_2.txt"));
+}
+
+TEST(RingFileFd, SingleFileIsTruncatedOnRotation)
+{
+    const TempDir tmp;
+    auto          config = makeConfig(tmp.path());
+    config.maxFiles      = 1;
+
+    {
+        RingFile ringFile{config};
+        writeMegabyte(ringFile, 'a');
+        ringFile.writeLine("after rotation");
+    }
+
+    const auto current = readFile(tmp.path() / "log.txt");
+    EXPECT_LT(current.size(), std::size_t{RingFileConfig::MBtoBytes});
+    EXPECT_NE(current.find("after rotation\n"), std::string::npos);
+    EXPECT_FALSE(std::filesystem::exists(tmp.path() / "log_1.txt"));
+}
+
+TEST(RingFileFd, ShiftsRotatedFilesOfPreviousRun)
+{
+    const TempDir tmp;
+    auto          config = makeConfig(tmp.path());
+    config.maxFiles      = 4;
+
+    std::ofstream{tmp.path() / "log_1.txt"} << "previous 1";
+    std::ofstream{tmp.path() / "log_2.txt"} << "previous 2";
+
+    {
+        RingFile ringFile{config};
+        writeMegabyte(ringFile, 'a');
+    }
+
+    EXPECT_EQ(readFile(tmp.path() / "log_2.txt"), "previous 1");
+    EXPECT_EQ(readFile(tmp.path() / "log_3.txt"), "previous 2");
+}
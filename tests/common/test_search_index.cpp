@@ -0,0 +1,82 @@
+// tests/common/test_search_index.cpp
+//
+// GoogleTest-based tests for SearchIndex.
+//
+// Coverage:
+//  - prefix matches come first, followed by substring matches, in key order
+//  - matching ignores case, results keep the original spelling
+//  - short queries below a trigram still find substring matches
+//  - the result limit is respected
+//  - add/remove/update keep the prefix and trigram indices consistent
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+#include "common/container/search_index.hpp"
+#include "common/container/set.hpp"
+
+namespace
+{
+    using Results = std::vector<std::string>;
+}   // namespace
+
+TEST(SearchIndex, PrefixMatchesPrecedeSubstringMatches)
+{
+    const SearchIndex index{Set<std::string>{"AAPL", "PAPL", "APP", "MSFT"}};
+
+    EXPECT_EQ(index.search("AP"), (Results{"APP", "AAPL", "PAPL"}));
+    EXPECT_EQ(index.search("PL"), (Results{"AAPL", "PAPL"}));
+    EXPECT_EQ(index.search("apl"), (Results{"AAPL", "PAPL"}));
+}
+
+TEST(SearchIndex, IgnoresCaseAndKeepsSpelling)
+{
+    const SearchIndex index{Set<std::string>{"Brk.B", "brk.a"}};
+
+    EXPECT_EQ(index.search("BRK"), (Results{"brk.a", "Brk.B"}));
+    EXPECT_TRUE(index.contains("Brk.B"));
+    EXPECT_FALSE(index.contains("BRK.B"));
+}
+
+TEST(SearchIndex, EmptyQueryMatchesAllUpToLimit)
+{
+    const SearchIndex index{Set<std::string>{"C", "B", "A"}};
+
+    EXPECT_EQ(index.search(""), (Results{"A", "B", "C"}));
+    EXPECT_EQ(index.search("", 2), (Results{"A", "B"}));
+    EXPECT_TRUE(index.search("A", 0).empty());
+}
+
+TEST(SearchIndex, LimitAppliesToSubstringMatches)
+{
+    Set<std::string> values;
+    for (int i = 0; i < 100; ++i)
+        values.insert("X" + std::to_string(1000 + i) + "ABC");
+
+    const SearchIndex index{values};
+
+    const auto results = index.search("0ABC", 3);
+    EXPECT_EQ(results, (Results{"X1000ABC", "X1010ABC", "X1020ABC"}));
+}
+
+TEST(SearchIndex, UpdateAddsAndRemovesDifference)
+{
+    SearchIndex index{Set<std::string>{"AAPL", "MSFT", "NVDA"}};
+
+    index.update(Set<std::string>{"MSFT", "NVDA", "AMZN"});
+
+    EXPECT_EQ(index.size(), 3U);
+    EXPECT_FALSE(index.contains("AAPL"));
+    EXPECT_TRUE(index.search("APL").empty());
+    EXPECT_TRUE(index.search("AA").empty());
+    EXPECT_EQ(index.search("MZ"), (Results{"AMZN"}));
+    EXPECT_EQ(index.search("A"), (Results{"AMZN", "NVDA"}));
+
+    EXPECT_FALSE(index.add("AMZN"));
+    EXPECT_TRUE(index.remove("AMZN"));
+    EXPECT_FALSE(index.remove("AMZN"));
+    EXPECT_TRUE(index.add("AAPL"));
+    EXPECT_EQ(index.search("APL"), (Results{"AAPL"}));
+}
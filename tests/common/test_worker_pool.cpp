@@ -0,0 +1,123 @@
+// tests/common/test_worker_pool.cpp
+//
+// GoogleTest-based tests for WorkerPool.
+//
+// Coverage:
+//  - every task of a batch runs exactly once
+//  - a pool without workers runs the tasks on the calling thread
+//  - the first exception of a task is rethrown after all tasks finished
+//  - batches submitted from several threads and nested batches complete
+//  - the shared instance can be reused for many batches
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <cstddef>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "common/worker_pool.hpp"
+
+namespace
+{
+    /// Number of tasks of a batch
+    constexpr std::size_t N_TASKS = 1000;
+}   // namespace
+
+TEST(WorkerPool, RunsEveryTaskOnce)
+{
+    WorkerPool                            pool{4};
+    std::vector<std::atomic<std::size_t>> runs(N_TASKS);
+
+    pool.parallelFor(N_TASKS, [&runs](std::size_t index) { ++runs[index]; });
+
+    for (const auto& count : runs)
+        EXPECT_EQ(count.load(), 1U);
+}
+
+TEST(WorkerPool, PoolWithoutWorkersRunsOnCallingThread)
+{
+    WorkerPool      pool{0};
+    const auto      caller = std::this_thread::get_id();
+    std::size_t     count  = 0;
+    std::atomic_int foreign{0};
+
+    pool.parallelFor(
+        N_TASKS,
+        [&](std::size_t)
+        {
+            ++count;
+            if (std::this_thread::get_id() != caller)
+                ++foreign;
+        }
+    );
+
+    EXPECT_EQ(pool.size(), 0U);
+    EXPECT_EQ(count, N_TASKS);
+    EXPECT_EQ(foreign.load(), 0);
+}
+
+TEST(WorkerPool, RethrowsTaskExceptionAfterAllTasksFinished)
+{
+    WorkerPool               pool{4};
+    std::atomic<std::size_t> finished{0};
+
+    EXPECT_THROW(
+        pool.parallelFor(
+            N_TASKS,
+            [&finished](std::size_t index)
+            {
+                ++finished;
+                if (index % 100 == 0)
+                    throw std::runtime_error{"task failed"};
+            }
+        ),
+        std::runtime_error
+    );
+
+    EXPECT_EQ(finished.load(), N_TASKS);
+}
+
+TEST(WorkerPool, ConcurrentAndNestedBatchesComplete)
+{
+    WorkerPool               pool{2};
+    std::atomic<std::size_t> total{0};
+
+    {
+        std::vector<std::jthread> submitters;
+        for (int i = 0; i < 4; ++i)
+        {
+            submitters.emplace_back(
+                [&]
+                {
+                    pool.parallelFor(
+                        8,
+                        [&](std::size_t)
+                        {
+                            pool.parallelFor(
+                                8,
+                                [&total](std::size_t) { ++total; }
+                            );
+                        }
+                    );
+                }
+            );
+        }
+    }
+
+    EXPECT_EQ(total.load(), 4U * 8U * 8U);
+}
+
+TEST(WorkerPool, SharedInstanceIsReusable)
+{
+    auto& pool = WorkerPool::getInstance();
+    EXPECT_EQ(&pool, &WorkerPool::getInstance());
+
+    for (int batch = 0; batch < 100; ++batch)
+    {
+        std::atomic<std::size_t> count{0};
+        pool.parallelFor(64, [&count](std::size_t) { ++count; });
+        EXPECT_EQ(count.load(), 64U);
+    }
+}
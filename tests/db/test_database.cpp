@@ -7,11 +7,13 @@
 //  - constructor relative path behavior (via CWD change)
 //  - execute success + error paths (message contains SQL)
 //  - prepare success + error paths (message contains SQL)
+//  - prepareCached (reuse, reset after failure, finalized on close)
 //  - lastInsertRowid + changes
 //  - move ctor / move assignment semantics
 //  - foreign key enforcement toggling
 //  - busy timeout behavior under lock contention
 //  - open invalid path (directory)
+//  - read-only connections (no file creation, writes rejected)
 //
 // These tests use real SQLite database files under the OS temp directory.
 
@@ -235,6 +237,60 @@ TEST(Database, PrepareValidSqlDoesNotThrow)
     EXPECT_NO_THROW((void) db.prepare("SELECT v FROM t WHERE id=1;"));
 }
 
+TEST(Database, PrepareCachedReturnsSameStatementForSameSql)
+{
+    const auto path = unique_temp_db_path();
+    TempDbFile cleanup{path};
+
+    db::Database db(path);
+    db.execute("CREATE TABLE t(id INTEGER PRIMARY KEY, v INTEGER);");
+
+    auto& first = db.prepareCached("INSERT INTO t(v) VALUES(?);");
+    first.bindInt64(1, 1);
+    first.executeToCompletion();
+
+    auto& second = db.prepareCached("INSERT INTO t(v) VALUES(?);");
+    EXPECT_EQ(&first, &second);
+
+    second.bindInt64(1, 2);
+    second.executeToCompletion();
+
+    EXPECT_EQ(db.queryInt("SELECT SUM(v) FROM t;"), 3);
+}
+
+TEST(Database, PrepareCachedIsReusableAfterFailedExecution)
+{
+    const auto path = unique_temp_db_path();
+    TempDbFile cleanup{path};
+
+    db::Database db(path);
+    db.execute("CREATE TABLE t(id INTEGER PRIMARY KEY, v INTEGER NOT NULL);");
+
+    auto& failing = db.prepareCached("INSERT INTO t(v) VALUES(?);");
+    failing.bindNull(1);
+    EXPECT_THROW(failing.executeToCompletion(), db::SqliteError);
+
+    auto& statement = db.prepareCached("INSERT INTO t(v) VALUES(?);");
+    statement.bindInt64(1, 7);
+    EXPECT_NO_THROW(statement.executeToCompletion());
+
+    EXPECT_EQ(db.queryInt("SELECT v FROM t;"), 7);
+}
+
+TEST(Database, CloseFinalizesCachedStatements)
+{
+    const auto path = unique_temp_db_path();
+    TempDbFile cleanup{path};
+
+    db::Database db(path);
+    db.execute("CREATE TABLE t(id INTEGER PRIMARY KEY, v INTEGER);");
+    (void) db.prepareCached("SELECT v FROM t;");
+
+    EXPECT_NO_THROW(db.close());
+    EXPECT_FALSE(db.isOpen());
+    EXPECT_THROW((void) db.prepareCached("SELECT v FROM t;"), db::SqliteError);
+}
+
 TEST(Database, PrepareInvalidSqlThrowsAndMessageContainsSql)
 {
     const auto path = unique_temp_db_path();
@@ -408,4 +464,34 @@ TEST(Database, OpenInvalidPathThrows)
     }
 
     std::filesystem::remove_all(dir, errorCode);
-}
\ No newline at end of file
+}
+
+TEST(Database, ReadOnlyDoesNotCreateMissingFile)
+{
+    const auto path = unique_temp_db_path();
+    TempDbFile cleanup{path};
+
+    EXPECT_THROW(db::Database(path, db::OpenMode::ReadOnly), db::SqliteError);
+    EXPECT_FALSE(std::filesystem::exists(path));
+}
+
+TEST(Database, ReadOnlyReadsButRejectsWrites)
+{
+    const auto path = unique_temp_db_path();
+    TempDbFile cleanup{path};
+
+    {
+        db::Database db(path);
+        db.execute("CREATE TABLE t(x INTEGER);");
+        db.execute("INSERT INTO t(x) VALUES(1);");
+    }
+
+    db::Database readOnly(path, db::OpenMode::ReadOnly);
+    EXPECT_TRUE(readOnly.isReadOnly());
+    EXPECT_EQ(readOnly.queryInt("SELECT COUNT(*) FROM t;"), 1);
+
+    EXPECT_THROW(
+        readOnly.execute("INSERT INTO t(x) VALUES(2);"),
+        db::SqliteError
+    );
+}
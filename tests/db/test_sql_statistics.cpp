@@ -0,0 +1,192 @@
+// tests/db/test_sql_statistics.cpp
+//
+// GoogleTest-based tests for db::SqlStatistics.
+//
+// Coverage:
+//  - normalize replaces literals and folds placeholder lists
+//  - long placeholder lists are folded into a single placeholder
+//  - executions of a prepared key share the key instead of copying the SQL
+//  - statistics aggregate count, min/max/total, p95 and rows per statement
+//  - the history is bounded to HISTORY_CAPACITY entries
+//  - statements and Database::execute report their executions
+//
+// These tests use real SQLite database files under the OS temp directory.
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "db/database.hpp"
+#include "db/sql_statistics.hpp"
+#include "db/statement.hpp"
+#include "test_fixtures.hpp"
+
+namespace
+{
+    using std::chrono::nanoseconds;
+
+    /**
+     * @brief Find the statistics entry of a normalized statement
+     */
+    const db::SqlStatementStats* findStats(
+        const std::vector<db::SqlStatementStats>& statistics,
+        const std::string&                        sql
+    )
+    {
+        const auto iter = std::ranges::find(
+            statistics,
+            sql,
+            &db::SqlStatementStats::sql
+        );
+
+        return iter == statistics.end() ? nullptr : &*iter;
+    }
+
+    class SqlStatisticsTest : public ::testing::Test
+    {
+       protected:
+        void SetUp() override { db::SqlStatistics::getInstance().clear(); }
+        void TearDown() override { db::SqlStatistics::getInstance().clear(); }
+    };
+}   // namespace
+
+TEST_F(SqlStatisticsTest, NormalizeReplacesLiteralsAndFoldsLists)
+{
+    using db::SqlStatistics;
+
+    EXPECT_EQ(
+        SqlStatistics::normalize("SELECT *  FROM t1\n WHERE id = 42;"),
+        "SELECT * FROM t1 WHERE id = ?;"
+    );
+    EXPECT_EQ(
+        SqlStatistics::normalize("SELECT 1 FROM t WHERE name = 'it''s';"),
+        "SELECT ? FROM t WHERE name = ?;"
+    );
+    EXPECT_EQ(
+        SqlStatistics::normalize("DELETE FROM t WHERE id IN (1, 2, 3);"),
+        SqlStatistics::normalize("DELETE FROM t WHERE id IN (?1,?2);")
+    );
+    EXPECT_EQ(
+        SqlStatistics::normalize("INSERT INTO t(a, b) VALUES (?, ?), (?, ?);"),
+        "INSERT INTO t(a, b) VALUES (?);"
+    );
+}
+
+TEST_F(SqlStatisticsTest, NormalizeFoldsLongLists)
+{
+    std::string sql = "DELETE FROM t WHERE id IN (1";
+    for (int i = 2; i <= 10000; ++i)
+        sql += ",  " + std::to_string(i);
+    sql += ");";
+
+    EXPECT_EQ(
+        db::SqlStatistics::normalize(sql),
+        "DELETE FROM t WHERE id IN (?);"
+    );
+}
+
+TEST_F(SqlStatisticsTest, RecordsSharePreparedKey)
+{
+    auto&      statistics = db::SqlStatistics::getInstance();
+    const auto key =
+        db::SqlStatistics::makeKey("SELECT * FROM t WHERE id = 7;");
+
+    EXPECT_EQ(key->normalized, "SELECT * FROM t WHERE id = ?;");
+
+    statistics.record(key, nanoseconds{10}, 1);
+    statistics.record(key, nanoseconds{20}, 0);
+
+    // the key itself and one reference per history entry
+    EXPECT_EQ(key.use_count(), 3);
+
+    const auto history = statistics.getHistory();
+    ASSERT_EQ(history.size(), 2U);
+    EXPECT_EQ(history.front().sql, "SELECT * FROM t WHERE id = 7;");
+
+    const auto result = statistics.getStatistics();
+    ASSERT_EQ(result.size(), 1U);
+    EXPECT_EQ(result.front().sql, "SELECT * FROM t WHERE id = ?;");
+    EXPECT_EQ(result.front().count, 2U);
+    EXPECT_EQ(result.front().totalTime, nanoseconds{30});
+}
+
+TEST_F(SqlStatisticsTest, AggregatesPerNormalizedStatement)
+{
+    auto& statistics = db::SqlStatistics::getInstance();
+
+    for (int i = 1; i <= 100; ++i)
+    {
+        statistics.record(
+            "SELECT * FROM t WHERE id = " + std::to_string(i) + ";",
+            nanoseconds{i},
+            1
+        );
+    }
+    statistics.record("SELECT 2;", nanoseconds{1000}, 0);
+
+    const auto result = statistics.getStatistics();
+    ASSERT_EQ(result.size(), 2U);
+
+    // sorted by total time, the single slow statement comes last
+    const auto& stats = result.front();
+    EXPECT_EQ(stats.sql, "SELECT * FROM t WHERE id = ?;");
+    EXPECT_EQ(stats.count, 100U);
+    EXPECT_EQ(stats.totalTime, nanoseconds{5050});
+    EXPECT_EQ(stats.minTime, nanoseconds{1});
+    EXPECT_EQ(stats.maxTime, nanoseconds{100});
+    EXPECT_EQ(stats.p95Time, nanoseconds{95});
+    EXPECT_EQ(stats.rows, 100);
+}
+
+TEST_F(SqlStatisticsTest, HistoryIsBounded)
+{
+    auto& statistics = db::SqlStatistics::getInstance();
+
+    const auto total = db::SqlStatistics::HISTORY_CAPACITY + 10;
+    for (std::size_t i = 0; i < total; ++i)
+        statistics.record("SELECT " + std::to_string(i) + ";", {}, 0);
+
+    const auto history = statistics.getHistory();
+    ASSERT_EQ(history.size(), db::SqlStatistics::HISTORY_CAPACITY);
+    EXPECT_EQ(history.front().sql, "SELECT 10;");
+    EXPECT_EQ(history.back().sql, "SELECT " + std::to_string(total - 1) + ";");
+
+    const auto result = statistics.getStatistics();
+    ASSERT_EQ(result.size(), 1U);
+    EXPECT_EQ(result.front().count, total);
+}
+
+TEST_F(SqlStatisticsTest, StatementsReportExecutions)
+{
+    tests::TempDbFile file;
+    db::Database      database{file.path()};
+
+    database.execute("CREATE TABLE items(id INTEGER PRIMARY KEY);");
+    database.execute("INSERT INTO items(id) VALUES (1), (2), (3);");
+
+    {
+        auto statement = database.prepare("SELECT id FROM items;");
+        while (statement.step() == db::StepResult::RowAvailable)
+        {
+        }
+
+        statement.reset();
+        std::ignore = statement.step();
+    }
+
+    const auto result = db::SqlStatistics::getInstance().getStatistics();
+
+    const auto* select = findStats(result, "SELECT id FROM items;");
+    ASSERT_NE(select, nullptr);
+    EXPECT_EQ(select->count, 2U);
+    EXPECT_EQ(select->rows, 4);
+
+    const auto* insert =
+        findStats(result, "INSERT INTO items(id) VALUES (?);");
+    ASSERT_NE(insert, nullptr);
+    EXPECT_EQ(insert->count, 1U);
+}
@@ -0,0 +1,175 @@
+// tests/filter/test_compiled_predicate.cpp
+//
+// GoogleTest-based tests for filter::CompiledPredicate.
+//
+// Coverage:
+//  - an empty predicate matches everything
+//  - typed leaves are recognized and stored in their typed tables
+//  - pure conjunctions use the typed fast path
+//  - OR / NOT predicates are flattened into a program with jumps
+//  - compiled and tree evaluation agree for all inputs
+//  - short-circuiting skips the right operand
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "filter/compiled_predicate.hpp"
+#include "filter/leaves.hpp"
+#include "filter/predicate.hpp"
+
+namespace
+{
+    struct Item
+    {
+        std::int64_t id;
+        std::string  name;
+        bool         open;
+    };
+
+    filter::Predicate<Item> hasId(std::vector<std::int64_t> ids)
+    {
+        return filter::makeIdSetPredicate<Item>(
+            [](const Item& item, const filter::IdList& idList)
+            { return idList.contains(item.id); },
+            filter::IdList{std::move(ids)}
+        );
+    }
+
+    filter::Predicate<Item> hasName(std::string name)
+    {
+        return filter::makeStringEqualPredicate<Item>(
+            [](const Item& item) { return item.name; },
+            std::move(name)
+        );
+    }
+
+    filter::Predicate<Item> isOpen(bool expected = true)
+    {
+        return filter::makeFlagPredicate<Item>(
+            [](const Item& item) { return item.open; },
+            expected
+        );
+    }
+
+    filter::Predicate<Item> idAbove(std::int64_t threshold)
+    {
+        return filter::makePredicate<Item>([threshold](const Item& item)
+                                           { return item.id > threshold; });
+    }
+
+    std::vector<Item> makeItems()
+    {
+        std::vector<Item> items;
+        for (std::int64_t i = 0; i < 12; ++i)
+        {
+            items.push_back(
+                Item{i, i % 3 == 0 ? "alpha" : "beta", i % 2 == 0}
+            );
+        }
+        return items;
+    }
+
+    void expectSameAsTree(const filter::Predicate<Item>& predicate)
+    {
+        const auto compiled =
+            filter::CompiledPredicate<Item>::compile(predicate);
+
+        for (const auto& item : makeItems())
+        {
+            EXPECT_EQ(
+                compiled(item),
+                filter::evaluatePredicate(predicate, item)
+            ) << "item id " << item.id;
+        }
+    }
+}   // namespace
+
+TEST(CompiledPredicate, EmptyPredicateMatchesEverything)
+{
+    const auto compiled =
+        filter::CompiledPredicate<Item>::compile(filter::Predicate<Item>());
+
+    EXPECT_TRUE(compiled.isConjunctive());
+    EXPECT_TRUE(compiled(Item{1, "alpha", false}));
+}
+
+TEST(CompiledPredicate, TypedLeavesAreRecognized)
+{
+    const auto compiled = filter::CompiledPredicate<Item>::compile(
+        hasId({1, 2}) && hasName("alpha") && isOpen() && idAbove(0)
+    );
+
+    std::vector<filter::OpCode> leafCodes;
+    for (const auto& instruction : compiled.getProgram())
+        if (instruction.opCode != filter::OpCode::JumpIfFalse)
+            leafCodes.push_back(instruction.opCode);
+
+    const std::vector<filter::OpCode> expected{
+        filter::OpCode::IdSet,
+        filter::OpCode::StringEqual,
+        filter::OpCode::Flag,
+        filter::OpCode::Call
+    };
+    EXPECT_EQ(leafCodes, expected);
+    EXPECT_TRUE(compiled.isConjunctive());
+}
+
+TEST(CompiledPredicate, ConjunctionMatchesTreeEvaluation)
+{
+    expectSameAsTree(hasId({0, 3, 4, 6, 9}) && isOpen());
+    expectSameAsTree(hasName("alpha") && idAbove(4) && isOpen(false));
+    expectSameAsTree(hasId({}) && hasName("beta"));
+}
+
+TEST(CompiledPredicate, OrAndNotAreCompiledIntoAProgram)
+{
+    const auto predicate =
+        (hasName("alpha") || !isOpen()) && !(hasId({2, 4}) || idAbove(9));
+
+    const auto compiled = filter::CompiledPredicate<Item>::compile(predicate);
+
+    EXPECT_FALSE(compiled.isConjunctive());
+    expectSameAsTree(predicate);
+    expectSameAsTree(!filter::Predicate<Item>());
+    expectSameAsTree(hasId({1}) || hasId({2}) || hasName("alpha"));
+}
+
+TEST(CompiledPredicate, ShortCircuitSkipsRightOperand)
+{
+    int calls = 0;
+
+    const auto counting = filter::makePredicate<Item>(
+        [&calls](const Item& /*item*/)
+        {
+            ++calls;
+            return true;
+        }
+    );
+
+    const auto andProgram =
+        filter::CompiledPredicate<Item>::compile(!isOpen() && counting);
+    EXPECT_FALSE(andProgram(Item{1, "alpha", true}));
+    EXPECT_EQ(calls, 0);
+
+    const auto orProgram =
+        filter::CompiledPredicate<Item>::compile(isOpen() || counting);
+    EXPECT_TRUE(orProgram(Item{1, "alpha", true}));
+    EXPECT_EQ(calls, 0);
+
+    EXPECT_TRUE(orProgram(Item{1, "alpha", false}));
+    EXPECT_EQ(calls, 1);
+}
+
+TEST(IdList, SortsAndDeduplicates)
+{
+    const filter::IdList ids{{5, 1, 5, 3}};
+
+    EXPECT_EQ(ids.size(), 3U);
+    EXPECT_TRUE(ids.contains(1));
+    EXPECT_TRUE(ids.contains(5));
+    EXPECT_FALSE(ids.contains(2));
+    EXPECT_TRUE(filter::IdList{}.empty());
+}
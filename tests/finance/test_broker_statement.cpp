@@ -0,0 +1,302 @@
+// tests/finance/test_broker_statement.cpp
+//
+// GoogleTest-based tests for finance::StatementParser.
+//
+// Coverage:
+//  - generic and Interactive Brokers headers are mapped onto the columns
+//  - sells and withdrawals reported as positive numbers are negated
+//  - semicolon delimited statements and repeated header rows are handled
+//  - an empty statement or a header missing required columns is rejected
+//  - malformed and short rows are reported without stopping the parser
+//  - dates with and without separators and times are parsed as UTC
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <format>
+#include <optional>
+#include <string>
+#include <string_view>
+
+#include "common/cash.hpp"
+#include "common/finance.hpp"
+#include "common/quantity.hpp"
+#include "common/timestamp.hpp"
+#include "error/finance_error.hpp"
+#include "finance/transaction/broker_statement.hpp"
+#include "test_values.hpp"
+
+namespace
+{
+    using tests::quantity;
+    using tests::usd;
+
+    using namespace std::chrono_literals;
+
+    using finance::BrokerLayout;
+    using finance::StatementParser;
+    using finance::StatementRow;
+    using finance::StatementRowKind;
+
+    /**
+     * @brief Milliseconds since the epoch, the representation of Timestamp
+     *
+     */
+    [[nodiscard]] std::int64_t millis(std::chrono::sys_seconds time)
+    {
+        using std::chrono::milliseconds;
+
+        const auto sinceEpoch = time.time_since_epoch();
+        return std::chrono::duration_cast<milliseconds>(sinceEpoch).count();
+    }
+
+    [[nodiscard]] std::optional<std::int64_t> parse(std::string_view value)
+    {
+        return StatementParser::parseTimestamp(value).transform(
+            &Timestamp::toInt64
+        );
+    }
+
+    /**
+     * @brief Reads the next row, which is expected to parse
+     *
+     */
+    [[nodiscard]] StatementRow nextRow(StatementParser& parser)
+    {
+        auto next = parser.next();
+
+        EXPECT_TRUE(next.has_value());
+        if (!next)
+            return {};
+
+        EXPECT_TRUE(next->has_value())
+            << (next->has_value() ? "" : next->error().toString());
+
+        return next->value_or(StatementRow{});
+    }
+
+    /**
+     * @brief Reads the next row, which is expected to be malformed
+     *
+     */
+    [[nodiscard]] FinanceError nextError(StatementParser& parser)
+    {
+        auto next = parser.next();
+
+        EXPECT_TRUE(next.has_value());
+        EXPECT_FALSE(next.has_value() && next->has_value());
+
+        if (!next || next->has_value())
+            return FinanceError{FinanceErrorType::InvalidStatement, ""};
+
+        return next->error();
+    }
+}   // namespace
+
+TEST(StatementParser, MapsGenericHeader)
+{
+    constexpr std::string_view data =
+        "Date,Type,Account,Cash_Account,Symbol,Quantity,Price,Amount,Fees,"
+        "Currency,Comment\n"
+        "2024-05-06 09:30:15,buy,Broker,Cash,AAPL,10,180.25,,1.5,USD,first\n"
+        "2024-05-07,sell,Broker,Cash,AAPL,4,185,,-1,USD,\n"
+        "2024-05-08,withdrawal,Cash,,,,,250,,USD,rent\n"
+        "2024-05-09,deposit,Cash,,,,,1000,,USD,\n";
+
+    StatementParser parser{data, BrokerLayout::Generic};
+    ASSERT_TRUE(parser.readHeader().has_value());
+
+    const auto buy = nextRow(parser);
+    EXPECT_EQ(buy.line, 2U);
+    EXPECT_EQ(buy.kind, StatementRowKind::Trade);
+    EXPECT_EQ(
+        buy.timestamp.toInt64(),
+        millis(std::chrono::sys_days{2024y / 5 / 6} + 9h + 30min + 15s)
+    );
+    EXPECT_EQ(buy.account, "Broker");
+    EXPECT_EQ(buy.cashAccount, "Cash");
+    EXPECT_EQ(buy.symbol, "AAPL");
+    EXPECT_EQ(buy.currency, Currency::USD);
+    EXPECT_EQ(buy.quantity, quantity(10));
+    EXPECT_EQ(buy.price, (Cash{Currency::USD, 180'250'000}));
+    EXPECT_EQ(buy.fees, (Cash{Currency::USD, 1'500'000}));
+    EXPECT_EQ(buy.comment, "first");
+
+    const auto sell = nextRow(parser);
+    EXPECT_EQ(sell.quantity, quantity(-4));
+    EXPECT_EQ(sell.fees, usd(1));
+
+    const auto withdrawal = nextRow(parser);
+    EXPECT_EQ(withdrawal.kind, StatementRowKind::Cash);
+    EXPECT_EQ(withdrawal.account, "Cash");
+    EXPECT_EQ(withdrawal.amount, usd(-250));
+    EXPECT_EQ(withdrawal.fees, (Cash{Currency::USD, 0}));
+
+    const auto deposit = nextRow(parser);
+    EXPECT_EQ(deposit.amount, usd(1000));
+
+    EXPECT_FALSE(parser.next().has_value());
+    EXPECT_EQ(parser.getOffset(), parser.getSize());
+}
+
+TEST(StatementParser, MapsInteractiveBrokersHeader)
+{
+    // flex query export, columns in the order the user configured them
+    constexpr std::string_view data =
+        "ClientAccountID,CurrencyPrimary,Symbol,DateTime,Quantity,TradePrice,"
+        "IBCommission,Buy/Sell,Description\n"
+        "U1234567,EUR,SAP,20240506;093000,-5,180.5,-1.25,SELL,SAP SE\n"
+        "U1234567,EUR,SAP,20240507;101500,3,179,-1,BUY,SAP SE\n";
+
+    StatementParser parser{data, BrokerLayout::InteractiveBrokers};
+    ASSERT_TRUE(parser.readHeader().has_value());
+
+    EXPECT_TRUE(parser.hasColumn(finance::StatementColumn::Symbol));
+    EXPECT_FALSE(parser.hasColumn(finance::StatementColumn::CashAccount));
+
+    const auto sell = nextRow(parser);
+    EXPECT_EQ(sell.kind, StatementRowKind::Trade);
+    EXPECT_EQ(
+        sell.timestamp.toInt64(),
+        millis(std::chrono::sys_days{2024y / 5 / 6} + 9h + 30min)
+    );
+    EXPECT_EQ(sell.account, "U1234567");
+    EXPECT_TRUE(sell.cashAccount.empty());
+    EXPECT_EQ(sell.symbol, "SAP");
+    EXPECT_EQ(sell.currency, Currency::EUR);
+    EXPECT_EQ(sell.quantity, quantity(-5));
+    EXPECT_EQ(sell.price, (Cash{Currency::EUR, 180'500'000}));
+    EXPECT_EQ(sell.fees, (Cash{Currency::EUR, 1'250'000}));
+    EXPECT_EQ(sell.comment, "SAP SE");
+
+    const auto buy = nextRow(parser);
+    EXPECT_EQ(buy.quantity, quantity(3));
+
+    EXPECT_FALSE(parser.next().has_value());
+}
+
+TEST(StatementParser, SemicolonsAndRepeatedHeaders)
+{
+    constexpr std::string_view data =
+        "date;symbol;quantity;price;currency\n"
+        "2024-05-06;AAPL;1;100;USD\n"
+        "date;symbol;quantity;price;currency\n"
+        "2024-05-07;MSFT;2;400;USD\n";
+
+    StatementParser parser{data, BrokerLayout::Generic};
+    ASSERT_TRUE(parser.readHeader().has_value());
+
+    // without a type column, rows naming a symbol are trades
+    const auto first = nextRow(parser);
+    EXPECT_EQ(first.kind, StatementRowKind::Trade);
+    EXPECT_EQ(first.symbol, "AAPL");
+
+    const auto second = nextRow(parser);
+    EXPECT_EQ(second.symbol, "MSFT");
+    EXPECT_EQ(second.line, 4U);
+
+    EXPECT_FALSE(parser.next().has_value());
+}
+
+TEST(StatementParser, RejectsEmptyStatementAndForeignHeader)
+{
+    StatementParser empty{"", BrokerLayout::Generic};
+    const auto      emptyHeader = empty.readHeader();
+
+    ASSERT_FALSE(emptyHeader.has_value());
+    EXPECT_EQ(
+        emptyHeader.error().getType(),
+        FinanceErrorType::InvalidStatement
+    );
+
+    // an IB export read with the generic layout lacks the date column
+    StatementParser foreign{
+        "DateTime,Symbol,Quantity,TradePrice,CurrencyPrimary\n",
+        BrokerLayout::Generic
+    };
+    const auto foreignHeader = foreign.readHeader();
+
+    ASSERT_FALSE(foreignHeader.has_value());
+    EXPECT_EQ(
+        foreignHeader.error().getType(),
+        FinanceErrorType::InvalidStatement
+    );
+
+    // neither trade nor cash columns
+    StatementParser noValues{"date,currency\n", BrokerLayout::Generic};
+    EXPECT_FALSE(noValues.readHeader().has_value());
+}
+
+TEST(StatementParser, ReportsMalformedAndShortRows)
+{
+    constexpr std::string_view data =
+        "date,type,currency,symbol,quantity,price,amount,fees\n"
+        "2024-13-01,buy,USD,AAPL,1,100,,\n"
+        "2024-05-06,buy,XXX,AAPL,1,100,,\n"
+        "2024-05-06,buy,USD,,1,100,,\n"
+        "2024-05-06,buy,USD,AAPL,0,100,,\n"
+        "2024-05-06,buy,USD,AAPL,1,-5,,\n"
+        "2024-05-06,buy,USD,AAPL,1,abc,,\n"
+        "2024-05-06,buy,USD,AAPL,1,100,,x\n"
+        "2024-05-06,deposit,USD,,,,0,\n"
+        "2024-05-06,buy,USD,AAPL\n"
+        "2024-05-06\n"
+        "2024-05-06,buy,USD,AAPL,1,100,,\n";
+
+    StatementParser parser{data, BrokerLayout::Generic};
+    ASSERT_TRUE(parser.readHeader().has_value());
+
+    const auto expectError = [&](std::size_t line, std::string_view text)
+    {
+        const auto error = nextError(parser);
+
+        EXPECT_EQ(error.getType(), FinanceErrorType::InvalidStatement);
+        EXPECT_NE(
+            error.toString().find(std::format("line {}", line)),
+            std::string::npos
+        ) << error.toString();
+        EXPECT_NE(error.toString().find(text), std::string::npos)
+            << error.toString();
+    };
+
+    expectError(2, "invalid date");
+    expectError(3, "unknown currency 'XXX'");
+    expectError(4, "trade without symbol");
+    expectError(5, "invalid quantity '0'");
+    expectError(6, "invalid price '-5'");
+    expectError(7, "invalid price 'abc'");
+    expectError(8, "invalid fees 'x'");
+    expectError(9, "invalid amount '0'");
+
+    // short rows miss the trailing fields
+    expectError(10, "invalid quantity ''");
+    expectError(11, "unknown currency ''");
+
+    // the parser continues after malformed rows
+    const auto row = nextRow(parser);
+    EXPECT_EQ(row.line, 12U);
+    EXPECT_EQ(row.symbol, "AAPL");
+
+    EXPECT_FALSE(parser.next().has_value());
+}
+
+TEST(StatementParser, ParsesTimestamps)
+{
+    const auto day = std::chrono::sys_days{2024y / 2 / 29};
+
+    EXPECT_EQ(parse("2024-02-29"), millis(day));
+    EXPECT_EQ(parse("20240229"), millis(day));
+    EXPECT_EQ(parse("2024-02-29T13:45"), millis(day + 13h + 45min));
+    EXPECT_EQ(
+        parse("2024-02-29, 13:45:30 EST"),
+        millis(day + 13h + 45min + 30s)
+    );
+    EXPECT_EQ(parse("20240229;134530"), millis(day + 13h + 45min + 30s));
+
+    EXPECT_EQ(parse("2023-02-29"), std::nullopt);
+    EXPECT_EQ(parse("2024-2-29"), std::nullopt);
+    EXPECT_EQ(parse("29.02.2024"), std::nullopt);
+    EXPECT_EQ(parse("2024-02-29 1x:00"), std::nullopt);
+}
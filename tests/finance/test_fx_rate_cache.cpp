@@ -0,0 +1,305 @@
+// tests/finance/test_fx_rate_cache.cpp
+//
+// GoogleTest-based tests for finance::ConversionMatrix and
+// finance::FxRateCache.
+//
+// Coverage:
+//  - the matrix holds the identity conversions and ignores invalid rates
+//  - conversions round to the micro units of the target currency
+//  - inverse rates are derived from cached rates
+//  - cross rates are derived over the base currency
+//  - cached rates take precedence over derived ones
+//  - a rate without a path between the currencies is missing
+//  - pairSymbol and parsePairSymbol round-trip, malformed symbols are
+//    rejected
+//  - update notifies only if a rate changed, with the currencies whose
+//    conversions changed
+//  - the persisted rates are loaded by a new cache, malformed files and
+//    entries are skipped
+//  - updates in quick succession persist the latest rates
+
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include "common/cash.hpp"
+#include "common/finance.hpp"
+#include "finance/fx_rate_cache.hpp"
+#include "test_fixtures.hpp"
+#include "test_values.hpp"
+
+namespace
+{
+    using tests::TempDir;
+
+    using tests::cash;
+    using tests::fxRate;
+
+    using finance::ConversionMatrix;
+    using finance::FxRateCache;
+
+    /// Tolerance of derived rates
+    constexpr double EPSILON = 1e-12;
+}   // namespace
+
+TEST(ConversionMatrix, HoldsIdentityConversionsOnly)
+{
+    const ConversionMatrix matrix;
+
+    EXPECT_EQ(matrix.rate(Currency::USD, Currency::USD), 1.0);
+    EXPECT_EQ(matrix.rate(Currency::EUR, Currency::EUR), 1.0);
+    EXPECT_FALSE(matrix.rate(Currency::EUR, Currency::USD).has_value());
+    EXPECT_FALSE(matrix.rate(Currency::Unknown, Currency::Unknown));
+}
+
+TEST(ConversionMatrix, IgnoresInvalidRates)
+{
+    ConversionMatrix matrix;
+
+    matrix.set(Currency::EUR, Currency::USD, 0.0);
+    matrix.set(Currency::EUR, Currency::GBP, -1.0);
+    matrix.set(
+        Currency::EUR,
+        Currency::CHF,
+        std::numeric_limits<double>::infinity()
+    );
+    matrix.set(Currency::Unknown, Currency::USD, 1.0);
+
+    EXPECT_FALSE(matrix.rate(Currency::EUR, Currency::USD).has_value());
+    EXPECT_FALSE(matrix.rate(Currency::EUR, Currency::GBP).has_value());
+    EXPECT_FALSE(matrix.rate(Currency::EUR, Currency::CHF).has_value());
+    EXPECT_FALSE(matrix.rate(Currency::Unknown, Currency::USD).has_value());
+}
+
+TEST(ConversionMatrix, ConvertsAndRoundsToMicroUnits)
+{
+    ConversionMatrix matrix;
+    matrix.set(Currency::EUR, Currency::USD, 1.1);
+
+    const auto converted =
+        matrix.convert(cash(Currency::EUR, 10), Currency::USD);
+
+    ASSERT_TRUE(converted.has_value());
+    EXPECT_EQ(converted.value(), cash(Currency::USD, 11));
+
+    const auto rounded =
+        ConversionMatrix::convert(Cash{Currency::EUR, 3}, Currency::USD, 0.5);
+    EXPECT_EQ(rounded, Cash(Currency::USD, 2));
+
+    EXPECT_FALSE(matrix.convert(Cash{Currency::GBP, 1}, Currency::USD));
+}
+
+TEST(FxRateCache, DerivesInverseRates)
+{
+    FxRateCache cache;
+    ASSERT_TRUE(cache.update({fxRate(Currency::EUR, Currency::USD, 1.25)}));
+
+    const auto inverse = cache.getRate(Currency::USD, Currency::EUR);
+
+    ASSERT_TRUE(inverse.has_value());
+    EXPECT_NEAR(inverse.value(), 0.8, EPSILON);
+    EXPECT_FALSE(cache.get(Currency::USD, Currency::EUR).has_value());
+}
+
+TEST(FxRateCache, DerivesCrossRatesOverBaseCurrency)
+{
+    FxRateCache cache;
+    ASSERT_TRUE(
+        cache.update(
+            {fxRate(Currency::EUR, Currency::USD, 1.2),
+             fxRate(Currency::GBP, Currency::USD, 1.5)}
+        )
+    );
+
+    const auto eurGbp = cache.getRate(Currency::EUR, Currency::GBP);
+    const auto gbpEur = cache.getRate(Currency::GBP, Currency::EUR);
+
+    ASSERT_TRUE(eurGbp.has_value());
+    ASSERT_TRUE(gbpEur.has_value());
+    EXPECT_NEAR(eurGbp.value(), 0.8, EPSILON);
+    EXPECT_NEAR(gbpEur.value(), 1.25, EPSILON);
+}
+
+TEST(FxRateCache, CachedRateTakesPrecedenceOverDerivedRate)
+{
+    FxRateCache cache;
+    ASSERT_TRUE(
+        cache.update(
+            {fxRate(Currency::EUR, Currency::USD, 1.2),
+             fxRate(Currency::USD, Currency::EUR, 0.9),
+             fxRate(Currency::GBP, Currency::USD, 1.5),
+             fxRate(Currency::EUR, Currency::GBP, 0.7)}
+        )
+    );
+
+    EXPECT_EQ(cache.getRate(Currency::USD, Currency::EUR), 0.9);
+    EXPECT_EQ(cache.getRate(Currency::EUR, Currency::GBP), 0.7);
+}
+
+TEST(FxRateCache, RateWithoutPathIsMissing)
+{
+    FxRateCache cache;
+    ASSERT_TRUE(cache.update({fxRate(Currency::EUR, Currency::USD, 1.2)}));
+
+    EXPECT_FALSE(cache.getRate(Currency::CHF, Currency::USD).has_value());
+    EXPECT_FALSE(cache.getRate(Currency::EUR, Currency::CHF).has_value());
+    EXPECT_FALSE(
+        cache.getMatrix()
+            .convert(cash(Currency::CHF, 1), Currency::USD)
+            .has_value()
+    );
+}
+
+TEST(FxRateCache, PairSymbolRoundTrips)
+{
+    const auto symbol = FxRateCache::pairSymbol(Currency::EUR, Currency::USD);
+    EXPECT_EQ(symbol, "EURUSD=X");
+
+    const auto pair = FxRateCache::parsePairSymbol(symbol);
+    ASSERT_TRUE(pair.has_value());
+    EXPECT_EQ(pair->first, Currency::EUR);
+    EXPECT_EQ(pair->second, Currency::USD);
+}
+
+TEST(FxRateCache, ParsePairSymbolRejectsMalformedSymbols)
+{
+    for (const std::string symbol : {
+             "",
+             "EURUSD",
+             "EURUSD=Y",
+             "EURUSD=XX",
+             "EURUS=X",
+             "EURXXX=X",
+             "XXXUSD=X",
+             "EUR-USD=X",
+             "AAPL"
+         })
+    {
+        EXPECT_FALSE(FxRateCache::parsePairSymbol(symbol).has_value())
+            << symbol;
+    }
+}
+
+TEST(FxRateCache, UpdateNotifiesOnlyOnChange)
+{
+    FxRateCache cache;
+    int         notifications = 0;
+    const auto  connection    = cache.subscribeToRatesUpdated(
+        [&notifications](const std::vector<Currency>&) { ++notifications; },
+        nullptr
+    );
+
+    EXPECT_TRUE(cache.update({fxRate(Currency::EUR, Currency::USD, 1.2)}));
+    EXPECT_FALSE(cache.update({fxRate(Currency::EUR, Currency::USD, 1.2)}));
+    EXPECT_FALSE(cache.update({fxRate(Currency::EUR, Currency::EUR, 1.0)}));
+    EXPECT_FALSE(cache.update({fxRate(Currency::GBP, Currency::USD, 0.0)}));
+    EXPECT_TRUE(cache.update({fxRate(Currency::EUR, Currency::USD, 1.3)}));
+
+    EXPECT_EQ(notifications, 2);
+}
+
+TEST(FxRateCache, UpdateReportsChangedCurrencies)
+{
+    FxRateCache cache;
+    ASSERT_TRUE(
+        cache.update(
+            {fxRate(Currency::EUR, Currency::USD, 1.2),
+             fxRate(Currency::GBP, Currency::USD, 1.5)}
+        )
+    );
+
+    std::vector<Currency> currencies;
+    const auto            connection = cache.subscribeToRatesUpdated(
+        [&currencies](const std::vector<Currency>& changed)
+        { currencies = changed; },
+        nullptr
+    );
+
+    const auto before = cache.getMatrix();
+    ASSERT_TRUE(cache.update({fxRate(Currency::EUR, Currency::USD, 1.25)}));
+
+    // GBP is reported because GBP -> EUR is crossed over USD, CHF has no
+    // rates at all
+    EXPECT_EQ(
+        currencies,
+        (std::vector{Currency::USD, Currency::EUR, Currency::GBP})
+    );
+    EXPECT_EQ(cache.getMatrix().getChangedCurrencies(before), currencies);
+    EXPECT_EQ(
+        before.rate(Currency::GBP, Currency::USD),
+        cache.getRate(Currency::GBP, Currency::USD)
+    );
+}
+
+TEST(FxRateCache, PersistedRatesAreLoadedByNewCache)
+{
+    const TempDir tmp;
+    const auto    path = tmp.path() / "fx" / "fx_rates.json";
+
+    {
+        FxRateCache cache{path};
+        ASSERT_TRUE(
+            cache.update(
+                {fxRate(Currency::EUR, Currency::USD, 1.2),
+                 fxRate(Currency::GBP, Currency::USD, 1.5)}
+            )
+        );
+    }
+
+    const FxRateCache reloaded{path};
+
+    const auto eurUsd = reloaded.get(Currency::EUR, Currency::USD);
+    ASSERT_TRUE(eurUsd.has_value());
+    EXPECT_EQ(eurUsd->rate, 1.2);
+    EXPECT_EQ(reloaded.getRate(Currency::GBP, Currency::USD), 1.5);
+    EXPECT_FALSE(std::filesystem::exists(path.string() + ".tmp"));
+}
+
+TEST(FxRateCache, MalformedFileAndEntriesAreSkipped)
+{
+    const TempDir tmp;
+    const auto    path = tmp.path() / "fx_rates.json";
+
+    {
+        std::ofstream file{path};
+        file << "{not json";
+    }
+    EXPECT_FALSE(FxRateCache{path}.getRate(Currency::EUR, Currency::USD));
+
+    {
+        std::ofstream file{path, std::ios::trunc};
+        file << R"([
+            {"pair": "EURUSD=X", "rate": 1.2, "fetchedAt": 0},
+            {"pair": "GBPUSD=X", "rate": -1.0, "fetchedAt": 0},
+            {"pair": "CHFUSD", "rate": 1.1, "fetchedAt": 0},
+            {"pair": "CHFUSD=X", "rate": 1.1}
+        ])";
+    }
+
+    const FxRateCache cache{path};
+    EXPECT_EQ(cache.getRate(Currency::EUR, Currency::USD), 1.2);
+    EXPECT_FALSE(cache.get(Currency::GBP, Currency::USD).has_value());
+    EXPECT_FALSE(cache.get(Currency::CHF, Currency::USD).has_value());
+}
+
+TEST(FxRateCache, SuccessiveUpdatesPersistLatestRates)
+{
+    const TempDir tmp;
+    const auto    path = tmp.path() / "fx_rates.json";
+
+    {
+        FxRateCache cache{path};
+        for (const double value : {1.1, 1.2, 1.3})
+        {
+            ASSERT_TRUE(
+                cache.update({fxRate(Currency::EUR, Currency::USD, value)})
+            );
+        }
+    }
+
+    EXPECT_EQ(FxRateCache{path}.getRate(Currency::EUR, Currency::USD), 1.3);
+}
@@ -0,0 +1,183 @@
+// tests/finance/test_pnl.cpp
+//
+// GoogleTest-based tests for the batch fold of finance::foldPositions.
+//
+// Coverage:
+//  - the parallel fold of many positions matches folding each position on
+//    its own, for the default and explicit worker counts
+//  - the error of a failing position is reported in its own slot
+//  - small batches and a single worker fold on the calling thread
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "common/cash.hpp"
+#include "common/finance.hpp"
+#include "common/quantity.hpp"
+#include "common/timestamp.hpp"
+#include "finance/transaction/pnl.hpp"
+#include "test_values.hpp"
+
+namespace
+{
+    using tests::quantity;
+    using tests::usd;
+
+    using finance::OptionTrade;
+    using finance::PositionEvent;
+    using finance::PositionEvents;
+    using finance::PositionState;
+    using finance::StockTrade;
+
+    constexpr std::int64_t TEST_TS = 1'715'000'000'000LL;
+
+    /// Number of positions of a batch, enough to be split over workers
+    constexpr std::size_t N_POSITIONS = 1000;
+
+    /// Every n-th position mixes contract sizes and fails to fold
+    constexpr std::size_t FAILING_EVERY = 97;
+
+    [[nodiscard]] PositionEvent stockTrade(
+        std::int64_t offset,
+        std::int64_t shares,
+        std::int64_t price
+    )
+    {
+        return PositionEvent{
+            .timestamp = Timestamp::fromInt64(TEST_TS + offset),
+            .data      = StockTrade{quantity(shares), usd(price), usd(1)}
+        };
+    }
+
+    [[nodiscard]] PositionEvent putOpen(
+        std::int64_t offset,
+        std::int64_t strike,
+        std::int64_t contractSize
+    )
+    {
+        return PositionEvent{
+            .timestamp = Timestamp::fromInt64(TEST_TS + offset),
+            .data      = OptionTrade{
+                .type         = OptionType::Put,
+                .buySell      = OptionBuySell::Sell,
+                .action       = TransactionOptionAction::Open,
+                .strike       = usd(strike),
+                .quantity     = quantity(1),
+                .contractSize = contractSize,
+                .premium      = usd(2),
+                .fees         = usd(1)
+            }
+        };
+    }
+
+    /**
+     * @brief Builds a batch of positions with different trades, every
+     * FAILING_EVERY-th position opens puts of different contract sizes
+     *
+     * @return std::vector<PositionEvents>
+     */
+    [[nodiscard]] std::vector<PositionEvents> makePositions()
+    {
+        std::vector<PositionEvents> positions(N_POSITIONS);
+
+        for (std::size_t i = 0; i < N_POSITIONS; ++i)
+        {
+            const auto n      = static_cast<std::int64_t>(i);
+            auto&      events = positions[i];
+
+            events.add(stockTrade(0, (n % 7) + 2, 100 + (n % 13)));
+            events.add(stockTrade(1, -1, 110));
+            events.add(putOpen(2, 90 + (n % 5), 100));
+
+            if (i % FAILING_EVERY == 0)
+                events.add(putOpen(3, 80, 10));
+            else
+                events.add(stockTrade(3, n % 3, 95));
+        }
+
+        return positions;
+    }
+
+    void expectSameState(const PositionState& lhs, const PositionState& rhs)
+    {
+        EXPECT_EQ(lhs.openQuantity, rhs.openQuantity);
+        EXPECT_EQ(lhs.costBasis, rhs.costBasis);
+        EXPECT_EQ(lhs.realizedPnL, rhs.realizedPnL);
+        EXPECT_EQ(lhs.realizedCostBasis, rhs.realizedCostBasis);
+        EXPECT_EQ(lhs.unrealizedOptionPnL, rhs.unrealizedOptionPnL);
+        EXPECT_EQ(lhs.fees, rhs.fees);
+        EXPECT_EQ(lhs.contractSize, rhs.contractSize);
+        EXPECT_EQ(lhs.openOptionLegs.size(), rhs.openOptionLegs.size());
+    }
+
+    void expectSequentialResults(
+        const std::vector<PositionEvents>&                   positions,
+        const std::vector<PnLResult<finance::PositionState>>& results
+    )
+    {
+        ASSERT_EQ(results.size(), positions.size());
+
+        for (std::size_t i = 0; i < positions.size(); ++i)
+        {
+            const auto expected =
+                finance::foldEvents(PositionState{}, positions[i]);
+
+            ASSERT_EQ(results[i].has_value(), expected.has_value()) << i;
+
+            if (expected)
+                expectSameState(results[i].value(), expected.value());
+            else
+                EXPECT_EQ(
+                    results[i].error().getType(),
+                    expected.error().getType()
+                );
+        }
+    }
+}   // namespace
+
+TEST(FoldPositions, ParallelFoldMatchesSequentialFold)
+{
+    const auto positions = makePositions();
+
+    expectSequentialResults(positions, finance::foldPositions(positions));
+}
+
+TEST(FoldPositions, ExplicitWorkerCountsMatchSequentialFold)
+{
+    const auto positions = makePositions();
+
+    for (const std::size_t maxWorkers : {1U, 2U, 3U, 8U, 64U})
+    {
+        SCOPED_TRACE(maxWorkers);
+        expectSequentialResults(
+            positions,
+            finance::foldPositions(positions, maxWorkers)
+        );
+    }
+}
+
+TEST(FoldPositions, FailingPositionReportsErrorInItsSlot)
+{
+    const auto positions = makePositions();
+    const auto results   = finance::foldPositions(positions);
+
+    for (std::size_t i = 0; i < results.size(); ++i)
+        EXPECT_EQ(results[i].has_value(), i % FAILING_EVERY != 0) << i;
+
+    EXPECT_EQ(
+        results[0].error().getType(),
+        PnLErrorType::InconsistentContractSize
+    );
+}
+
+TEST(FoldPositions, SmallBatchIsFolded)
+{
+    auto positions = makePositions();
+    positions.resize(3);
+
+    expectSequentialResults(positions, finance::foldPositions(positions));
+    EXPECT_TRUE(finance::foldPositions({}).empty());
+}
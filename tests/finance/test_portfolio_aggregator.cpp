@@ -0,0 +1,163 @@
+// tests/finance/test_portfolio_aggregator.cpp
+//
+// GoogleTest-based tests for finance::PortfolioAggregator.
+//
+// Coverage:
+//  - position values and balances are summed exactly per currency, replacing
+//    and removing an amount updates its subtotal
+//  - the subtotals are converted into the base currency with the cached
+//    conversion matrix, currencies without a rate are reported
+//  - an OnFxRatesUpdated notification only reconverts the reported
+//    currencies whose rate to the base currency changed
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <vector>
+
+#include "common/cash.hpp"
+#include "common/finance.hpp"
+#include "config/id_types.hpp"
+#include "finance/fx_rate_cache.hpp"
+#include "finance/portfolio_aggregator.hpp"
+#include "test_values.hpp"
+
+namespace
+{
+    using tests::cash;
+    using tests::fxRate;
+    using tests::usd;
+
+    using finance::FxRateCache;
+    using finance::PortfolioAggregator;
+}   // namespace
+
+TEST(PortfolioAggregator, SubtotalsAreExactPerCurrency)
+{
+    PortfolioAggregator aggregator{Currency::USD};
+
+    aggregator.setPositionValue(PositionId{1}, cash(Currency::EUR, 100));
+    aggregator.setPositionValue(PositionId{2}, cash(Currency::EUR, 50));
+    aggregator.setPositionValue(PositionId{3}, usd(30));
+    aggregator.setBalance(AccountId{1}, cash(Currency::EUR, 20));
+    aggregator.setBalance(AccountId{2}, usd(5));
+
+    EXPECT_EQ(
+        aggregator.getPositionSubtotal(Currency::EUR),
+        cash(Currency::EUR, 150)
+    );
+    EXPECT_EQ(
+        aggregator.getBalanceSubtotal(Currency::EUR),
+        cash(Currency::EUR, 20)
+    );
+
+    aggregator.setPositionValue(PositionId{2}, cash(Currency::EUR, 70));
+    aggregator.setBalance(AccountId{1}, cash(Currency::EUR, -10));
+    EXPECT_TRUE(aggregator.removePosition(PositionId{1}));
+    EXPECT_FALSE(aggregator.removePosition(PositionId{1}));
+
+    EXPECT_EQ(
+        aggregator.getPositionSubtotal(Currency::EUR),
+        cash(Currency::EUR, 70)
+    );
+    EXPECT_EQ(
+        aggregator.getBalanceSubtotal(Currency::EUR),
+        cash(Currency::EUR, -10)
+    );
+    EXPECT_EQ(aggregator.getPositionSubtotal(Currency::USD), usd(30));
+    EXPECT_EQ(aggregator.getBalanceSubtotal(Currency::USD), usd(5));
+
+    // without rates only the base currency is converted
+    EXPECT_EQ(aggregator.getTotal(), usd(35));
+    EXPECT_EQ(
+        aggregator.getUnconvertedCurrencies(),
+        std::vector{Currency::EUR}
+    );
+
+    aggregator.clear();
+    EXPECT_EQ(aggregator.getTotal(), usd(0));
+    EXPECT_TRUE(aggregator.getUnconvertedCurrencies().empty());
+}
+
+TEST(PortfolioAggregator, ConvertsSubtotalsWithCachedMatrix)
+{
+    FxRateCache cache;
+    ASSERT_TRUE(cache.update({fxRate(Currency::EUR, Currency::USD, 1.2)}));
+
+    PortfolioAggregator aggregator{Currency::USD};
+    aggregator.setPositionValue(PositionId{1}, cash(Currency::EUR, 100));
+    aggregator.setPositionValue(PositionId{2}, usd(50));
+    aggregator.setBalance(AccountId{1}, cash(Currency::EUR, 10));
+    aggregator.setBalance(AccountId{2}, cash(Currency::GBP, 10));
+
+    EXPECT_EQ(aggregator.updateRates(cache.getMatrix()), 1U);
+
+    EXPECT_EQ(aggregator.getPositionsTotal(), usd(170));
+    EXPECT_EQ(aggregator.getBalancesTotal(), usd(12));
+    EXPECT_EQ(aggregator.getTotal(), usd(182));
+    EXPECT_EQ(aggregator.getSubtotal(Currency::EUR), usd(132));
+    EXPECT_EQ(
+        aggregator.getConvertedPositionValue(PositionId{1}),
+        usd(120)
+    );
+    EXPECT_FALSE(aggregator.getSubtotal(Currency::GBP).has_value());
+    EXPECT_EQ(
+        aggregator.getUnconvertedCurrencies(),
+        std::vector{Currency::GBP}
+    );
+
+    // the native subtotals stay exact
+    EXPECT_EQ(
+        aggregator.getBalanceSubtotal(Currency::GBP),
+        cash(Currency::GBP, 10)
+    );
+}
+
+TEST(PortfolioAggregator, RateUpdateReconvertsOnlyReportedCurrencies)
+{
+    FxRateCache cache;
+    ASSERT_TRUE(
+        cache.update(
+            {fxRate(Currency::EUR, Currency::USD, 1.2),
+             fxRate(Currency::GBP, Currency::USD, 1.5)}
+        )
+    );
+
+    PortfolioAggregator aggregator{Currency::USD};
+    aggregator.setPositionValue(PositionId{1}, cash(Currency::EUR, 100));
+    aggregator.setBalance(AccountId{1}, cash(Currency::GBP, 10));
+    ASSERT_EQ(aggregator.updateRates(cache.getMatrix()), 2U);
+    ASSERT_EQ(aggregator.getTotal(), usd(135));
+
+    std::size_t reconverted = 0;
+    const auto  connection  = cache.subscribeToRatesUpdated(
+        [&](const std::vector<Currency>& currencies)
+        {
+            reconverted =
+                aggregator.updateRates(cache.getMatrix(), currencies);
+        },
+        nullptr
+    );
+
+    // GBP is reported as GBP -> EUR changed, but its rate to USD did not
+    ASSERT_TRUE(cache.update({fxRate(Currency::EUR, Currency::USD, 1.5)}));
+    EXPECT_EQ(reconverted, 1U);
+    EXPECT_EQ(aggregator.getSubtotal(Currency::EUR), usd(150));
+    EXPECT_EQ(aggregator.getTotal(), usd(165));
+
+    // currencies that are not reported keep their converted subtotal
+    FxRateCache other;
+    ASSERT_TRUE(
+        other.update(
+            {fxRate(Currency::EUR, Currency::USD, 2.0),
+             fxRate(Currency::GBP, Currency::USD, 2.0)}
+        )
+    );
+
+    EXPECT_EQ(
+        aggregator.updateRates(other.getMatrix(), {Currency::GBP}),
+        1U
+    );
+    EXPECT_EQ(aggregator.getSubtotal(Currency::EUR), usd(150));
+    EXPECT_EQ(aggregator.getSubtotal(Currency::GBP), usd(20));
+}
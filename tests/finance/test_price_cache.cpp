@@ -0,0 +1,99 @@
+// tests/finance/test_price_cache.cpp
+//
+// GoogleTest-based tests for the watched symbols of finance::PriceCache.
+//
+// Coverage:
+//  - a symbol watched twice stays watched after one unwatch
+//  - the last unwatch drops the symbol, unknown symbols are ignored
+//  - OnWatchedSymbolsAdded fires only if a symbol was not watched before
+//  - unwatching keeps the cached quotes
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <unordered_set>
+
+#include "common/timestamp.hpp"
+#include "finance/price_cache.hpp"
+#include "finance/price_quote.hpp"
+#include "test_values.hpp"
+
+namespace
+{
+    using tests::usd;
+
+    using finance::PriceCache;
+    using finance::PriceQuote;
+
+    using Symbols = std::unordered_set<std::string>;
+}   // namespace
+
+TEST(PriceCache, WatchIsReferenceCounted)
+{
+    PriceCache cache;
+
+    cache.watch({"AAPL", "MSFT"});
+    cache.watch({"AAPL"});
+    cache.unwatch({"AAPL"});
+
+    EXPECT_EQ(cache.getWatchedSymbols(), (Symbols{"AAPL", "MSFT"}));
+}
+
+TEST(PriceCache, LastUnwatchDropsSymbol)
+{
+    PriceCache cache;
+
+    cache.watch({"AAPL", "MSFT"});
+    cache.watch({"AAPL"});
+
+    cache.unwatch({"AAPL", "MSFT"});
+    EXPECT_EQ(cache.getWatchedSymbols(), (Symbols{"AAPL"}));
+
+    cache.unwatch({"AAPL", "NVDA"});
+    EXPECT_TRUE(cache.getWatchedSymbols().empty());
+
+    // a dropped symbol starts counting from zero again
+    cache.watch({"AAPL"});
+    cache.unwatch({"AAPL"});
+    EXPECT_TRUE(cache.getWatchedSymbols().empty());
+}
+
+TEST(PriceCache, WatchNotifiesOnlyForNewSymbols)
+{
+    PriceCache cache;
+    int        notifications = 0;
+    const auto connection    = cache.subscribeToWatchedSymbolsAdded(
+        [&notifications] { ++notifications; },
+        nullptr
+    );
+
+    cache.watch({"AAPL"});
+    EXPECT_EQ(notifications, 1);
+
+    // already watched symbols do not notify, not even in a batch
+    cache.watch({"AAPL"});
+    cache.watch({"AAPL", "AAPL"});
+    EXPECT_EQ(notifications, 1);
+
+    // one notification per batch containing a new symbol
+    cache.watch({"AAPL", "MSFT", "NVDA"});
+    EXPECT_EQ(notifications, 2);
+
+    cache.unwatch({"MSFT"});
+    EXPECT_EQ(notifications, 2);
+
+    cache.watch({"MSFT"});
+    EXPECT_EQ(notifications, 3);
+}
+
+TEST(PriceCache, UnwatchKeepsCachedQuotes)
+{
+    PriceCache cache;
+
+    cache.watch({"AAPL"});
+    cache.update({{"AAPL", PriceQuote{usd(190), Timestamp::fromInt64(0)}}});
+    cache.unwatch({"AAPL"});
+
+    EXPECT_TRUE(cache.getWatchedSymbols().empty());
+    EXPECT_TRUE(cache.get("AAPL").has_value());
+}
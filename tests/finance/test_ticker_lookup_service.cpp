@@ -0,0 +1,352 @@
+// tests/finance/test_ticker_lookup_service.cpp
+//
+// GoogleTest-based tests for finance::TickerLookupService, the fetcher is
+// replaced by a fake that counts and optionally blocks its calls.
+//
+// Coverage:
+//  - normalize converts symbols to upper case
+//  - a cache miss is fetched on the worker, a cache hit is answered directly
+//  - expired entries are fetched again
+//  - failed lookups are reported but not cached
+//  - concurrent requests of the same symbol are coalesced into one fetch
+//  - clear drops the cached and the persisted entries
+//  - the persisted cache is loaded by a new service
+//  - a disconnected subscriber is not notified
+//  - stopping the service drops pending requests and is idempotent
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "finance/ticker_lookup_service.hpp"
+#include "test_fixtures.hpp"
+
+namespace
+{
+    using tests::TempDir;
+
+    using namespace std::chrono_literals;
+
+    using finance::Stock;
+    using finance::TickerLookupService;
+
+    /// Upper bound for waiting on the worker thread
+    constexpr auto Timeout = 5s;
+
+    Stock makeStock(const std::string& ticker)
+    {
+        return Stock{
+            ticker,
+            Currency::USD,
+            ticker + " Inc.",
+            ticker + " Incorporated",
+            "NMS",
+            "Technology",
+            "Software",
+            AssetClass::Stock
+        };
+    }
+
+    // NOLINTBEGIN(misc-non-private-member-variables-in-classes)
+    /**
+     * @brief Fake fetcher state shared between the test and the worker
+     * thread, fetches block while the gate is closed
+     *
+     */
+    struct FakeFetcher
+    {
+        std::mutex              mutex;
+        std::condition_variable condition;
+        std::vector<std::string> fetched;
+        bool                     gateOpen = true;
+        bool                     fail     = false;
+
+        TickerLookupService::Fetcher makeFetcher()
+        {
+            return [this](const std::string& ticker)
+                       -> YFinanceResult<Stock>
+            {
+                std::unique_lock lock{mutex};
+                fetched.push_back(ticker);
+                condition.notify_all();
+                condition.wait(lock, [this] { return gateOpen; });
+
+                if (fail)
+                    return std::unexpected(
+                        YFinanceError{YFinanceErrorType::InvalidTicker}
+                    );
+
+                return makeStock(ticker);
+            };
+        }
+
+        void close()
+        {
+            const std::scoped_lock lock{mutex};
+            gateOpen = false;
+        }
+
+        void open()
+        {
+            {
+                const std::scoped_lock lock{mutex};
+                gateOpen = true;
+            }
+            condition.notify_all();
+        }
+
+        bool waitForFetches(std::size_t count)
+        {
+            std::unique_lock lock{mutex};
+            return condition.wait_for(
+                lock,
+                Timeout,
+                [this, count] { return fetched.size() >= count; }
+            );
+        }
+
+        std::size_t fetchCount()
+        {
+            const std::scoped_lock lock{mutex};
+            return fetched.size();
+        }
+    };
+
+    /**
+     * @brief Records the finished lookups delivered to a subscriber
+     *
+     */
+    struct LookupRecorder
+    {
+        std::mutex               mutex;
+        std::condition_variable  condition;
+        std::vector<std::string> tickers;
+        std::size_t              failures = 0;
+
+        Connection subscribe(TickerLookupService& service)
+        {
+            return service.subscribeToLookup(
+                [this](
+                    const std::string&                    ticker,
+                    const YFinanceResult<Stock>& result
+                )
+                {
+                    {
+                        const std::scoped_lock lock{mutex};
+                        tickers.push_back(ticker);
+                        if (!result)
+                            ++failures;
+                    }
+                    condition.notify_all();
+                },
+                this
+            );
+        }
+
+        bool waitForLookups(std::size_t count)
+        {
+            std::unique_lock lock{mutex};
+            return condition.wait_for(
+                lock,
+                Timeout,
+                [this, count] { return tickers.size() >= count; }
+            );
+        }
+
+        std::size_t lookupCount()
+        {
+            const std::scoped_lock lock{mutex};
+            return tickers.size();
+        }
+    };
+    // NOLINTEND(misc-non-private-member-variables-in-classes)
+}   // namespace
+
+TEST(TickerLookupService, NormalizeUppercasesSymbols)
+{
+    EXPECT_EQ(TickerLookupService::normalize("aapl"), "AAPL");
+    EXPECT_EQ(TickerLookupService::normalize("Brk.b"), "BRK.B");
+    EXPECT_EQ(TickerLookupService::normalize(""), "");
+}
+
+TEST(TickerLookupService, CacheMissIsFetchedAndCacheHitIsAnsweredDirectly)
+{
+    FakeFetcher         fetcher;
+    TickerLookupService service{{}, 1h, fetcher.makeFetcher()};
+    LookupRecorder      recorder;
+    const auto          connection = recorder.subscribe(service);
+
+    EXPECT_FALSE(service.request("aapl").has_value());
+    ASSERT_TRUE(recorder.waitForLookups(1));
+    EXPECT_EQ(recorder.tickers.front(), "AAPL");
+
+    const auto cached = service.request("AAPL");
+    ASSERT_TRUE(cached.has_value());
+    EXPECT_EQ(cached->getTicker(), "AAPL");
+    EXPECT_TRUE(service.getCached("aapl").has_value());
+    EXPECT_EQ(fetcher.fetchCount(), 1U);
+}
+
+TEST(TickerLookupService, ExpiredEntryIsFetchedAgain)
+{
+    FakeFetcher         fetcher;
+    TickerLookupService service{{}, 0s, fetcher.makeFetcher()};
+    LookupRecorder      recorder;
+    const auto          connection = recorder.subscribe(service);
+
+    EXPECT_FALSE(service.request("AAPL").has_value());
+    ASSERT_TRUE(recorder.waitForLookups(1));
+
+    EXPECT_FALSE(service.getCached("AAPL").has_value());
+    EXPECT_FALSE(service.request("AAPL").has_value());
+    ASSERT_TRUE(recorder.waitForLookups(2));
+    EXPECT_EQ(fetcher.fetchCount(), 2U);
+}
+
+TEST(TickerLookupService, FailedLookupIsReportedButNotCached)
+{
+    FakeFetcher fetcher;
+    fetcher.fail = true;
+
+    TickerLookupService service{{}, 1h, fetcher.makeFetcher()};
+    LookupRecorder      recorder;
+    const auto          connection = recorder.subscribe(service);
+
+    EXPECT_FALSE(service.request("NOPE").has_value());
+    ASSERT_TRUE(recorder.waitForLookups(1));
+
+    EXPECT_EQ(recorder.failures, 1U);
+    EXPECT_FALSE(service.getCached("NOPE").has_value());
+    EXPECT_FALSE(service.isPending("NOPE"));
+}
+
+TEST(TickerLookupService, ConcurrentRequestsAreCoalesced)
+{
+    FakeFetcher fetcher;
+    fetcher.close();
+
+    TickerLookupService service{{}, 1h, fetcher.makeFetcher()};
+    LookupRecorder      recorder;
+    const auto          connection = recorder.subscribe(service);
+
+    EXPECT_FALSE(service.request("AAPL").has_value());
+    ASSERT_TRUE(fetcher.waitForFetches(1));
+
+    // the fetch is blocked, further requests only join it
+    EXPECT_FALSE(service.request("aapl").has_value());
+    EXPECT_FALSE(service.request("AAPL").has_value());
+    EXPECT_TRUE(service.isPending("Aapl"));
+
+    fetcher.open();
+    ASSERT_TRUE(recorder.waitForLookups(1));
+
+    EXPECT_EQ(fetcher.fetchCount(), 1U);
+    EXPECT_EQ(recorder.lookupCount(), 1U);
+    EXPECT_FALSE(service.isPending("AAPL"));
+}
+
+TEST(TickerLookupService, ClearDropsCachedAndPersistedEntries)
+{
+    const TempDir tmp;
+    const auto    cachePath = tmp.path() / "tickers.json";
+    FakeFetcher   fetcher;
+
+    {
+        TickerLookupService service{cachePath, 1h, fetcher.makeFetcher()};
+        LookupRecorder      recorder;
+        const auto          connection = recorder.subscribe(service);
+
+        EXPECT_FALSE(service.request("AAPL").has_value());
+        ASSERT_TRUE(recorder.waitForLookups(1));
+
+        service.clear();
+        EXPECT_FALSE(service.getCached("AAPL").has_value());
+    }
+
+    const TickerLookupService reloaded{cachePath, 1h, fetcher.makeFetcher()};
+    EXPECT_FALSE(reloaded.getCached("AAPL").has_value());
+}
+
+TEST(TickerLookupService, PersistedCacheIsLoadedByNewService)
+{
+    const TempDir tmp;
+    const auto    cachePath = tmp.path() / "tickers.json";
+    FakeFetcher   fetcher;
+
+    {
+        TickerLookupService service{cachePath, 1h, fetcher.makeFetcher()};
+        LookupRecorder      recorder;
+        const auto          connection = recorder.subscribe(service);
+
+        EXPECT_FALSE(service.request("AAPL").has_value());
+        EXPECT_FALSE(service.request("MSFT").has_value());
+        ASSERT_TRUE(recorder.waitForLookups(2));
+    }
+
+    TickerLookupService reloaded{cachePath, 1h, fetcher.makeFetcher()};
+
+    const auto stock = reloaded.request("msft");
+    ASSERT_TRUE(stock.has_value());
+    EXPECT_EQ(stock->getTicker(), "MSFT");
+    EXPECT_EQ(stock->getShortName(), "MSFT Inc.");
+    EXPECT_TRUE(reloaded.getCached("AAPL").has_value());
+    EXPECT_EQ(fetcher.fetchCount(), 2U);
+}
+
+TEST(TickerLookupService, DisconnectedSubscriberIsNotNotified)
+{
+    FakeFetcher         fetcher;
+    TickerLookupService service{{}, 1h, fetcher.makeFetcher()};
+    LookupRecorder      disconnected;
+    LookupRecorder      connected;
+    auto                connection = disconnected.subscribe(service);
+    const auto          other      = connected.subscribe(service);
+
+    connection.reset();
+
+    EXPECT_FALSE(service.request("AAPL").has_value());
+    ASSERT_TRUE(connected.waitForLookups(1));
+    EXPECT_EQ(disconnected.lookupCount(), 0U);
+}
+
+TEST(TickerLookupService, StopDropsPendingRequests)
+{
+    FakeFetcher fetcher;
+    fetcher.close();
+
+    LookupRecorder recorder;
+    {
+        TickerLookupService service{{}, 1h, fetcher.makeFetcher()};
+        const auto          connection = recorder.subscribe(service);
+
+        EXPECT_FALSE(service.request("AAPL").has_value());
+        ASSERT_TRUE(fetcher.waitForFetches(1));
+        EXPECT_FALSE(service.request("MSFT").has_value());
+
+        // the fetch in progress is finished, the queued one is dropped
+        const std::jthread opener{
+            [&fetcher]
+            {
+                std::this_thread::sleep_for(20ms);
+                fetcher.open();
+            }
+        };
+
+        service.stop();
+        service.stop();
+
+        EXPECT_TRUE(service.isPending("MSFT"));
+    }
+
+    EXPECT_EQ(fetcher.fetchCount(), 1U);
+    EXPECT_EQ(recorder.lookupCount(), 1U);
+}
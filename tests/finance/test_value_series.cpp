@@ -0,0 +1,370 @@
+// tests/finance/test_value_series.cpp
+//
+// GoogleTest-based tests for finance::buildValueSeries, the sweep is
+// compared with a naive fold of every position for every day.
+//
+// Coverage:
+//  - buys, partial sells and a full close match the naive fold
+//  - days without events or closes carry the last close forward
+//  - positions of different currencies are converted into the base currency
+//  - closes in another currency are converted into the position currency
+//  - a missing rate and a position mixing currencies are reported as errors
+//  - an empty range yields no points
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+#include "common/cash.hpp"
+#include "common/finance.hpp"
+#include "common/quantity.hpp"
+#include "common/timestamp.hpp"
+#include "config/id_types.hpp"
+#include "finance/fx_rate_cache.hpp"
+#include "finance/transaction/pnl.hpp"
+#include "finance/transaction/value_series.hpp"
+#include "test_values.hpp"
+
+namespace
+{
+    using tests::cash;
+    using tests::quantity;
+
+    using namespace std::chrono_literals;
+
+    using finance::ConversionMatrix;
+    using finance::DailyClose;
+    using finance::PortfolioValuePoint;
+    using finance::PositionEvent;
+    using finance::PositionState;
+    using finance::SeriesPosition;
+    using finance::StockTrade;
+
+    using Day = std::chrono::sys_days;
+
+    /// Milliseconds per day
+    constexpr std::int64_t MS_PER_DAY = 86'400'000;
+
+    /// The first day of the test ranges
+    constexpr Day DAY_0 = std::chrono::sys_days{2024y / 5 / 6};
+
+    /**
+     * @brief A stock trade at noon of a day relative to DAY_0, negative
+     * shares sell
+     *
+     */
+    [[nodiscard]] PositionEvent trade(
+        int          day,
+        std::int64_t shares,
+        const Cash&  price
+    )
+    {
+        const auto dayStart =
+            std::chrono::duration_cast<std::chrono::milliseconds>(
+                (DAY_0 + std::chrono::days{day}).time_since_epoch()
+            );
+
+        return PositionEvent{
+            .timestamp =
+                Timestamp::fromInt64(dayStart.count() + (MS_PER_DAY / 2)),
+            .data = StockTrade{
+                quantity(shares),
+                price,
+                Cash{price.getCurrency(), 0}
+            }
+        };
+    }
+
+    [[nodiscard]] DailyClose close(int day, const Cash& price)
+    {
+        return DailyClose{DAY_0 + std::chrono::days{day}, price};
+    }
+
+    /**
+     * @brief Folds every position from scratch for every day, the reference
+     * for the sweep
+     *
+     */
+    [[nodiscard]] std::vector<PortfolioValuePoint> naiveSeries(
+        const std::vector<SeriesPosition>& positions,
+        Day                                from,
+        Day                                to,
+        Currency                           base,
+        const ConversionMatrix&            rates
+    )
+    {
+        std::vector<PortfolioValuePoint> series;
+
+        for (auto day = from; day <= to; day += std::chrono::days{1})
+        {
+            PortfolioValuePoint point{day, Cash{base, 0}, Cash{base, 0}};
+
+            for (const auto& position : positions)
+            {
+                auto events = position.events;
+                events.sort();
+
+                finance::PositionEvents applied;
+                for (const auto& event : events)
+                    if (finance::toDay(event.timestamp) <= day)
+                        applied.add(event);
+
+                const auto state =
+                    finance::foldEvents(PositionState{}, applied).value();
+
+                if (state.openQuantity.isZero())
+                    continue;
+
+                std::optional<Cash> latest;
+                std::optional<Day>  latestDay;
+                for (const auto& dailyClose : position.closes)
+                {
+                    if (dailyClose.day <= day &&
+                        (!latestDay || dailyClose.day >= *latestDay))
+                    {
+                        latestDay = dailyClose.day;
+                        latest    = dailyClose.close;
+                    }
+                }
+
+                const auto currency = state.costBasis.getCurrency();
+                if (latest && latest->getCurrency() != currency)
+                    latest = rates.convert(*latest, currency).value();
+
+                const auto pnl   = finance::snapshot(state, latest);
+                const auto value = pnl.costBasis + pnl.unrealizedPnL;
+
+                point.marketValue += currency == base
+                                         ? value
+                                         : rates.convert(value, base).value();
+                point.costBasis +=
+                    currency == base ? pnl.costBasis
+                                     : rates.convert(pnl.costBasis, base)
+                                           .value();
+            }
+
+            series.push_back(point);
+        }
+
+        return series;
+    }
+
+    void expectSameSeries(
+        const std::vector<PortfolioValuePoint>& actual,
+        const std::vector<PortfolioValuePoint>& expected
+    )
+    {
+        ASSERT_EQ(actual.size(), expected.size());
+
+        for (std::size_t i = 0; i < actual.size(); ++i)
+        {
+            EXPECT_EQ(actual[i].day, expected[i].day) << i;
+            EXPECT_EQ(actual[i].marketValue, expected[i].marketValue) << i;
+            EXPECT_EQ(actual[i].costBasis, expected[i].costBasis) << i;
+        }
+    }
+
+    [[nodiscard]] ConversionMatrix eurUsdRates()
+    {
+        ConversionMatrix rates;
+        rates.set(Currency::EUR, Currency::USD, 1.1);
+        rates.set(Currency::USD, Currency::EUR, 1.0 / 1.1);
+        return rates;
+    }
+}   // namespace
+
+TEST(ValueSeries, BuysSellsAndFullCloseMatchNaiveFold)
+{
+    const auto usd = [](std::int64_t units)
+    { return cash(Currency::USD, units); };
+
+    std::vector<SeriesPosition> positions(2);
+
+    positions[0].id = PositionId{1};
+    positions[0].events.add(trade(1, 10, usd(100)));
+    positions[0].events.add(trade(3, 5, usd(110)));
+    positions[0].events.add(trade(5, -8, usd(120)));
+    positions[0].events.add(trade(7, -7, usd(115)));
+    positions[0].closes = {
+        close(0, usd(99)),
+        close(2, usd(105)),
+        close(4, usd(112)),
+        close(6, usd(118)),
+        close(8, usd(116))
+    };
+
+    // events out of order, bought before the range starts
+    positions[1].id = PositionId{2};
+    positions[1].events.add(trade(4, -2, usd(55)));
+    positions[1].events.add(trade(-3, 4, usd(50)));
+    positions[1].closes = {close(-2, usd(48)), close(5, usd(57))};
+
+    const auto rates = ConversionMatrix{};
+    const auto to    = DAY_0 + std::chrono::days{9};
+
+    const auto series =
+        finance::buildValueSeries(positions, DAY_0, to, Currency::USD, rates);
+
+    ASSERT_TRUE(series.has_value());
+    expectSameSeries(
+        series.value(),
+        naiveSeries(positions, DAY_0, to, Currency::USD, rates)
+    );
+
+    // the first position is fully closed on day 7
+    EXPECT_EQ(series->back().costBasis, usd(100));
+    EXPECT_EQ(series->back().marketValue, usd(114));
+}
+
+TEST(ValueSeries, GapDaysCarryLastCloseForward)
+{
+    const auto usd = [](std::int64_t units)
+    { return cash(Currency::USD, units); };
+
+    std::vector<SeriesPosition> positions(1);
+    positions[0].id = PositionId{1};
+    positions[0].events.add(trade(0, 10, usd(100)));
+    positions[0].closes = {close(0, usd(101)), close(4, usd(90))};
+
+    const auto rates = ConversionMatrix{};
+    const auto to    = DAY_0 + std::chrono::days{5};
+
+    const auto series =
+        finance::buildValueSeries(positions, DAY_0, to, Currency::USD, rates);
+
+    ASSERT_TRUE(series.has_value());
+    expectSameSeries(
+        series.value(),
+        naiveSeries(positions, DAY_0, to, Currency::USD, rates)
+    );
+
+    for (std::size_t day = 0; day < 4; ++day)
+        EXPECT_EQ(series.value()[day].marketValue, usd(1010)) << day;
+
+    EXPECT_EQ(series.value()[4].marketValue, usd(900));
+    EXPECT_EQ(series.value()[5].marketValue, usd(900));
+}
+
+TEST(ValueSeries, MixedCurrenciesAreConvertedIntoBaseCurrency)
+{
+    std::vector<SeriesPosition> positions(2);
+
+    positions[0].id = PositionId{1};
+    positions[0].events.add(trade(0, 10, cash(Currency::USD, 100)));
+    positions[0].closes = {close(1, cash(Currency::USD, 110))};
+
+    positions[1].id = PositionId{2};
+    positions[1].events.add(trade(0, 10, cash(Currency::EUR, 50)));
+    positions[1].events.add(trade(2, -5, cash(Currency::EUR, 60)));
+    positions[1].closes = {
+        close(1, cash(Currency::EUR, 55)),
+        close(3, cash(Currency::USD, 66))
+    };
+
+    const auto rates = eurUsdRates();
+    const auto to    = DAY_0 + std::chrono::days{4};
+
+    for (const auto base : {Currency::USD, Currency::EUR})
+    {
+        SCOPED_TRACE(CurrencyMeta::toString(base));
+
+        const auto series =
+            finance::buildValueSeries(positions, DAY_0, to, base, rates);
+
+        ASSERT_TRUE(series.has_value());
+        expectSameSeries(
+            series.value(),
+            naiveSeries(positions, DAY_0, to, base, rates)
+        );
+        EXPECT_EQ(series->back().marketValue.getCurrency(), base);
+    }
+
+    const auto series = finance::buildValueSeries(
+        positions,
+        DAY_0,
+        to,
+        Currency::USD,
+        rates
+    );
+    ASSERT_TRUE(series.has_value());
+
+    // 10 * 110 USD + 10 * 55 EUR at 1.1
+    EXPECT_EQ(series.value()[1].marketValue, cash(Currency::USD, 1705));
+}
+
+TEST(ValueSeries, MissingRateIsReportedAsError)
+{
+    std::vector<SeriesPosition> positions(1);
+    positions[0].id = PositionId{1};
+    positions[0].events.add(trade(0, 10, cash(Currency::CHF, 100)));
+
+    const auto series = finance::buildValueSeries(
+        positions,
+        DAY_0,
+        DAY_0 + std::chrono::days{1},
+        Currency::USD,
+        eurUsdRates()
+    );
+
+    ASSERT_FALSE(series.has_value());
+    EXPECT_EQ(series.error().getType(), FinanceErrorType::CurrencyUnknown);
+}
+
+TEST(ValueSeries, MissingCloseRateIsReportedAsError)
+{
+    std::vector<SeriesPosition> positions(1);
+    positions[0].id = PositionId{1};
+    positions[0].events.add(trade(0, 10, cash(Currency::USD, 100)));
+    positions[0].closes = {close(0, cash(Currency::GBP, 80))};
+
+    const auto series = finance::buildValueSeries(
+        positions,
+        DAY_0,
+        DAY_0 + std::chrono::days{1},
+        Currency::USD,
+        eurUsdRates()
+    );
+
+    ASSERT_FALSE(series.has_value());
+    EXPECT_EQ(series.error().getType(), FinanceErrorType::CurrencyUnknown);
+}
+
+TEST(ValueSeries, PositionMixingCurrenciesIsReportedAsError)
+{
+    std::vector<SeriesPosition> positions(1);
+    positions[0].id = PositionId{1};
+    positions[0].events.add(trade(0, 10, cash(Currency::USD, 100)));
+    positions[0].events.add(trade(1, 10, cash(Currency::EUR, 100)));
+
+    const auto series = finance::buildValueSeries(
+        positions,
+        DAY_0,
+        DAY_0 + std::chrono::days{1},
+        Currency::USD,
+        eurUsdRates()
+    );
+
+    ASSERT_FALSE(series.has_value());
+    EXPECT_EQ(series.error().getType(), FinanceErrorType::InvalidPosition);
+}
+
+TEST(ValueSeries, EmptyRangeYieldsNoPoints)
+{
+    const std::vector<SeriesPosition> positions;
+
+    const auto series = finance::buildValueSeries(
+        positions,
+        DAY_0 + std::chrono::days{1},
+        DAY_0,
+        Currency::USD,
+        ConversionMatrix{}
+    );
+
+    ASSERT_TRUE(series.has_value());
+    EXPECT_TRUE(series->empty());
+}
@@ -0,0 +1,372 @@
+#ifndef __TESTS__GATEWAY__FAKE_STORES_HPP__
+#define __TESTS__GATEWAY__FAKE_STORES_HPP__
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "common/container/id_id_map.hpp"
+#include "common/container/id_map.hpp"
+#include "connections/connection.hpp"
+#include "config/id_types.hpp"
+#include "finance/account/account.hpp"
+#include "finance/account/accounts.hpp"
+#include "finance/instrument/option.hpp"
+#include "finance/instrument/stock.hpp"
+#include "finance/instrument/stocks.hpp"
+#include "finance/positions.hpp"
+#include "finance/transaction/transaction_filter.hpp"
+#include "finance/transaction/transactions.hpp"
+#include "store/i_account_store.hpp"
+#include "store/i_option_store.hpp"
+#include "store/i_position_store.hpp"
+#include "store/i_stock_store.hpp"
+#include "store/i_transaction_store.hpp"
+
+namespace tests
+{
+
+    class FakeTransactionStore : public store::ITransactionStore
+    {
+       public:
+        // NOLINTBEGIN(misc-non-private-member-variables-in-classes)
+        finance::Transactions                   transactions;
+        std::uint64_t                           version = 0;
+        std::vector<finance::DomainTransaction> addedTransactions;
+        int                                     addBatchCallCount = 0;
+        // NOLINTEND(misc-non-private-member-variables-in-classes)
+
+        [[nodiscard]] std::uint64_t getVersion() const override
+        {
+            return version;
+        }
+
+        [[nodiscard]] store::TransactionStoreResult addCashTransaction(
+            finance::CashTransaction /*transaction*/
+        ) override
+        {
+            return store::TransactionStoreResult::Error;
+        }
+
+        [[nodiscard]] store::TransactionStoreResult addStockTransaction(
+            finance::StockTransaction transaction
+        ) override
+        {
+            transactions.addTransaction(transaction);
+            ++version;
+            return store::TransactionStoreResult::Ok;
+        }
+
+        [[nodiscard]] store::TransactionStoreResult addOptionTransaction(
+            finance::OptionTransaction transaction
+        ) override
+        {
+            transactions.addTransaction(transaction);
+            ++version;
+            return store::TransactionStoreResult::Ok;
+        }
+
+        [[nodiscard]] store::TransactionStoreResult addTransactions(
+            std::vector<finance::DomainTransaction> batch
+        ) override
+        {
+            ++addBatchCallCount;
+            addedTransactions.insert(
+                addedTransactions.end(),
+                batch.begin(),
+                batch.end()
+            );
+            ++version;
+            return store::TransactionStoreResult::Ok;
+        }
+
+        [[nodiscard]] FinanceResult<finance::Transactions> getTransactions(
+            finance::TransactionFilter filter
+        ) const override
+        {
+            if (filter.accountIds.empty())
+                return transactions;
+
+            return transactions.filter(filter.accountIds);
+        }
+
+        [[nodiscard]] FinanceResult<finance::Transactions> getTransactions(
+        ) const override
+        {
+            return transactions;
+        }
+
+        [[nodiscard]] Connection subscribeToTransactionAdded(
+            store::OnTransactionAdded::func /*func*/,
+            void* /*user*/
+        ) override
+        {
+            return {};
+        }
+    };
+
+    class FakePositionStore : public store::IPositionStore
+    {
+       public:
+        // NOLINTBEGIN(misc-non-private-member-variables-in-classes)
+        finance::Positions  positions;
+        IdIdMap<PositionId> idRemap;
+        std::uint64_t       version = 0;
+        // NOLINTEND(misc-non-private-member-variables-in-classes)
+
+       private:
+        int _nextId = 1;
+
+       public:
+        [[nodiscard]] std::uint64_t getVersion() const override
+        {
+            return version;
+        }
+
+        [[nodiscard]] PositionId createPosition(
+            const finance::Position& position
+        ) override
+        {
+            auto newPosition = position;
+            newPosition.setId(PositionId{_nextId++});
+            positions.addUnchecked(newPosition);
+            ++version;
+            return newPosition.getId();
+        }
+
+        [[nodiscard]] finance::Positions getAllPositions() const override
+        {
+            return positions;
+        }
+
+        [[nodiscard]] finance::Positions getOpenPositions() const override
+        {
+            return positions.getOpenPositions();
+        }
+
+        [[nodiscard]] const IdIdMap<PositionId>& getIdRemap() const override
+        {
+            return idRemap;
+        }
+
+        [[nodiscard]] Connection subscribeToPositionClosed(
+            store::PositionClosed::func /*func*/,
+            void* /*user*/
+        ) override
+        {
+            return {};
+        }
+    };
+
+    class FakeOptionStore : public store::IOptionStore
+    {
+       public:
+        // NOLINTBEGIN(misc-non-private-member-variables-in-classes)
+        IdMap<InstrumentId, finance::Option> options;
+        IdIdMap<InstrumentId>                instrumentIdMap;
+        std::uint64_t                        version           = 0;
+        mutable int                          getOptionCallCount = 0;
+        // NOLINTEND(misc-non-private-member-variables-in-classes)
+
+        [[nodiscard]] std::uint64_t getVersion() const override
+        {
+            return version;
+        }
+
+        [[nodiscard]] std::expected<InstrumentId, store::OptionStoreResult>
+        addOption(finance::Option option) override
+        {
+            options.addUnchecked(option.getInstrumentId(), option);
+            ++version;
+            return option.getInstrumentId();
+        }
+
+        [[nodiscard]] const IdIdMap<InstrumentId>& getInstrumentIdMap(
+        ) const override
+        {
+            return instrumentIdMap;
+        }
+
+        [[nodiscard]] finance::Options getOptions(
+            const IdSet<InstrumentId>& /*instrumentIds*/
+        ) const override
+        {
+            return {};
+        }
+
+        [[nodiscard]] std::optional<finance::Option> getOption(
+            InstrumentId instrumentId
+        ) const override
+        {
+            ++getOptionCallCount;
+
+            if (!options.contains(instrumentId))
+                return std::nullopt;
+
+            return options.at(instrumentId);
+        }
+    };
+
+    class FakeStockStore : public store::IStockStore
+    {
+       public:
+        // NOLINTBEGIN(misc-non-private-member-variables-in-classes)
+        IdMap<InstrumentId, finance::Stock> stocks;
+        IdIdMap<InstrumentId>               instrumentIdMap;
+        std::uint64_t                       version = 0;
+        // NOLINTEND(misc-non-private-member-variables-in-classes)
+
+        [[nodiscard]] std::uint64_t getVersion() const override
+        {
+            return version;
+        }
+
+        [[nodiscard]] store::StockStoreResult addStock(
+            finance::Stock /*stock*/
+        ) override
+        {
+            return store::StockStoreResult::Error;
+        }
+
+        [[nodiscard]] std::optional<finance::Stock> getStock(
+            InstrumentId id
+        ) const override
+        {
+            if (!stocks.contains(id))
+                return std::nullopt;
+
+            return stocks.at(id);
+        }
+
+        [[nodiscard]] finance::Stocks getStocks(
+            const IdSet<InstrumentId>& /*ids*/
+        ) const override
+        {
+            return {};
+        }
+
+        [[nodiscard]] finance::Stocks getStocks() const override
+        {
+            finance::Stocks result;
+            for (const auto& [_, stock] : stocks)
+                result.addUnchecked(stock);
+
+            return result;
+        }
+
+        [[nodiscard]] Set<std::string> getAllTickers() const override
+        {
+            return {};
+        }
+
+        [[nodiscard]] IdMap<InstrumentId, std::string> getInstrumentIdToNameMap(
+        ) const override
+        {
+            return {};
+        }
+
+        [[nodiscard]] std::optional<InstrumentId> getInstrumentId(
+            const std::string& /*ticker*/
+        ) const override
+        {
+            return std::nullopt;
+        }
+
+        [[nodiscard]] const IdIdMap<InstrumentId>& getInstrumentIdMap(
+        ) const override
+        {
+            return instrumentIdMap;
+        }
+
+        [[nodiscard]] Connection subscribeToStoreChange(
+            StoreChanged<StockId>::func /*func*/,
+            void* /*subscriber*/
+        ) override
+        {
+            return {};
+        }
+    };
+
+    class FakeAccountStore : public store::IAccountStore
+    {
+       public:
+        // NOLINTBEGIN(misc-non-private-member-variables-in-classes)
+        finance::Accounts  accounts;
+        IdIdMap<AccountId> idRemap;
+        // NOLINTEND(misc-non-private-member-variables-in-classes)
+
+        [[nodiscard]] store::AccountStoreResult createAccount(
+            const finance::Account& /*account*/
+        ) override
+        {
+            return store::AccountStoreResult::Error;
+        }
+
+        [[nodiscard]] const IdIdMap<AccountId>& getIdRemap() const override
+        {
+            return idRemap;
+        }
+
+        [[nodiscard]] std::optional<finance::Account> getAccount(
+            AccountId id
+        ) const override
+        {
+            if (!accounts.contains(id))
+                return std::nullopt;
+
+            return accounts.at(id);
+        }
+
+        [[nodiscard]] std::vector<finance::Account> getAllAccounts(
+        ) const override
+        {
+            return {};
+        }
+
+        [[nodiscard]] std::vector<finance::Account> getCashAccounts(
+        ) const override
+        {
+            return {};
+        }
+
+        [[nodiscard]] std::vector<finance::Account> getSecurityAccounts(
+        ) const override
+        {
+            return {};
+        }
+
+        [[nodiscard]] IdMap<AccountId, std::string> getAccountIdToNameMap(
+        ) const override
+        {
+            return {};
+        }
+
+        [[nodiscard]] std::optional<AccountId> getExternalAccount(
+            Currency /*currency*/
+        ) const override
+        {
+            return std::nullopt;
+        }
+
+        [[nodiscard]] IdSet<AccountId> getExternalAccountIds() const override
+        {
+            return {};
+        }
+
+        void updateActiveProfile(
+            const std::optional<ProfileId>& /*profileIdOpt*/
+        ) override
+        {
+        }
+
+        [[nodiscard]] const finance::Accounts& getAccountSession(
+        ) const override
+        {
+            return accounts;
+        }
+    };
+
+}   // namespace tests
+
+#endif   // __TESTS__GATEWAY__FAKE_STORES_HPP__
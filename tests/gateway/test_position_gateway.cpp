@@ -0,0 +1,305 @@
+// tests/gateway/test_position_gateway.cpp
+//
+// GoogleTest-based tests for gateway::PositionGateway.
+//
+// Coverage:
+//  - a memoized position state is reused for the same view, the mark price is
+//    applied on every call
+//  - a version change of any contributing store drops the memoized state
+//  - a view over different transactions of a memoized position is folded
+//    again
+//  - the portfolio value series carries closes over days without a close and
+//    is converted into the base currency
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "common/cash.hpp"
+#include "common/finance.hpp"
+#include "common/quantity.hpp"
+#include "common/timestamp.hpp"
+#include "config/id_types.hpp"
+#include "fake_stores.hpp"
+#include "finance/fx_rate_cache.hpp"
+#include "finance/instrument/option.hpp"
+#include "finance/instrument/stock.hpp"
+#include "finance/transaction/option_transaction.hpp"
+#include "finance/transaction/stock_transaction.hpp"
+#include "finance/transaction/transactions.hpp"
+#include "finance/transaction/value_series.hpp"
+#include "gateway/position_gateway.hpp"
+#include "test_values.hpp"
+
+namespace
+{
+    using tests::cash;
+    using tests::quantity;
+    using tests::usd;
+
+    constexpr std::int64_t TEST_TS = 1'715'000'000'000LL;
+
+    const PositionId   POSITION_ID{1};
+    const InstrumentId STOCK_INSTRUMENT{1};
+    const InstrumentId OPTION_INSTRUMENT{2};
+
+    [[nodiscard]] finance::Stock makeStock()
+    {
+        return finance::Stock{
+            "AAPL",
+            Currency::USD,
+            "Apple",
+            "Apple Inc.",
+            "NASDAQ",
+            "Technology",
+            "Consumer Electronics",
+            AssetClass::Stock
+        };
+    }
+
+    [[nodiscard]] finance::StockTransaction makeStockBuy(
+        TransactionId id,
+        std::int64_t  shares
+    )
+    {
+        return finance::StockTransaction{
+            id,
+            Timestamp::fromInt64(TEST_TS + id.value()),
+            TransactionStatus::Completed,
+            STOCK_INSTRUMENT,
+            AccountId{1},
+            AccountId{2},
+            AccountId{3},
+            quantity(shares),
+            usd(100),
+            usd(0),
+            POSITION_ID
+        };
+    }
+
+    [[nodiscard]] finance::OptionTransaction makeCallBuy(TransactionId id)
+    {
+        return finance::OptionTransaction{
+            id,
+            Timestamp::fromInt64(TEST_TS + id.value()),
+            TransactionStatus::Completed,
+            OPTION_INSTRUMENT,
+            AccountId{1},
+            AccountId{2},
+            AccountId{3},
+            quantity(1),
+            usd(-200),
+            usd(0),
+            POSITION_ID,
+            TransactionOptionAction::Open,
+            OptionBuySell::Buy
+        };
+    }
+
+    class PositionGatewayTest : public ::testing::Test
+    {
+       protected:
+        // NOLINTBEGIN(misc-non-private-member-variables-in-classes)
+        std::shared_ptr<tests::FakeTransactionStore> _transactionStore;
+        std::shared_ptr<tests::FakePositionStore>    _positionStore;
+        std::shared_ptr<tests::FakeOptionStore>      _optionStore;
+        std::shared_ptr<tests::FakeStockStore>       _stockStore;
+        gateway::PositionGateway                     _gateway;
+        // NOLINTEND(misc-non-private-member-variables-in-classes)
+
+        PositionGatewayTest()
+            : _transactionStore{std::make_shared<tests::FakeTransactionStore>(
+              )},
+              _positionStore{std::make_shared<tests::FakePositionStore>()},
+              _optionStore{std::make_shared<tests::FakeOptionStore>()},
+              _stockStore{std::make_shared<tests::FakeStockStore>()},
+              _gateway{
+                  _transactionStore,
+                  _positionStore,
+                  _optionStore,
+                  _stockStore
+              }
+        {
+            _stockStore->stocks.addUnchecked(STOCK_INSTRUMENT, makeStock());
+            _optionStore->options.addUnchecked(
+                OPTION_INSTRUMENT,
+                finance::Option{
+                    OptionId{1},
+                    OPTION_INSTRUMENT,
+                    makeStock(),
+                    OptionType::Call,
+                    usd(100),
+                    Timestamp::fromInt64(TEST_TS),
+                    100
+                }
+            );
+        }
+
+        /// Returns a view over a single bought call
+        [[nodiscard]] static finance::TransactionsView makeOptionView()
+        {
+            finance::OptionTransactions options;
+            options.add(makeCallBuy(TransactionId{1}));
+
+            const finance::Transactions txs{{}, {}, options};
+            return finance::TransactionsView{txs, {}, {0}};
+        }
+    };
+}   // namespace
+
+TEST_F(PositionGatewayTest, ReusesMemoizedStateForSameView)
+{
+    const auto view = makeOptionView();
+
+    const auto first =
+        _gateway.calculatePositionPnl(POSITION_ID, view, usd(120));
+    const auto second =
+        _gateway.calculatePositionPnl(POSITION_ID, view, usd(130));
+
+    ASSERT_TRUE(first.has_value());
+    ASSERT_TRUE(second.has_value());
+
+    // the option is only resolved by the first fold
+    EXPECT_EQ(_optionStore->getOptionCallCount, 1);
+
+    // the memoized state is price-independent, each call applies its mark
+    EXPECT_NE(first->unrealizedPnL, second->unrealizedPnL);
+    EXPECT_EQ(second->unrealizedPnL - first->unrealizedPnL, usd(1000));
+}
+
+TEST_F(PositionGatewayTest, StoreVersionChangeDropsMemoizedState)
+{
+    const auto view = makeOptionView();
+
+    const std::vector<std::function<void()>> bumps{
+        [this] { ++_transactionStore->version; },
+        [this] { ++_positionStore->version; },
+        [this] { ++_optionStore->version; },
+        [this] { ++_stockStore->version; }
+    };
+
+    ASSERT_TRUE(
+        _gateway.calculatePositionPnl(POSITION_ID, view, std::nullopt)
+    );
+    EXPECT_EQ(_optionStore->getOptionCallCount, 1);
+
+    for (std::size_t i = 0; i < bumps.size(); ++i)
+    {
+        bumps[i]();
+
+        ASSERT_TRUE(
+            _gateway.calculatePositionPnl(POSITION_ID, view, std::nullopt)
+        );
+        EXPECT_EQ(_optionStore->getOptionCallCount, static_cast<int>(i) + 2);
+    }
+}
+
+TEST_F(PositionGatewayTest, ViewOverOtherTransactionsIsFoldedAgain)
+{
+    finance::StockTransactions stocks;
+    stocks.add(makeStockBuy(TransactionId{1}, 10));
+    stocks.add(makeStockBuy(TransactionId{2}, 5));
+
+    const finance::Transactions    txs{{}, stocks, {}};
+    const finance::TransactionsView firstBuy{txs, {0}, {}};
+    const finance::TransactionsView bothBuys{txs, {0, 1}, {}};
+
+    const auto first =
+        _gateway.calculatePositionPnl(POSITION_ID, firstBuy, std::nullopt);
+    const auto both =
+        _gateway.calculatePositionPnl(POSITION_ID, bothBuys, std::nullopt);
+    const auto firstAgain =
+        _gateway.calculatePositionPnl(POSITION_ID, firstBuy, std::nullopt);
+
+    ASSERT_TRUE(first.has_value());
+    ASSERT_TRUE(both.has_value());
+    ASSERT_TRUE(firstAgain.has_value());
+
+    EXPECT_EQ(first->quantity, quantity(10));
+    EXPECT_EQ(both->quantity, quantity(15));
+    EXPECT_EQ(firstAgain->quantity, quantity(10));
+}
+
+TEST_F(PositionGatewayTest, PortfolioValueSeriesInBaseCurrency)
+{
+    ASSERT_EQ(
+        _transactionStore->addStockTransaction(
+            makeStockBuy(TransactionId{1}, 10)
+        ),
+        store::TransactionStoreResult::Ok
+    );
+    ASSERT_EQ(
+        _transactionStore->addStockTransaction(
+            makeStockBuy(TransactionId{2}, 5)
+        ),
+        store::TransactionStoreResult::Ok
+    );
+
+    const auto from = finance::toDay(Timestamp::fromInt64(TEST_TS));
+    const auto to   = from + std::chrono::days{3};
+
+    const std::unordered_map<std::string, std::vector<finance::DailyClose>>
+        closesByTicker{
+            {"AAPL",
+             {{from, usd(110)}, {from + std::chrono::days{2}, usd(120)}}}
+        };
+
+    const auto usdSeries = _gateway.getPortfolioValueSeries(
+        {},
+        closesByTicker,
+        from,
+        to,
+        Currency::USD,
+        finance::ConversionMatrix{}
+    );
+
+    ASSERT_TRUE(usdSeries.has_value());
+    ASSERT_EQ(usdSeries->size(), 4U);
+
+    // day 1 and day 3 carry the previous close
+    const std::vector<Cash> expected{
+        usd(1650),
+        usd(1650),
+        usd(1800),
+        usd(1800)
+    };
+    for (std::size_t i = 0; i < expected.size(); ++i)
+    {
+        EXPECT_EQ(usdSeries.value()[i].marketValue, expected[i]) << i;
+        EXPECT_EQ(usdSeries.value()[i].costBasis, usd(1500)) << i;
+    }
+
+    finance::ConversionMatrix rates;
+    rates.set(Currency::USD, Currency::EUR, 0.5);
+
+    const auto eurSeries = _gateway.getPortfolioValueSeries(
+        {},
+        closesByTicker,
+        from,
+        to,
+        Currency::EUR,
+        rates
+    );
+
+    ASSERT_TRUE(eurSeries.has_value());
+    EXPECT_EQ(eurSeries->back().marketValue, cash(Currency::EUR, 900));
+    EXPECT_EQ(eurSeries->back().costBasis, cash(Currency::EUR, 750));
+
+    const auto missingRate = _gateway.getPortfolioValueSeries(
+        {},
+        closesByTicker,
+        from,
+        to,
+        Currency::CHF,
+        rates
+    );
+
+    ASSERT_FALSE(missingRate.has_value());
+    EXPECT_EQ(missingRate.error().getType(), FinanceErrorType::CurrencyUnknown);
+}
@@ -0,0 +1,448 @@
+// tests/gateway/test_statement_importer.cpp
+//
+// GoogleTest-based tests for gateway::StatementImporter.
+//
+// Coverage:
+//  - unknown accounts and tickers, currency mismatches and malformed rows
+//    are reported as row errors, the remaining rows are imported
+//  - statements listing the newest rows first are imported chronologically
+//  - a trade on an open position continues it, a trade on a flat position
+//    opens a new position slot
+//  - stage() creates the new positions, assigns the legs and adds all
+//    transactions as one batch
+//  - a stop request cancels the import
+//  - progress is reported per parsed row, skipped rows included
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <optional>
+#include <stop_token>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "common/cash.hpp"
+#include "common/finance.hpp"
+#include "common/quantity.hpp"
+#include "common/timestamp.hpp"
+#include "config/id_types.hpp"
+#include "fake_stores.hpp"
+#include "finance/account/account.hpp"
+#include "finance/instrument/stock.hpp"
+#include "finance/position.hpp"
+#include "finance/transaction/stock_transaction.hpp"
+#include "gateway/position_gateway.hpp"
+#include "gateway/statement_importer.hpp"
+#include "test_values.hpp"
+
+namespace
+{
+    using tests::quantity;
+    using tests::usd;
+
+    using namespace std::chrono_literals;
+
+    using gateway::StatementImport;
+
+    const AccountId    SECURITY_ACCOUNT{1};
+    const AccountId    CASH_ACCOUNT{2};
+    const AccountId    EXTERNAL_ACCOUNT{3};
+    const InstrumentId AAPL{1};
+    const InstrumentId MSFT{2};
+
+    /// The header of the generic layout
+    constexpr std::string_view HEADER =
+        "date,type,account,cash_account,symbol,quantity,price,amount,fees,"
+        "currency,comment\n";
+
+    [[nodiscard]] Timestamp timestamp(std::chrono::sys_days day)
+    {
+        using std::chrono::milliseconds;
+
+        const auto sinceEpoch = day.time_since_epoch();
+        return Timestamp::fromInt64(
+            std::chrono::duration_cast<milliseconds>(sinceEpoch).count()
+        );
+    }
+
+    [[nodiscard]] finance::Account makeAccount(
+        AccountId          id,
+        const std::string& name,
+        AccountKind        kind
+    )
+    {
+        return finance::Account{
+            id,
+            AccountStatus::Active,
+            name,
+            Currency::USD,
+            kind
+        };
+    }
+
+    [[nodiscard]] finance::Stock makeStock(
+        const std::string& ticker,
+        InstrumentId       instrumentId
+    )
+    {
+        finance::Stock stock{
+            ticker,
+            Currency::USD,
+            ticker,
+            ticker,
+            "NASDAQ",
+            "Technology",
+            "Technology",
+            AssetClass::Stock
+        };
+
+        stock.setId(StockId{instrumentId.value()});
+        stock.setInstrumentId(instrumentId);
+        return stock;
+    }
+
+    /**
+     * @brief A statement written to a temporary file, removed again on
+     * destruction
+     *
+     */
+    struct StatementFile
+    {
+        std::filesystem::path path;
+
+        explicit StatementFile(std::string_view rows)
+        {
+            const auto* const test =
+                ::testing::UnitTest::GetInstance()->current_test_info();
+
+            path = std::filesystem::temp_directory_path() /
+                   (std::string{"mt_statement_"} + test->name() + ".csv");
+
+            std::ofstream file{path, std::ios::binary};
+            file << HEADER << rows;
+        }
+
+        ~StatementFile()
+        {
+            std::error_code errorCode;
+            std::filesystem::remove(path, errorCode);
+        }
+
+        StatementFile(StatementFile const&)            = delete;
+        StatementFile& operator=(StatementFile const&) = delete;
+        StatementFile(StatementFile&&)                 = delete;
+        StatementFile& operator=(StatementFile&&)      = delete;
+    };
+
+    class StatementImporterTest : public ::testing::Test
+    {
+       protected:
+        // NOLINTBEGIN(misc-non-private-member-variables-in-classes)
+        std::shared_ptr<tests::FakeAccountStore>     _accountStore;
+        std::shared_ptr<tests::FakeTransactionStore> _transactionStore;
+        std::shared_ptr<tests::FakePositionStore>    _positionStore;
+        std::shared_ptr<tests::FakeOptionStore>      _optionStore;
+        std::shared_ptr<tests::FakeStockStore>       _stockStore;
+        gateway::PositionGateway                     _gateway;
+        /// The AAPL position that is open before the import
+        PositionId _openPosition = PositionId::invalid();
+        // NOLINTEND(misc-non-private-member-variables-in-classes)
+
+        StatementImporterTest()
+            : _accountStore{std::make_shared<tests::FakeAccountStore>()},
+              _transactionStore{std::make_shared<tests::FakeTransactionStore>(
+              )},
+              _positionStore{std::make_shared<tests::FakePositionStore>()},
+              _optionStore{std::make_shared<tests::FakeOptionStore>()},
+              _stockStore{std::make_shared<tests::FakeStockStore>()},
+              _gateway{
+                  _transactionStore,
+                  _positionStore,
+                  _optionStore,
+                  _stockStore
+              }
+        {
+            _accountStore->accounts.addUnchecked(
+                makeAccount(SECURITY_ACCOUNT, "Broker", AccountKind::Security)
+            );
+            _accountStore->accounts.addUnchecked(
+                makeAccount(CASH_ACCOUNT, "Cash", AccountKind::Cash)
+            );
+            _accountStore->accounts.addUnchecked(
+                makeAccount(EXTERNAL_ACCOUNT, "External", AccountKind::External)
+            );
+
+            _stockStore->stocks.addUnchecked(AAPL, makeStock("AAPL", AAPL));
+            _stockStore->stocks.addUnchecked(MSFT, makeStock("MSFT", MSFT));
+
+            // 10 AAPL bought before the import
+            const auto openedAt = timestamp(2024y / 1 / 2);
+
+            _openPosition =
+                _positionStore->createPosition(finance::Position{openedAt});
+            _transactionStore->transactions.addTransaction(
+                finance::StockTransaction{
+                    TransactionId{1},
+                    openedAt,
+                    TransactionStatus::Completed,
+                    AAPL,
+                    SECURITY_ACCOUNT,
+                    CASH_ACCOUNT,
+                    EXTERNAL_ACCOUNT,
+                    quantity(10),
+                    usd(100),
+                    Cash{Currency::USD, 0},
+                    _openPosition
+                }
+            );
+        }
+
+        /// Creates an importer over the current store contents
+        [[nodiscard]] gateway::StatementImporter makeImporter() const
+        {
+            return gateway::StatementImporter{
+                _accountStore,
+                _stockStore,
+                _positionStore,
+                _transactionStore,
+                _gateway
+            };
+        }
+
+        /// Reads a statement that is expected to be readable
+        [[nodiscard]] StatementImport read(std::string_view rows) const
+        {
+            const StatementFile file{rows};
+            auto result = makeImporter().read(file.path, {});
+
+            EXPECT_TRUE(result.has_value())
+                << (result ? "" : result.error().toString());
+
+            return result.value_or(StatementImport{});
+        }
+    };
+
+    /// Trades in chronological order: AAPL continues the open position, MSFT
+    /// is opened, closed and opened again, AAPL is closed and opened again
+    constexpr std::string_view TRADES =
+        "2024-05-06,buy,Broker,Cash,AAPL,5,110,,,USD,\n"
+        "2024-05-07,buy,Broker,Cash,MSFT,3,400,,,USD,\n"
+        "2024-05-08,sell,Broker,Cash,MSFT,3,410,,,USD,\n"
+        "2024-05-09,buy,Broker,Cash,MSFT,2,405,,,USD,\n"
+        "2024-05-10,sell,Broker,Cash,AAPL,15,120,,,USD,\n"
+        "2024-05-13,buy,Broker,Cash,AAPL,1,118,,,USD,\n"
+        "2024-05-14,deposit,Cash,,,,,500,,USD,\n";
+}   // namespace
+
+TEST_F(StatementImporterTest, ReportsUnresolvedAndMalformedRows)
+{
+    const auto statement = read(
+        "2024-05-06,buy,Nope,Cash,AAPL,1,100,,,USD,\n"
+        "2024-05-06,buy,Broker,Wallet,AAPL,1,100,,,USD,\n"
+        "2024-05-06,buy,Broker,Cash,XXX,1,100,,,USD,\n"
+        "2024-05-06,buy,Broker,Cash,AAPL,1,100,,,EUR,\n"
+        "2024-05-06,buy,Broker,Cash,AAPL,abc,100,,,USD,\n"
+        "2024-05-06,deposit,Cash,,,,,500,,USD,\n"
+    );
+
+    ASSERT_EQ(statement.rowErrors.size(), 5U);
+
+    const std::vector<std::string_view> expected{
+        "line 2: unknown account 'Nope'",
+        "line 3: unknown account 'Wallet'",
+        "line 4: unknown ticker 'XXX'",
+        "line 5: currency EUR does not match the cash account (USD)",
+        "line 6: invalid quantity 'abc'"
+    };
+
+    for (std::size_t i = 0; i < expected.size(); ++i)
+    {
+        const auto& error = statement.rowErrors[i];
+
+        EXPECT_EQ(error.getType(), FinanceErrorType::InvalidStatement) << i;
+        EXPECT_NE(error.toString().find(expected[i]), std::string::npos)
+            << error.toString();
+    }
+
+    ASSERT_EQ(statement.transactions.size(), 1U);
+    EXPECT_EQ(statement.positionSlots.front(), StatementImport::NO_POSITION);
+    EXPECT_TRUE(statement.positions.empty());
+}
+
+TEST_F(StatementImporterTest, ImportsNewestFirstStatementChronologically)
+{
+    const auto statement = read(
+        "2024-05-09,buy,Broker,Cash,MSFT,1,405,,,USD,\n"
+        "2024-05-08,buy,Broker,Cash,MSFT,2,400,,,USD,\n"
+        "2024-05-07,buy,Broker,Cash,MSFT,3,395,,,USD,\n"
+    );
+
+    ASSERT_TRUE(statement.rowErrors.empty());
+    ASSERT_EQ(statement.transactions.size(), 3U);
+
+    const auto firstDay = std::chrono::sys_days{2024y / 5 / 7};
+
+    for (std::size_t i = 0; i < statement.transactions.size(); ++i)
+    {
+        const auto day = firstDay + std::chrono::days{i};
+
+        EXPECT_EQ(
+            statement.transactions[i].getTimestamp().toInt64(),
+            timestamp(day).toInt64()
+        ) << i;
+        EXPECT_EQ(statement.positionSlots[i], 0U) << i;
+    }
+
+    // the new position opens with the oldest trade
+    ASSERT_EQ(statement.positions.size(), 1U);
+    EXPECT_FALSE(statement.positions[0].existing.isValid());
+    EXPECT_EQ(
+        statement.positions[0].openedAt.toInt64(),
+        timestamp(firstDay).toInt64()
+    );
+}
+
+TEST_F(StatementImporterTest, AssignsTradesToOpenAndNewPositions)
+{
+    const auto statement = read(TRADES);
+
+    ASSERT_TRUE(statement.rowErrors.empty());
+
+    const auto none = StatementImport::NO_POSITION;
+    EXPECT_EQ(
+        statement.positionSlots,
+        (std::vector<std::size_t>{0, 1, 1, 2, 0, 3, none})
+    );
+
+    ASSERT_EQ(statement.positions.size(), 4U);
+
+    // the open AAPL position is continued until it is flat
+    EXPECT_EQ(statement.positions[0].existing, _openPosition);
+
+    for (std::size_t slot = 1; slot < statement.positions.size(); ++slot)
+        EXPECT_FALSE(statement.positions[slot].existing.isValid()) << slot;
+
+    EXPECT_EQ(
+        statement.positions[2].openedAt.toInt64(),
+        timestamp(std::chrono::sys_days{2024y / 5 / 9}).toInt64()
+    );
+}
+
+TEST_F(StatementImporterTest, StageCreatesPositionsAndAddsOneBatch)
+{
+    auto                importer = makeImporter();
+    const StatementFile file{TRADES};
+    auto                imported = importer.read(file.path, {});
+
+    ASSERT_TRUE(imported.has_value());
+
+    const auto summary = importer.stage(std::move(imported.value()));
+
+    ASSERT_TRUE(summary.has_value());
+    EXPECT_EQ(summary->transactions, 7U);
+    EXPECT_EQ(summary->createdPositions, 3U);
+    EXPECT_EQ(summary->skippedRows, 0U);
+
+    // the open position plus the three created ones
+    EXPECT_EQ(_positionStore->positions.size(), 4U);
+
+    EXPECT_EQ(_transactionStore->addBatchCallCount, 1);
+
+    const auto& added = _transactionStore->addedTransactions;
+    ASSERT_EQ(added.size(), 7U);
+
+    const PositionId              created{_openPosition.value() + 1};
+    const std::vector<PositionId> expected{
+        _openPosition,
+        created,
+        created,
+        PositionId{created.value() + 1},
+        _openPosition,
+        PositionId{created.value() + 2}
+    };
+
+    for (std::size_t i = 0; i < expected.size(); ++i)
+    {
+        ASSERT_EQ(added[i].getLegs().size(), 1U) << i;
+        EXPECT_EQ(added[i].getLegs()[0].getPositionId(), expected[i]) << i;
+    }
+
+    EXPECT_TRUE(added.back().getLegs().empty());
+}
+
+TEST_F(StatementImporterTest, StopRequestCancelsImport)
+{
+    const auto          importer = makeImporter();
+    const StatementFile file{TRADES};
+
+    std::stop_source stopped;
+    stopped.request_stop();
+
+    const auto before = importer.read(file.path, {}, stopped.get_token());
+
+    ASSERT_FALSE(before.has_value());
+    EXPECT_EQ(before.error().getType(), FinanceErrorType::ImportCancelled);
+
+    // a stop requested while reading ends the import at the next row
+    std::stop_source source;
+    const auto       during = importer.read(
+        file.path,
+        {},
+        source.get_token(),
+        [&source](const gateway::StatementImportProgress& /*progress*/)
+        { source.request_stop(); }
+    );
+
+    ASSERT_FALSE(during.has_value());
+    EXPECT_EQ(during.error().getType(), FinanceErrorType::ImportCancelled);
+}
+
+TEST_F(StatementImporterTest, ReportsProgressPerParsedRow)
+{
+    // more skipped rows than one progress interval
+    constexpr std::size_t ROWS = 5000;
+
+    std::string rows;
+    for (std::size_t i = 0; i < ROWS; ++i)
+        rows += "2024-05-06,buy,Broker,Cash,XXX,1,100,,,USD,\n";
+
+    const auto          importer = makeImporter();
+    const StatementFile file{rows};
+
+    std::size_t reading    = 0;
+    std::size_t converting = 0;
+    std::size_t lastDone   = 0;
+    std::size_t lastTotal  = 0;
+
+    const auto statement = importer.read(
+        file.path,
+        {},
+        {},
+        [&](const gateway::StatementImportProgress& progress)
+        {
+            if (progress.phase == gateway::StatementImportPhase::Reading)
+            {
+                ++reading;
+                lastDone  = progress.done;
+                lastTotal = progress.total;
+            }
+            else
+                ++converting;
+        }
+    );
+
+    ASSERT_TRUE(statement.has_value());
+    EXPECT_EQ(statement->rowErrors.size(), ROWS);
+
+    // at the first row, after the progress interval and at the end
+    EXPECT_EQ(reading, 3U);
+    EXPECT_EQ(lastDone, lastTotal);
+    EXPECT_EQ(converting, 1U);
+}
@@ -0,0 +1,157 @@
+// tests/logging/test_tracer.cpp
+//
+// GoogleTest-based tests for logging::Tracer.
+//
+// Coverage:
+//  - trace scopes are ignored while no capture is running
+//  - nested scopes are recorded with their thread and durations
+//  - every thread records into its own buffer
+//  - the buffers of exited threads are reused
+//  - starting a new capture discards the events of the previous one
+//  - the capture is written as Chrome trace-event JSON
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <latch>
+#include <set>
+#include <string>
+#include <thread>
+
+#include "logging/tracer.hpp"
+
+namespace
+{
+    void tracedWork()
+    {
+        TRACE_SCOPE("Test.Outer");
+        {
+            TRACE_SCOPE("Test.Inner");
+        }
+    }
+}   // namespace
+
+TEST(Tracer, ScopesAreIgnoredWithoutCapture)
+{
+    auto& tracer = logging::Tracer::getInstance();
+
+    tracer.start();
+    tracer.stop();
+
+    tracedWork();
+
+    EXPECT_TRUE(tracer.getEvents().empty());
+}
+
+TEST(Tracer, RecordsNestedScopes)
+{
+    auto& tracer = logging::Tracer::getInstance();
+
+    tracer.start();
+    tracedWork();
+    const auto info = tracer.stop();
+
+    EXPECT_EQ(info.events, 2U);
+    EXPECT_EQ(info.threads, 1U);
+
+    const auto events = tracer.getEvents();
+    ASSERT_EQ(events.size(), 2U);
+    EXPECT_STREQ(events[0].name, "Test.Outer");
+    EXPECT_STREQ(events[1].name, "Test.Inner");
+    EXPECT_LE(events[0].startNs, events[1].startNs);
+    EXPECT_GE(events[0].durationNs, events[1].durationNs);
+    EXPECT_EQ(events[0].threadId, events[1].threadId);
+}
+
+TEST(Tracer, EveryThreadRecordsIntoItsOwnBuffer)
+{
+    auto& tracer = logging::Tracer::getInstance();
+
+    tracer.start();
+    {
+        // both threads are alive at the same time, so none of them can take
+        // over the buffer of the other
+        std::latch   alive{2};
+        const auto   work = [&alive]
+        {
+            tracedWork();
+            alive.arrive_and_wait();
+        };
+        std::jthread first{work};
+        std::jthread second{work};
+    }
+    tracedWork();
+    const auto info = tracer.stop();
+
+    EXPECT_EQ(info.events, 6U);
+    EXPECT_EQ(info.threads, 3U);
+}
+
+TEST(Tracer, BuffersOfExitedThreadsAreReused)
+{
+    auto& tracer = logging::Tracer::getInstance();
+
+    tracer.start();
+    for (int i = 0; i < 8; ++i)
+        std::jthread{tracedWork}.join();
+    const auto info = tracer.stop();
+
+    EXPECT_EQ(info.events, 16U);
+    EXPECT_EQ(info.threads, 1U);
+
+    std::set<std::uint32_t> threadIds;
+    for (const auto& event : tracer.getEvents())
+        threadIds.insert(event.threadId);
+
+    EXPECT_EQ(threadIds.size(), 1U);
+}
+
+TEST(Tracer, NewCaptureDiscardsPreviousEvents)
+{
+    auto& tracer = logging::Tracer::getInstance();
+
+    tracer.start();
+    tracedWork();
+    tracer.stop();
+
+    tracer.start();
+    {
+        TRACE_SCOPE("Test.Second");
+    }
+    tracer.stop();
+
+    const auto events = tracer.getEvents();
+    ASSERT_EQ(events.size(), 1U);
+    EXPECT_STREQ(events[0].name, "Test.Second");
+}
+
+TEST(Tracer, WritesChromeTraceJson)
+{
+    auto& tracer = logging::Tracer::getInstance();
+
+    tracer.start();
+    tracedWork();
+    tracer.stop();
+
+    const auto path =
+        std::filesystem::temp_directory_path() / "molartracker_trace.json";
+
+    ASSERT_TRUE(tracer.writeChromeTrace(path));
+
+    std::ifstream     file{path};
+    const std::string content{
+        std::istreambuf_iterator<char>{file},
+        std::istreambuf_iterator<char>{}
+    };
+
+    EXPECT_TRUE(content.starts_with(R"({"displayTimeUnit":"ns")"));
+    EXPECT_NE(content.find(R"("name":"Test.Outer")"), std::string::npos);
+    EXPECT_NE(content.find(R"("ph":"X")"), std::string::npos);
+    EXPECT_NE(content.find(R"("name":"thread_name")"), std::string::npos);
+    EXPECT_TRUE(content.ends_with("]}\n"));
+
+    std::filesystem::remove(path);
+}
@@ -5,10 +5,17 @@
 // Coverage:
 //  - createTable (DDL generation, SQL tracking)
 //  - insert / batchInsert (return value, ID sequencing, atomicity)
+//  - upsert (new / existing / mixed rows, id order, chunking, rollback)
 //  - get / getUnique (empty, single, multiple rows; optional fields)
 //  - update / updateField (success, not-found, no-PK)
+//  - dirty column tracking (getDirtyMask, markClean, partial UPDATE), a
+//    row without dirty columns is only checked for existence
 //  - deleteByPk (removes row)
+//  - deleteWhere (removes matching rows, rejects an empty where clause)
 //  - WHERE / orderBy / limit query options
+//  - flattened WHERE expressions (FlatWhere)
+//  - successive Query::where calls compile into one AND list
+//  - exists / count / sum / minimum / maximum aggregates
 //  - addColumn / dropColumn (schema evolution)
 //  - JOIN + getJoined
 //  - Foreign-key constraint enforcement
@@ -16,11 +23,17 @@
 //  - getExecutedSQL SQL tracking
 
 #include <gtest/gtest.h>
+#include <sqlite3.h>
 
+#include <cstddef>
+#include <cstdint>
 #include <filesystem>
+#include <map>
 #include <optional>
 #include <random>
+#include <span>
 #include <string>
+#include <vector>
 
 #include "config/strong_id.hpp"
 #include "db/database.hpp"
@@ -30,6 +43,8 @@
 #include "orm/crud.hpp"
 #include "orm/crud/crud_error.hpp"
 #include "orm/field.hpp"
+#include "orm/fields.hpp"
+#include "orm/flat_where.hpp"
 #include "orm/join.hpp"
 #include "orm/orm_model.hpp"
 #include "orm/query_options.hpp"
@@ -499,6 +514,97 @@ TEST_F(CrudTest, WhereWithNoMatchReturnsEmpty)
     EXPECT_TRUE(rows.empty());
 }
 
+TEST_F(CrudTest, OrChainIsFlattenedIntoOneList)
+{
+    orm::WhereExpr where;
+    for (const auto* label : {"a", "b", "c", "d"})
+        where |= orm::makeWhere<ItemRow::labelField>(
+            std::string{label},
+            filter::Operator::Equal
+        );
+
+    const auto flat = orm::FlatWhere::compile(where);
+
+    ASSERT_EQ(flat.getNodes().size(), 5U);
+    EXPECT_EQ(flat.getNodes().front().kind, orm::WhereNodeKind::Or);
+    EXPECT_EQ(flat.getNodes().front().operand, 4U);
+    EXPECT_EQ(flat.getNodes().front().size, 5U);
+    EXPECT_EQ(flat.getLeafCount(), 4U);
+    EXPECT_EQ(
+        flat.getDBOperations(),
+        "(item.label = ?) OR (item.label = ?) OR (item.label = ?) OR "
+        "(item.label = ?)"
+    );
+}
+
+TEST_F(CrudTest, MixedOperatorsKeepTheirGrouping)
+{
+    const auto label = [](const char* value)
+    {
+        return orm::makeWhere<ItemRow::labelField>(
+            std::string{value},
+            filter::Operator::Equal
+        );
+    };
+
+    const auto where = (label("a") && label("b") && label("c")) ||
+                       !label("d") || orm::makeIsNull<ItemRow::noteField>();
+
+    EXPECT_EQ(
+        orm::getDBOperations(where),
+        "((item.label = ?) AND (item.label = ?) AND (item.label = ?)) OR "
+        "(NOT (item.label = ?)) OR (item.note IS NULL)"
+    );
+    EXPECT_TRUE(orm::FlatWhere::compile(orm::makeEmptyWhere()).empty());
+}
+
+TEST_F(CrudTest, QueryWhereCallsShareOneAndList)
+{
+    insertItem(_crud, _db.db, makeItem("a"));
+    insertItem(_crud, _db.db, makeItem("b"));
+
+    const auto query = orm::Query{}
+                           .where<ItemRow::labelField>(
+                               std::string{"a"},
+                               filter::Operator::Equal
+                           )
+                           .where<ItemRow::activeField>(
+                               true,
+                               filter::Operator::Equal
+                           );
+
+    EXPECT_EQ(
+        query.getWhereDBOperations(),
+        "WHERE (item.label = ?) AND (item.active = ?)"
+    );
+
+    const auto rows = _crud.get<ItemRow>(_db.db, query);
+    ASSERT_EQ(rows.size(), 1U);
+    EXPECT_EQ(std::string(rows[0].label.value()), "a");
+}
+
+TEST_F(CrudTest, LongOrChainSelectsAllMatchingRows)
+{
+    // stays below SQLite's default expression depth limit of 1000
+    constexpr int nItems = 400;
+
+    for (int i = 0; i < nItems; ++i)
+        insertItem(_crud, _db.db, makeItem("item_" + std::to_string(i)));
+
+    orm::WhereExpr where;
+    for (int i = 0; i < nItems; i += 2)
+        where |= orm::makeWhere<ItemRow::idField>(
+            ItemId{i + 1},
+            filter::Operator::Equal
+        );
+
+    const auto rows = _crud.get<ItemRow>(_db.db, orm::Query{}.where(where));
+
+    ASSERT_EQ(rows.size(), static_cast<std::size_t>(nItems / 2));
+    for (const auto& row : rows)
+        EXPECT_EQ(row.id.value().value() % 2, 1);
+}
+
 TEST_F(CrudTest, OrderByLabelAscending)
 {
     insertItem(_crud, _db.db, makeItem("mango"));
@@ -567,6 +673,81 @@ TEST_F(CrudTest, WhereAndOrderByCombined)
     EXPECT_EQ(std::string(rows[1].label.value()), "z_active");
 }
 
+// ===========================================================================
+// aggregate tests
+// ===========================================================================
+
+TEST_F(CrudTest, ExistsReflectsMatchingRows)
+{
+    insertItem(_crud, _db.db, makeItem("present"));
+
+    const auto hasLabel = [](const std::string& label)
+    {
+        return orm::Query{}.where<ItemRow::labelField>(
+            label,
+            filter::Operator::Equal
+        );
+    };
+
+    EXPECT_TRUE(_crud.exists<ItemRow>(_db.db, hasLabel("present")));
+    EXPECT_FALSE(_crud.exists<ItemRow>(_db.db, hasLabel("absent")));
+
+    const auto& sql = _crud.getExecutedSQL().back();
+    EXPECT_NE(sql.find("SELECT EXISTS("), std::string::npos) << sql;
+}
+
+TEST_F(CrudTest, CountIgnoresOrderAndLimit)
+{
+    insertItem(_crud, _db.db, makeItem("c1", 0.0, true));
+    insertItem(_crud, _db.db, makeItem("c2", 0.0, true));
+    insertItem(_crud, _db.db, makeItem("c3", 0.0, false));
+
+    EXPECT_EQ(_crud.count<ItemRow>(_db.db), 3);
+
+    const auto activeQuery =
+        orm::Query{}
+            .where<ItemRow::activeField>(true, filter::Operator::Equal)
+            .orderBy<ItemRow::labelField>(true)
+            .limit(1);
+
+    EXPECT_EQ(_crud.count<ItemRow>(_db.db, activeQuery), 2);
+}
+
+TEST_F(CrudTest, SumMinMaxAggregateMatchingRows)
+{
+    insertItem(_crud, _db.db, makeItem("s1", 1.5, true));
+    insertItem(_crud, _db.db, makeItem("s2", 2.5, true));
+    insertItem(_crud, _db.db, makeItem("s3", 10.0, false));
+
+    EXPECT_DOUBLE_EQ(_crud.sum<ItemRow::scoreField>(_db.db), 14.0);
+
+    const auto activeQuery =
+        orm::Query{}.where<ItemRow::activeField>(true, filter::Operator::Equal);
+
+    EXPECT_DOUBLE_EQ(_crud.sum<ItemRow::scoreField>(_db.db, activeQuery), 4.0);
+    EXPECT_EQ(
+        _crud.minimum<ItemRow::scoreField>(_db.db, activeQuery),
+        std::optional<double>{1.5}
+    );
+    EXPECT_EQ(
+        _crud.maximum<ItemRow::scoreField>(_db.db, activeQuery),
+        std::optional<double>{2.5}
+    );
+    EXPECT_EQ(
+        _crud.maximum<ItemRow::labelField>(_db.db),
+        std::optional<std::string>{"s3"}
+    );
+}
+
+TEST_F(CrudTest, AggregatesOverNoRows)
+{
+    EXPECT_FALSE(_crud.exists<ItemRow>(_db.db, orm::Query{}));
+    EXPECT_EQ(_crud.count<ItemRow>(_db.db), 0);
+    EXPECT_DOUBLE_EQ(_crud.sum<ItemRow::scoreField>(_db.db), 0.0);
+    EXPECT_FALSE(_crud.minimum<ItemRow::scoreField>(_db.db).has_value());
+    EXPECT_FALSE(_crud.maximum<ItemRow::noteField>(_db.db).has_value());
+}
+
 // ===========================================================================
 // update tests
 // ===========================================================================
@@ -629,6 +810,89 @@ TEST_F(CrudTest, UpdateChangesArePersistedCorrectly)
     EXPECT_EQ(reloaded.front().note.value().value(), "updated note");
 }
 
+TEST_F(CrudTest, LoadedRowHasNoDirtyColumns)
+{
+    insertItem(_crud, _db.db, makeItem("clean"));
+
+    const auto rows = _crud.get<ItemRow>(_db.db);
+    ASSERT_EQ(rows.size(), 1U);
+    EXPECT_EQ(orm::getDirtyMask(rows.front()), 0U);
+    EXPECT_EQ(orm::getDirtyMask(makeItem("fresh")), 0b11111U);
+}
+
+TEST_F(CrudTest, AssigningFieldMarksOnlyThatColumnDirty)
+{
+    insertItem(_crud, _db.db, makeItem("mask"));
+
+    auto row  = _crud.get<ItemRow>(_db.db).front();
+    row.score = 4.0;
+
+    // columns: id, label, score, active, note
+    EXPECT_EQ(orm::getDirtyMask(row), 0b00100U);
+
+    orm::markClean(row);
+    EXPECT_EQ(orm::getDirtyMask(row), 0U);
+}
+
+TEST_F(CrudTest, UpdateWritesOnlyDirtyColumns)
+{
+    insertItem(_crud, _db.db, makeItem("partial", 1.0));
+
+    auto row  = _crud.get<ItemRow>(_db.db).front();
+    row.score = 2.0;
+
+    ASSERT_TRUE(_crud.update(_db.db, row).has_value());
+
+    const auto& sql = _crud.getExecutedSQL().back();
+    EXPECT_NE(sql.find("score=?"), std::string::npos) << sql;
+    EXPECT_EQ(sql.find("label=?"), std::string::npos) << sql;
+    EXPECT_EQ(sql.find("active=?"), std::string::npos) << sql;
+}
+
+TEST_F(CrudTest, PartialUpdateKeepsColumnsChangedElsewhere)
+{
+    insertItem(_crud, _db.db, makeItem("original", 1.0));
+
+    auto first  = _crud.get<ItemRow>(_db.db).front();
+    auto second = first;
+
+    first.label = "renamed";
+    ASSERT_TRUE(_crud.update(_db.db, first).has_value());
+
+    second.score = 9.0;
+    ASSERT_TRUE(_crud.update(_db.db, second).has_value());
+
+    const auto reloaded = _crud.get<ItemRow>(_db.db).front();
+    EXPECT_EQ(reloaded.label.value(), "renamed");
+    EXPECT_DOUBLE_EQ(reloaded.score.value(), 9.0);
+}
+
+TEST_F(CrudTest, UpdateWithoutDirtyColumnsWritesNothing)
+{
+    insertItem(_crud, _db.db, makeItem("untouched"));
+
+    const auto row = _crud.get<ItemRow>(_db.db).front();
+
+    EXPECT_TRUE(_crud.update(_db.db, row).has_value());
+
+    // only the existence of the row is checked
+    const auto& sql = _crud.getExecutedSQL().back();
+    EXPECT_EQ(sql.find("UPDATE"), std::string::npos) << sql;
+    EXPECT_NE(sql.find("EXISTS"), std::string::npos) << sql;
+}
+
+TEST_F(CrudTest, UpdateWithoutDirtyColumnsOfDeletedRowReturnsNoRowsUpdated)
+{
+    insertItem(_crud, _db.db, makeItem("deleted"));
+
+    const auto row = _crud.get<ItemRow>(_db.db).front();
+    _crud.deleteByPk(_db.db, row);
+
+    const auto result = _crud.update(_db.db, row);
+    ASSERT_FALSE(result.has_value());
+    EXPECT_EQ(result.error().getType(), orm::CrudErrorType::NoRowsUpdated);
+}
+
 // ===========================================================================
 // deleteByPk tests
 // ===========================================================================
@@ -673,6 +937,33 @@ TEST_F(CrudTest, DeleteByPkLeavesOtherRowsIntact)
         EXPECT_NE(std::string(row.label.value()), "remove_b");
 }
 
+TEST_F(CrudTest, DeleteWhereRemovesOnlyMatchingRows)
+{
+    insertItem(_crud, _db.db, makeItem("keep_a"));
+    insertItem(_crud, _db.db, makeItem("remove_b"));
+    insertItem(_crud, _db.db, makeItem("remove_c"));
+
+    const std::vector<std::string> labels{"remove_b", "remove_c", "absent"};
+    const auto query = orm::Query{}.in<ItemRow::labelField>(labels);
+
+    _crud.deleteWhere<ItemRow>(_db.db, query);
+
+    const auto after = _crud.get<ItemRow>(_db.db);
+    ASSERT_EQ(after.size(), 1U);
+    EXPECT_EQ(std::string(after.front().label.value()), "keep_a");
+}
+
+TEST_F(CrudTest, DeleteWhereWithoutWhereClauseThrows)
+{
+    insertItem(_crud, _db.db, makeItem("keep"));
+
+    EXPECT_THROW(
+        _crud.deleteWhere<ItemRow>(_db.db, orm::Query{}),
+        orm::CrudException
+    );
+    EXPECT_EQ(_crud.get<ItemRow>(_db.db).size(), 1U);
+}
+
 // ===========================================================================
 // batchInsert tests
 // ===========================================================================
@@ -704,6 +995,160 @@ TEST_F(CrudTest, BatchInsertReturnsIdForEachRow)
     EXPECT_NE((*result)[0], (*result)[1]);
 }
 
+// ===========================================================================
+// upsert tests
+// ===========================================================================
+
+namespace
+{
+    std::map<std::int64_t, std::string> labelsById(
+        orm::Crud&    crud,
+        db::Database& db
+    )
+    {
+        std::map<std::int64_t, std::string> labels;
+        for (const auto& row : crud.get<ItemRow>(db))
+            labels.emplace(row.id.value().value(), row.label.value());
+        return labels;
+    }
+}   // namespace
+
+TEST_F(CrudTest, UpsertEmptySpanReturnsNoIds)
+{
+    const std::vector<ItemRow> rows;
+
+    const auto result = _crud.upsert<ItemRow>(_db.db, rows);
+    ASSERT_TRUE(result.has_value());
+    EXPECT_TRUE(result->empty());
+}
+
+TEST_F(CrudTest, UpsertInsertsNewRowsAndReturnsIdsInInputOrder)
+{
+    const std::vector<ItemRow> rows{
+        makeItem("up_a"),
+        makeItem("up_b"),
+        makeItem("up_c")
+    };
+
+    const auto result = _crud.upsert<ItemRow>(_db.db, rows);
+    ASSERT_TRUE(result.has_value());
+    ASSERT_EQ(result->size(), 3U);
+
+    const auto labels = labelsById(_crud, _db.db);
+    ASSERT_EQ(labels.size(), 3U);
+    EXPECT_EQ(labels.at((*result)[0]), "up_a");
+    EXPECT_EQ(labels.at((*result)[1]), "up_b");
+    EXPECT_EQ(labels.at((*result)[2]), "up_c");
+}
+
+TEST_F(CrudTest, UpsertTreatsTemporaryIdsAsNewRows)
+{
+    ItemRow row = makeItem("temporary");
+    row.id      = ItemId::from(-5);
+
+    const auto result = _crud.upsert<ItemRow>(_db.db, std::span{&row, 1});
+    ASSERT_TRUE(result.has_value());
+    ASSERT_EQ(result->size(), 1U);
+    EXPECT_GT(result->front(), 0);
+}
+
+TEST_F(CrudTest, UpsertUpdatesExistingRows)
+{
+    const auto id = _crud.insert(_db.db, makeItem("before", 1.0)).value();
+
+    ItemRow row = makeItem("after", 2.0, false, std::string{"updated"});
+    row.id      = ItemId::from(id);
+
+    const auto result = _crud.upsert<ItemRow>(_db.db, std::span{&row, 1});
+    ASSERT_TRUE(result.has_value());
+    ASSERT_EQ(result->size(), 1U);
+    EXPECT_EQ(result->front(), id);
+
+    const auto rows = _crud.get<ItemRow>(_db.db);
+    ASSERT_EQ(rows.size(), 1U);
+    EXPECT_EQ(rows.front().label.value(), "after");
+    EXPECT_DOUBLE_EQ(rows.front().score.value(), 2.0);
+    EXPECT_FALSE(rows.front().active.value());
+    EXPECT_EQ(rows.front().note.value(), std::optional<std::string>{"updated"});
+}
+
+TEST_F(CrudTest, UpsertMapsMixedRowsToInputOrder)
+{
+    const auto existingId = _crud.insert(_db.db, makeItem("existing")).value();
+
+    ItemRow existing = makeItem("existing_renamed");
+    existing.id      = ItemId::from(existingId);
+
+    // an explicit id above every existing one is inserted with that id
+    ItemRow explicitNew = makeItem("explicit");
+    explicitNew.id      = ItemId::from(existingId + 10);
+
+    const std::vector<ItemRow> rows{
+        makeItem("new_a"),
+        existing,
+        makeItem("new_b"),
+        explicitNew,
+        makeItem("new_c")
+    };
+
+    const auto result = _crud.upsert<ItemRow>(_db.db, rows);
+    ASSERT_TRUE(result.has_value());
+    ASSERT_EQ(result->size(), 5U);
+
+    EXPECT_EQ((*result)[1], existingId);
+    EXPECT_EQ((*result)[3], existingId + 10);
+    EXPECT_LT((*result)[0], (*result)[2]);
+    EXPECT_LT((*result)[2], (*result)[4]);
+
+    const auto labels = labelsById(_crud, _db.db);
+    ASSERT_EQ(labels.size(), 5U);
+    EXPECT_EQ(labels.at((*result)[0]), "new_a");
+    EXPECT_EQ(labels.at((*result)[1]), "existing_renamed");
+    EXPECT_EQ(labels.at((*result)[2]), "new_b");
+    EXPECT_EQ(labels.at((*result)[3]), "explicit");
+    EXPECT_EQ(labels.at((*result)[4]), "new_c");
+}
+
+TEST_F(CrudTest, UpsertSplitsRowsIntoChunksOfTheVariableLimit)
+{
+    // five columns per row, two rows per statement
+    sqlite3_limit(_db.db.nativeHandle(), SQLITE_LIMIT_VARIABLE_NUMBER, 12);
+    ASSERT_EQ(_db.db.getVariableLimit(), 12U);
+
+    std::vector<ItemRow> rows;
+    for (int i = 0; i < 7; ++i)
+        rows.push_back(makeItem("chunk_" + std::to_string(i)));
+
+    const auto nExecutedBefore = _crud.getExecutedSQL().size();
+
+    const auto result = _crud.upsert<ItemRow>(_db.db, rows);
+    ASSERT_TRUE(result.has_value());
+    ASSERT_EQ(result->size(), 7U);
+
+    // full chunks share one prepared statement, the last chunk has its own
+    EXPECT_EQ(_crud.getExecutedSQL().size(), nExecutedBefore + 2);
+
+    const auto labels = labelsById(_crud, _db.db);
+    ASSERT_EQ(labels.size(), 7U);
+    for (std::size_t i = 0; i < rows.size(); ++i)
+        EXPECT_EQ(labels.at((*result)[i]), "chunk_" + std::to_string(i));
+}
+
+TEST_F(CrudTest, UpsertUniqueViolationReturnsErrorAndRollsBack)
+{
+    insertItem(_crud, _db.db, makeItem("taken"));
+
+    const std::vector<ItemRow> rows{makeItem("fresh"), makeItem("taken")};
+
+    const auto result = _crud.upsert<ItemRow>(_db.db, rows);
+    ASSERT_FALSE(result.has_value());
+    EXPECT_EQ(result.error().getType(), orm::CrudErrorType::UpsertFailed);
+
+    const auto labels = labelsById(_crud, _db.db);
+    ASSERT_EQ(labels.size(), 1U);
+    EXPECT_EQ(labels.begin()->second, "taken");
+}
+
 // ===========================================================================
 // Unique constraint tests
 // ===========================================================================
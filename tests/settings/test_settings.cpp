@@ -8,7 +8,7 @@
 //  - isDirty is true after construction (GeneralSettings._version is set
 //    but not yet committed)
 //  - getKey returns the schema key
-//  - save() writes a settings.json file to the config directory
+//  - save() writes a settings.json file to the config directory once flushed
 //  - isDirty is false after save()
 //  - save() fires the OnSaved callback
 //  - Save then reload: modified defaultProfile is persisted and reloaded
@@ -126,6 +126,7 @@ TEST(Settings, SaveCreatesSettingsFile)
     ASSERT_FALSE(std::filesystem::exists(file));
 
     settings.save();
+    settings.flush();
 
     EXPECT_TRUE(std::filesystem::exists(file));
 }
@@ -189,6 +190,7 @@ TEST(Settings, SaveAndReloadDefaultProfilePreserved)
     settings::Settings settings1(tmp.path);
     settings1.getGeneralSettings().setDefaultProfile("Persisted");
     settings1.save();
+    settings1.flush();
 
     settings::Settings settings2(tmp.path);
     ASSERT_TRUE(settings2.getGeneralSettings().hasDefaultProfile());
@@ -204,6 +206,7 @@ TEST(Settings, SaveAndReloadNotDirtyAfterReload)
     settings::Settings settings1(tmp.path);
     settings1.getGeneralSettings().setDefaultProfile("Reload");
     settings1.save();
+    settings1.flush();
 
     settings::Settings settings2(tmp.path);
     EXPECT_FALSE(settings2.isDirty());
@@ -219,6 +222,7 @@ TEST(Settings, SaveAndReloadLogLevelPreserved)
         );
     ASSERT_TRUE(result.has_value());
     settings1.save();
+    settings1.flush();
 
     settings::Settings settings2(tmp.path);
     EXPECT_EQ(
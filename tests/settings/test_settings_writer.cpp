@@ -0,0 +1,109 @@
+// tests/settings/test_settings_writer.cpp
+//
+// GoogleTest-based tests for settings::SettingsWriter.
+//
+// Coverage:
+//  - snapshots scheduled within the debounce window are written once, with
+//    the content of the latest snapshot
+//  - a snapshot is written once the debounce window has passed
+//  - a snapshot serializing to the last written content is not written
+//  - seeded content counts as written
+//  - a pending snapshot is written when the writer is destroyed
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <filesystem>
+#include <nlohmann/json.hpp>
+#include <string>
+#include <thread>
+
+#include "settings/settings_writer.hpp"
+#include "test_fixtures.hpp"
+
+namespace
+{
+    using tests::TempDir;
+    using tests::readFile;
+
+    using namespace std::chrono_literals;
+
+}   // namespace
+
+TEST(SettingsWriter, CoalescesSnapshotsWithinDebounceWindow)
+{
+    const TempDir            tmp;
+    const auto               file = tmp.path() / "settings.json";
+    settings::SettingsWriter writer{file, 1h};
+
+    writer.schedule(nlohmann::json{{"value", 1}});
+    writer.schedule(nlohmann::json{{"value", 2}});
+    writer.schedule(nlohmann::json{{"value", 3}});
+    writer.flush();
+
+    EXPECT_EQ(writer.getWriteCount(), 1U);
+    EXPECT_EQ(readFile(file), nlohmann::json({{"value", 3}}).dump(4));
+}
+
+TEST(SettingsWriter, WritesAfterDebounceWindow)
+{
+    const TempDir            tmp;
+    const auto               file = tmp.path() / "settings.json";
+    settings::SettingsWriter writer{file, 10ms};
+
+    writer.schedule(nlohmann::json{{"value", 1}});
+
+    const auto timeout = std::chrono::steady_clock::now() + 5s;
+    while (writer.getWriteCount() == 0 &&
+           std::chrono::steady_clock::now() < timeout)
+        std::this_thread::sleep_for(5ms);
+
+    EXPECT_EQ(writer.getWriteCount(), 1U);
+    EXPECT_TRUE(std::filesystem::exists(file));
+}
+
+TEST(SettingsWriter, SkipsUnchangedContent)
+{
+    const TempDir            tmp;
+    settings::SettingsWriter writer{tmp.path() / "settings.json", 1h};
+
+    writer.schedule(nlohmann::json{{"value", 1}});
+    writer.flush();
+    writer.schedule(nlohmann::json{{"value", 1}});
+    writer.flush();
+
+    EXPECT_EQ(writer.getWriteCount(), 1U);
+
+    writer.schedule(nlohmann::json{{"value", 2}});
+    writer.flush();
+
+    EXPECT_EQ(writer.getWriteCount(), 2U);
+}
+
+TEST(SettingsWriter, SeededContentIsNotWrittenAgain)
+{
+    const TempDir            tmp;
+    const auto               file = tmp.path() / "settings.json";
+    const nlohmann::json     snapshot{{"value", 1}};
+    settings::SettingsWriter writer{file, 1h};
+
+    writer.seed(snapshot.dump(4));
+    writer.schedule(snapshot);
+    writer.flush();
+
+    EXPECT_EQ(writer.getWriteCount(), 0U);
+    EXPECT_FALSE(std::filesystem::exists(file));
+}
+
+TEST(SettingsWriter, DestructionWritesPendingSnapshot)
+{
+    const TempDir tmp;
+    const auto    file = tmp.path() / "settings.json";
+
+    {
+        settings::SettingsWriter writer{file, 1h};
+        writer.schedule(nlohmann::json{{"value", 1}});
+    }
+
+    EXPECT_EQ(readFile(file), nlohmann::json({{"value", 1}}).dump(4));
+}
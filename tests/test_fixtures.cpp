@@ -1,8 +1,12 @@
 #include "test_fixtures.hpp"
 
+#include <cstdint>
 #include <filesystem>
+#include <fstream>
 #include <iostream>
+#include <iterator>
 #include <random>
+#include <string>
 
 namespace tests
 {
@@ -58,4 +62,51 @@ namespace tests
                 "_" + std::to_string(random2) + ".sqlite");
     }
 
-}   // namespace tests
\ No newline at end of file
+    /**
+     * @brief Construct a new TempDir object and create the directory.
+     *
+     */
+    TempDir::TempDir()
+    {
+        std::random_device                           random;
+        std::mt19937_64                              gen(random());
+        std::uniform_int_distribution<std::uint64_t> dis;
+
+        _path = std::filesystem::temp_directory_path() /
+                ("molartracker_test_" + std::to_string(dis(gen)));
+
+        std::filesystem::create_directories(_path);
+    }
+
+    TempDir::~TempDir()
+    {
+        std::error_code errorCode;
+        std::filesystem::remove_all(_path, errorCode);
+    }
+
+    /**
+     * @brief Get the path to the temporary directory.
+     *
+     * @return const std::filesystem::path&
+     */
+    const std::filesystem::path& TempDir::path() const noexcept
+    {
+        return _path;
+    }
+
+    /**
+     * @brief Read a whole file, a missing file reads as empty.
+     *
+     * @param path
+     * @return std::string
+     */
+    std::string readFile(const std::filesystem::path& path)
+    {
+        std::ifstream file{path, std::ios::binary};
+        return {
+            std::istreambuf_iterator<char>{file},
+            std::istreambuf_iterator<char>{}
+        };
+    }
+
+}   // namespace tests
@@ -2,6 +2,7 @@
 #define __TESTS__TEST_FIXTURES_HPP__
 
 #include <filesystem>
+#include <string>
 
 namespace tests
 {
@@ -28,5 +29,30 @@ namespace tests
         static std::filesystem::path _unique_db_path();
     };
 
+    /**
+     * @brief A uniquely named directory below the system temp directory,
+     * removed with its contents on destruction
+     *
+     */
+    class TempDir
+    {
+       private:
+        std::filesystem::path _path;
+
+       public:
+        TempDir();
+
+        TempDir(const TempDir&)            = delete;
+        TempDir& operator=(const TempDir&) = delete;
+        TempDir(TempDir&&)                 = delete;
+        TempDir& operator=(TempDir&&)      = delete;
+
+        ~TempDir();
+
+        [[nodiscard]] const std::filesystem::path& path() const noexcept;
+    };
+
+    [[nodiscard]] std::string readFile(const std::filesystem::path& path);
+
 }   // namespace tests
 #endif   // __TESTS__TEST_FIXTURES_HPP__
@@ -0,0 +1,69 @@
+#ifndef __TESTS__TEST_VALUES_HPP__
+#define __TESTS__TEST_VALUES_HPP__
+
+#include <cstdint>
+
+#include "common/cash.hpp"
+#include "common/finance.hpp"
+#include "common/quantity.hpp"
+#include "finance/fx_rate_cache.hpp"
+
+namespace tests
+{
+    /// Cash amounts are stored in micro units
+    inline constexpr std::int64_t CASH_UNIT = 1'000'000;
+
+    /**
+     * @brief Cash of whole units of a currency
+     *
+     * @param currency
+     * @param units
+     * @return Cash
+     */
+    [[nodiscard]] inline Cash cash(Currency currency, std::int64_t units)
+    {
+        return Cash{currency, units * CASH_UNIT};
+    }
+
+    /**
+     * @brief Cash of whole US dollars
+     *
+     * @param units
+     * @return Cash
+     */
+    [[nodiscard]] inline Cash usd(std::int64_t units)
+    {
+        return cash(Currency::USD, units);
+    }
+
+    /**
+     * @brief A quantity of whole shares or contracts
+     *
+     * @param units
+     * @return Quantity
+     */
+    [[nodiscard]] inline Quantity quantity(std::int64_t units)
+    {
+        return Quantity{units * Quantity::factor};
+    }
+
+    /**
+     * @brief An exchange rate fetched now
+     *
+     * @param from
+     * @param to
+     * @param value Units of to per unit of from
+     * @return finance::FxRate
+     */
+    [[nodiscard]] inline finance::FxRate fxRate(
+        Currency from,
+        Currency to,
+        double   value
+    )
+    {
+        return finance::FxRate{from, to, value, finance::FxRate::Clock::now()};
+    }
+
+}   // namespace tests
+
+#endif   // __TESTS__TEST_VALUES_HPP__
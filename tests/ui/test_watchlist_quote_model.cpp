@@ -0,0 +1,136 @@
+#include <gtest/gtest.h>
+
+#include <QVariant>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "common/cash.hpp"
+#include "common/finance.hpp"
+#include "ui/watchlist/watchlist_quote_model.hpp"
+
+namespace
+{
+    ui::WatchlistQuote makeQuote(micro_units last, micro_units previousClose)
+    {
+        return ui::WatchlistQuote{
+            Cash{Currency::USD, last},
+            Cash{Currency::USD, previousClose}
+        };
+    }
+
+    // -------------------------------------------------------------------------
+
+    class WatchlistQuoteModelTest : public ::testing::Test
+    {
+       protected:
+        ui::WatchlistQuoteModel model;
+        int                     dataChangedCount = 0;
+        int                     firstChangedRow  = -1;
+        int                     lastChangedRow   = -1;
+
+        void SetUp() override
+        {
+            model.setSymbols({"AAPL", "MSFT", "NVDA"});
+
+            QObject::connect(
+                &model,
+                &QAbstractItemModel::dataChanged,
+                [this](const QModelIndex& topLeft, const QModelIndex& bottomRight)
+                {
+                    ++dataChangedCount;
+                    firstChangedRow = topLeft.row();
+                    lastChangedRow  = bottomRight.row();
+                }
+            );
+        }
+
+        [[nodiscard]] QString display(int row, int column) const
+        {
+            return model.data(model.index(row, column), Qt::DisplayRole)
+                .toString();
+        }
+    };
+
+    TEST_F(WatchlistQuoteModelTest, RowPerDistinctSymbol)
+    {
+        model.setSymbols({"AAPL", "MSFT", "AAPL"});
+        EXPECT_EQ(model.rowCount({}), 2);
+        EXPECT_EQ(model.columnCount({}), 4);
+        EXPECT_EQ(display(1, 0), "MSFT");
+    }
+
+    TEST_F(WatchlistQuoteModelTest, RowWithoutQuoteShowsPlaceholder)
+    {
+        EXPECT_EQ(display(0, 0), "AAPL");
+        EXPECT_EQ(display(0, 1), "-");
+        EXPECT_FALSE(model.quoteAt(0).has_value());
+    }
+
+    TEST_F(WatchlistQuoteModelTest, QueuedQuotesAreAppliedOnFlush)
+    {
+        model.queueQuotes({{"MSFT", makeQuote(110, 100)}});
+
+        EXPECT_TRUE(model.hasPendingQuotes());
+        EXPECT_FALSE(model.quoteAt(1).has_value());
+
+        model.flush();
+
+        EXPECT_FALSE(model.hasPendingQuotes());
+        ASSERT_TRUE(model.quoteAt(1).has_value());
+        EXPECT_EQ(model.quoteAt(1).value(), makeQuote(110, 100));
+        EXPECT_EQ(display(1, 3), "+10.00%");
+    }
+
+    TEST_F(WatchlistQuoteModelTest, NegativeChangeHasSingleSign)
+    {
+        model.queueQuotes({{"AAPL", makeQuote(90, 100)}});
+        model.flush();
+
+        EXPECT_EQ(display(0, 3), "-10.00%");
+    }
+
+    TEST_F(WatchlistQuoteModelTest, BatchesAreCoalescedIntoOneSignal)
+    {
+        model.queueQuotes({{"AAPL", makeQuote(101, 100)}});
+        model.queueQuotes({{"NVDA", makeQuote(50, 40)}});
+        model.queueQuotes({{"AAPL", makeQuote(102, 100)}});
+        model.flush();
+
+        EXPECT_EQ(dataChangedCount, 1);
+        EXPECT_EQ(firstChangedRow, 0);
+        EXPECT_EQ(lastChangedRow, 2);
+        EXPECT_EQ(model.quoteAt(0).value(), makeQuote(102, 100));
+    }
+
+    TEST_F(WatchlistQuoteModelTest, UnchangedQuotesEmitNothing)
+    {
+        model.queueQuotes({{"AAPL", makeQuote(101, 100)}});
+        model.flush();
+        dataChangedCount = 0;
+
+        model.queueQuotes({{"AAPL", makeQuote(101, 100)}});
+        model.flush();
+
+        EXPECT_EQ(dataChangedCount, 0);
+    }
+
+    TEST_F(WatchlistQuoteModelTest, UnknownSymbolsAreIgnored)
+    {
+        model.queueQuotes({{"TSLA", makeQuote(200, 100)}});
+
+        EXPECT_FALSE(model.hasPendingQuotes());
+        model.flush();
+        EXPECT_EQ(dataChangedCount, 0);
+    }
+
+    TEST_F(WatchlistQuoteModelTest, SetSymbolsDropsPendingQuotesOfOldRows)
+    {
+        model.queueQuotes({{"AAPL", makeQuote(101, 100)}});
+        model.setSymbols({"MSFT"});
+        model.flush();
+
+        EXPECT_EQ(dataChangedCount, 0);
+        EXPECT_FALSE(model.quoteAt(0).has_value());
+    }
+}   // namespace